@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Benchmarks the flower's state endpoints: requests per second, latency and
+the heap high-water mark reported by the flower itself.
+
+    python3 benchmark_api.py 192.168.4.1
+    python3 benchmark_api.py 192.168.4.1 --duration 30 --clients 4 --path /configuration
+
+Every path is requested by --clients parallel clients for --duration seconds.
+The heap numbers come from /api/v1/state ("system"): `min_free_heap` is the
+lowest free heap since boot, so how far it drops during a run is the heap
+high-water mark caused by the load. A dip that stays above the earlier
+minimum (e.g. from boot or a previous path) does not move it and shows as 0.
+"""
+
+import argparse
+import json
+import threading
+import time
+import urllib.request
+
+DEFAULT_PATHS = ["/api/v1/state", "/configuration", "/sensorData"]
+
+
+def fetch(host, path, timeout=5):
+    with urllib.request.urlopen("http://%s%s" % (host, path), timeout=timeout) as response:
+        return response.read()
+
+
+def read_heap(host):
+    system = json.loads(fetch(host, "/api/v1/state"))["system"]
+    return system["free_heap"], system["min_free_heap"]
+
+
+def run(host, path, duration, clients):
+    latencies = []
+    errors = [0]
+    lock = threading.Lock()
+    ends_at = time.monotonic() + duration
+
+    def client():
+        while time.monotonic() < ends_at:
+            started_at = time.monotonic()
+            try:
+                fetch(host, path)
+            except OSError:
+                with lock:
+                    errors[0] += 1
+                continue
+            with lock:
+                latencies.append(time.monotonic() - started_at)
+
+    threads = [threading.Thread(target=client) for _ in range(clients)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    latencies.sort()
+    return latencies, errors[0]
+
+
+def percentile(values, fraction):
+    if not values:
+        return float("nan")
+    return values[min(len(values) - 1, int(len(values) * fraction))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host")
+    parser.add_argument("--duration", type=float, default=10, help="seconds per path")
+    parser.add_argument("--clients", type=int, default=2, help="parallel clients")
+    parser.add_argument("--path", action="append", help="path to benchmark (repeatable)")
+    arguments = parser.parse_args()
+
+    print("%-16s %8s %8s %8s %7s %10s %10s" % ("path", "req/s", "p50 ms", "p95 ms", "errors", "free heap", "heap hwm"))
+    for path in arguments.path or DEFAULT_PATHS:
+        free_before, min_before = read_heap(arguments.host)
+        latencies, errors = run(arguments.host, path, arguments.duration, arguments.clients)
+        free_after, min_after = read_heap(arguments.host)
+        print("%-16s %8.1f %8.1f %8.1f %7d %10d %10d" % (
+            path, len(latencies) / arguments.duration,
+            percentile(latencies, 0.5) * 1000, percentile(latencies, 0.95) * 1000,
+            errors, free_after, max(0, min_before - min_after)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,136 @@
+Import("env")
+
+# Builds the filesystem image from a compressed copy of `data`: every asset
+# is stored gzipped under its own name (SPIFFS names are limited to 31
+# characters, no room for a ".gz" suffix) and listed in `assets.txt` with a
+# content hash, which the web server sends as ETag. References in index.html
+# get the hash as version (`?v=`), so those URLs can be cached as immutable.
+#
+# With EMBED_WEB_ASSETS in the build flags, the compressed assets are also
+# written to a generated header (WebAssets.h) and linked into the firmware.
+
+import gzip
+import hashlib
+import os
+import re
+import shutil
+
+MANIFEST_NAME = "assets.txt"
+MAX_NAME_LENGTH = 31
+ETAG_LENGTH = 16
+HEADER_NAME = "WebAssets.h"
+BYTES_PER_LINE = 16
+
+source_dir = env.subst("$PROJECT_DATA_DIR")
+target_dir = os.path.join(env.subst("$BUILD_DIR"), "data")
+header_dir = os.path.join(env.subst("$BUILD_DIR"), "web_assets")
+is_embedding = re.search(r"EMBED_WEB_ASSETS(?!=(0|false))", str(env.GetProjectOption("build_flags", ""))) is not None
+
+
+def read_assets():
+    assets = {}
+    for root, _, files in os.walk(source_dir):
+        for name in sorted(files):
+            path = os.path.join(root, name)
+            url = "/" + os.path.relpath(path, source_dir).replace(os.sep, "/")
+            with open(path, "rb") as file:
+                assets[url] = file.read()
+    return assets
+
+
+def etag(content):
+    return hashlib.sha256(content).hexdigest()[:ETAG_LENGTH]
+
+
+def version_references(html, assets):
+    def replace(match):
+        url = "/" + match.group(2).lstrip("./")
+        if url not in assets:
+            return match.group(0)
+        return '%s="%s?v=%s"' % (match.group(1), match.group(2), etag(assets[url]))
+
+    return re.sub(r'(src|href)="([^"?#:]+)"', replace, html)
+
+
+def compress_assets():
+    assets = read_assets()
+    if "/index.html" in assets:
+        html = assets["/index.html"].decode("utf-8")
+        assets["/index.html"] = version_references(html, assets).encode("utf-8")
+
+    compressed_assets = []
+    for url, content in sorted(assets.items()):
+        if len(url) > MAX_NAME_LENGTH:
+            raise ValueError("Asset name too long for SPIFFS: " + url)
+        compressed = gzip.compress(content, 9, mtime=0)
+        is_gzipped = len(compressed) < len(content)
+        stored = compressed if is_gzipped else content
+        compressed_assets.append((url, etag(content), is_gzipped, stored))
+
+    raw_size = sum(len(content) for content in assets.values())
+    stored_size = sum(len(asset[3]) for asset in compressed_assets)
+    print("Compressed web assets: %d -> %d bytes (%d files)" % (raw_size, stored_size, len(compressed_assets)))
+    return compressed_assets
+
+
+def write_image(assets):
+    shutil.rmtree(target_dir, ignore_errors=True)
+    manifest = []
+    for url, asset_etag, is_gzipped, stored in assets:
+        path = os.path.join(target_dir, url[1:])
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "wb") as file:
+            file.write(stored)
+        manifest.append("%s %s %d" % (url, asset_etag, 1 if is_gzipped else 0))
+
+    with open(os.path.join(target_dir, MANIFEST_NAME), "w") as file:
+        file.write("\n".join(manifest) + "\n")
+
+
+def write_header(assets):
+    lines = [
+        "// Generated by compress_fs.py from data/, do not edit",
+        "",
+        "#ifndef WEBASSETS_H_",
+        "#define WEBASSETS_H_",
+        "",
+        "#include <Arduino.h>",
+        '#include "StaticAssetHandler.h"',
+        "",
+    ]
+    for index, (url, _, _, stored) in enumerate(assets):
+        lines.append("// %s" % url)
+        lines.append("const uint8_t WEB_ASSET_%d[] PROGMEM = {" % index)
+        for offset in range(0, len(stored), BYTES_PER_LINE):
+            chunk = stored[offset:offset + BYTES_PER_LINE]
+            lines.append("  " + ", ".join("0x%02x" % byte for byte in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+
+    lines.append("const StaticAsset WEB_ASSETS[] = {")
+    for index, (url, asset_etag, is_gzipped, stored) in enumerate(assets):
+        lines.append('  { "%s", "\\"%s\\"", %s, WEB_ASSET_%d, %d },'
+                     % (url, asset_etag, "true" if is_gzipped else "false", index, len(stored)))
+    lines.append("};")
+    lines.append("const uint8_t WEB_ASSET_COUNT = %d;" % len(assets))
+    lines.append("")
+    lines.append("#endif")
+
+    os.makedirs(header_dir, exist_ok=True)
+    path = os.path.join(header_dir, HEADER_NAME)
+    content = "\n".join(lines) + "\n"
+    # Keep the header untouched if nothing changed, it is included by the web server
+    if os.path.exists(path):
+        with open(path) as file:
+            if file.read() == content:
+                return
+    with open(path, "w") as file:
+        file.write(content)
+
+
+assets = compress_assets()
+write_image(assets)
+env.Replace(PROJECT_DATA_DIR=target_dir)
+if is_embedding:
+    write_header(assets)
+    env.Append(CPPPATH=[header_dir])
@@ -34,15 +34,8 @@ function sendGlobalConfiguration() {
         [key_led_brightness]: brightness,
         [key_adaptive_brightness]: adaptive,
         [key_color]: color
-    }, function(response) {
-        // Response handled by readResponse in main script
-        var data = {};
-        String(response).split("&").forEach(function(item) {
-            var parts = String(item).split("=");
-            data[parts[0]] = parts[1];
-        });
-        updateGlobalUI(data);
     });
+    // The new state arrives through /events (readResponse)
 }
 
 function updateGlobalUI(data) {
@@ -176,14 +169,6 @@ $(document).ready(function() {
         if (weather) {
             $.post("/configuration", {
                 [key_weather_debug]: weather
-            }, function(response) {
-                // Update UI from response
-                var data = {};
-                String(response).split("&").forEach(function(item) {
-                    var parts = String(item).split("=");
-                    data[parts[0]] = parts[1];
-                });
-                updateGlobalUI(data);
             });
         }
     });
@@ -1 +1 @@
-!function(t,e){"use strict";"object"==typeof module&&"object"==typeof module.exports?module.exports=t.document?e(t,!0):function(t){if(!t.document)throw new Error("jQuery requires a window with a document");return e(t)}:e(t)}("undefined"!=typeof window?window:this,function(t,e){"use strict";var i=[],n=t.document,o=Object.getPrototypeOf,s=i.slice,r=i.concat,a=i.push,l=i.indexOf,u={},h=u.toString,c=u.hasOwnProperty,d=c.toString,p=d.call(Object),f={};function m(t,e){var i=(e=e||n).createElement("script");i.text=t,e.head.appendChild(i).parentNode.removeChild(i)}var g="3.2.1",v=function(t,e){return new v.fn.init(t,e)},y=/^[\s\uFEFF\xA0]+|[\s\uFEFF\xA0]+$/g,_=/^-ms-/,b=/-([a-z])/g,x=function(t,e){return e.toUpperCase()};function w(t){var e=!!t&&"length"in t&&t.length,i=v.type(t);return"function"!==i&&!v.isWindow(t)&&("array"===i||0===e||"number"==typeof e&&e>0&&e-1 in t)}v.fn=v.prototype={jquery:g,constructor:v,length:0,toArray:function(){return s.call(this)},get:function(t){return null==t?s.call(this):t<0?this[t+this.length]:this[t]},pushStack:function(t){var e=v.merge(this.constructor(),t);return e.prevObject=this,e},each:function(t){return v.each(this,t)},map:function(t){return this.pushStack(v.map(this,function(e,i){return t.call(e,i,e)}))},slice:function(){return this.pushStack(s.apply(this,arguments))},first:function(){return this.eq(0)},last:function(){return this.eq(-1)},eq:function(t){var e=this.length,i=+t+(t<0?e:0);return this.pushStack(i>=0&&i<e?[this[i]]:[])},end:function(){return this.prevObject||this.constructor()},push:a,sort:i.sort,splice:i.splice},v.extend=v.fn.extend=function(){var t,e,i,n,o,s,r=arguments[0]||{},a=1,l=arguments.length,u=!1;for("boolean"==typeof r&&(u=r,r=arguments[a]||{},a++),"object"==typeof r||v.isFunction(r)||(r={}),a===l&&(r=this,a--);a<l;a++)if(null!=(t=arguments[a]))for(e in t)i=r[e],r!==(n=t[e])&&(u&&n&&(v.isPlainObject(n)||(o=Array.isArray(n)))?(o?(o=!1,s=i&&Array.isArray(i)?i:[]):s=i&&v.isPlainObject(i)?i:{},r[e]=v.extend(u,s,n)):void 0!==n&&(r[e]=n));return r},v.extend({expando:"jQuery"+(g+Math.random()).replace(/\D/g,""),isReady:!0,error:function(t){throw new Error(t)},noop:function(){},isFunction:function(t){return"function"===v.type(t)},isWindow:function(t){return null!=t&&t===t.window},isNumeric:function(t){var e=v.type(t);return("number"===e||"string"===e)&&!isNaN(t-parseFloat(t))},isPlainObject:function(t){var e,i;return!(!t||"[object Object]"!==h.call(t)||(e=o(t))&&(i=c.call(e,"constructor")&&e.constructor,"function"!=typeof i||d.call(i)!==p))},isEmptyObject:function(t){var e;for(e in t)return!1;return!0},type:function(t){return null==t?t+"":"object"==typeof t||"function"==typeof t?u[h.call(t)]||"object":typeof t},globalEval:function(t){m(t)},camelCase:function(t){return t.replace(_,"ms-").replace(b,x)},each:function(t,e){var i,n=0;if(w(t))for(i=t.length;n<i&&!1!==e.call(t[n],n,t[n]);n++);else for(n in t)if(!1===e.call(t[n],n,t[n]))break;return t},trim:function(t){return null==t?"":(t+"").replace(y,"")},makeArray:function(t,e){var i=e||[];return null!=t&&(w(Object(t))?v.merge(i,"string"==typeof t?[t]:t):a.call(i,t)),i},inArray:function(t,e,i){return null==e?-1:l.call(e,t,i)},merge:function(t,e){for(var i=+e.length,n=0,o=t.length;n<i;n++)t[o++]=e[n];return t.length=o,t},grep:function(t,e,i){for(var n=[],o=0,s=t.length,r=!i;o<s;o++)!e(t[o],o)!==r&&n.push(t[o]);return n},map:function(t,e,i){var n,o,s=0,a=[];if(w(t))for(n=t.length;s<n;s++)null!=(o=e(t[s],s,i))&&a.push(o);else for(s in t)null!=(o=e(t[s],s,i))&&a.push(o);return r.apply([],a)},guid:1,proxy:function(t,e){var i,n,o;if("string"==typeof e&&(i=t[e],e=t,t=i),v.isFunction(t))return n=s.call(arguments,2),(o=function(){return t.apply(e||this,n.concat(s.call(arguments)))}).guid=t.guid=t.guid||v.guid++,o},now:Date.now,support:f}),"function"==typeof Symbol&&(v.fn[Symbol.iterator]=i[Symbol.iterator]),v.each("Boolean Number String Function Array Date RegExp Object Error Symbol".split(" "),function(t,e){u["[object "+e+"]"]=e.toLowerCase()});var k=function(t){var e,i,n,o,s,r,a,l,u,h,c,d,p,f,m,g,v,y,_,b="sizzle"+1*new Date,x=t.document,w=0,k=0,C=rt(),T=rt(),E=rt(),S=function(t,e){return t===e&&(c=!0),0},N={}.hasOwnProperty,A=[],L=A.pop,D=A.push,j=A.push,P=A.slice,H=function(t,e){for(var i=0,n=t.length;i<n;i++)if(t[i]===e)return i;return-1},$="checked|selected|async|autofocus|autoplay|controls|defer|disabled|hidden|ismap|loop|multiple|open|readonly|required|scoped",M="[\\x20\\t\\r\\n\\f]",q="(?:\\\\.|[\\w-]|[^\0-\\xa0])+",O="\\["+M+"*("+q+")(?:"+M+"*([*^$|!~]?=)"+M+"*(?:'((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\"|("+q+"))|)"+M+"*\\]",F=":("+q+")(?:\\((('((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\")|((?:\\\\.|[^\\\\()[\\]]|"+O+")*)|.*)\\)|)",I=new RegExp(M+"+","g"),R=new RegExp("^"+M+"+|((?:^|[^\\\\])(?:\\\\.)*)"+M+"+$","g"),z=new RegExp("^"+M+"*,"+M+"*"),B=new RegExp("^"+M+"*([>+~]|"+M+")"+M+"*"),W=new RegExp("="+M+"*([^\\]'\"]*?)"+M+"*\\]","g"),V=new RegExp(F),U=new RegExp("^"+q+"$"),X={ID:new RegExp("^#("+q+")"),CLASS:new RegExp("^\\.("+q+")"),TAG:new RegExp("^("+q+"|[*])"),ATTR:new RegExp("^"+O),PSEUDO:new RegExp("^"+F),CHILD:new RegExp("^:(only|first|last|nth|nth-last)-(child|of-type)(?:\\("+M+"*(even|odd|(([+-]|)(\\d*)n|)"+M+"*(?:([+-]|)"+M+"*(\\d+)|))"+M+"*\\)|)","i"),bool:new RegExp("^(?:"+$+")$","i"),needsContext:new RegExp("^"+M+"*[>+~]|:(even|odd|eq|gt|lt|nth|first|last)(?:\\("+M+"*((?:-\\d)?\\d*)"+M+"*\\)|)(?=[^-]|$)","i")},Q=/^(?:input|select|textarea|button)$/i,Y=/^h\d$/i,G=/^[^{]+\{\s*\[native \w/,J=/^(?:#([\w-]+)|(\w+)|\.([\w-]+))$/,K=/[+~]/,Z=new RegExp("\\\\([\\da-f]{1,6}"+M+"?|("+M+")|.)","ig"),tt=function(t,e,i){var n="0x"+e-65536;return n!=n||i?e:n<0?String.fromCharCode(n+65536):String.fromCharCode(n>>10|55296,1023&n|56320)},et=/([\0-\x1f\x7f]|^-?\d)|^-$|[^\0-\x1f\x7f-\uFFFF\w-]/g,it=function(t,e){return e?"\0"===t?"�":t.slice(0,-1)+"\\"+t.charCodeAt(t.length-1).toString(16)+" ":"\\"+t},nt=function(){d()},ot=yt(function(t){return!0===t.disabled&&("form"in t||"label"in t)},{dir:"parentNode",next:"legend"});try{j.apply(A=P.call(x.childNodes),x.childNodes),A[x.childNodes.length].nodeType}catch(t){j={apply:A.length?function(t,e){D.apply(t,P.call(e))}:function(t,e){for(var i=t.length,n=0;t[i++]=e[n++];);t.length=i-1}}}function st(t,e,n,o){var s,a,u,h,c,f,v,y=e&&e.ownerDocument,w=e?e.nodeType:9;if(n=n||[],"string"!=typeof t||!t||1!==w&&9!==w&&11!==w)return n;if(!o&&((e?e.ownerDocument||e:x)!==p&&d(e),e=e||p,m)){if(11!==w&&(c=J.exec(t)))if(s=c[1]){if(9===w){if(!(u=e.getElementById(s)))return n;if(u.id===s)return n.push(u),n}else if(y&&(u=y.getElementById(s))&&_(e,u)&&u.id===s)return n.push(u),n}else{if(c[2])return j.apply(n,e.getElementsByTagName(t)),n;if((s=c[3])&&i.getElementsByClassName&&e.getElementsByClassName)return j.apply(n,e.getElementsByClassName(s)),n}if(i.qsa&&!E[t+" "]&&(!g||!g.test(t))){if(1!==w)y=e,v=t;else if("object"!==e.nodeName.toLowerCase()){for((h=e.getAttribute("id"))?h=h.replace(et,it):e.setAttribute("id",h=b),a=(f=r(t)).length;a--;)f[a]="#"+h+" "+vt(f[a]);v=f.join(","),y=K.test(t)&&mt(e.parentNode)||e}if(v)try{return j.apply(n,y.querySelectorAll(v)),n}catch(t){}finally{h===b&&e.removeAttribute("id")}}}return l(t.replace(R,"$1"),e,n,o)}function rt(){var t=[];return function e(i,o){return t.push(i+" ")>n.cacheLength&&delete e[t.shift()],e[i+" "]=o}}function at(t){return t[b]=!0,t}function lt(t){var e=p.createElement("fieldset");try{return!!t(e)}catch(t){return!1}finally{e.parentNode&&e.parentNode.removeChild(e),e=null}}function ut(t,e){for(var i=t.split("|"),o=i.length;o--;)n.attrHandle[i[o]]=e}function ht(t,e){var i=e&&t,n=i&&1===t.nodeType&&1===e.nodeType&&t.sourceIndex-e.sourceIndex;if(n)return n;if(i)for(;i=i.nextSibling;)if(i===e)return-1;return t?1:-1}function ct(t){return function(e){return"input"===e.nodeName.toLowerCase()&&e.type===t}}function dt(t){return function(e){var i=e.nodeName.toLowerCase();return("input"===i||"button"===i)&&e.type===t}}function pt(t){return function(e){return"form"in e?e.parentNode&&!1===e.disabled?"label"in e?"label"in e.parentNode?e.parentNode.disabled===t:e.disabled===t:e.isDisabled===t||e.isDisabled!==!t&&ot(e)===t:e.disabled===t:"label"in e&&e.disabled===t}}function ft(t){return at(function(e){return e=+e,at(function(i,n){for(var o,s=t([],i.length,e),r=s.length;r--;)i[o=s[r]]&&(i[o]=!(n[o]=i[o]))})})}function mt(t){return t&&void 0!==t.getElementsByTagName&&t}for(e in i=st.support={},s=st.isXML=function(t){var e=t&&(t.ownerDocument||t).documentElement;return!!e&&"HTML"!==e.nodeName},d=st.setDocument=function(t){var e,o,r=t?t.ownerDocument||t:x;return r!==p&&9===r.nodeType&&r.documentElement?(f=(p=r).documentElement,m=!s(p),x!==p&&(o=p.defaultView)&&o.top!==o&&(o.addEventListener?o.addEventListener("unload",nt,!1):o.attachEvent&&o.attachEvent("onunload",nt)),i.attributes=lt(function(t){return t.className="i",!t.getAttribute("className")}),i.getElementsByTagName=lt(function(t){return t.appendChild(p.createComment("")),!t.getElementsByTagName("*").length}),i.getElementsByClassName=G.test(p.getElementsByClassName),i.getById=lt(function(t){return f.appendChild(t).id=b,!p.getElementsByName||!p.getElementsByName(b).length}),i.getById?(n.filter.ID=function(t){var e=t.replace(Z,tt);return function(t){return t.getAttribute("id")===e}},n.find.ID=function(t,e){if(void 0!==e.getElementById&&m){var i=e.getElementById(t);return i?[i]:[]}}):(n.filter.ID=function(t){var e=t.replace(Z,tt);return function(t){var i=void 0!==t.getAttributeNode&&t.getAttributeNode("id");return i&&i.value===e}},n.find.ID=function(t,e){if(void 0!==e.getElementById&&m){var i,n,o,s=e.getElementById(t);if(s){if((i=s.getAttributeNode("id"))&&i.value===t)return[s];for(o=e.getElementsByName(t),n=0;s=o[n++];)if((i=s.getAttributeNode("id"))&&i.value===t)return[s]}return[]}}),n.find.TAG=i.getElementsByTagName?function(t,e){return void 0!==e.getElementsByTagName?e.getElementsByTagName(t):i.qsa?e.querySelectorAll(t):void 0}:function(t,e){var i,n=[],o=0,s=e.getElementsByTagName(t);if("*"===t){for(;i=s[o++];)1===i.nodeType&&n.push(i);return n}return s},n.find.CLASS=i.getElementsByClassName&&function(t,e){if(void 0!==e.getElementsByClassName&&m)return e.getElementsByClassName(t)},v=[],g=[],(i.qsa=G.test(p.querySelectorAll))&&(lt(function(t){f.appendChild(t).innerHTML="<a id='"+b+"'></a><select id='"+b+"-\r\\' msallowcapture=''><option selected=''></option></select>",t.querySelectorAll("[msallowcapture^='']").length&&g.push("[*^$]="+M+"*(?:''|\"\")"),t.querySelectorAll("[selected]").length||g.push("\\["+M+"*(?:value|"+$+")"),t.querySelectorAll("[id~="+b+"-]").length||g.push("~="),t.querySelectorAll(":checked").length||g.push(":checked"),t.querySelectorAll("a#"+b+"+*").length||g.push(".#.+[+~]")}),lt(function(t){t.innerHTML="<a href='' disabled='disabled'></a><select disabled='disabled'><option/></select>";var e=p.createElement("input");e.setAttribute("type","hidden"),t.appendChild(e).setAttribute("name","D"),t.querySelectorAll("[name=d]").length&&g.push("name"+M+"*[*^$|!~]?="),2!==t.querySelectorAll(":enabled").length&&g.push(":enabled",":disabled"),f.appendChild(t).disabled=!0,2!==t.querySelectorAll(":disabled").length&&g.push(":enabled",":disabled"),t.querySelectorAll("*,:x"),g.push(",.*:")})),(i.matchesSelector=G.test(y=f.matches||f.webkitMatchesSelector||f.mozMatchesSelector||f.oMatchesSelector||f.msMatchesSelector))&&lt(function(t){i.disconnectedMatch=y.call(t,"*"),y.call(t,"[s!='']:x"),v.push("!=",F)}),g=g.length&&new RegExp(g.join("|")),v=v.length&&new RegExp(v.join("|")),e=G.test(f.compareDocumentPosition),_=e||G.test(f.contains)?function(t,e){var i=9===t.nodeType?t.documentElement:t,n=e&&e.parentNode;return t===n||!(!n||1!==n.nodeType||!(i.contains?i.contains(n):t.compareDocumentPosition&&16&t.compareDocumentPosition(n)))}:function(t,e){if(e)for(;e=e.parentNode;)if(e===t)return!0;return!1},S=e?function(t,e){if(t===e)return c=!0,0;var n=!t.compareDocumentPosition-!e.compareDocumentPosition;return n||(1&(n=(t.ownerDocument||t)===(e.ownerDocument||e)?t.compareDocumentPosition(e):1)||!i.sortDetached&&e.compareDocumentPosition(t)===n?t===p||t.ownerDocument===x&&_(x,t)?-1:e===p||e.ownerDocument===x&&_(x,e)?1:h?H(h,t)-H(h,e):0:4&n?-1:1)}:function(t,e){if(t===e)return c=!0,0;var i,n=0,o=t.parentNode,s=e.parentNode,r=[t],a=[e];if(!o||!s)return t===p?-1:e===p?1:o?-1:s?1:h?H(h,t)-H(h,e):0;if(o===s)return ht(t,e);for(i=t;i=i.parentNode;)r.unshift(i);for(i=e;i=i.parentNode;)a.unshift(i);for(;r[n]===a[n];)n++;return n?ht(r[n],a[n]):r[n]===x?-1:a[n]===x?1:0},p):p},st.matches=function(t,e){return st(t,null,null,e)},st.matchesSelector=function(t,e){if((t.ownerDocument||t)!==p&&d(t),e=e.replace(W,"='$1']"),i.matchesSelector&&m&&!E[e+" "]&&(!v||!v.test(e))&&(!g||!g.test(e)))try{var n=y.call(t,e);if(n||i.disconnectedMatch||t.document&&11!==t.document.nodeType)return n}catch(t){}return st(e,p,null,[t]).length>0},st.contains=function(t,e){return(t.ownerDocument||t)!==p&&d(t),_(t,e)},st.attr=function(t,e){(t.ownerDocument||t)!==p&&d(t);var o=n.attrHandle[e.toLowerCase()],s=o&&N.call(n.attrHandle,e.toLowerCase())?o(t,e,!m):void 0;return void 0!==s?s:i.attributes||!m?t.getAttribute(e):(s=t.getAttributeNode(e))&&s.specified?s.value:null},st.escape=function(t){return(t+"").replace(et,it)},st.error=function(t){throw new Error("Syntax error, unrecognized expression: "+t)},st.uniqueSort=function(t){var e,n=[],o=0,s=0;if(c=!i.detectDuplicates,h=!i.sortStable&&t.slice(0),t.sort(S),c){for(;e=t[s++];)e===t[s]&&(o=n.push(s));for(;o--;)t.splice(n[o],1)}return h=null,t},o=st.getText=function(t){var e,i="",n=0,s=t.nodeType;if(s){if(1===s||9===s||11===s){if("string"==typeof t.textContent)return t.textContent;for(t=t.firstChild;t;t=t.nextSibling)i+=o(t)}else if(3===s||4===s)return t.nodeValue}else for(;e=t[n++];)i+=o(e);return i},(n=st.selectors={cacheLength:50,createPseudo:at,match:X,attrHandle:{},find:{},relative:{">":{dir:"parentNode",first:!0}," ":{dir:"parentNode"},"+":{dir:"previousSibling",first:!0},"~":{dir:"previousSibling"}},preFilter:{ATTR:function(t){return t[1]=t[1].replace(Z,tt),t[3]=(t[3]||t[4]||t[5]||"").replace(Z,tt),"~="===t[2]&&(t[3]=" "+t[3]+" "),t.slice(0,4)},CHILD:function(t){return t[1]=t[1].toLowerCase(),"nth"===t[1].slice(0,3)?(t[3]||st.error(t[0]),t[4]=+(t[4]?t[5]+(t[6]||1):2*("even"===t[3]||"odd"===t[3])),t[5]=+(t[7]+t[8]||"odd"===t[3])):t[3]&&st.error(t[0]),t},PSEUDO:function(t){var e,i=!t[6]&&t[2];return X.CHILD.test(t[0])?null:(t[3]?t[2]=t[4]||t[5]||"":i&&V.test(i)&&(e=r(i,!0))&&(e=i.indexOf(")",i.length-e)-i.length)&&(t[0]=t[0].slice(0,e),t[2]=i.slice(0,e)),t.slice(0,3))}},filter:{TAG:function(t){var e=t.replace(Z,tt).toLowerCase();return"*"===t?function(){return!0}:function(t){return t.nodeName&&t.nodeName.toLowerCase()===e}},CLASS:function(t){var e=C[t+" "];return e||(e=new RegExp("(^|"+M+")"+t+"("+M+"|$)"))&&C(t,function(t){return e.test("string"==typeof t.className&&t.className||void 0!==t.getAttribute&&t.getAttribute("class")||"")})},ATTR:function(t,e,i){return function(n){var o=st.attr(n,t);return null==o?"!="===e:!e||(o+="","="===e?o===i:"!="===e?o!==i:"^="===e?i&&0===o.indexOf(i):"*="===e?i&&o.indexOf(i)>-1:"$="===e?i&&o.slice(-i.length)===i:"~="===e?(" "+o.replace(I," ")+" ").indexOf(i)>-1:"|="===e&&(o===i||o.slice(0,i.length+1)===i+"-"))}},CHILD:function(t,e,i,n,o){var s="nth"!==t.slice(0,3),r="last"!==t.slice(-4),a="of-type"===e;return 1===n&&0===o?function(t){return!!t.parentNode}:function(e,i,l){var u,h,c,d,p,f,m=s!==r?"nextSibling":"previousSibling",g=e.parentNode,v=a&&e.nodeName.toLowerCase(),y=!l&&!a,_=!1;if(g){if(s){for(;m;){for(d=e;d=d[m];)if(a?d.nodeName.toLowerCase()===v:1===d.nodeType)return!1;f=m="only"===t&&!f&&"nextSibling"}return!0}if(f=[r?g.firstChild:g.lastChild],r&&y){for(_=(p=(u=(h=(c=(d=g)[b]||(d[b]={}))[d.uniqueID]||(c[d.uniqueID]={}))[t]||[])[0]===w&&u[1])&&u[2],d=p&&g.childNodes[p];d=++p&&d&&d[m]||(_=p=0)||f.pop();)if(1===d.nodeType&&++_&&d===e){h[t]=[w,p,_];break}}else if(y&&(_=p=(u=(h=(c=(d=e)[b]||(d[b]={}))[d.uniqueID]||(c[d.uniqueID]={}))[t]||[])[0]===w&&u[1]),!1===_)for(;(d=++p&&d&&d[m]||(_=p=0)||f.pop())&&((a?d.nodeName.toLowerCase()!==v:1!==d.nodeType)||!++_||(y&&((h=(c=d[b]||(d[b]={}))[d.uniqueID]||(c[d.uniqueID]={}))[t]=[w,_]),d!==e)););return(_-=o)===n||_%n==0&&_/n>=0}}},PSEUDO:function(t,e){var i,o=n.pseudos[t]||n.setFilters[t.toLowerCase()]||st.error("unsupported pseudo: "+t);return o[b]?o(e):o.length>1?(i=[t,t,"",e],n.setFilters.hasOwnProperty(t.toLowerCase())?at(function(t,i){for(var n,s=o(t,e),r=s.length;r--;)t[n=H(t,s[r])]=!(i[n]=s[r])}):function(t){return o(t,0,i)}):o}},pseudos:{not:at(function(t){var e=[],i=[],n=a(t.replace(R,"$1"));return n[b]?at(function(t,e,i,o){for(var s,r=n(t,null,o,[]),a=t.length;a--;)(s=r[a])&&(t[a]=!(e[a]=s))}):function(t,o,s){return e[0]=t,n(e,null,s,i),e[0]=null,!i.pop()}}),has:at(function(t){return function(e){return st(t,e).length>0}}),contains:at(function(t){return t=t.replace(Z,tt),function(e){return(e.textContent||e.innerText||o(e)).indexOf(t)>-1}}),lang:at(function(t){return U.test(t||"")||st.error("unsupported lang: "+t),t=t.replace(Z,tt).toLowerCase(),function(e){var i;do{if(i=m?e.lang:e.getAttribute("xml:lang")||e.getAttribute("lang"))return(i=i.toLowerCase())===t||0===i.indexOf(t+"-")}while((e=e.parentNode)&&1===e.nodeType);return!1}}),target:function(e){var i=t.location&&t.location.hash;return i&&i.slice(1)===e.id},root:function(t){return t===f},focus:function(t){return t===p.activeElement&&(!p.hasFocus||p.hasFocus())&&!!(t.type||t.href||~t.tabIndex)},enabled:pt(!1),disabled:pt(!0),checked:function(t){var e=t.nodeName.toLowerCase();return"input"===e&&!!t.checked||"option"===e&&!!t.selected},selected:function(t){return t.parentNode&&t.parentNode.selectedIndex,!0===t.selected},empty:function(t){for(t=t.firstChild;t;t=t.nextSibling)if(t.nodeType<6)return!1;return!0},parent:function(t){return!n.pseudos.empty(t)},header:function(t){return Y.test(t.nodeName)},input:function(t){return Q.test(t.nodeName)},button:function(t){var e=t.nodeName.toLowerCase();return"input"===e&&"button"===t.type||"button"===e},text:function(t){var e;return"input"===t.nodeName.toLowerCase()&&"text"===t.type&&(null==(e=t.getAttribute("type"))||"text"===e.toLowerCase())},first:ft(function(){return[0]}),last:ft(function(t,e){return[e-1]}),eq:ft(function(t,e,i){return[i<0?i+e:i]}),even:ft(function(t,e){for(var i=0;i<e;i+=2)t.push(i);return t}),odd:ft(function(t,e){for(var i=1;i<e;i+=2)t.push(i);return t}),lt:ft(function(t,e,i){for(var n=i<0?i+e:i;--n>=0;)t.push(n);return t}),gt:ft(function(t,e,i){for(var n=i<0?i+e:i;++n<e;)t.push(n);return t})}}).pseudos.nth=n.pseudos.eq,{radio:!0,checkbox:!0,file:!0,password:!0,image:!0})n.pseudos[e]=ct(e);for(e in{submit:!0,reset:!0})n.pseudos[e]=dt(e);function gt(){}function vt(t){for(var e=0,i=t.length,n="";e<i;e++)n+=t[e].value;return n}function yt(t,e,i){var n=e.dir,o=e.next,s=o||n,r=i&&"parentNode"===s,a=k++;return e.first?function(e,i,o){for(;e=e[n];)if(1===e.nodeType||r)return t(e,i,o);return!1}:function(e,i,l){var u,h,c,d=[w,a];if(l){for(;e=e[n];)if((1===e.nodeType||r)&&t(e,i,l))return!0}else for(;e=e[n];)if(1===e.nodeType||r)if(h=(c=e[b]||(e[b]={}))[e.uniqueID]||(c[e.uniqueID]={}),o&&o===e.nodeName.toLowerCase())e=e[n]||e;else{if((u=h[s])&&u[0]===w&&u[1]===a)return d[2]=u[2];if(h[s]=d,d[2]=t(e,i,l))return!0}return!1}}function _t(t){return t.length>1?function(e,i,n){for(var o=t.length;o--;)if(!t[o](e,i,n))return!1;return!0}:t[0]}function bt(t,e,i,n,o){for(var s,r=[],a=0,l=t.length,u=null!=e;a<l;a++)(s=t[a])&&(i&&!i(s,n,o)||(r.push(s),u&&e.push(a)));return r}function xt(t,e,i,n,o,s){return n&&!n[b]&&(n=xt(n)),o&&!o[b]&&(o=xt(o,s)),at(function(s,r,a,l){var u,h,c,d=[],p=[],f=r.length,m=s||function(t,e,i){for(var n=0,o=e.length;n<o;n++)st(t,e[n],i);return i}(e||"*",a.nodeType?[a]:a,[]),g=!t||!s&&e?m:bt(m,d,t,a,l),v=i?o||(s?t:f||n)?[]:r:g;if(i&&i(g,v,a,l),n)for(u=bt(v,p),n(u,[],a,l),h=u.length;h--;)(c=u[h])&&(v[p[h]]=!(g[p[h]]=c));if(s){if(o||t){if(o){for(u=[],h=v.length;h--;)(c=v[h])&&u.push(g[h]=c);o(null,v=[],u,l)}for(h=v.length;h--;)(c=v[h])&&(u=o?H(s,c):d[h])>-1&&(s[u]=!(r[u]=c))}}else v=bt(v===r?v.splice(f,v.length):v),o?o(null,r,v,l):j.apply(r,v)})}function wt(t){for(var e,i,o,s=t.length,r=n.relative[t[0].type],a=r||n.relative[" "],l=r?1:0,h=yt(function(t){return t===e},a,!0),c=yt(function(t){return H(e,t)>-1},a,!0),d=[function(t,i,n){var o=!r&&(n||i!==u)||((e=i).nodeType?h(t,i,n):c(t,i,n));return e=null,o}];l<s;l++)if(i=n.relative[t[l].type])d=[yt(_t(d),i)];else{if((i=n.filter[t[l].type].apply(null,t[l].matches))[b]){for(o=++l;o<s&&!n.relative[t[o].type];o++);return xt(l>1&&_t(d),l>1&&vt(t.slice(0,l-1).concat({value:" "===t[l-2].type?"*":""})).replace(R,"$1"),i,l<o&&wt(t.slice(l,o)),o<s&&wt(t=t.slice(o)),o<s&&vt(t))}d.push(i)}return _t(d)}function kt(t,e){var i=e.length>0,o=t.length>0,s=function(s,r,a,l,h){var c,f,g,v=0,y="0",_=s&&[],b=[],x=u,k=s||o&&n.find.TAG("*",h),C=w+=null==x?1:Math.random()||.1,T=k.length;for(h&&(u=r===p||r||h);y!==T&&null!=(c=k[y]);y++){if(o&&c){for(f=0,r||c.ownerDocument===p||(d(c),a=!m);g=t[f++];)if(g(c,r||p,a)){l.push(c);break}h&&(w=C)}i&&((c=!g&&c)&&v--,s&&_.push(c))}if(v+=y,i&&y!==v){for(f=0;g=e[f++];)g(_,b,r,a);if(s){if(v>0)for(;y--;)_[y]||b[y]||(b[y]=L.call(l));b=bt(b)}j.apply(l,b),h&&!s&&b.length>0&&v+e.length>1&&st.uniqueSort(l)}return h&&(w=C,u=x),_};return i?at(s):s}return gt.prototype=n.filters=n.pseudos,n.setFilters=new gt,r=st.tokenize=function(t,e){var i,o,s,r,a,l,u,h=T[t+" "];if(h)return e?0:h.slice(0);for(a=t,l=[],u=n.preFilter;a;){for(r in i&&!(o=z.exec(a))||(o&&(a=a.slice(o[0].length)||a),l.push(s=[])),i=!1,(o=B.exec(a))&&(i=o.shift(),s.push({value:i,type:o[0].replace(R," ")}),a=a.slice(i.length)),n.filter)!(o=X[r].exec(a))||u[r]&&!(o=u[r](o))||(i=o.shift(),s.push({value:i,type:r,matches:o}),a=a.slice(i.length));if(!i)break}return e?a.length:a?st.error(t):T(t,l).slice(0)},a=st.compile=function(t,e){var i,n=[],o=[],s=E[t+" "];if(!s){for(e||(e=r(t)),i=e.length;i--;)(s=wt(e[i]))[b]?n.push(s):o.push(s);(s=E(t,kt(o,n))).selector=t}return s},l=st.select=function(t,e,i,o){var s,l,u,h,c,d="function"==typeof t&&t,p=!o&&r(t=d.selector||t);if(i=i||[],1===p.length){if((l=p[0]=p[0].slice(0)).length>2&&"ID"===(u=l[0]).type&&9===e.nodeType&&m&&n.relative[l[1].type]){if(!(e=(n.find.ID(u.matches[0].replace(Z,tt),e)||[])[0]))return i;d&&(e=e.parentNode),t=t.slice(l.shift().value.length)}for(s=X.needsContext.test(t)?0:l.length;s--&&(u=l[s],!n.relative[h=u.type]);)if((c=n.find[h])&&(o=c(u.matches[0].replace(Z,tt),K.test(l[0].type)&&mt(e.parentNode)||e))){if(l.splice(s,1),!(t=o.length&&vt(l)))return j.apply(i,o),i;break}}return(d||a(t,p))(o,e,!m,i,!e||K.test(t)&&mt(e.parentNode)||e),i},i.sortStable=b.split("").sort(S).join("")===b,i.detectDuplicates=!!c,d(),i.sortDetached=lt(function(t){return 1&t.compareDocumentPosition(p.createElement("fieldset"))}),lt(function(t){return t.innerHTML="<a href='#'></a>","#"===t.firstChild.getAttribute("href")})||ut("type|href|height|width",function(t,e,i){if(!i)return t.getAttribute(e,"type"===e.toLowerCase()?1:2)}),i.attributes&&lt(function(t){return t.innerHTML="<input/>",t.firstChild.setAttribute("value",""),""===t.firstChild.getAttribute("value")})||ut("value",function(t,e,i){if(!i&&"input"===t.nodeName.toLowerCase())return t.defaultValue}),lt(function(t){return null==t.getAttribute("disabled")})||ut($,function(t,e,i){var n;if(!i)return!0===t[e]?e.toLowerCase():(n=t.getAttributeNode(e))&&n.specified?n.value:null}),st}(t);v.find=k,v.expr=k.selectors,v.expr[":"]=v.expr.pseudos,v.uniqueSort=v.unique=k.uniqueSort,v.text=k.getText,v.isXMLDoc=k.isXML,v.contains=k.contains,v.escapeSelector=k.escape;var C=function(t,e,i){for(var n=[],o=void 0!==i;(t=t[e])&&9!==t.nodeType;)if(1===t.nodeType){if(o&&v(t).is(i))break;n.push(t)}return n},T=function(t,e){for(var i=[];t;t=t.nextSibling)1===t.nodeType&&t!==e&&i.push(t);return i},E=v.expr.match.needsContext;function S(t,e){return t.nodeName&&t.nodeName.toLowerCase()===e.toLowerCase()}var N=/^<([a-z][^\/\0>:\x20\t\r\n\f]*)[\x20\t\r\n\f]*\/?>(?:<\/\1>|)$/i,A=/^.[^:#\[\.,]*$/;function L(t,e,i){return v.isFunction(e)?v.grep(t,function(t,n){return!!e.call(t,n,t)!==i}):e.nodeType?v.grep(t,function(t){return t===e!==i}):"string"!=typeof e?v.grep(t,function(t){return l.call(e,t)>-1!==i}):A.test(e)?v.filter(e,t,i):(e=v.filter(e,t),v.grep(t,function(t){return l.call(e,t)>-1!==i&&1===t.nodeType}))}v.filter=function(t,e,i){var n=e[0];return i&&(t=":not("+t+")"),1===e.length&&1===n.nodeType?v.find.matchesSelector(n,t)?[n]:[]:v.find.matches(t,v.grep(e,function(t){return 1===t.nodeType}))},v.fn.extend({find:function(t){var e,i,n=this.length,o=this;if("string"!=typeof t)return this.pushStack(v(t).filter(function(){for(e=0;e<n;e++)if(v.contains(o[e],this))return!0}));for(i=this.pushStack([]),e=0;e<n;e++)v.find(t,o[e],i);return n>1?v.uniqueSort(i):i},filter:function(t){return this.pushStack(L(this,t||[],!1))},not:function(t){return this.pushStack(L(this,t||[],!0))},is:function(t){return!!L(this,"string"==typeof t&&E.test(t)?v(t):t||[],!1).length}});var D,j=/^(?:\s*(<[\w\W]+>)[^>]*|#([\w-]+))$/;(v.fn.init=function(t,e,i){var o,s;if(!t)return this;if(i=i||D,"string"==typeof t){if(!(o="<"===t[0]&&">"===t[t.length-1]&&t.length>=3?[null,t,null]:j.exec(t))||!o[1]&&e)return!e||e.jquery?(e||i).find(t):this.constructor(e).find(t);if(o[1]){if(e=e instanceof v?e[0]:e,v.merge(this,v.parseHTML(o[1],e&&e.nodeType?e.ownerDocument||e:n,!0)),N.test(o[1])&&v.isPlainObject(e))for(o in e)v.isFunction(this[o])?this[o](e[o]):this.attr(o,e[o]);return this}return(s=n.getElementById(o[2]))&&(this[0]=s,this.length=1),this}return t.nodeType?(this[0]=t,this.length=1,this):v.isFunction(t)?void 0!==i.ready?i.ready(t):t(v):v.makeArray(t,this)}).prototype=v.fn,D=v(n);var P=/^(?:parents|prev(?:Until|All))/,H={children:!0,contents:!0,next:!0,prev:!0};function $(t,e){for(;(t=t[e])&&1!==t.nodeType;);return t}v.fn.extend({has:function(t){var e=v(t,this),i=e.length;return this.filter(function(){for(var t=0;t<i;t++)if(v.contains(this,e[t]))return!0})},closest:function(t,e){var i,n=0,o=this.length,s=[],r="string"!=typeof t&&v(t);if(!E.test(t))for(;n<o;n++)for(i=this[n];i&&i!==e;i=i.parentNode)if(i.nodeType<11&&(r?r.index(i)>-1:1===i.nodeType&&v.find.matchesSelector(i,t))){s.push(i);break}return this.pushStack(s.length>1?v.uniqueSort(s):s)},index:function(t){return t?"string"==typeof t?l.call(v(t),this[0]):l.call(this,t.jquery?t[0]:t):this[0]&&this[0].parentNode?this.first().prevAll().length:-1},add:function(t,e){return this.pushStack(v.uniqueSort(v.merge(this.get(),v(t,e))))},addBack:function(t){return this.add(null==t?this.prevObject:this.prevObject.filter(t))}}),v.each({parent:function(t){var e=t.parentNode;return e&&11!==e.nodeType?e:null},parents:function(t){return C(t,"parentNode")},parentsUntil:function(t,e,i){return C(t,"parentNode",i)},next:function(t){return $(t,"nextSibling")},prev:function(t){return $(t,"previousSibling")},nextAll:function(t){return C(t,"nextSibling")},prevAll:function(t){return C(t,"previousSibling")},nextUntil:function(t,e,i){return C(t,"nextSibling",i)},prevUntil:function(t,e,i){return C(t,"previousSibling",i)},siblings:function(t){return T((t.parentNode||{}).firstChild,t)},children:function(t){return T(t.firstChild)},contents:function(t){return S(t,"iframe")?t.contentDocument:(S(t,"template")&&(t=t.content||t),v.merge([],t.childNodes))}},function(t,e){v.fn[t]=function(i,n){var o=v.map(this,e,i);return"Until"!==t.slice(-5)&&(n=i),n&&"string"==typeof n&&(o=v.filter(n,o)),this.length>1&&(H[t]||v.uniqueSort(o),P.test(t)&&o.reverse()),this.pushStack(o)}});var M=/[^\x20\t\r\n\f]+/g;function q(t){return t}function O(t){throw t}function F(t,e,i,n){var o;try{t&&v.isFunction(o=t.promise)?o.call(t).done(e).fail(i):t&&v.isFunction(o=t.then)?o.call(t,e,i):e.apply(void 0,[t].slice(n))}catch(t){i.apply(void 0,[t])}}v.Callbacks=function(t){t="string"==typeof t?function(t){var e={};return v.each(t.match(M)||[],function(t,i){e[i]=!0}),e}(t):v.extend({},t);var e,i,n,o,s=[],r=[],a=-1,l=function(){for(o=o||t.once,n=e=!0;r.length;a=-1)for(i=r.shift();++a<s.length;)!1===s[a].apply(i[0],i[1])&&t.stopOnFalse&&(a=s.length,i=!1);t.memory||(i=!1),e=!1,o&&(s=i?[]:"")},u={add:function(){return s&&(i&&!e&&(a=s.length-1,r.push(i)),function e(i){v.each(i,function(i,n){v.isFunction(n)?t.unique&&u.has(n)||s.push(n):n&&n.length&&"string"!==v.type(n)&&e(n)})}(arguments),i&&!e&&l()),this},remove:function(){return v.each(arguments,function(t,e){for(var i;(i=v.inArray(e,s,i))>-1;)s.splice(i,1),i<=a&&a--}),this},has:function(t){return t?v.inArray(t,s)>-1:s.length>0},empty:function(){return s&&(s=[]),this},disable:function(){return o=r=[],s=i="",this},disabled:function(){return!s},lock:function(){return o=r=[],i||e||(s=i=""),this},locked:function(){return!!o},fireWith:function(t,i){return o||(i=[t,(i=i||[]).slice?i.slice():i],r.push(i),e||l()),this},fire:function(){return u.fireWith(this,arguments),this},fired:function(){return!!n}};return u},v.extend({Deferred:function(e){var i=[["notify","progress",v.Callbacks("memory"),v.Callbacks("memory"),2],["resolve","done",v.Callbacks("once memory"),v.Callbacks("once memory"),0,"resolved"],["reject","fail",v.Callbacks("once memory"),v.Callbacks("once memory"),1,"rejected"]],n="pending",o={state:function(){return n},always:function(){return s.done(arguments).fail(arguments),this},catch:function(t){return o.then(null,t)},pipe:function(){var t=arguments;return v.Deferred(function(e){v.each(i,function(i,n){var o=v.isFunction(t[n[4]])&&t[n[4]];s[n[1]](function(){var t=o&&o.apply(this,arguments);t&&v.isFunction(t.promise)?t.promise().progress(e.notify).done(e.resolve).fail(e.reject):e[n[0]+"With"](this,o?[t]:arguments)})}),t=null}).promise()},then:function(e,n,o){var s=0;function r(e,i,n,o){return function(){var a=this,l=arguments,u=function(){var t,u;if(!(e<s)){if((t=n.apply(a,l))===i.promise())throw new TypeError("Thenable self-resolution");u=t&&("object"==typeof t||"function"==typeof t)&&t.then,v.isFunction(u)?o?u.call(t,r(s,i,q,o),r(s,i,O,o)):(s++,u.call(t,r(s,i,q,o),r(s,i,O,o),r(s,i,q,i.notifyWith))):(n!==q&&(a=void 0,l=[t]),(o||i.resolveWith)(a,l))}},h=o?u:function(){try{u()}catch(t){v.Deferred.exceptionHook&&v.Deferred.exceptionHook(t,h.stackTrace),e+1>=s&&(n!==O&&(a=void 0,l=[t]),i.rejectWith(a,l))}};e?h():(v.Deferred.getStackHook&&(h.stackTrace=v.Deferred.getStackHook()),t.setTimeout(h))}}return v.Deferred(function(t){i[0][3].add(r(0,t,v.isFunction(o)?o:q,t.notifyWith)),i[1][3].add(r(0,t,v.isFunction(e)?e:q)),i[2][3].add(r(0,t,v.isFunction(n)?n:O))}).promise()},promise:function(t){return null!=t?v.extend(t,o):o}},s={};return v.each(i,function(t,e){var r=e[2],a=e[5];o[e[1]]=r.add,a&&r.add(function(){n=a},i[3-t][2].disable,i[0][2].lock),r.add(e[3].fire),s[e[0]]=function(){return s[e[0]+"With"](this===s?void 0:this,arguments),this},s[e[0]+"With"]=r.fireWith}),o.promise(s),e&&e.call(s,s),s},when:function(t){var e=arguments.length,i=e,n=Array(i),o=s.call(arguments),r=v.Deferred(),a=function(t){return function(i){n[t]=this,o[t]=arguments.length>1?s.call(arguments):i,--e||r.resolveWith(n,o)}};if(e<=1&&(F(t,r.done(a(i)).resolve,r.reject,!e),"pending"===r.state()||v.isFunction(o[i]&&o[i].then)))return r.then();for(;i--;)F(o[i],a(i),r.reject);return r.promise()}});var I=/^(Eval|Internal|Range|Reference|Syntax|Type|URI)Error$/;v.Deferred.exceptionHook=function(e,i){t.console&&t.console.warn&&e&&I.test(e.name)&&t.console.warn("jQuery.Deferred exception: "+e.message,e.stack,i)},v.readyException=function(e){t.setTimeout(function(){throw e})};var R=v.Deferred();function z(){n.removeEventListener("DOMContentLoaded",z),t.removeEventListener("load",z),v.ready()}v.fn.ready=function(t){return R.then(t).catch(function(t){v.readyException(t)}),this},v.extend({isReady:!1,readyWait:1,ready:function(t){(!0===t?--v.readyWait:v.isReady)||(v.isReady=!0,!0!==t&&--v.readyWait>0||R.resolveWith(n,[v]))}}),v.ready.then=R.then,"complete"===n.readyState||"loading"!==n.readyState&&!n.documentElement.doScroll?t.setTimeout(v.ready):(n.addEventListener("DOMContentLoaded",z),t.addEventListener("load",z));var B=function(t,e,i,n,o,s,r){var a=0,l=t.length,u=null==i;if("object"===v.type(i))for(a in o=!0,i)B(t,e,a,i[a],!0,s,r);else if(void 0!==n&&(o=!0,v.isFunction(n)||(r=!0),u&&(r?(e.call(t,n),e=null):(u=e,e=function(t,e,i){return u.call(v(t),i)})),e))for(;a<l;a++)e(t[a],i,r?n:n.call(t[a],a,e(t[a],i)));return o?t:u?e.call(t):l?e(t[0],i):s},W=function(t){return 1===t.nodeType||9===t.nodeType||!+t.nodeType};function V(){this.expando=v.expando+V.uid++}V.uid=1,V.prototype={cache:function(t){var e=t[this.expando];return e||(e={},W(t)&&(t.nodeType?t[this.expando]=e:Object.defineProperty(t,this.expando,{value:e,configurable:!0}))),e},set:function(t,e,i){var n,o=this.cache(t);if("string"==typeof e)o[v.camelCase(e)]=i;else for(n in e)o[v.camelCase(n)]=e[n];return o},get:function(t,e){return void 0===e?this.cache(t):t[this.expando]&&t[this.expando][v.camelCase(e)]},access:function(t,e,i){return void 0===e||e&&"string"==typeof e&&void 0===i?this.get(t,e):(this.set(t,e,i),void 0!==i?i:e)},remove:function(t,e){var i,n=t[this.expando];if(void 0!==n){if(void 0!==e){Array.isArray(e)?e=e.map(v.camelCase):e=(e=v.camelCase(e))in n?[e]:e.match(M)||[],i=e.length;for(;i--;)delete n[e[i]]}(void 0===e||v.isEmptyObject(n))&&(t.nodeType?t[this.expando]=void 0:delete t[this.expando])}},hasData:function(t){var e=t[this.expando];return void 0!==e&&!v.isEmptyObject(e)}};var U=new V,X=new V,Q=/^(?:\{[\w\W]*\}|\[[\w\W]*\])$/,Y=/[A-Z]/g;function G(t,e,i){var n;if(void 0===i&&1===t.nodeType)if(n="data-"+e.replace(Y,"-$&").toLowerCase(),"string"==typeof(i=t.getAttribute(n))){try{i=function(t){return"true"===t||"false"!==t&&("null"===t?null:t===+t+""?+t:Q.test(t)?JSON.parse(t):t)}(i)}catch(t){}X.set(t,e,i)}else i=void 0;return i}v.extend({hasData:function(t){return X.hasData(t)||U.hasData(t)},data:function(t,e,i){return X.access(t,e,i)},removeData:function(t,e){X.remove(t,e)},_data:function(t,e,i){return U.access(t,e,i)},_removeData:function(t,e){U.remove(t,e)}}),v.fn.extend({data:function(t,e){var i,n,o,s=this[0],r=s&&s.attributes;if(void 0===t){if(this.length&&(o=X.get(s),1===s.nodeType&&!U.get(s,"hasDataAttrs"))){for(i=r.length;i--;)r[i]&&(0===(n=r[i].name).indexOf("data-")&&(n=v.camelCase(n.slice(5)),G(s,n,o[n])));U.set(s,"hasDataAttrs",!0)}return o}return"object"==typeof t?this.each(function(){X.set(this,t)}):B(this,function(e){var i;if(s&&void 0===e){if(void 0!==(i=X.get(s,t)))return i;if(void 0!==(i=G(s,t)))return i}else this.each(function(){X.set(this,t,e)})},null,e,arguments.length>1,null,!0)},removeData:function(t){return this.each(function(){X.remove(this,t)})}}),v.extend({queue:function(t,e,i){var n;if(t)return e=(e||"fx")+"queue",n=U.get(t,e),i&&(!n||Array.isArray(i)?n=U.access(t,e,v.makeArray(i)):n.push(i)),n||[]},dequeue:function(t,e){e=e||"fx";var i=v.queue(t,e),n=i.length,o=i.shift(),s=v._queueHooks(t,e);"inprogress"===o&&(o=i.shift(),n--),o&&("fx"===e&&i.unshift("inprogress"),delete s.stop,o.call(t,function(){v.dequeue(t,e)},s)),!n&&s&&s.empty.fire()},_queueHooks:function(t,e){var i=e+"queueHooks";return U.get(t,i)||U.access(t,i,{empty:v.Callbacks("once memory").add(function(){U.remove(t,[e+"queue",i])})})}}),v.fn.extend({queue:function(t,e){var i=2;return"string"!=typeof t&&(e=t,t="fx",i--),arguments.length<i?v.queue(this[0],t):void 0===e?this:this.each(function(){var i=v.queue(this,t,e);v._queueHooks(this,t),"fx"===t&&"inprogress"!==i[0]&&v.dequeue(this,t)})},dequeue:function(t){return this.each(function(){v.dequeue(this,t)})},clearQueue:function(t){return this.queue(t||"fx",[])},promise:function(t,e){var i,n=1,o=v.Deferred(),s=this,r=this.length,a=function(){--n||o.resolveWith(s,[s])};for("string"!=typeof t&&(e=t,t=void 0),t=t||"fx";r--;)(i=U.get(s[r],t+"queueHooks"))&&i.empty&&(n++,i.empty.add(a));return a(),o.promise(e)}});var J=/[+-]?(?:\d*\.|)\d+(?:[eE][+-]?\d+|)/.source,K=new RegExp("^(?:([+-])=|)("+J+")([a-z%]*)$","i"),Z=["Top","Right","Bottom","Left"],tt=function(t,e){return"none"===(t=e||t).style.display||""===t.style.display&&v.contains(t.ownerDocument,t)&&"none"===v.css(t,"display")},et=function(t,e,i,n){var o,s,r={};for(s in e)r[s]=t.style[s],t.style[s]=e[s];for(s in o=i.apply(t,n||[]),e)t.style[s]=r[s];return o};function it(t,e,i,n){var o,s=1,r=20,a=n?function(){return n.cur()}:function(){return v.css(t,e,"")},l=a(),u=i&&i[3]||(v.cssNumber[e]?"":"px"),h=(v.cssNumber[e]||"px"!==u&&+l)&&K.exec(v.css(t,e));if(h&&h[3]!==u){u=u||h[3],i=i||[],h=+l||1;do{h/=s=s||".5",v.style(t,e,h+u)}while(s!==(s=a()/l)&&1!==s&&--r)}return i&&(h=+h||+l||0,o=i[1]?h+(i[1]+1)*i[2]:+i[2],n&&(n.unit=u,n.start=h,n.end=o)),o}var nt={};function ot(t){var e,i=t.ownerDocument,n=t.nodeName,o=nt[n];return o||(e=i.body.appendChild(i.createElement(n)),o=v.css(e,"display"),e.parentNode.removeChild(e),"none"===o&&(o="block"),nt[n]=o,o)}function st(t,e){for(var i,n,o=[],s=0,r=t.length;s<r;s++)(n=t[s]).style&&(i=n.style.display,e?("none"===i&&(o[s]=U.get(n,"display")||null,o[s]||(n.style.display="")),""===n.style.display&&tt(n)&&(o[s]=ot(n))):"none"!==i&&(o[s]="none",U.set(n,"display",i)));for(s=0;s<r;s++)null!=o[s]&&(t[s].style.display=o[s]);return t}v.fn.extend({show:function(){return st(this,!0)},hide:function(){return st(this)},toggle:function(t){return"boolean"==typeof t?t?this.show():this.hide():this.each(function(){tt(this)?v(this).show():v(this).hide()})}});var rt=/^(?:checkbox|radio)$/i,at=/<([a-z][^\/\0>\x20\t\r\n\f]+)/i,lt=/^$|\/(?:java|ecma)script/i,ut={option:[1,"<select multiple='multiple'>","</select>"],thead:[1,"<table>","</table>"],col:[2,"<table><colgroup>","</colgroup></table>"],tr:[2,"<table><tbody>","</tbody></table>"],td:[3,"<table><tbody><tr>","</tr></tbody></table>"],_default:[0,"",""]};function ht(t,e){var i;return i=void 0!==t.getElementsByTagName?t.getElementsByTagName(e||"*"):void 0!==t.querySelectorAll?t.querySelectorAll(e||"*"):[],void 0===e||e&&S(t,e)?v.merge([t],i):i}function ct(t,e){for(var i=0,n=t.length;i<n;i++)U.set(t[i],"globalEval",!e||U.get(e[i],"globalEval"))}ut.optgroup=ut.option,ut.tbody=ut.tfoot=ut.colgroup=ut.caption=ut.thead,ut.th=ut.td;var dt=/<|&#?\w+;/;function pt(t,e,i,n,o){for(var s,r,a,l,u,h,c=e.createDocumentFragment(),d=[],p=0,f=t.length;p<f;p++)if((s=t[p])||0===s)if("object"===v.type(s))v.merge(d,s.nodeType?[s]:s);else if(dt.test(s)){for(r=r||c.appendChild(e.createElement("div")),a=(at.exec(s)||["",""])[1].toLowerCase(),l=ut[a]||ut._default,r.innerHTML=l[1]+v.htmlPrefilter(s)+l[2],h=l[0];h--;)r=r.lastChild;v.merge(d,r.childNodes),(r=c.firstChild).textContent=""}else d.push(e.createTextNode(s));for(c.textContent="",p=0;s=d[p++];)if(n&&v.inArray(s,n)>-1)o&&o.push(s);else if(u=v.contains(s.ownerDocument,s),r=ht(c.appendChild(s),"script"),u&&ct(r),i)for(h=0;s=r[h++];)lt.test(s.type||"")&&i.push(s);return c}!function(){var t=n.createDocumentFragment().appendChild(n.createElement("div")),e=n.createElement("input");e.setAttribute("type","radio"),e.setAttribute("checked","checked"),e.setAttribute("name","t"),t.appendChild(e),f.checkClone=t.cloneNode(!0).cloneNode(!0).lastChild.checked,t.innerHTML="<textarea>x</textarea>",f.noCloneChecked=!!t.cloneNode(!0).lastChild.defaultValue}();var ft=n.documentElement,mt=/^key/,gt=/^(?:mouse|pointer|contextmenu|drag|drop)|click/,vt=/^([^.]*)(?:\.(.+)|)/;function yt(){return!0}function _t(){return!1}function bt(){try{return n.activeElement}catch(t){}}function xt(t,e,i,n,o,s){var r,a;if("object"==typeof e){for(a in"string"!=typeof i&&(n=n||i,i=void 0),e)xt(t,a,i,n,e[a],s);return t}if(null==n&&null==o?(o=i,n=i=void 0):null==o&&("string"==typeof i?(o=n,n=void 0):(o=n,n=i,i=void 0)),!1===o)o=_t;else if(!o)return t;return 1===s&&(r=o,(o=function(t){return v().off(t),r.apply(this,arguments)}).guid=r.guid||(r.guid=v.guid++)),t.each(function(){v.event.add(this,e,o,n,i)})}v.event={global:{},add:function(t,e,i,n,o){var s,r,a,l,u,h,c,d,p,f,m,g=U.get(t);if(g)for(i.handler&&(i=(s=i).handler,o=s.selector),o&&v.find.matchesSelector(ft,o),i.guid||(i.guid=v.guid++),(l=g.events)||(l=g.events={}),(r=g.handle)||(r=g.handle=function(e){return void 0!==v&&v.event.triggered!==e.type?v.event.dispatch.apply(t,arguments):void 0}),u=(e=(e||"").match(M)||[""]).length;u--;)p=m=(a=vt.exec(e[u])||[])[1],f=(a[2]||"").split(".").sort(),p&&(c=v.event.special[p]||{},p=(o?c.delegateType:c.bindType)||p,c=v.event.special[p]||{},h=v.extend({type:p,origType:m,data:n,handler:i,guid:i.guid,selector:o,needsContext:o&&v.expr.match.needsContext.test(o),namespace:f.join(".")},s),(d=l[p])||((d=l[p]=[]).delegateCount=0,c.setup&&!1!==c.setup.call(t,n,f,r)||t.addEventListener&&t.addEventListener(p,r)),c.add&&(c.add.call(t,h),h.handler.guid||(h.handler.guid=i.guid)),o?d.splice(d.delegateCount++,0,h):d.push(h),v.event.global[p]=!0)},remove:function(t,e,i,n,o){var s,r,a,l,u,h,c,d,p,f,m,g=U.hasData(t)&&U.get(t);if(g&&(l=g.events)){for(u=(e=(e||"").match(M)||[""]).length;u--;)if(p=m=(a=vt.exec(e[u])||[])[1],f=(a[2]||"").split(".").sort(),p){for(c=v.event.special[p]||{},d=l[p=(n?c.delegateType:c.bindType)||p]||[],a=a[2]&&new RegExp("(^|\\.)"+f.join("\\.(?:.*\\.|)")+"(\\.|$)"),r=s=d.length;s--;)h=d[s],!o&&m!==h.origType||i&&i.guid!==h.guid||a&&!a.test(h.namespace)||n&&n!==h.selector&&("**"!==n||!h.selector)||(d.splice(s,1),h.selector&&d.delegateCount--,c.remove&&c.remove.call(t,h));r&&!d.length&&(c.teardown&&!1!==c.teardown.call(t,f,g.handle)||v.removeEvent(t,p,g.handle),delete l[p])}else for(p in l)v.event.remove(t,p+e[u],i,n,!0);v.isEmptyObject(l)&&U.remove(t,"handle events")}},dispatch:function(t){var e,i,n,o,s,r,a=v.event.fix(t),l=new Array(arguments.length),u=(U.get(this,"events")||{})[a.type]||[],h=v.event.special[a.type]||{};for(l[0]=a,e=1;e<arguments.length;e++)l[e]=arguments[e];if(a.delegateTarget=this,!h.preDispatch||!1!==h.preDispatch.call(this,a)){for(r=v.event.handlers.call(this,a,u),e=0;(o=r[e++])&&!a.isPropagationStopped();)for(a.currentTarget=o.elem,i=0;(s=o.handlers[i++])&&!a.isImmediatePropagationStopped();)a.rnamespace&&!a.rnamespace.test(s.namespace)||(a.handleObj=s,a.data=s.data,void 0!==(n=((v.event.special[s.origType]||{}).handle||s.handler).apply(o.elem,l))&&!1===(a.result=n)&&(a.preventDefault(),a.stopPropagation()));return h.postDispatch&&h.postDispatch.call(this,a),a.result}},handlers:function(t,e){var i,n,o,s,r,a=[],l=e.delegateCount,u=t.target;if(l&&u.nodeType&&!("click"===t.type&&t.button>=1))for(;u!==this;u=u.parentNode||this)if(1===u.nodeType&&("click"!==t.type||!0!==u.disabled)){for(s=[],r={},i=0;i<l;i++)void 0===r[o=(n=e[i]).selector+" "]&&(r[o]=n.needsContext?v(o,this).index(u)>-1:v.find(o,this,null,[u]).length),r[o]&&s.push(n);s.length&&a.push({elem:u,handlers:s})}return u=this,l<e.length&&a.push({elem:u,handlers:e.slice(l)}),a},addProp:function(t,e){Object.defineProperty(v.Event.prototype,t,{enumerable:!0,configurable:!0,get:v.isFunction(e)?function(){if(this.originalEvent)return e(this.originalEvent)}:function(){if(this.originalEvent)return this.originalEvent[t]},set:function(e){Object.defineProperty(this,t,{enumerable:!0,configurable:!0,writable:!0,value:e})}})},fix:function(t){return t[v.expando]?t:new v.Event(t)},special:{load:{noBubble:!0},focus:{trigger:function(){if(this!==bt()&&this.focus)return this.focus(),!1},delegateType:"focusin"},blur:{trigger:function(){if(this===bt()&&this.blur)return this.blur(),!1},delegateType:"focusout"},click:{trigger:function(){if("checkbox"===this.type&&this.click&&S(this,"input"))return this.click(),!1},_default:function(t){return S(t.target,"a")}},beforeunload:{postDispatch:function(t){void 0!==t.result&&t.originalEvent&&(t.originalEvent.returnValue=t.result)}}}},v.removeEvent=function(t,e,i){t.removeEventListener&&t.removeEventListener(e,i)},v.Event=function(t,e){return this instanceof v.Event?(t&&t.type?(this.originalEvent=t,this.type=t.type,this.isDefaultPrevented=t.defaultPrevented||void 0===t.defaultPrevented&&!1===t.returnValue?yt:_t,this.target=t.target&&3===t.target.nodeType?t.target.parentNode:t.target,this.currentTarget=t.currentTarget,this.relatedTarget=t.relatedTarget):this.type=t,e&&v.extend(this,e),this.timeStamp=t&&t.timeStamp||v.now(),void(this[v.expando]=!0)):new v.Event(t,e)},v.Event.prototype={constructor:v.Event,isDefaultPrevented:_t,isPropagationStopped:_t,isImmediatePropagationStopped:_t,isSimulated:!1,preventDefault:function(){var t=this.originalEvent;this.isDefaultPrevented=yt,t&&!this.isSimulated&&t.preventDefault()},stopPropagation:function(){var t=this.originalEvent;this.isPropagationStopped=yt,t&&!this.isSimulated&&t.stopPropagation()},stopImmediatePropagation:function(){var t=this.originalEvent;this.isImmediatePropagationStopped=yt,t&&!this.isSimulated&&t.stopImmediatePropagation(),this.stopPropagation()}},v.each({altKey:!0,bubbles:!0,cancelable:!0,changedTouches:!0,ctrlKey:!0,detail:!0,eventPhase:!0,metaKey:!0,pageX:!0,pageY:!0,shiftKey:!0,view:!0,char:!0,charCode:!0,key:!0,keyCode:!0,button:!0,buttons:!0,clientX:!0,clientY:!0,offsetX:!0,offsetY:!0,pointerId:!0,pointerType:!0,screenX:!0,screenY:!0,targetTouches:!0,toElement:!0,touches:!0,which:function(t){var e=t.button;return null==t.which&&mt.test(t.type)?null!=t.charCode?t.charCode:t.keyCode:!t.which&&void 0!==e&&gt.test(t.type)?1&e?1:2&e?3:4&e?2:0:t.which}},v.event.addProp),v.each({mouseenter:"mouseover",mouseleave:"mouseout",pointerenter:"pointerover",pointerleave:"pointerout"},function(t,e){v.event.special[t]={delegateType:e,bindType:e,handle:function(t){var i,n=t.relatedTarget,o=t.handleObj;return n&&(n===this||v.contains(this,n))||(t.type=o.origType,i=o.handler.apply(this,arguments),t.type=e),i}}}),v.fn.extend({on:function(t,e,i,n){return xt(this,t,e,i,n)},one:function(t,e,i,n){return xt(this,t,e,i,n,1)},off:function(t,e,i){var n,o;if(t&&t.preventDefault&&t.handleObj)return n=t.handleObj,v(t.delegateTarget).off(n.namespace?n.origType+"."+n.namespace:n.origType,n.selector,n.handler),this;if("object"==typeof t){for(o in t)this.off(o,e,t[o]);return this}return!1!==e&&"function"!=typeof e||(i=e,e=void 0),!1===i&&(i=_t),this.each(function(){v.event.remove(this,t,i,e)})}});var wt=/<(?!area|br|col|embed|hr|img|input|link|meta|param)(([a-z][^\/\0>\x20\t\r\n\f]*)[^>]*)\/>/gi,kt=/<script|<style|<link/i,Ct=/checked\s*(?:[^=]|=\s*.checked.)/i,Tt=/^true\/(.*)/,Et=/^\s*<!(?:\[CDATA\[|--)|(?:\]\]|--)>\s*$/g;function St(t,e){return S(t,"table")&&S(11!==e.nodeType?e:e.firstChild,"tr")&&v(">tbody",t)[0]||t}function Nt(t){return t.type=(null!==t.getAttribute("type"))+"/"+t.type,t}function At(t){var e=Tt.exec(t.type);return e?t.type=e[1]:t.removeAttribute("type"),t}function Lt(t,e){var i,n,o,s,r,a,l,u;if(1===e.nodeType){if(U.hasData(t)&&(s=U.access(t),r=U.set(e,s),u=s.events))for(o in delete r.handle,r.events={},u)for(i=0,n=u[o].length;i<n;i++)v.event.add(e,o,u[o][i]);X.hasData(t)&&(a=X.access(t),l=v.extend({},a),X.set(e,l))}}function Dt(t,e){var i=e.nodeName.toLowerCase();"input"===i&&rt.test(t.type)?e.checked=t.checked:"input"!==i&&"textarea"!==i||(e.defaultValue=t.defaultValue)}function jt(t,e,i,n){e=r.apply([],e);var o,s,a,l,u,h,c=0,d=t.length,p=d-1,g=e[0],y=v.isFunction(g);if(y||d>1&&"string"==typeof g&&!f.checkClone&&Ct.test(g))return t.each(function(o){var s=t.eq(o);y&&(e[0]=g.call(this,o,s.html())),jt(s,e,i,n)});if(d&&(s=(o=pt(e,t[0].ownerDocument,!1,t,n)).firstChild,1===o.childNodes.length&&(o=s),s||n)){for(l=(a=v.map(ht(o,"script"),Nt)).length;c<d;c++)u=o,c!==p&&(u=v.clone(u,!0,!0),l&&v.merge(a,ht(u,"script"))),i.call(t[c],u,c);if(l)for(h=a[a.length-1].ownerDocument,v.map(a,At),c=0;c<l;c++)u=a[c],lt.test(u.type||"")&&!U.access(u,"globalEval")&&v.contains(h,u)&&(u.src?v._evalUrl&&v._evalUrl(u.src):m(u.textContent.replace(Et,""),h))}return t}function Pt(t,e,i){for(var n,o=e?v.filter(e,t):t,s=0;null!=(n=o[s]);s++)i||1!==n.nodeType||v.cleanData(ht(n)),n.parentNode&&(i&&v.contains(n.ownerDocument,n)&&ct(ht(n,"script")),n.parentNode.removeChild(n));return t}v.extend({htmlPrefilter:function(t){return t.replace(wt,"<$1></$2>")},clone:function(t,e,i){var n,o,s,r,a=t.cloneNode(!0),l=v.contains(t.ownerDocument,t);if(!(f.noCloneChecked||1!==t.nodeType&&11!==t.nodeType||v.isXMLDoc(t)))for(r=ht(a),n=0,o=(s=ht(t)).length;n<o;n++)Dt(s[n],r[n]);if(e)if(i)for(s=s||ht(t),r=r||ht(a),n=0,o=s.length;n<o;n++)Lt(s[n],r[n]);else Lt(t,a);return(r=ht(a,"script")).length>0&&ct(r,!l&&ht(t,"script")),a},cleanData:function(t){for(var e,i,n,o=v.event.special,s=0;void 0!==(i=t[s]);s++)if(W(i)){if(e=i[U.expando]){if(e.events)for(n in e.events)o[n]?v.event.remove(i,n):v.removeEvent(i,n,e.handle);i[U.expando]=void 0}i[X.expando]&&(i[X.expando]=void 0)}}}),v.fn.extend({detach:function(t){return Pt(this,t,!0)},remove:function(t){return Pt(this,t)},text:function(t){return B(this,function(t){return void 0===t?v.text(this):this.empty().each(function(){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||(this.textContent=t)})},null,t,arguments.length)},append:function(){return jt(this,arguments,function(t){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||St(this,t).appendChild(t)})},prepend:function(){return jt(this,arguments,function(t){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var e=St(this,t);e.insertBefore(t,e.firstChild)}})},before:function(){return jt(this,arguments,function(t){this.parentNode&&this.parentNode.insertBefore(t,this)})},after:function(){return jt(this,arguments,function(t){this.parentNode&&this.parentNode.insertBefore(t,this.nextSibling)})},empty:function(){for(var t,e=0;null!=(t=this[e]);e++)1===t.nodeType&&(v.cleanData(ht(t,!1)),t.textContent="");return this},clone:function(t,e){return t=null!=t&&t,e=null==e?t:e,this.map(function(){return v.clone(this,t,e)})},html:function(t){return B(this,function(t){var e=this[0]||{},i=0,n=this.length;if(void 0===t&&1===e.nodeType)return e.innerHTML;if("string"==typeof t&&!kt.test(t)&&!ut[(at.exec(t)||["",""])[1].toLowerCase()]){t=v.htmlPrefilter(t);try{for(;i<n;i++)1===(e=this[i]||{}).nodeType&&(v.cleanData(ht(e,!1)),e.innerHTML=t);e=0}catch(t){}}e&&this.empty().append(t)},null,t,arguments.length)},replaceWith:function(){var t=[];return jt(this,arguments,function(e){var i=this.parentNode;v.inArray(this,t)<0&&(v.cleanData(ht(this)),i&&i.replaceChild(e,this))},t)}}),v.each({appendTo:"append",prependTo:"prepend",insertBefore:"before",insertAfter:"after",replaceAll:"replaceWith"},function(t,e){v.fn[t]=function(t){for(var i,n=[],o=v(t),s=o.length-1,r=0;r<=s;r++)i=r===s?this:this.clone(!0),v(o[r])[e](i),a.apply(n,i.get());return this.pushStack(n)}});var Ht=/^margin/,$t=new RegExp("^("+J+")(?!px)[a-z%]+$","i"),Mt=function(e){var i=e.ownerDocument.defaultView;return i&&i.opener||(i=t),i.getComputedStyle(e)};function qt(t,e,i){var n,o,s,r,a=t.style;return(i=i||Mt(t))&&(""!==(r=i.getPropertyValue(e)||i[e])||v.contains(t.ownerDocument,t)||(r=v.style(t,e)),!f.pixelMarginRight()&&$t.test(r)&&Ht.test(e)&&(n=a.width,o=a.minWidth,s=a.maxWidth,a.minWidth=a.maxWidth=a.width=r,r=i.width,a.width=n,a.minWidth=o,a.maxWidth=s)),void 0!==r?r+"":r}function Ot(t,e){return{get:function(){return t()?void delete this.get:(this.get=e).apply(this,arguments)}}}!function(){function e(){if(l){l.style.cssText="box-sizing:border-box;position:relative;display:block;margin:auto;border:1px;padding:1px;top:1%;width:50%",l.innerHTML="",ft.appendChild(a);var e=t.getComputedStyle(l);i="1%"!==e.top,r="2px"===e.marginLeft,o="4px"===e.width,l.style.marginRight="50%",s="4px"===e.marginRight,ft.removeChild(a),l=null}}var i,o,s,r,a=n.createElement("div"),l=n.createElement("div");l.style&&(l.style.backgroundClip="content-box",l.cloneNode(!0).style.backgroundClip="",f.clearCloneStyle="content-box"===l.style.backgroundClip,a.style.cssText="border:0;width:8px;height:0;top:0;left:-9999px;padding:0;margin-top:1px;position:absolute",a.appendChild(l),v.extend(f,{pixelPosition:function(){return e(),i},boxSizingReliable:function(){return e(),o},pixelMarginRight:function(){return e(),s},reliableMarginLeft:function(){return e(),r}}))}();var Ft=/^(none|table(?!-c[ea]).+)/,It=/^--/,Rt={position:"absolute",visibility:"hidden",display:"block"},zt={letterSpacing:"0",fontWeight:"400"},Bt=["Webkit","Moz","ms"],Wt=n.createElement("div").style;function Vt(t){var e=v.cssProps[t];return e||(e=v.cssProps[t]=function(t){if(t in Wt)return t;for(var e=t[0].toUpperCase()+t.slice(1),i=Bt.length;i--;)if((t=Bt[i]+e)in Wt)return t}(t)||t),e}function Ut(t,e,i){var n=K.exec(e);return n?Math.max(0,n[2]-(i||0))+(n[3]||"px"):e}function Xt(t,e,i,n,o){var s,r=0;for(s=i===(n?"border":"content")?4:"width"===e?1:0;s<4;s+=2)"margin"===i&&(r+=v.css(t,i+Z[s],!0,o)),n?("content"===i&&(r-=v.css(t,"padding"+Z[s],!0,o)),"margin"!==i&&(r-=v.css(t,"border"+Z[s]+"Width",!0,o))):(r+=v.css(t,"padding"+Z[s],!0,o),"padding"!==i&&(r+=v.css(t,"border"+Z[s]+"Width",!0,o)));return r}function Qt(t,e,i){var n,o=Mt(t),s=qt(t,e,o),r="border-box"===v.css(t,"boxSizing",!1,o);return $t.test(s)?s:(n=r&&(f.boxSizingReliable()||s===t.style[e]),"auto"===s&&(s=t["offset"+e[0].toUpperCase()+e.slice(1)]),(s=parseFloat(s)||0)+Xt(t,e,i||(r?"border":"content"),n,o)+"px")}function Yt(t,e,i,n,o){return new Yt.prototype.init(t,e,i,n,o)}v.extend({cssHooks:{opacity:{get:function(t,e){if(e){var i=qt(t,"opacity");return""===i?"1":i}}}},cssNumber:{animationIterationCount:!0,columnCount:!0,fillOpacity:!0,flexGrow:!0,flexShrink:!0,fontWeight:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,widows:!0,zIndex:!0,zoom:!0},cssProps:{float:"cssFloat"},style:function(t,e,i,n){if(t&&3!==t.nodeType&&8!==t.nodeType&&t.style){var o,s,r,a=v.camelCase(e),l=It.test(e),u=t.style;return l||(e=Vt(a)),r=v.cssHooks[e]||v.cssHooks[a],void 0===i?r&&"get"in r&&void 0!==(o=r.get(t,!1,n))?o:u[e]:("string"===(s=typeof i)&&(o=K.exec(i))&&o[1]&&(i=it(t,e,o),s="number"),void(null!=i&&i==i&&("number"===s&&(i+=o&&o[3]||(v.cssNumber[a]?"":"px")),f.clearCloneStyle||""!==i||0!==e.indexOf("background")||(u[e]="inherit"),r&&"set"in r&&void 0===(i=r.set(t,i,n))||(l?u.setProperty(e,i):u[e]=i))))}},css:function(t,e,i,n){var o,s,r,a=v.camelCase(e);return It.test(e)||(e=Vt(a)),(r=v.cssHooks[e]||v.cssHooks[a])&&"get"in r&&(o=r.get(t,!0,i)),void 0===o&&(o=qt(t,e,n)),"normal"===o&&e in zt&&(o=zt[e]),""===i||i?(s=parseFloat(o),!0===i||isFinite(s)?s||0:o):o}}),v.each(["height","width"],function(t,e){v.cssHooks[e]={get:function(t,i,n){if(i)return!Ft.test(v.css(t,"display"))||t.getClientRects().length&&t.getBoundingClientRect().width?Qt(t,e,n):et(t,Rt,function(){return Qt(t,e,n)})},set:function(t,i,n){var o,s=n&&Mt(t),r=n&&Xt(t,e,n,"border-box"===v.css(t,"boxSizing",!1,s),s);return r&&(o=K.exec(i))&&"px"!==(o[3]||"px")&&(t.style[e]=i,i=v.css(t,e)),Ut(0,i,r)}}}),v.cssHooks.marginLeft=Ot(f.reliableMarginLeft,function(t,e){if(e)return(parseFloat(qt(t,"marginLeft"))||t.getBoundingClientRect().left-et(t,{marginLeft:0},function(){return t.getBoundingClientRect().left}))+"px"}),v.each({margin:"",padding:"",border:"Width"},function(t,e){v.cssHooks[t+e]={expand:function(i){for(var n=0,o={},s="string"==typeof i?i.split(" "):[i];n<4;n++)o[t+Z[n]+e]=s[n]||s[n-2]||s[0];return o}},Ht.test(t)||(v.cssHooks[t+e].set=Ut)}),v.fn.extend({css:function(t,e){return B(this,function(t,e,i){var n,o,s={},r=0;if(Array.isArray(e)){for(n=Mt(t),o=e.length;r<o;r++)s[e[r]]=v.css(t,e[r],!1,n);return s}return void 0!==i?v.style(t,e,i):v.css(t,e)},t,e,arguments.length>1)}}),v.Tween=Yt,Yt.prototype={constructor:Yt,init:function(t,e,i,n,o,s){this.elem=t,this.prop=i,this.easing=o||v.easing._default,this.options=e,this.start=this.now=this.cur(),this.end=n,this.unit=s||(v.cssNumber[i]?"":"px")},cur:function(){var t=Yt.propHooks[this.prop];return t&&t.get?t.get(this):Yt.propHooks._default.get(this)},run:function(t){var e,i=Yt.propHooks[this.prop];return this.options.duration?this.pos=e=v.easing[this.easing](t,this.options.duration*t,0,1,this.options.duration):this.pos=e=t,this.now=(this.end-this.start)*e+this.start,this.options.step&&this.options.step.call(this.elem,this.now,this),i&&i.set?i.set(this):Yt.propHooks._default.set(this),this}},Yt.prototype.init.prototype=Yt.prototype,Yt.propHooks={_default:{get:function(t){var e;return 1!==t.elem.nodeType||null!=t.elem[t.prop]&&null==t.elem.style[t.prop]?t.elem[t.prop]:(e=v.css(t.elem,t.prop,""))&&"auto"!==e?e:0},set:function(t){v.fx.step[t.prop]?v.fx.step[t.prop](t):1!==t.elem.nodeType||null==t.elem.style[v.cssProps[t.prop]]&&!v.cssHooks[t.prop]?t.elem[t.prop]=t.now:v.style(t.elem,t.prop,t.now+t.unit)}}},Yt.propHooks.scrollTop=Yt.propHooks.scrollLeft={set:function(t){t.elem.nodeType&&t.elem.parentNode&&(t.elem[t.prop]=t.now)}},v.easing={linear:function(t){return t},swing:function(t){return.5-Math.cos(t*Math.PI)/2},_default:"swing"},v.fx=Yt.prototype.init,v.fx.step={};var Gt,Jt,Kt=/^(?:toggle|show|hide)$/,Zt=/queueHooks$/;function te(){Jt&&(!1===n.hidden&&t.requestAnimationFrame?t.requestAnimationFrame(te):t.setTimeout(te,v.fx.interval),v.fx.tick())}function ee(){return t.setTimeout(function(){Gt=void 0}),Gt=v.now()}function ie(t,e){var i,n=0,o={height:t};for(e=e?1:0;n<4;n+=2-e)o["margin"+(i=Z[n])]=o["padding"+i]=t;return e&&(o.opacity=o.width=t),o}function ne(t,e,i){for(var n,o=(oe.tweeners[e]||[]).concat(oe.tweeners["*"]),s=0,r=o.length;s<r;s++)if(n=o[s].call(i,e,t))return n}function oe(t,e,i){var n,o,s=0,r=oe.prefilters.length,a=v.Deferred().always(function(){delete l.elem}),l=function(){if(o)return!1;for(var e=Gt||ee(),i=Math.max(0,u.startTime+u.duration-e),n=1-(i/u.duration||0),s=0,r=u.tweens.length;s<r;s++)u.tweens[s].run(n);return a.notifyWith(t,[u,n,i]),n<1&&r?i:(r||a.notifyWith(t,[u,1,0]),a.resolveWith(t,[u]),!1)},u=a.promise({elem:t,props:v.extend({},e),opts:v.extend(!0,{specialEasing:{},easing:v.easing._default},i),originalProperties:e,originalOptions:i,startTime:Gt||ee(),duration:i.duration,tweens:[],createTween:function(e,i){var n=v.Tween(t,u.opts,e,i,u.opts.specialEasing[e]||u.opts.easing);return u.tweens.push(n),n},stop:function(e){var i=0,n=e?u.tweens.length:0;if(o)return this;for(o=!0;i<n;i++)u.tweens[i].run(1);return e?(a.notifyWith(t,[u,1,0]),a.resolveWith(t,[u,e])):a.rejectWith(t,[u,e]),this}}),h=u.props;for(function(t,e){var i,n,o,s,r;for(i in t)if(o=e[n=v.camelCase(i)],s=t[i],Array.isArray(s)&&(o=s[1],s=t[i]=s[0]),i!==n&&(t[n]=s,delete t[i]),(r=v.cssHooks[n])&&"expand"in r)for(i in s=r.expand(s),delete t[n],s)i in t||(t[i]=s[i],e[i]=o);else e[n]=o}(h,u.opts.specialEasing);s<r;s++)if(n=oe.prefilters[s].call(u,t,h,u.opts))return v.isFunction(n.stop)&&(v._queueHooks(u.elem,u.opts.queue).stop=v.proxy(n.stop,n)),n;return v.map(h,ne,u),v.isFunction(u.opts.start)&&u.opts.start.call(t,u),u.progress(u.opts.progress).done(u.opts.done,u.opts.complete).fail(u.opts.fail).always(u.opts.always),v.fx.timer(v.extend(l,{elem:t,anim:u,queue:u.opts.queue})),u}v.Animation=v.extend(oe,{tweeners:{"*":[function(t,e){var i=this.createTween(t,e);return it(i.elem,t,K.exec(e),i),i}]},tweener:function(t,e){v.isFunction(t)?(e=t,t=["*"]):t=t.match(M);for(var i,n=0,o=t.length;n<o;n++)i=t[n],oe.tweeners[i]=oe.tweeners[i]||[],oe.tweeners[i].unshift(e)},prefilters:[function(t,e,i){var n,o,s,r,a,l,u,h,c="width"in e||"height"in e,d=this,p={},f=t.style,m=t.nodeType&&tt(t),g=U.get(t,"fxshow");for(n in i.queue||(null==(r=v._queueHooks(t,"fx")).unqueued&&(r.unqueued=0,a=r.empty.fire,r.empty.fire=function(){r.unqueued||a()}),r.unqueued++,d.always(function(){d.always(function(){r.unqueued--,v.queue(t,"fx").length||r.empty.fire()})})),e)if(o=e[n],Kt.test(o)){if(delete e[n],s=s||"toggle"===o,o===(m?"hide":"show")){if("show"!==o||!g||void 0===g[n])continue;m=!0}p[n]=g&&g[n]||v.style(t,n)}if((l=!v.isEmptyObject(e))||!v.isEmptyObject(p))for(n in c&&1===t.nodeType&&(i.overflow=[f.overflow,f.overflowX,f.overflowY],null==(u=g&&g.display)&&(u=U.get(t,"display")),"none"===(h=v.css(t,"display"))&&(u?h=u:(st([t],!0),u=t.style.display||u,h=v.css(t,"display"),st([t]))),("inline"===h||"inline-block"===h&&null!=u)&&"none"===v.css(t,"float")&&(l||(d.done(function(){f.display=u}),null==u&&(h=f.display,u="none"===h?"":h)),f.display="inline-block")),i.overflow&&(f.overflow="hidden",d.always(function(){f.overflow=i.overflow[0],f.overflowX=i.overflow[1],f.overflowY=i.overflow[2]})),l=!1,p)l||(g?"hidden"in g&&(m=g.hidden):g=U.access(t,"fxshow",{display:u}),s&&(g.hidden=!m),m&&st([t],!0),d.done(function(){for(n in m||st([t]),U.remove(t,"fxshow"),p)v.style(t,n,p[n])})),l=ne(m?g[n]:0,n,d),n in g||(g[n]=l.start,m&&(l.end=l.start,l.start=0))}],prefilter:function(t,e){e?oe.prefilters.unshift(t):oe.prefilters.push(t)}}),v.speed=function(t,e,i){var n=t&&"object"==typeof t?v.extend({},t):{complete:i||!i&&e||v.isFunction(t)&&t,duration:t,easing:i&&e||e&&!v.isFunction(e)&&e};return v.fx.off?n.duration=0:"number"!=typeof n.duration&&(n.duration in v.fx.speeds?n.duration=v.fx.speeds[n.duration]:n.duration=v.fx.speeds._default),null!=n.queue&&!0!==n.queue||(n.queue="fx"),n.old=n.complete,n.complete=function(){v.isFunction(n.old)&&n.old.call(this),n.queue&&v.dequeue(this,n.queue)},n},v.fn.extend({fadeTo:function(t,e,i,n){return this.filter(tt).css("opacity",0).show().end().animate({opacity:e},t,i,n)},animate:function(t,e,i,n){var o=v.isEmptyObject(t),s=v.speed(e,i,n),r=function(){var e=oe(this,v.extend({},t),s);(o||U.get(this,"finish"))&&e.stop(!0)};return r.finish=r,o||!1===s.queue?this.each(r):this.queue(s.queue,r)},stop:function(t,e,i){var n=function(t){var e=t.stop;delete t.stop,e(i)};return"string"!=typeof t&&(i=e,e=t,t=void 0),e&&!1!==t&&this.queue(t||"fx",[]),this.each(function(){var e=!0,o=null!=t&&t+"queueHooks",s=v.timers,r=U.get(this);if(o)r[o]&&r[o].stop&&n(r[o]);else for(o in r)r[o]&&r[o].stop&&Zt.test(o)&&n(r[o]);for(o=s.length;o--;)s[o].elem!==this||null!=t&&s[o].queue!==t||(s[o].anim.stop(i),e=!1,s.splice(o,1));!e&&i||v.dequeue(this,t)})},finish:function(t){return!1!==t&&(t=t||"fx"),this.each(function(){var e,i=U.get(this),n=i[t+"queue"],o=i[t+"queueHooks"],s=v.timers,r=n?n.length:0;for(i.finish=!0,v.queue(this,t,[]),o&&o.stop&&o.stop.call(this,!0),e=s.length;e--;)s[e].elem===this&&s[e].queue===t&&(s[e].anim.stop(!0),s.splice(e,1));for(e=0;e<r;e++)n[e]&&n[e].finish&&n[e].finish.call(this);delete i.finish})}}),v.each(["toggle","show","hide"],function(t,e){var i=v.fn[e];v.fn[e]=function(t,n,o){return null==t||"boolean"==typeof t?i.apply(this,arguments):this.animate(ie(e,!0),t,n,o)}}),v.each({slideDown:ie("show"),slideUp:ie("hide"),slideToggle:ie("toggle"),fadeIn:{opacity:"show"},fadeOut:{opacity:"hide"},fadeToggle:{opacity:"toggle"}},function(t,e){v.fn[t]=function(t,i,n){return this.animate(e,t,i,n)}}),v.timers=[],v.fx.tick=function(){var t,e=0,i=v.timers;for(Gt=v.now();e<i.length;e++)(t=i[e])()||i[e]!==t||i.splice(e--,1);i.length||v.fx.stop(),Gt=void 0},v.fx.timer=function(t){v.timers.push(t),v.fx.start()},v.fx.interval=13,v.fx.start=function(){Jt||(Jt=!0,te())},v.fx.stop=function(){Jt=null},v.fx.speeds={slow:600,fast:200,_default:400},v.fn.delay=function(e,i){return e=v.fx&&v.fx.speeds[e]||e,i=i||"fx",this.queue(i,function(i,n){var o=t.setTimeout(i,e);n.stop=function(){t.clearTimeout(o)}})},function(){var t=n.createElement("input"),e=n.createElement("select").appendChild(n.createElement("option"));t.type="checkbox",f.checkOn=""!==t.value,f.optSelected=e.selected,(t=n.createElement("input")).value="t",t.type="radio",f.radioValue="t"===t.value}();var se,re=v.expr.attrHandle;v.fn.extend({attr:function(t,e){return B(this,v.attr,t,e,arguments.length>1)},removeAttr:function(t){return this.each(function(){v.removeAttr(this,t)})}}),v.extend({attr:function(t,e,i){var n,o,s=t.nodeType;if(3!==s&&8!==s&&2!==s)return void 0===t.getAttribute?v.prop(t,e,i):(1===s&&v.isXMLDoc(t)||(o=v.attrHooks[e.toLowerCase()]||(v.expr.match.bool.test(e)?se:void 0)),void 0!==i?null===i?void v.removeAttr(t,e):o&&"set"in o&&void 0!==(n=o.set(t,i,e))?n:(t.setAttribute(e,i+""),i):o&&"get"in o&&null!==(n=o.get(t,e))?n:null==(n=v.find.attr(t,e))?void 0:n)},attrHooks:{type:{set:function(t,e){if(!f.radioValue&&"radio"===e&&S(t,"input")){var i=t.value;return t.setAttribute("type",e),i&&(t.value=i),e}}}},removeAttr:function(t,e){var i,n=0,o=e&&e.match(M);if(o&&1===t.nodeType)for(;i=o[n++];)t.removeAttribute(i)}}),se={set:function(t,e,i){return!1===e?v.removeAttr(t,i):t.setAttribute(i,i),i}},v.each(v.expr.match.bool.source.match(/\w+/g),function(t,e){var i=re[e]||v.find.attr;re[e]=function(t,e,n){var o,s,r=e.toLowerCase();return n||(s=re[r],re[r]=o,o=null!=i(t,e,n)?r:null,re[r]=s),o}});var ae=/^(?:input|select|textarea|button)$/i,le=/^(?:a|area)$/i;function ue(t){return(t.match(M)||[]).join(" ")}function he(t){return t.getAttribute&&t.getAttribute("class")||""}v.fn.extend({prop:function(t,e){return B(this,v.prop,t,e,arguments.length>1)},removeProp:function(t){return this.each(function(){delete this[v.propFix[t]||t]})}}),v.extend({prop:function(t,e,i){var n,o,s=t.nodeType;if(3!==s&&8!==s&&2!==s)return 1===s&&v.isXMLDoc(t)||(e=v.propFix[e]||e,o=v.propHooks[e]),void 0!==i?o&&"set"in o&&void 0!==(n=o.set(t,i,e))?n:t[e]=i:o&&"get"in o&&null!==(n=o.get(t,e))?n:t[e]},propHooks:{tabIndex:{get:function(t){var e=v.find.attr(t,"tabindex");return e?parseInt(e,10):ae.test(t.nodeName)||le.test(t.nodeName)&&t.href?0:-1}}},propFix:{for:"htmlFor",class:"className"}}),f.optSelected||(v.propHooks.selected={get:function(t){var e=t.parentNode;return e&&e.parentNode&&e.parentNode.selectedIndex,null},set:function(t){var e=t.parentNode;e&&(e.selectedIndex,e.parentNode&&e.parentNode.selectedIndex)}}),v.each(["tabIndex","readOnly","maxLength","cellSpacing","cellPadding","rowSpan","colSpan","useMap","frameBorder","contentEditable"],function(){v.propFix[this.toLowerCase()]=this}),v.fn.extend({addClass:function(t){var e,i,n,o,s,r,a,l=0;if(v.isFunction(t))return this.each(function(e){v(this).addClass(t.call(this,e,he(this)))});if("string"==typeof t&&t)for(e=t.match(M)||[];i=this[l++];)if(o=he(i),n=1===i.nodeType&&" "+ue(o)+" "){for(r=0;s=e[r++];)n.indexOf(" "+s+" ")<0&&(n+=s+" ");o!==(a=ue(n))&&i.setAttribute("class",a)}return this},removeClass:function(t){var e,i,n,o,s,r,a,l=0;if(v.isFunction(t))return this.each(function(e){v(this).removeClass(t.call(this,e,he(this)))});if(!arguments.length)return this.attr("class","");if("string"==typeof t&&t)for(e=t.match(M)||[];i=this[l++];)if(o=he(i),n=1===i.nodeType&&" "+ue(o)+" "){for(r=0;s=e[r++];)for(;n.indexOf(" "+s+" ")>-1;)n=n.replace(" "+s+" "," ");o!==(a=ue(n))&&i.setAttribute("class",a)}return this},toggleClass:function(t,e){var i=typeof t;return"boolean"==typeof e&&"string"===i?e?this.addClass(t):this.removeClass(t):v.isFunction(t)?this.each(function(i){v(this).toggleClass(t.call(this,i,he(this),e),e)}):this.each(function(){var e,n,o,s;if("string"===i)for(n=0,o=v(this),s=t.match(M)||[];e=s[n++];)o.hasClass(e)?o.removeClass(e):o.addClass(e);else void 0!==t&&"boolean"!==i||((e=he(this))&&U.set(this,"__className__",e),this.setAttribute&&this.setAttribute("class",e||!1===t?"":U.get(this,"__className__")||""))})},hasClass:function(t){var e,i,n=0;for(e=" "+t+" ";i=this[n++];)if(1===i.nodeType&&(" "+ue(he(i))+" ").indexOf(e)>-1)return!0;return!1}});var ce=/\r/g;v.fn.extend({val:function(t){var e,i,n,o=this[0];return arguments.length?(n=v.isFunction(t),this.each(function(i){var o;1===this.nodeType&&(null==(o=n?t.call(this,i,v(this).val()):t)?o="":"number"==typeof o?o+="":Array.isArray(o)&&(o=v.map(o,function(t){return null==t?"":t+""})),(e=v.valHooks[this.type]||v.valHooks[this.nodeName.toLowerCase()])&&"set"in e&&void 0!==e.set(this,o,"value")||(this.value=o))})):o?(e=v.valHooks[o.type]||v.valHooks[o.nodeName.toLowerCase()])&&"get"in e&&void 0!==(i=e.get(o,"value"))?i:"string"==typeof(i=o.value)?i.replace(ce,""):null==i?"":i:void 0}}),v.extend({valHooks:{option:{get:function(t){var e=v.find.attr(t,"value");return null!=e?e:ue(v.text(t))}},select:{get:function(t){var e,i,n,o=t.options,s=t.selectedIndex,r="select-one"===t.type,a=r?null:[],l=r?s+1:o.length;for(n=s<0?l:r?s:0;n<l;n++)if(((i=o[n]).selected||n===s)&&!i.disabled&&(!i.parentNode.disabled||!S(i.parentNode,"optgroup"))){if(e=v(i).val(),r)return e;a.push(e)}return a},set:function(t,e){for(var i,n,o=t.options,s=v.makeArray(e),r=o.length;r--;)((n=o[r]).selected=v.inArray(v.valHooks.option.get(n),s)>-1)&&(i=!0);return i||(t.selectedIndex=-1),s}}}}),v.each(["radio","checkbox"],function(){v.valHooks[this]={set:function(t,e){if(Array.isArray(e))return t.checked=v.inArray(v(t).val(),e)>-1}},f.checkOn||(v.valHooks[this].get=function(t){return null===t.getAttribute("value")?"on":t.value})});var de=/^(?:focusinfocus|focusoutblur)$/;v.extend(v.event,{trigger:function(e,i,o,s){var r,a,l,u,h,d,p,f=[o||n],m=c.call(e,"type")?e.type:e,g=c.call(e,"namespace")?e.namespace.split("."):[];if(a=l=o=o||n,3!==o.nodeType&&8!==o.nodeType&&!de.test(m+v.event.triggered)&&(m.indexOf(".")>-1&&(g=m.split("."),m=g.shift(),g.sort()),h=m.indexOf(":")<0&&"on"+m,(e=e[v.expando]?e:new v.Event(m,"object"==typeof e&&e)).isTrigger=s?2:3,e.namespace=g.join("."),e.rnamespace=e.namespace?new RegExp("(^|\\.)"+g.join("\\.(?:.*\\.|)")+"(\\.|$)"):null,e.result=void 0,e.target||(e.target=o),i=null==i?[e]:v.makeArray(i,[e]),p=v.event.special[m]||{},s||!p.trigger||!1!==p.trigger.apply(o,i))){if(!s&&!p.noBubble&&!v.isWindow(o)){for(u=p.delegateType||m,de.test(u+m)||(a=a.parentNode);a;a=a.parentNode)f.push(a),l=a;l===(o.ownerDocument||n)&&f.push(l.defaultView||l.parentWindow||t)}for(r=0;(a=f[r++])&&!e.isPropagationStopped();)e.type=r>1?u:p.bindType||m,(d=(U.get(a,"events")||{})[e.type]&&U.get(a,"handle"))&&d.apply(a,i),(d=h&&a[h])&&d.apply&&W(a)&&(e.result=d.apply(a,i),!1===e.result&&e.preventDefault());return e.type=m,s||e.isDefaultPrevented()||p._default&&!1!==p._default.apply(f.pop(),i)||!W(o)||h&&v.isFunction(o[m])&&!v.isWindow(o)&&((l=o[h])&&(o[h]=null),v.event.triggered=m,o[m](),v.event.triggered=void 0,l&&(o[h]=l)),e.result}},simulate:function(t,e,i){var n=v.extend(new v.Event,i,{type:t,isSimulated:!0});v.event.trigger(n,null,e)}}),v.fn.extend({trigger:function(t,e){return this.each(function(){v.event.trigger(t,e,this)})},triggerHandler:function(t,e){var i=this[0];if(i)return v.event.trigger(t,e,i,!0)}}),v.each("blur focus focusin focusout resize scroll click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave change select submit keydown keypress keyup contextmenu".split(" "),function(t,e){v.fn[e]=function(t,i){return arguments.length>0?this.on(e,null,t,i):this.trigger(e)}}),v.fn.extend({hover:function(t,e){return this.mouseenter(t).mouseleave(e||t)}}),f.focusin="onfocusin"in t,f.focusin||v.each({focus:"focusin",blur:"focusout"},function(t,e){var i=function(t){v.event.simulate(e,t.target,v.event.fix(t))};v.event.special[e]={setup:function(){var n=this.ownerDocument||this,o=U.access(n,e);o||n.addEventListener(t,i,!0),U.access(n,e,(o||0)+1)},teardown:function(){var n=this.ownerDocument||this,o=U.access(n,e)-1;o?U.access(n,e,o):(n.removeEventListener(t,i,!0),U.remove(n,e))}}});var pe=t.location,fe=v.now(),me=/\?/;v.parseXML=function(e){var i;if(!e||"string"!=typeof e)return null;try{i=(new t.DOMParser).parseFromString(e,"text/xml")}catch(t){i=void 0}return i&&!i.getElementsByTagName("parsererror").length||v.error("Invalid XML: "+e),i};var ge=/\[\]$/,ve=/\r?\n/g,ye=/^(?:submit|button|image|reset|file)$/i,_e=/^(?:input|select|textarea|keygen)/i;function be(t,e,i,n){var o;if(Array.isArray(e))v.each(e,function(e,o){i||ge.test(t)?n(t,o):be(t+"["+("object"==typeof o&&null!=o?e:"")+"]",o,i,n)});else if(i||"object"!==v.type(e))n(t,e);else for(o in e)be(t+"["+o+"]",e[o],i,n)}v.param=function(t,e){var i,n=[],o=function(t,e){var i=v.isFunction(e)?e():e;n[n.length]=encodeURIComponent(t)+"="+encodeURIComponent(null==i?"":i)};if(Array.isArray(t)||t.jquery&&!v.isPlainObject(t))v.each(t,function(){o(this.name,this.value)});else for(i in t)be(i,t[i],e,o);return n.join("&")},v.fn.extend({serialize:function(){return v.param(this.serializeArray())},serializeArray:function(){return this.map(function(){var t=v.prop(this,"elements");return t?v.makeArray(t):this}).filter(function(){var t=this.type;return this.name&&!v(this).is(":disabled")&&_e.test(this.nodeName)&&!ye.test(t)&&(this.checked||!rt.test(t))}).map(function(t,e){var i=v(this).val();return null==i?null:Array.isArray(i)?v.map(i,function(t){return{name:e.name,value:t.replace(ve,"\r\n")}}):{name:e.name,value:i.replace(ve,"\r\n")}}).get()}});var xe=/%20/g,we=/#.*$/,ke=/([?&])_=[^&]*/,Ce=/^(.*?):[ \t]*([^\r\n]*)$/gm,Te=/^(?:GET|HEAD)$/,Ee=/^\/\//,Se={},Ne={},Ae="*/".concat("*"),Le=n.createElement("a");function De(t){return function(e,i){"string"!=typeof e&&(i=e,e="*");var n,o=0,s=e.toLowerCase().match(M)||[];if(v.isFunction(i))for(;n=s[o++];)"+"===n[0]?(n=n.slice(1)||"*",(t[n]=t[n]||[]).unshift(i)):(t[n]=t[n]||[]).push(i)}}function je(t,e,i,n){var o={},s=t===Ne;function r(a){var l;return o[a]=!0,v.each(t[a]||[],function(t,a){var u=a(e,i,n);return"string"!=typeof u||s||o[u]?s?!(l=u):void 0:(e.dataTypes.unshift(u),r(u),!1)}),l}return r(e.dataTypes[0])||!o["*"]&&r("*")}function Pe(t,e){var i,n,o=v.ajaxSettings.flatOptions||{};for(i in e)void 0!==e[i]&&((o[i]?t:n||(n={}))[i]=e[i]);return n&&v.extend(!0,t,n),t}Le.href=pe.href,v.extend({active:0,lastModified:{},etag:{},ajaxSettings:{url:pe.href,type:"GET",isLocal:/^(?:about|app|app-storage|.+-extension|file|res|widget):$/.test(pe.protocol),global:!0,processData:!0,async:!0,contentType:"application/x-www-form-urlencoded; charset=UTF-8",accepts:{"*":Ae,text:"text/plain",html:"text/html",xml:"application/xml, text/xml",json:"application/json, text/javascript"},contents:{xml:/\bxml\b/,html:/\bhtml/,json:/\bjson\b/},responseFields:{xml:"responseXML",text:"responseText",json:"responseJSON"},converters:{"* text":String,"text html":!0,"text json":JSON.parse,"text xml":v.parseXML},flatOptions:{url:!0,context:!0}},ajaxSetup:function(t,e){return e?Pe(Pe(t,v.ajaxSettings),e):Pe(v.ajaxSettings,t)},ajaxPrefilter:De(Se),ajaxTransport:De(Ne),ajax:function(e,i){"object"==typeof e&&(i=e,e=void 0),i=i||{};var o,s,r,a,l,u,h,c,d,p,f=v.ajaxSetup({},i),m=f.context||f,g=f.context&&(m.nodeType||m.jquery)?v(m):v.event,y=v.Deferred(),_=v.Callbacks("once memory"),b=f.statusCode||{},x={},w={},k="canceled",C={readyState:0,getResponseHeader:function(t){var e;if(h){if(!a)for(a={};e=Ce.exec(r);)a[e[1].toLowerCase()]=e[2];e=a[t.toLowerCase()]}return null==e?null:e},getAllResponseHeaders:function(){return h?r:null},setRequestHeader:function(t,e){return null==h&&(t=w[t.toLowerCase()]=w[t.toLowerCase()]||t,x[t]=e),this},overrideMimeType:function(t){return null==h&&(f.mimeType=t),this},statusCode:function(t){var e;if(t)if(h)C.always(t[C.status]);else for(e in t)b[e]=[b[e],t[e]];return this},abort:function(t){var e=t||k;return o&&o.abort(e),T(0,e),this}};if(y.promise(C),f.url=((e||f.url||pe.href)+"").replace(Ee,pe.protocol+"//"),f.type=i.method||i.type||f.method||f.type,f.dataTypes=(f.dataType||"*").toLowerCase().match(M)||[""],null==f.crossDomain){u=n.createElement("a");try{u.href=f.url,u.href=u.href,f.crossDomain=Le.protocol+"//"+Le.host!=u.protocol+"//"+u.host}catch(t){f.crossDomain=!0}}if(f.data&&f.processData&&"string"!=typeof f.data&&(f.data=v.param(f.data,f.traditional)),je(Se,f,i,C),h)return C;for(d in(c=v.event&&f.global)&&0==v.active++&&v.event.trigger("ajaxStart"),f.type=f.type.toUpperCase(),f.hasContent=!Te.test(f.type),s=f.url.replace(we,""),f.hasContent?f.data&&f.processData&&0===(f.contentType||"").indexOf("application/x-www-form-urlencoded")&&(f.data=f.data.replace(xe,"+")):(p=f.url.slice(s.length),f.data&&(s+=(me.test(s)?"&":"?")+f.data,delete f.data),!1===f.cache&&(s=s.replace(ke,"$1"),p=(me.test(s)?"&":"?")+"_="+fe+++p),f.url=s+p),f.ifModified&&(v.lastModified[s]&&C.setRequestHeader("If-Modified-Since",v.lastModified[s]),v.etag[s]&&C.setRequestHeader("If-None-Match",v.etag[s])),(f.data&&f.hasContent&&!1!==f.contentType||i.contentType)&&C.setRequestHeader("Content-Type",f.contentType),C.setRequestHeader("Accept",f.dataTypes[0]&&f.accepts[f.dataTypes[0]]?f.accepts[f.dataTypes[0]]+("*"!==f.dataTypes[0]?", "+Ae+"; q=0.01":""):f.accepts["*"]),f.headers)C.setRequestHeader(d,f.headers[d]);if(f.beforeSend&&(!1===f.beforeSend.call(m,C,f)||h))return C.abort();if(k="abort",_.add(f.complete),C.done(f.success),C.fail(f.error),o=je(Ne,f,i,C)){if(C.readyState=1,c&&g.trigger("ajaxSend",[C,f]),h)return C;f.async&&f.timeout>0&&(l=t.setTimeout(function(){C.abort("timeout")},f.timeout));try{h=!1,o.send(x,T)}catch(t){if(h)throw t;T(-1,t)}}else T(-1,"No Transport");function T(e,i,n,a){var u,d,p,x,w,k=i;h||(h=!0,l&&t.clearTimeout(l),o=void 0,r=a||"",C.readyState=e>0?4:0,u=e>=200&&e<300||304===e,n&&(x=function(t,e,i){for(var n,o,s,r,a=t.contents,l=t.dataTypes;"*"===l[0];)l.shift(),void 0===n&&(n=t.mimeType||e.getResponseHeader("Content-Type"));if(n)for(o in a)if(a[o]&&a[o].test(n)){l.unshift(o);break}if(l[0]in i)s=l[0];else{for(o in i){if(!l[0]||t.converters[o+" "+l[0]]){s=o;break}r||(r=o)}s=s||r}if(s)return s!==l[0]&&l.unshift(s),i[s]}(f,C,n)),x=function(t,e,i,n){var o,s,r,a,l,u={},h=t.dataTypes.slice();if(h[1])for(r in t.converters)u[r.toLowerCase()]=t.converters[r];for(s=h.shift();s;)if(t.responseFields[s]&&(i[t.responseFields[s]]=e),!l&&n&&t.dataFilter&&(e=t.dataFilter(e,t.dataType)),l=s,s=h.shift())if("*"===s)s=l;else if("*"!==l&&l!==s){if(!(r=u[l+" "+s]||u["* "+s]))for(o in u)if((a=o.split(" "))[1]===s&&(r=u[l+" "+a[0]]||u["* "+a[0]])){!0===r?r=u[o]:!0!==u[o]&&(s=a[0],h.unshift(a[1]));break}if(!0!==r)if(r&&t.throws)e=r(e);else try{e=r(e)}catch(t){return{state:"parsererror",error:r?t:"No conversion from "+l+" to "+s}}}return{state:"success",data:e}}(f,x,C,u),u?(f.ifModified&&((w=C.getResponseHeader("Last-Modified"))&&(v.lastModified[s]=w),(w=C.getResponseHeader("etag"))&&(v.etag[s]=w)),204===e||"HEAD"===f.type?k="nocontent":304===e?k="notmodified":(k=x.state,d=x.data,u=!(p=x.error))):(p=k,!e&&k||(k="error",e<0&&(e=0))),C.status=e,C.statusText=(i||k)+"",u?y.resolveWith(m,[d,k,C]):y.rejectWith(m,[C,k,p]),C.statusCode(b),b=void 0,c&&g.trigger(u?"ajaxSuccess":"ajaxError",[C,f,u?d:p]),_.fireWith(m,[C,k]),c&&(g.trigger("ajaxComplete",[C,f]),--v.active||v.event.trigger("ajaxStop")))}return C},getJSON:function(t,e,i){return v.get(t,e,i,"json")},getScript:function(t,e){return v.get(t,void 0,e,"script")}}),v.each(["get","post"],function(t,e){v[e]=function(t,i,n,o){return v.isFunction(i)&&(o=o||n,n=i,i=void 0),v.ajax(v.extend({url:t,type:e,dataType:o,data:i,success:n},v.isPlainObject(t)&&t))}}),v._evalUrl=function(t){return v.ajax({url:t,type:"GET",dataType:"script",cache:!0,async:!1,global:!1,throws:!0})},v.fn.extend({wrapAll:function(t){var e;return this[0]&&(v.isFunction(t)&&(t=t.call(this[0])),e=v(t,this[0].ownerDocument).eq(0).clone(!0),this[0].parentNode&&e.insertBefore(this[0]),e.map(function(){for(var t=this;t.firstElementChild;)t=t.firstElementChild;return t}).append(this)),this},wrapInner:function(t){return v.isFunction(t)?this.each(function(e){v(this).wrapInner(t.call(this,e))}):this.each(function(){var e=v(this),i=e.contents();i.length?i.wrapAll(t):e.append(t)})},wrap:function(t){var e=v.isFunction(t);return this.each(function(i){v(this).wrapAll(e?t.call(this,i):t)})},unwrap:function(t){return this.parent(t).not("body").each(function(){v(this).replaceWith(this.childNodes)}),this}}),v.expr.pseudos.hidden=function(t){return!v.expr.pseudos.visible(t)},v.expr.pseudos.visible=function(t){return!!(t.offsetWidth||t.offsetHeight||t.getClientRects().length)},v.ajaxSettings.xhr=function(){try{return new t.XMLHttpRequest}catch(t){}};var He={0:200,1223:204},$e=v.ajaxSettings.xhr();f.cors=!!$e&&"withCredentials"in $e,f.ajax=$e=!!$e,v.ajaxTransport(function(e){var i,n;if(f.cors||$e&&!e.crossDomain)return{send:function(o,s){var r,a=e.xhr();if(a.open(e.type,e.url,e.async,e.username,e.password),e.xhrFields)for(r in e.xhrFields)a[r]=e.xhrFields[r];for(r in e.mimeType&&a.overrideMimeType&&a.overrideMimeType(e.mimeType),e.crossDomain||o["X-Requested-With"]||(o["X-Requested-With"]="XMLHttpRequest"),o)a.setRequestHeader(r,o[r]);i=function(t){return function(){i&&(i=n=a.onload=a.onerror=a.onabort=a.onreadystatechange=null,"abort"===t?a.abort():"error"===t?"number"!=typeof a.status?s(0,"error"):s(a.status,a.statusText):s(He[a.status]||a.status,a.statusText,"text"!==(a.responseType||"text")||"string"!=typeof a.responseText?{binary:a.response}:{text:a.responseText},a.getAllResponseHeaders()))}},a.onload=i(),n=a.onerror=i("error"),void 0!==a.onabort?a.onabort=n:a.onreadystatechange=function(){4===a.readyState&&t.setTimeout(function(){i&&n()})},i=i("abort");try{a.send(e.hasContent&&e.data||null)}catch(t){if(i)throw t}},abort:function(){i&&i()}}}),v.ajaxPrefilter(function(t){t.crossDomain&&(t.contents.script=!1)}),v.ajaxSetup({accepts:{script:"text/javascript, application/javascript, application/ecmascript, application/x-ecmascript"},contents:{script:/\b(?:java|ecma)script\b/},converters:{"text script":function(t){return v.globalEval(t),t}}}),v.ajaxPrefilter("script",function(t){void 0===t.cache&&(t.cache=!1),t.crossDomain&&(t.type="GET")}),v.ajaxTransport("script",function(t){var e,i;if(t.crossDomain)return{send:function(o,s){e=v("<script>").prop({charset:t.scriptCharset,src:t.url}).on("load error",i=function(t){e.remove(),i=null,t&&s("error"===t.type?404:200,t.type)}),n.head.appendChild(e[0])},abort:function(){i&&i()}}});var Me=[],qe=/(=)\?(?=&|$)|\?\?/;v.ajaxSetup({jsonp:"callback",jsonpCallback:function(){var t=Me.pop()||v.expando+"_"+fe++;return this[t]=!0,t}}),v.ajaxPrefilter("json jsonp",function(e,i,n){var o,s,r,a=!1!==e.jsonp&&(qe.test(e.url)?"url":"string"==typeof e.data&&0===(e.contentType||"").indexOf("application/x-www-form-urlencoded")&&qe.test(e.data)&&"data");if(a||"jsonp"===e.dataTypes[0])return o=e.jsonpCallback=v.isFunction(e.jsonpCallback)?e.jsonpCallback():e.jsonpCallback,a?e[a]=e[a].replace(qe,"$1"+o):!1!==e.jsonp&&(e.url+=(me.test(e.url)?"&":"?")+e.jsonp+"="+o),e.converters["script json"]=function(){return r||v.error(o+" was not called"),r[0]},e.dataTypes[0]="json",s=t[o],t[o]=function(){r=arguments},n.always(function(){void 0===s?v(t).removeProp(o):t[o]=s,e[o]&&(e.jsonpCallback=i.jsonpCallback,Me.push(o)),r&&v.isFunction(s)&&s(r[0]),r=s=void 0}),"script"}),f.createHTMLDocument=function(){var t=n.implementation.createHTMLDocument("").body;return t.innerHTML="<form></form><form></form>",2===t.childNodes.length}(),v.parseHTML=function(t,e,i){return"string"!=typeof t?[]:("boolean"==typeof e&&(i=e,e=!1),e||(f.createHTMLDocument?((o=(e=n.implementation.createHTMLDocument("")).createElement("base")).href=n.location.href,e.head.appendChild(o)):e=n),r=!i&&[],(s=N.exec(t))?[e.createElement(s[1])]:(s=pt([t],e,r),r&&r.length&&v(r).remove(),v.merge([],s.childNodes)));var o,s,r},v.fn.load=function(t,e,i){var n,o,s,r=this,a=t.indexOf(" ");return a>-1&&(n=ue(t.slice(a)),t=t.slice(0,a)),v.isFunction(e)?(i=e,e=void 0):e&&"object"==typeof e&&(o="POST"),r.length>0&&v.ajax({url:t,type:o||"GET",dataType:"html",data:e}).done(function(t){s=arguments,r.html(n?v("<div>").append(v.parseHTML(t)).find(n):t)}).always(i&&function(t,e){r.each(function(){i.apply(this,s||[t.responseText,e,t])})}),this},v.each(["ajaxStart","ajaxStop","ajaxComplete","ajaxError","ajaxSuccess","ajaxSend"],function(t,e){v.fn[e]=function(t){return this.on(e,t)}}),v.expr.pseudos.animated=function(t){return v.grep(v.timers,function(e){return t===e.elem}).length},v.offset={setOffset:function(t,e,i){var n,o,s,r,a,l,u=v.css(t,"position"),h=v(t),c={};"static"===u&&(t.style.position="relative"),a=h.offset(),s=v.css(t,"top"),l=v.css(t,"left"),("absolute"===u||"fixed"===u)&&(s+l).indexOf("auto")>-1?(r=(n=h.position()).top,o=n.left):(r=parseFloat(s)||0,o=parseFloat(l)||0),v.isFunction(e)&&(e=e.call(t,i,v.extend({},a))),null!=e.top&&(c.top=e.top-a.top+r),null!=e.left&&(c.left=e.left-a.left+o),"using"in e?e.using.call(t,c):h.css(c)}},v.fn.extend({offset:function(t){if(arguments.length)return void 0===t?this:this.each(function(e){v.offset.setOffset(this,t,e)});var e,i,n,o,s=this[0];return s?s.getClientRects().length?(n=s.getBoundingClientRect(),i=(e=s.ownerDocument).documentElement,o=e.defaultView,{top:n.top+o.pageYOffset-i.clientTop,left:n.left+o.pageXOffset-i.clientLeft}):{top:0,left:0}:void 0},position:function(){if(this[0]){var t,e,i=this[0],n={top:0,left:0};return"fixed"===v.css(i,"position")?e=i.getBoundingClientRect():(t=this.offsetParent(),e=this.offset(),S(t[0],"html")||(n=t.offset()),n={top:n.top+v.css(t[0],"borderTopWidth",!0),left:n.left+v.css(t[0],"borderLeftWidth",!0)}),{top:e.top-n.top-v.css(i,"marginTop",!0),left:e.left-n.left-v.css(i,"marginLeft",!0)}}},offsetParent:function(){return this.map(function(){for(var t=this.offsetParent;t&&"static"===v.css(t,"position");)t=t.offsetParent;return t||ft})}}),v.each({scrollLeft:"pageXOffset",scrollTop:"pageYOffset"},function(t,e){var i="pageYOffset"===e;v.fn[t]=function(n){return B(this,function(t,n,o){var s;return v.isWindow(t)?s=t:9===t.nodeType&&(s=t.defaultView),void 0===o?s?s[e]:t[n]:void(s?s.scrollTo(i?s.pageXOffset:o,i?o:s.pageYOffset):t[n]=o)},t,n,arguments.length)}}),v.each(["top","left"],function(t,e){v.cssHooks[e]=Ot(f.pixelPosition,function(t,i){if(i)return i=qt(t,e),$t.test(i)?v(t).position()[e]+"px":i})}),v.each({Height:"height",Width:"width"},function(t,e){v.each({padding:"inner"+t,content:e,"":"outer"+t},function(i,n){v.fn[n]=function(o,s){var r=arguments.length&&(i||"boolean"!=typeof o),a=i||(!0===o||!0===s?"margin":"border");return B(this,function(e,i,o){var s;return v.isWindow(e)?0===n.indexOf("outer")?e["inner"+t]:e.document.documentElement["client"+t]:9===e.nodeType?(s=e.documentElement,Math.max(e.body["scroll"+t],s["scroll"+t],e.body["offset"+t],s["offset"+t],s["client"+t])):void 0===o?v.css(e,i,a):v.style(e,i,o,a)},e,r?o:void 0,r)}})}),v.fn.extend({bind:function(t,e,i){return this.on(t,null,e,i)},unbind:function(t,e){return this.off(t,null,e)},delegate:function(t,e,i,n){return this.on(e,t,i,n)},undelegate:function(t,e,i){return 1===arguments.length?this.off(t,"**"):this.off(e,t||"**",i)}}),v.holdReady=function(t){t?v.readyWait++:v.ready(!0)},v.isArray=Array.isArray,v.parseJSON=JSON.parse,v.nodeName=S,"function"==typeof define&&define.amd&&define("jquery",[],function(){return v});var Oe=t.jQuery,Fe=t.$;return v.noConflict=function(e){return t.$===v&&(t.$=Fe),e&&t.jQuery===v&&(t.jQuery=Oe),v},e||(t.jQuery=t.$=v),v});var _typeof="function"==typeof Symbol&&"symbol"==typeof Symbol.iterator?function(t){return typeof t}:function(t){return t&&"function"==typeof Symbol&&t.constructor===Symbol&&t!==Symbol.prototype?"symbol":typeof t},windowIsDefined="object"===("undefined"==typeof window?"undefined":_typeof(window));if(function(t){if("function"==typeof define&&define.amd)define(["jquery"],t);else if("object"===("undefined"==typeof module?"undefined":_typeof(module))&&module.exports){var e;try{e=require("jquery")}catch(t){e=null}module.exports=t(e)}else window&&(window.Slider=t(window.jQuery))}(function(t){var e,i="slider",n="bootstrapSlider";return windowIsDefined&&!window.console&&(window.console={}),windowIsDefined&&!window.console.log&&(window.console.log=function(){}),windowIsDefined&&!window.console.warn&&(window.console.warn=function(){}),function(t){function e(){}var i=Array.prototype.slice;!function(t){function n(e){e.prototype.option||(e.prototype.option=function(e){t.isPlainObject(e)&&(this.options=t.extend(!0,this.options,e))})}function o(e,n){t.fn[e]=function(o){if("string"==typeof o){for(var r=i.call(arguments,1),a=0,l=this.length;l>a;a++){var u=this[a],h=t.data(u,e);if(h)if(t.isFunction(h[o])&&"_"!==o.charAt(0)){var c=h[o].apply(h,r);if(void 0!==c&&c!==h)return c}else s("no such method '"+o+"' for "+e+" instance");else s("cannot call methods on "+e+" prior to initialization; attempted to call '"+o+"'")}return this}var d=this.map(function(){var i=t.data(this,e);return i?(i.option(o),i._init()):(i=new n(this,o),t.data(this,e,i)),t(this)});return!d||d.length>1?d:d[0]}}if(t){var s="undefined"==typeof console?e:function(t){console.error(t)};t.bridget=function(t,e){n(e),o(t,e)},t.bridget}}(t)}(t),function(t){function o(e,i){function n(t,e){var i="data-slider-"+e.replace(/_/g,"-"),n=t.getAttribute(i);try{return JSON.parse(n)}catch(t){return n}}this._state={value:null,enabled:null,offset:null,size:null,percentage:null,inDrag:!1,over:!1},this.ticksCallbackMap={},this.handleCallbackMap={},"string"==typeof e?this.element=document.querySelector(e):e instanceof HTMLElement&&(this.element=e),i=i||{};for(var o=Object.keys(this.defaultOptions),s=0;s<o.length;s++){var a=o[s],l=i[a];l=null!==(l=void 0!==l?l:n(this.element,a))?l:this.defaultOptions[a],this.options||(this.options={}),this.options[a]=l}"auto"===this.options.rtl&&(this.options.rtl="rtl"===window.getComputedStyle(this.element).direction),"vertical"!==this.options.orientation||"top"!==this.options.tooltip_position&&"bottom"!==this.options.tooltip_position?"horizontal"!==this.options.orientation||"left"!==this.options.tooltip_position&&"right"!==this.options.tooltip_position||(this.options.tooltip_position="top"):this.options.rtl?this.options.tooltip_position="left":this.options.tooltip_position="right";var u,h,c,d,p,f=this.element.style.width,m=!1,g=this.element.parentNode;if(this.sliderElem)m=!0;else{this.sliderElem=document.createElement("div"),this.sliderElem.className="slider";var v=document.createElement("div");v.className="slider-track",(h=document.createElement("div")).className="slider-track-low",(u=document.createElement("div")).className="slider-selection",(c=document.createElement("div")).className="slider-track-high",(d=document.createElement("div")).className="slider-handle min-slider-handle",d.setAttribute("role","slider"),d.setAttribute("aria-valuemin",this.options.min),d.setAttribute("aria-valuemax",this.options.max),(p=document.createElement("div")).className="slider-handle max-slider-handle",p.setAttribute("role","slider"),p.setAttribute("aria-valuemin",this.options.min),p.setAttribute("aria-valuemax",this.options.max),v.appendChild(h),v.appendChild(u),v.appendChild(c),this.rangeHighlightElements=[];var y=this.options.rangeHighlights;if(Array.isArray(y)&&y.length>0)for(var _=0;_<y.length;_++){var b=document.createElement("div"),x=y[_].class||"";b.className="slider-rangeHighlight slider-selection "+x,this.rangeHighlightElements.push(b),v.appendChild(b)}var w=Array.isArray(this.options.labelledby);if(w&&this.options.labelledby[0]&&d.setAttribute("aria-labelledby",this.options.labelledby[0]),w&&this.options.labelledby[1]&&p.setAttribute("aria-labelledby",this.options.labelledby[1]),!w&&this.options.labelledby&&(d.setAttribute("aria-labelledby",this.options.labelledby),p.setAttribute("aria-labelledby",this.options.labelledby)),this.ticks=[],Array.isArray(this.options.ticks)&&this.options.ticks.length>0){for(this.ticksContainer=document.createElement("div"),this.ticksContainer.className="slider-tick-container",s=0;s<this.options.ticks.length;s++){var k=document.createElement("div");if(k.className="slider-tick",this.options.ticks_tooltip){var C=this._addTickListener(),T=C.addMouseEnter(this,k,s),E=C.addMouseLeave(this,k);this.ticksCallbackMap[s]={mouseEnter:T,mouseLeave:E}}this.ticks.push(k),this.ticksContainer.appendChild(k)}u.className+=" tick-slider-selection"}if(this.tickLabels=[],Array.isArray(this.options.ticks_labels)&&this.options.ticks_labels.length>0)for(this.tickLabelContainer=document.createElement("div"),this.tickLabelContainer.className="slider-tick-label-container",s=0;s<this.options.ticks_labels.length;s++){var S=document.createElement("div"),N=0===this.options.ticks_positions.length,A=this.options.reversed&&N?this.options.ticks_labels.length-(s+1):s;S.className="slider-tick-label",S.innerHTML=this.options.ticks_labels[A],this.tickLabels.push(S),this.tickLabelContainer.appendChild(S)}var L=function(t){var e=document.createElement("div");e.className="tooltip-arrow";var i=document.createElement("div");i.className="tooltip-inner",t.appendChild(e),t.appendChild(i)},D=document.createElement("div");D.className="tooltip tooltip-main",D.setAttribute("role","presentation"),L(D);var j=document.createElement("div");j.className="tooltip tooltip-min",j.setAttribute("role","presentation"),L(j);var P=document.createElement("div");P.className="tooltip tooltip-max",P.setAttribute("role","presentation"),L(P),this.sliderElem.appendChild(v),this.sliderElem.appendChild(D),this.sliderElem.appendChild(j),this.sliderElem.appendChild(P),this.tickLabelContainer&&this.sliderElem.appendChild(this.tickLabelContainer),this.ticksContainer&&this.sliderElem.appendChild(this.ticksContainer),this.sliderElem.appendChild(d),this.sliderElem.appendChild(p),g.insertBefore(this.sliderElem,this.element),this.element.style.display="none"}if(t&&(this.$element=t(this.element),this.$sliderElem=t(this.sliderElem)),this.eventToCallbackMap={},this.sliderElem.id=this.options.id,this.touchCapable="ontouchstart"in window||window.DocumentTouch&&document instanceof window.DocumentTouch,this.touchX=0,this.touchY=0,this.tooltip=this.sliderElem.querySelector(".tooltip-main"),this.tooltipInner=this.tooltip.querySelector(".tooltip-inner"),this.tooltip_min=this.sliderElem.querySelector(".tooltip-min"),this.tooltipInner_min=this.tooltip_min.querySelector(".tooltip-inner"),this.tooltip_max=this.sliderElem.querySelector(".tooltip-max"),this.tooltipInner_max=this.tooltip_max.querySelector(".tooltip-inner"),r[this.options.scale]&&(this.options.scale=r[this.options.scale]),!0===m&&(this._removeClass(this.sliderElem,"slider-horizontal"),this._removeClass(this.sliderElem,"slider-vertical"),this._removeClass(this.sliderElem,"slider-rtl"),this._removeClass(this.tooltip,"hide"),this._removeClass(this.tooltip_min,"hide"),this._removeClass(this.tooltip_max,"hide"),["left","right","top","width","height"].forEach(function(t){this._removeProperty(this.trackLow,t),this._removeProperty(this.trackSelection,t),this._removeProperty(this.trackHigh,t)},this),[this.handle1,this.handle2].forEach(function(t){this._removeProperty(t,"left"),this._removeProperty(t,"right"),this._removeProperty(t,"top")},this),[this.tooltip,this.tooltip_min,this.tooltip_max].forEach(function(t){this._removeProperty(t,"left"),this._removeProperty(t,"right"),this._removeProperty(t,"top"),this._removeClass(t,"right"),this._removeClass(t,"left"),this._removeClass(t,"top")},this)),"vertical"===this.options.orientation?(this._addClass(this.sliderElem,"slider-vertical"),this.stylePos="top",this.mousePos="pageY",this.sizePos="offsetHeight"):(this._addClass(this.sliderElem,"slider-horizontal"),this.sliderElem.style.width=f,this.options.orientation="horizontal",this.options.rtl?this.stylePos="right":this.stylePos="left",this.mousePos="pageX",this.sizePos="offsetWidth"),this.options.rtl&&this._addClass(this.sliderElem,"slider-rtl"),this._setTooltipPosition(),Array.isArray(this.options.ticks)&&this.options.ticks.length>0&&(this.options.max=Math.max.apply(Math,this.options.ticks),this.options.min=Math.min.apply(Math,this.options.ticks)),Array.isArray(this.options.value)?(this.options.range=!0,this._state.value=this.options.value):this.options.range?this._state.value=[this.options.value,this.options.max]:this._state.value=this.options.value,this.trackLow=h||this.trackLow,this.trackSelection=u||this.trackSelection,this.trackHigh=c||this.trackHigh,"none"===this.options.selection?(this._addClass(this.trackLow,"hide"),this._addClass(this.trackSelection,"hide"),this._addClass(this.trackHigh,"hide")):("after"===this.options.selection||"before"===this.options.selection)&&(this._removeClass(this.trackLow,"hide"),this._removeClass(this.trackSelection,"hide"),this._removeClass(this.trackHigh,"hide")),this.handle1=d||this.handle1,this.handle2=p||this.handle2,!0===m)for(this._removeClass(this.handle1,"round triangle"),this._removeClass(this.handle2,"round triangle hide"),s=0;s<this.ticks.length;s++)this._removeClass(this.ticks[s],"round triangle hide");if(-1!==["round","triangle","custom"].indexOf(this.options.handle))for(this._addClass(this.handle1,this.options.handle),this._addClass(this.handle2,this.options.handle),s=0;s<this.ticks.length;s++)this._addClass(this.ticks[s],this.options.handle);if(this._state.offset=this._offset(this.sliderElem),this._state.size=this.sliderElem[this.sizePos],this.setValue(this._state.value),this.handle1Keydown=this._keydown.bind(this,0),this.handle1.addEventListener("keydown",this.handle1Keydown,!1),this.handle2Keydown=this._keydown.bind(this,1),this.handle2.addEventListener("keydown",this.handle2Keydown,!1),this.mousedown=this._mousedown.bind(this),this.touchstart=this._touchstart.bind(this),this.touchmove=this._touchmove.bind(this),this.touchCapable){var H=!1;try{var $=Object.defineProperty({},"passive",{get:function(){H=!0}});window.addEventListener("test",null,$)}catch(t){}var M=!!H&&{passive:!0};this.sliderElem.addEventListener("touchstart",this.touchstart,M),this.sliderElem.addEventListener("touchmove",this.touchmove,M)}if(this.sliderElem.addEventListener("mousedown",this.mousedown,!1),this.resize=this._resize.bind(this),window.addEventListener("resize",this.resize,!1),"hide"===this.options.tooltip)this._addClass(this.tooltip,"hide"),this._addClass(this.tooltip_min,"hide"),this._addClass(this.tooltip_max,"hide");else if("always"===this.options.tooltip)this._showTooltip(),this._alwaysShowTooltip=!0;else{if(this.showTooltip=this._showTooltip.bind(this),this.hideTooltip=this._hideTooltip.bind(this),this.options.ticks_tooltip){var q=this._addTickListener(),O=q.addMouseEnter(this,this.handle1),F=q.addMouseLeave(this,this.handle1);this.handleCallbackMap.handle1={mouseEnter:O,mouseLeave:F},O=q.addMouseEnter(this,this.handle2),F=q.addMouseLeave(this,this.handle2),this.handleCallbackMap.handle2={mouseEnter:O,mouseLeave:F}}else this.sliderElem.addEventListener("mouseenter",this.showTooltip,!1),this.sliderElem.addEventListener("mouseleave",this.hideTooltip,!1);this.handle1.addEventListener("focus",this.showTooltip,!1),this.handle1.addEventListener("blur",this.hideTooltip,!1),this.handle2.addEventListener("focus",this.showTooltip,!1),this.handle2.addEventListener("blur",this.hideTooltip,!1)}this.options.enabled?this.enable():this.disable()}var s=function(t){return"Invalid input value '"+t+"' passed in"},r={linear:{toValue:function(t){var e=t/100*(this.options.max-this.options.min),i=!0;if(this.options.ticks_positions.length>0){for(var n,o,s,r=0,a=1;a<this.options.ticks_positions.length;a++)if(t<=this.options.ticks_positions[a]){n=this.options.ticks[a-1],s=this.options.ticks_positions[a-1],o=this.options.ticks[a],r=this.options.ticks_positions[a];break}e=n+(t-s)/(r-s)*(o-n),i=!1}var l=(i?this.options.min:0)+Math.round(e/this.options.step)*this.options.step;return l<this.options.min?this.options.min:l>this.options.max?this.options.max:l},toPercentage:function(t){if(this.options.max===this.options.min)return 0;if(this.options.ticks_positions.length>0){for(var e,i,n,o=0,s=0;s<this.options.ticks.length;s++)if(t<=this.options.ticks[s]){e=s>0?this.options.ticks[s-1]:0,n=s>0?this.options.ticks_positions[s-1]:0,i=this.options.ticks[s],o=this.options.ticks_positions[s];break}if(s>0)return n+(t-e)/(i-e)*(o-n)}return 100*(t-this.options.min)/(this.options.max-this.options.min)}},logarithmic:{toValue:function(t){var e=0===this.options.min?0:Math.log(this.options.min),i=Math.log(this.options.max),n=Math.exp(e+(i-e)*t/100);return Math.round(n)===this.options.max?this.options.max:(n=this.options.min+Math.round((n-this.options.min)/this.options.step)*this.options.step)<this.options.min?this.options.min:n>this.options.max?this.options.max:n},toPercentage:function(t){if(this.options.max===this.options.min)return 0;var e=Math.log(this.options.max),i=0===this.options.min?0:Math.log(this.options.min);return 100*((0===t?0:Math.log(t))-i)/(e-i)}}};if((e=function(t,e){return o.call(this,t,e),this}).prototype={_init:function(){},constructor:e,defaultOptions:{id:"",min:0,max:10,step:1,precision:0,orientation:"horizontal",value:5,range:!1,selection:"before",tooltip:"show",tooltip_split:!1,handle:"round",reversed:!1,rtl:"auto",enabled:!0,formatter:function(t){return Array.isArray(t)?t[0]+" : "+t[1]:t},natural_arrow_keys:!1,ticks:[],ticks_positions:[],ticks_labels:[],ticks_snap_bounds:0,ticks_tooltip:!1,scale:"linear",focus:!1,tooltip_position:null,labelledby:null,rangeHighlights:[]},getElement:function(){return this.sliderElem},getValue:function(){return this.options.range?this._state.value:this._state.value[0]},setValue:function(t,e,i){t||(t=0);var n=this.getValue();this._state.value=this._validateInputValue(t);var o=this._applyPrecision.bind(this);this.options.range?(this._state.value[0]=o(this._state.value[0]),this._state.value[1]=o(this._state.value[1]),this._state.value[0]=Math.max(this.options.min,Math.min(this.options.max,this._state.value[0])),this._state.value[1]=Math.max(this.options.min,Math.min(this.options.max,this._state.value[1]))):(this._state.value=o(this._state.value),this._state.value=[Math.max(this.options.min,Math.min(this.options.max,this._state.value))],this._addClass(this.handle2,"hide"),"after"===this.options.selection?this._state.value[1]=this.options.max:this._state.value[1]=this.options.min),this.options.max>this.options.min?this._state.percentage=[this._toPercentage(this._state.value[0]),this._toPercentage(this._state.value[1]),100*this.options.step/(this.options.max-this.options.min)]:this._state.percentage=[0,0,100],this._layout();var s=this.options.range?this._state.value:this._state.value[0];return this._setDataVal(s),!0===e&&this._trigger("slide",s),n!==s&&!0===i&&this._trigger("change",{oldValue:n,newValue:s}),this},destroy:function(){this._removeSliderEventHandlers(),this.sliderElem.parentNode.removeChild(this.sliderElem),this.element.style.display="",this._cleanUpEventCallbacksMap(),this.element.removeAttribute("data"),t&&(this._unbindJQueryEventHandlers(),this.$element.removeData("slider"))},disable:function(){return this._state.enabled=!1,this.handle1.removeAttribute("tabindex"),this.handle2.removeAttribute("tabindex"),this._addClass(this.sliderElem,"slider-disabled"),this._trigger("slideDisabled"),this},enable:function(){return this._state.enabled=!0,this.handle1.setAttribute("tabindex",0),this.handle2.setAttribute("tabindex",0),this._removeClass(this.sliderElem,"slider-disabled"),this._trigger("slideEnabled"),this},toggle:function(){return this._state.enabled?this.disable():this.enable(),this},isEnabled:function(){return this._state.enabled},on:function(t,e){return this._bindNonQueryEventHandler(t,e),this},off:function(e,i){t?(this.$element.off(e,i),this.$sliderElem.off(e,i)):this._unbindNonQueryEventHandler(e,i)},getAttribute:function(t){return t?this.options[t]:this.options},setAttribute:function(t,e){return this.options[t]=e,this},refresh:function(){return this._removeSliderEventHandlers(),o.call(this,this.element,this.options),t&&t.data(this.element,"slider",this),this},relayout:function(){return this._resize(),this._layout(),this},_removeSliderEventHandlers:function(){if(this.handle1.removeEventListener("keydown",this.handle1Keydown,!1),this.handle2.removeEventListener("keydown",this.handle2Keydown,!1),this.options.ticks_tooltip){for(var t=this.ticksContainer.getElementsByClassName("slider-tick"),e=0;e<t.length;e++)t[e].removeEventListener("mouseenter",this.ticksCallbackMap[e].mouseEnter,!1),t[e].removeEventListener("mouseleave",this.ticksCallbackMap[e].mouseLeave,!1);this.handle1.removeEventListener("mouseenter",this.handleCallbackMap.handle1.mouseEnter,!1),this.handle2.removeEventListener("mouseenter",this.handleCallbackMap.handle2.mouseEnter,!1),this.handle1.removeEventListener("mouseleave",this.handleCallbackMap.handle1.mouseLeave,!1),this.handle2.removeEventListener("mouseleave",this.handleCallbackMap.handle2.mouseLeave,!1)}this.handleCallbackMap=null,this.ticksCallbackMap=null,this.showTooltip&&(this.handle1.removeEventListener("focus",this.showTooltip,!1),this.handle2.removeEventListener("focus",this.showTooltip,!1)),this.hideTooltip&&(this.handle1.removeEventListener("blur",this.hideTooltip,!1),this.handle2.removeEventListener("blur",this.hideTooltip,!1)),this.showTooltip&&this.sliderElem.removeEventListener("mouseenter",this.showTooltip,!1),this.hideTooltip&&this.sliderElem.removeEventListener("mouseleave",this.hideTooltip,!1),this.sliderElem.removeEventListener("touchstart",this.touchstart,!1),this.sliderElem.removeEventListener("touchmove",this.touchmove,!1),this.sliderElem.removeEventListener("mousedown",this.mousedown,!1),window.removeEventListener("resize",this.resize,!1)},_bindNonQueryEventHandler:function(t,e){void 0===this.eventToCallbackMap[t]&&(this.eventToCallbackMap[t]=[]),this.eventToCallbackMap[t].push(e)},_unbindNonQueryEventHandler:function(t,e){var i=this.eventToCallbackMap[t];if(void 0!==i)for(var n=0;n<i.length;n++)if(i[n]===e){i.splice(n,1);break}},_cleanUpEventCallbacksMap:function(){for(var t=Object.keys(this.eventToCallbackMap),e=0;e<t.length;e++){var i=t[e];delete this.eventToCallbackMap[i]}},_showTooltip:function(){!1===this.options.tooltip_split?(this._addClass(this.tooltip,"in"),this.tooltip_min.style.display="none",this.tooltip_max.style.display="none"):(this._addClass(this.tooltip_min,"in"),this._addClass(this.tooltip_max,"in"),this.tooltip.style.display="none"),this._state.over=!0},_hideTooltip:function(){!1===this._state.inDrag&&!0!==this.alwaysShowTooltip&&(this._removeClass(this.tooltip,"in"),this._removeClass(this.tooltip_min,"in"),this._removeClass(this.tooltip_max,"in")),this._state.over=!1},_setToolTipOnMouseOver:function(t){function e(t,e){return e?[100-t.percentage[0],this.options.range?100-t.percentage[1]:t.percentage[1]]:[t.percentage[0],t.percentage[1]]}var i=this.options.formatter(t?t.value[0]:this._state.value[0]),n=e(t||this._state,this.options.reversed);this._setText(this.tooltipInner,i),this.tooltip.style[this.stylePos]=n[0]+"%"},_addTickListener:function(){return{addMouseEnter:function(t,e,i){var n=function(){var e=t._state,n=i>=0?i:this.attributes["aria-valuenow"].value,o=parseInt(n,10);e.value[0]=o,e.percentage[0]=t.options.ticks_positions[o],t._setToolTipOnMouseOver(e),t._showTooltip()};return e.addEventListener("mouseenter",n,!1),n},addMouseLeave:function(t,e){var i=function(){t._hideTooltip()};return e.addEventListener("mouseleave",i,!1),i}}},_layout:function(){var t,e;if(t=this.options.reversed?[100-this._state.percentage[0],this.options.range?100-this._state.percentage[1]:this._state.percentage[1]]:[this._state.percentage[0],this._state.percentage[1]],this.handle1.style[this.stylePos]=t[0]+"%",this.handle1.setAttribute("aria-valuenow",this._state.value[0]),isNaN(this.options.formatter(this._state.value[0]))&&this.handle1.setAttribute("aria-valuetext",this.options.formatter(this._state.value[0])),this.handle2.style[this.stylePos]=t[1]+"%",this.handle2.setAttribute("aria-valuenow",this._state.value[1]),isNaN(this.options.formatter(this._state.value[1]))&&this.handle2.setAttribute("aria-valuetext",this.options.formatter(this._state.value[1])),this.rangeHighlightElements.length>0&&Array.isArray(this.options.rangeHighlights)&&this.options.rangeHighlights.length>0)for(var i=0;i<this.options.rangeHighlights.length;i++){var n=this._toPercentage(this.options.rangeHighlights[i].start),o=this._toPercentage(this.options.rangeHighlights[i].end);if(this.options.reversed){var s=100-o;o=100-n,n=s}var r=this._createHighlightRange(n,o);r?"vertical"===this.options.orientation?(this.rangeHighlightElements[i].style.top=r.start+"%",this.rangeHighlightElements[i].style.height=r.size+"%"):(this.options.rtl?this.rangeHighlightElements[i].style.right=r.start+"%":this.rangeHighlightElements[i].style.left=r.start+"%",this.rangeHighlightElements[i].style.width=r.size+"%"):this.rangeHighlightElements[i].style.display="none"}if(Array.isArray(this.options.ticks)&&this.options.ticks.length>0){var a,l="vertical"===this.options.orientation?"height":"width";a="vertical"===this.options.orientation?"marginTop":this.options.rtl?"marginRight":"marginLeft";var u=this._state.size/(this.options.ticks.length-1);if(this.tickLabelContainer){var h=0;if(0===this.options.ticks_positions.length)"vertical"!==this.options.orientation&&(this.tickLabelContainer.style[a]=-u/2+"px"),h=this.tickLabelContainer.offsetHeight;else for(c=0;c<this.tickLabelContainer.childNodes.length;c++)this.tickLabelContainer.childNodes[c].offsetHeight>h&&(h=this.tickLabelContainer.childNodes[c].offsetHeight);"horizontal"===this.options.orientation&&(this.sliderElem.style.marginBottom=h+"px")}for(var c=0;c<this.options.ticks.length;c++){var d=this.options.ticks_positions[c]||this._toPercentage(this.options.ticks[c]);this.options.reversed&&(d=100-d),this.ticks[c].style[this.stylePos]=d+"%",this._removeClass(this.ticks[c],"in-selection"),this.options.range?d>=t[0]&&d<=t[1]&&this._addClass(this.ticks[c],"in-selection"):"after"===this.options.selection&&d>=t[0]?this._addClass(this.ticks[c],"in-selection"):"before"===this.options.selection&&d<=t[0]&&this._addClass(this.ticks[c],"in-selection"),this.tickLabels[c]&&(this.tickLabels[c].style[l]=u+"px","vertical"!==this.options.orientation&&void 0!==this.options.ticks_positions[c]?(this.tickLabels[c].style.position="absolute",this.tickLabels[c].style[this.stylePos]=d+"%",this.tickLabels[c].style[a]=-u/2+"px"):"vertical"===this.options.orientation&&(this.options.rtl?this.tickLabels[c].style.marginRight=this.sliderElem.offsetWidth+"px":this.tickLabels[c].style.marginLeft=this.sliderElem.offsetWidth+"px",this.tickLabelContainer.style[a]=this.sliderElem.offsetWidth/2*-1+"px"))}}if(this.options.range){e=this.options.formatter(this._state.value),this._setText(this.tooltipInner,e),this.tooltip.style[this.stylePos]=(t[1]+t[0])/2+"%";var p=this.options.formatter(this._state.value[0]);this._setText(this.tooltipInner_min,p);var f=this.options.formatter(this._state.value[1]);this._setText(this.tooltipInner_max,f),this.tooltip_min.style[this.stylePos]=t[0]+"%",this.tooltip_max.style[this.stylePos]=t[1]+"%"}else e=this.options.formatter(this._state.value[0]),this._setText(this.tooltipInner,e),this.tooltip.style[this.stylePos]=t[0]+"%";if("vertical"===this.options.orientation)this.trackLow.style.top="0",this.trackLow.style.height=Math.min(t[0],t[1])+"%",this.trackSelection.style.top=Math.min(t[0],t[1])+"%",this.trackSelection.style.height=Math.abs(t[0]-t[1])+"%",this.trackHigh.style.bottom="0",this.trackHigh.style.height=100-Math.min(t[0],t[1])-Math.abs(t[0]-t[1])+"%";else{"right"===this.stylePos?this.trackLow.style.right="0":this.trackLow.style.left="0",this.trackLow.style.width=Math.min(t[0],t[1])+"%","right"===this.stylePos?this.trackSelection.style.right=Math.min(t[0],t[1])+"%":this.trackSelection.style.left=Math.min(t[0],t[1])+"%",this.trackSelection.style.width=Math.abs(t[0]-t[1])+"%","right"===this.stylePos?this.trackHigh.style.left="0":this.trackHigh.style.right="0",this.trackHigh.style.width=100-Math.min(t[0],t[1])-Math.abs(t[0]-t[1])+"%";var m=this.tooltip_min.getBoundingClientRect(),g=this.tooltip_max.getBoundingClientRect();"bottom"===this.options.tooltip_position?m.right>g.left?(this._removeClass(this.tooltip_max,"bottom"),this._addClass(this.tooltip_max,"top"),this.tooltip_max.style.top="",this.tooltip_max.style.bottom="22px"):(this._removeClass(this.tooltip_max,"top"),this._addClass(this.tooltip_max,"bottom"),this.tooltip_max.style.top=this.tooltip_min.style.top,this.tooltip_max.style.bottom=""):m.right>g.left?(this._removeClass(this.tooltip_max,"top"),this._addClass(this.tooltip_max,"bottom"),this.tooltip_max.style.top="18px"):(this._removeClass(this.tooltip_max,"bottom"),this._addClass(this.tooltip_max,"top"),this.tooltip_max.style.top=this.tooltip_min.style.top)}},_createHighlightRange:function(t,e){return this._isHighlightRange(t,e)?t>e?{start:e,size:t-e}:{start:t,size:e-t}:null},_isHighlightRange:function(t,e){return t>=0&&100>=t&&e>=0&&100>=e},_resize:function(t){this._state.offset=this._offset(this.sliderElem),this._state.size=this.sliderElem[this.sizePos],this._layout()},_removeProperty:function(t,e){t.style.removeProperty?t.style.removeProperty(e):t.style.removeAttribute(e)},_mousedown:function(t){if(!this._state.enabled)return!1;this._state.offset=this._offset(this.sliderElem),this._state.size=this.sliderElem[this.sizePos];var e=this._getPercentage(t);if(this.options.range){var i=Math.abs(this._state.percentage[0]-e),n=Math.abs(this._state.percentage[1]-e);this._state.dragged=n>i?0:1,this._adjustPercentageForRangeSliders(e)}else this._state.dragged=0;this._state.percentage[this._state.dragged]=e,this._layout(),this.touchCapable&&(document.removeEventListener("touchmove",this.mousemove,!1),document.removeEventListener("touchend",this.mouseup,!1)),this.mousemove&&document.removeEventListener("mousemove",this.mousemove,!1),this.mouseup&&document.removeEventListener("mouseup",this.mouseup,!1),this.mousemove=this._mousemove.bind(this),this.mouseup=this._mouseup.bind(this),this.touchCapable&&(document.addEventListener("touchmove",this.mousemove,!1),document.addEventListener("touchend",this.mouseup,!1)),document.addEventListener("mousemove",this.mousemove,!1),document.addEventListener("mouseup",this.mouseup,!1),this._state.inDrag=!0;var o=this._calculateValue();return this._trigger("slideStart",o),this._setDataVal(o),this.setValue(o,!1,!0),t.returnValue=!1,this.options.focus&&this._triggerFocusOnHandle(this._state.dragged),!0},_touchstart:function(t){if(void 0!==t.changedTouches){var e=t.changedTouches[0];this.touchX=e.pageX,this.touchY=e.pageY}else this._mousedown(t)},_triggerFocusOnHandle:function(t){0===t&&this.handle1.focus(),1===t&&this.handle2.focus()},_keydown:function(t,e){if(!this._state.enabled)return!1;var i;switch(e.keyCode){case 37:case 40:i=-1;break;case 39:case 38:i=1}if(i){if(this.options.natural_arrow_keys){var n="vertical"===this.options.orientation&&!this.options.reversed,o="horizontal"===this.options.orientation&&this.options.reversed;(n||o)&&(i=-i)}var s=this._state.value[t]+i*this.options.step,r=s/this.options.max*100;if(this._state.keyCtrl=t,this.options.range)this._adjustPercentageForRangeSliders(r),s=[this._state.keyCtrl?this._state.value[0]:s,this._state.keyCtrl?s:this._state.value[1]];return this._trigger("slideStart",s),this._setDataVal(s),this.setValue(s,!0,!0),this._setDataVal(s),this._trigger("slideStop",s),this._layout(),this._pauseEvent(e),delete this._state.keyCtrl,!1}},_pauseEvent:function(t){t.stopPropagation&&t.stopPropagation(),t.preventDefault&&t.preventDefault(),t.cancelBubble=!0,t.returnValue=!1},_mousemove:function(t){if(!this._state.enabled)return!1;var e=this._getPercentage(t);this._adjustPercentageForRangeSliders(e),this._state.percentage[this._state.dragged]=e,this._layout();var i=this._calculateValue(!0);return this.setValue(i,!0,!0),!1},_touchmove:function(t){if(void 0!==t.changedTouches){var e=t.changedTouches[0],i=e.pageX-this.touchX,n=e.pageY-this.touchY;this._state.inDrag||("vertical"===this.options.orientation&&5>=i&&i>=-5&&(n>=15||-15>=n)?this._mousedown(t):5>=n&&n>=-5&&(i>=15||-15>=i)&&this._mousedown(t))}},_adjustPercentageForRangeSliders:function(t){if(this.options.range){var e=this._getNumDigitsAfterDecimalPlace(t);e=e?e-1:0;var i=this._applyToFixedAndParseFloat(t,e);0===this._state.dragged&&this._applyToFixedAndParseFloat(this._state.percentage[1],e)<i?(this._state.percentage[0]=this._state.percentage[1],this._state.dragged=1):1===this._state.dragged&&this._applyToFixedAndParseFloat(this._state.percentage[0],e)>i?(this._state.percentage[1]=this._state.percentage[0],this._state.dragged=0):0===this._state.keyCtrl&&this._state.value[1]/this.options.max*100<t?(this._state.percentage[0]=this._state.percentage[1],this._state.keyCtrl=1,this.handle2.focus()):1===this._state.keyCtrl&&this._state.value[0]/this.options.max*100>t&&(this._state.percentage[1]=this._state.percentage[0],this._state.keyCtrl=0,this.handle1.focus())}},_mouseup:function(){if(!this._state.enabled)return!1;this.touchCapable&&(document.removeEventListener("touchmove",this.mousemove,!1),document.removeEventListener("touchend",this.mouseup,!1)),document.removeEventListener("mousemove",this.mousemove,!1),document.removeEventListener("mouseup",this.mouseup,!1),this._state.inDrag=!1,!1===this._state.over&&this._hideTooltip();var t=this._calculateValue(!0);return this._layout(),this._setDataVal(t),this._trigger("slideStop",t),!1},_calculateValue:function(t){var e;if(this.options.range?(e=[this.options.min,this.options.max],0!==this._state.percentage[0]&&(e[0]=this._toValue(this._state.percentage[0]),e[0]=this._applyPrecision(e[0])),100!==this._state.percentage[1]&&(e[1]=this._toValue(this._state.percentage[1]),e[1]=this._applyPrecision(e[1]))):(e=this._toValue(this._state.percentage[0]),e=parseFloat(e),e=this._applyPrecision(e)),t){for(var i=[e,1/0],n=0;n<this.options.ticks.length;n++){var o=Math.abs(this.options.ticks[n]-e);o<=i[1]&&(i=[this.options.ticks[n],o])}if(i[1]<=this.options.ticks_snap_bounds)return i[0]}return e},_applyPrecision:function(t){var e=this.options.precision||this._getNumDigitsAfterDecimalPlace(this.options.step);return this._applyToFixedAndParseFloat(t,e)},_getNumDigitsAfterDecimalPlace:function(t){var e=(""+t).match(/(?:\.(\d+))?(?:[eE]([+-]?\d+))?$/);return e?Math.max(0,(e[1]?e[1].length:0)-(e[2]?+e[2]:0)):0},_applyToFixedAndParseFloat:function(t,e){var i=t.toFixed(e);return parseFloat(i)},_getPercentage:function(t){!this.touchCapable||"touchstart"!==t.type&&"touchmove"!==t.type||(t=t.touches[0]);var e=t[this.mousePos]-this._state.offset[this.stylePos];"right"===this.stylePos&&(e=-e);var i=e/this._state.size*100;return i=Math.round(i/this._state.percentage[2])*this._state.percentage[2],this.options.reversed&&(i=100-i),Math.max(0,Math.min(100,i))},_validateInputValue:function(t){if(isNaN(+t)){if(Array.isArray(t))return this._validateArray(t),t;throw new Error(s(t))}return+t},_validateArray:function(t){for(var e=0;e<t.length;e++){var i=t[e];if("number"!=typeof i)throw new Error(s(i))}},_setDataVal:function(t){this.element.setAttribute("data-value",t),this.element.setAttribute("value",t),this.element.value=t},_trigger:function(e,i){i=i||0===i?i:void 0;var n=this.eventToCallbackMap[e];if(n&&n.length)for(var o=0;o<n.length;o++){(0,n[o])(i)}t&&this._triggerJQueryEvent(e,i)},_triggerJQueryEvent:function(t,e){var i={type:t,value:e};this.$element.trigger(i),this.$sliderElem.trigger(i)},_unbindJQueryEventHandlers:function(){this.$element.off(),this.$sliderElem.off()},_setText:function(t,e){void 0!==t.textContent?t.textContent=e:void 0!==t.innerText&&(t.innerText=e)},_removeClass:function(t,e){for(var i=e.split(" "),n=t.className,o=0;o<i.length;o++){var s=i[o],r=new RegExp("(?:\\s|^)"+s+"(?:\\s|$)");n=n.replace(r," ")}t.className=n.trim()},_addClass:function(t,e){for(var i=e.split(" "),n=t.className,o=0;o<i.length;o++){var s=i[o];new RegExp("(?:\\s|^)"+s+"(?:\\s|$)").test(n)||(n+=" "+s)}t.className=n.trim()},_offsetLeft:function(t){return t.getBoundingClientRect().left},_offsetRight:function(t){return t.getBoundingClientRect().right},_offsetTop:function(t){for(var e=t.offsetTop;(t=t.offsetParent)&&!isNaN(t.offsetTop);)e+=t.offsetTop,"BODY"!==t.tagName&&(e-=t.scrollTop);return e},_offset:function(t){return{left:this._offsetLeft(t),right:this._offsetRight(t),top:this._offsetTop(t)}},_css:function(e,i,n){if(t)t.style(e,i,n);else{var o=i.replace(/^-ms-/,"ms-").replace(/-([\da-z])/gi,function(t,e){return e.toUpperCase()});e.style[o]=n}},_toValue:function(t){return this.options.scale.toValue.apply(this,[t])},_toPercentage:function(t){return this.options.scale.toPercentage.apply(this,[t])},_setTooltipPosition:function(){var t=[this.tooltip,this.tooltip_min,this.tooltip_max];if("vertical"===this.options.orientation){var e,i="left"===(e=this.options.tooltip_position?this.options.tooltip_position:this.options.rtl?"left":"right")?"right":"left";t.forEach(function(t){this._addClass(t,e),t.style[i]="100%"}.bind(this))}else"bottom"===this.options.tooltip_position?t.forEach(function(t){this._addClass(t,"bottom"),t.style.top="22px"}.bind(this)):t.forEach(function(t){this._addClass(t,"top"),t.style.top=-this.tooltip.outerHeight-14+"px"}.bind(this))}},t&&t.fn){var a=void 0;t.fn.slider?(windowIsDefined&&window.console.warn("bootstrap-slider.js - WARNING: $.fn.slider namespace is already bound. Use the $.fn.bootstrapSlider namespace instead."),a=n):(t.bridget(i,e),a=i),t.bridget(n,e),t(function(){t("input[data-provide=slider]")[a]()})}}(t),e}),"undefined"==typeof jQuery)throw new Error("Bootstrap's JavaScript requires jQuery");!function(t){"use strict";var e=jQuery.fn.jquery.split(" ")[0].split(".");if(e[0]<2&&e[1]<9||1==e[0]&&9==e[1]&&e[2]<1||e[0]>3)throw new Error("Bootstrap's JavaScript requires jQuery version 1.9.1 or higher, but lower than version 4")}(),function(t){"use strict";function e(e,i){var n=e.nodeName.toLowerCase();if(-1!==t.inArray(n,i))return-1===t.inArray(n,o)||Boolean(e.nodeValue.match(r)||e.nodeValue.match(a));for(var s=t(i).filter(function(t,e){return e instanceof RegExp}),l=0,u=s.length;u>l;l++)if(n.match(s[l]))return!0;return!1}function i(i,n,o){if(0===i.length)return i;if(o&&"function"==typeof o)return o(i);if(!document.implementation||!document.implementation.createHTMLDocument)return i;var s=document.implementation.createHTMLDocument("sanitization");s.body.innerHTML=i;for(var r=t.map(n,function(t,e){return e}),a=t(s.body).find("*"),l=0,u=a.length;u>l;l++){var h=a[l],c=h.nodeName.toLowerCase();if(-1!==t.inArray(c,r))for(var d=t.map(h.attributes,function(t){return t}),p=[].concat(n["*"]||[],n[c]||[]),f=0,m=d.length;m>f;f++)e(d[f],p)||h.removeAttribute(d[f].nodeName);else h.parentNode.removeChild(h)}return s.body.innerHTML}var n=["sanitize","whiteList","sanitizeFn"],o=["background","cite","href","itemtype","longdesc","poster","src","xlink:href"],s={"*":["class","dir","id","lang","role",/^aria-[\w-]*$/i],a:["target","href","title","rel"],area:[],b:[],br:[],col:[],code:[],div:[],em:[],hr:[],h1:[],h2:[],h3:[],h4:[],h5:[],h6:[],i:[],img:["src","alt","title","width","height"],li:[],ol:[],p:[],pre:[],s:[],small:[],span:[],sub:[],sup:[],strong:[],u:[],ul:[]},r=/^(?:(?:https?|mailto|ftp|tel|file):|[^&:\/?#]*(?:[\/?#]|$))/gi,a=/^data:(?:image\/(?:bmp|gif|jpeg|jpg|png|tiff|webp)|video\/(?:mpeg|mp4|ogg|webm)|audio\/(?:mp3|oga|ogg|opus));base64,[a-z0-9+\/]+=*$/i,l=function(t,e){this.type=null,this.options=null,this.enabled=null,this.timeout=null,this.hoverState=null,this.$element=null,this.inState=null,this.init("tooltip",t,e)};l.VERSION="3.4.1",l.TRANSITION_DURATION=150,l.DEFAULTS={animation:!0,placement:"top",selector:!1,template:'<div class="tooltip" role="tooltip"><div class="tooltip-arrow"></div><div class="tooltip-inner"></div></div>',trigger:"hover focus",title:"",delay:0,html:!1,container:!1,viewport:{selector:"body",padding:0},sanitize:!0,sanitizeFn:null,whiteList:s},l.prototype.init=function(e,i,n){if(this.enabled=!0,this.type=e,this.$element=t(i),this.options=this.getOptions(n),this.$viewport=this.options.viewport&&t(document).find(t.isFunction(this.options.viewport)?this.options.viewport.call(this,this.$element):this.options.viewport.selector||this.options.viewport),this.inState={click:!1,hover:!1,focus:!1},this.$element[0]instanceof document.constructor&&!this.options.selector)throw new Error("`selector` option must be specified when initializing "+this.type+" on the window.document object!");for(var o=this.options.trigger.split(" "),s=o.length;s--;){var r=o[s];if("click"==r)this.$element.on("click."+this.type,this.options.selector,t.proxy(this.toggle,this));else if("manual"!=r){var a="hover"==r?"mouseenter":"focusin",l="hover"==r?"mouseleave":"focusout";this.$element.on(a+"."+this.type,this.options.selector,t.proxy(this.enter,this)),this.$element.on(l+"."+this.type,this.options.selector,t.proxy(this.leave,this))}}this.options.selector?this._options=t.extend({},this.options,{trigger:"manual",selector:""}):this.fixTitle()},l.prototype.getDefaults=function(){return l.DEFAULTS},l.prototype.getOptions=function(e){var o=this.$element.data();for(var s in o)o.hasOwnProperty(s)&&-1!==t.inArray(s,n)&&delete o[s];return(e=t.extend({},this.getDefaults(),o,e)).delay&&"number"==typeof e.delay&&(e.delay={show:e.delay,hide:e.delay}),e.sanitize&&(e.template=i(e.template,e.whiteList,e.sanitizeFn)),e},l.prototype.getDelegateOptions=function(){var e={},i=this.getDefaults();return this._options&&t.each(this._options,function(t,n){i[t]!=n&&(e[t]=n)}),e},l.prototype.enter=function(e){var i=e instanceof this.constructor?e:t(e.currentTarget).data("bs."+this.type);return i||(i=new this.constructor(e.currentTarget,this.getDelegateOptions()),t(e.currentTarget).data("bs."+this.type,i)),e instanceof t.Event&&(i.inState["focusin"==e.type?"focus":"hover"]=!0),i.tip().hasClass("in")||"in"==i.hoverState?void(i.hoverState="in"):(clearTimeout(i.timeout),i.hoverState="in",i.options.delay&&i.options.delay.show?void(i.timeout=setTimeout(function(){"in"==i.hoverState&&i.show()},i.options.delay.show)):i.show())},l.prototype.isInStateTrue=function(){for(var t in this.inState)if(this.inState[t])return!0;return!1},l.prototype.leave=function(e){var i=e instanceof this.constructor?e:t(e.currentTarget).data("bs."+this.type);return i||(i=new this.constructor(e.currentTarget,this.getDelegateOptions()),t(e.currentTarget).data("bs."+this.type,i)),e instanceof t.Event&&(i.inState["focusout"==e.type?"focus":"hover"]=!1),i.isInStateTrue()?void 0:(clearTimeout(i.timeout),i.hoverState="out",i.options.delay&&i.options.delay.hide?void(i.timeout=setTimeout(function(){"out"==i.hoverState&&i.hide()},i.options.delay.hide)):i.hide())},l.prototype.show=function(){var e=t.Event("show.bs."+this.type);if(this.hasContent()&&this.enabled){this.$element.trigger(e);var i=t.contains(this.$element[0].ownerDocument.documentElement,this.$element[0]);if(e.isDefaultPrevented()||!i)return;var n=this,o=this.tip(),s=this.getUID(this.type);this.setContent(),o.attr("id",s),this.$element.attr("aria-describedby",s),this.options.animation&&o.addClass("fade");var r="function"==typeof this.options.placement?this.options.placement.call(this,o[0],this.$element[0]):this.options.placement,a=/\s?auto?\s?/i,u=a.test(r);u&&(r=r.replace(a,"")||"top"),o.detach().css({top:0,left:0,display:"block"}).addClass(r).data("bs."+this.type,this),this.options.container?o.appendTo(t(document).find(this.options.container)):o.insertAfter(this.$element),this.$element.trigger("inserted.bs."+this.type);var h=this.getPosition(),c=o[0].offsetWidth,d=o[0].offsetHeight;if(u){var p=r,f=this.getPosition(this.$viewport);r="bottom"==r&&h.bottom+d>f.bottom?"top":"top"==r&&h.top-d<f.top?"bottom":"right"==r&&h.right+c>f.width?"left":"left"==r&&h.left-c<f.left?"right":r,o.removeClass(p).addClass(r)}var m=this.getCalculatedOffset(r,h,c,d);this.applyPlacement(m,r);var g=function(){var t=n.hoverState;n.$element.trigger("shown.bs."+n.type),n.hoverState=null,"out"==t&&n.leave(n)};t.support.transition&&this.$tip.hasClass("fade")?o.one("bsTransitionEnd",g).emulateTransitionEnd(l.TRANSITION_DURATION):g()}},l.prototype.applyPlacement=function(e,i){var n=this.tip(),o=n[0].offsetWidth,s=n[0].offsetHeight,r=parseInt(n.css("margin-top"),10),a=parseInt(n.css("margin-left"),10);isNaN(r)&&(r=0),isNaN(a)&&(a=0),e.top+=r,e.left+=a,t.offset.setOffset(n[0],t.extend({using:function(t){n.css({top:Math.round(t.top),left:Math.round(t.left)})}},e),0),n.addClass("in");var l=n[0].offsetWidth,u=n[0].offsetHeight;"top"==i&&u!=s&&(e.top=e.top+s-u);var h=this.getViewportAdjustedDelta(i,e,l,u);h.left?e.left+=h.left:e.top+=h.top;var c=/top|bottom/.test(i),d=c?2*h.left-o+l:2*h.top-s+u,p=c?"offsetWidth":"offsetHeight";n.offset(e),this.replaceArrow(d,n[0][p],c)},l.prototype.replaceArrow=function(t,e,i){this.arrow().css(i?"left":"top",50*(1-t/e)+"%").css(i?"top":"left","")},l.prototype.setContent=function(){var t=this.tip(),e=this.getTitle();this.options.html?(this.options.sanitize&&(e=i(e,this.options.whiteList,this.options.sanitizeFn)),t.find(".tooltip-inner").html(e)):t.find(".tooltip-inner").text(e),t.removeClass("fade in top bottom left right")},l.prototype.hide=function(e){function i(){"in"!=n.hoverState&&o.detach(),n.$element&&n.$element.removeAttr("aria-describedby").trigger("hidden.bs."+n.type),e&&e()}var n=this,o=t(this.$tip),s=t.Event("hide.bs."+this.type);return this.$element.trigger(s),s.isDefaultPrevented()?void 0:(o.removeClass("in"),t.support.transition&&o.hasClass("fade")?o.one("bsTransitionEnd",i).emulateTransitionEnd(l.TRANSITION_DURATION):i(),this.hoverState=null,this)},l.prototype.fixTitle=function(){var t=this.$element;(t.attr("title")||"string"!=typeof t.attr("data-original-title"))&&t.attr("data-original-title",t.attr("title")||"").attr("title","")},l.prototype.hasContent=function(){return this.getTitle()},l.prototype.getPosition=function(e){var i=(e=e||this.$element)[0],n="BODY"==i.tagName,o=i.getBoundingClientRect();null==o.width&&(o=t.extend({},o,{width:o.right-o.left,height:o.bottom-o.top}));var s=window.SVGElement&&i instanceof window.SVGElement,r=n?{top:0,left:0}:s?null:e.offset(),a={scroll:n?document.documentElement.scrollTop||document.body.scrollTop:e.scrollTop()},l=n?{width:t(window).width(),height:t(window).height()}:null;return t.extend({},o,a,l,r)},l.prototype.getCalculatedOffset=function(t,e,i,n){return"bottom"==t?{top:e.top+e.height,left:e.left+e.width/2-i/2}:"top"==t?{top:e.top-n,left:e.left+e.width/2-i/2}:"left"==t?{top:e.top+e.height/2-n/2,left:e.left-i}:{top:e.top+e.height/2-n/2,left:e.left+e.width}},l.prototype.getViewportAdjustedDelta=function(t,e,i,n){var o={top:0,left:0};if(!this.$viewport)return o;var s=this.options.viewport&&this.options.viewport.padding||0,r=this.getPosition(this.$viewport);if(/right|left/.test(t)){var a=e.top-s-r.scroll,l=e.top+s-r.scroll+n;a<r.top?o.top=r.top-a:l>r.top+r.height&&(o.top=r.top+r.height-l)}else{var u=e.left-s,h=e.left+s+i;u<r.left?o.left=r.left-u:h>r.right&&(o.left=r.left+r.width-h)}return o},l.prototype.getTitle=function(){var t=this.$element,e=this.options;return t.attr("data-original-title")||("function"==typeof e.title?e.title.call(t[0]):e.title)},l.prototype.getUID=function(t){do{t+=~~(1e6*Math.random())}while(document.getElementById(t));return t},l.prototype.tip=function(){if(!this.$tip&&(this.$tip=t(this.options.template),1!=this.$tip.length))throw new Error(this.type+" `template` option must consist of exactly 1 top-level element!");return this.$tip},l.prototype.arrow=function(){return this.$arrow=this.$arrow||this.tip().find(".tooltip-arrow")},l.prototype.enable=function(){this.enabled=!0},l.prototype.disable=function(){this.enabled=!1},l.prototype.toggleEnabled=function(){this.enabled=!this.enabled},l.prototype.toggle=function(e){var i=this;e&&((i=t(e.currentTarget).data("bs."+this.type))||(i=new this.constructor(e.currentTarget,this.getDelegateOptions()),t(e.currentTarget).data("bs."+this.type,i))),e?(i.inState.click=!i.inState.click,i.isInStateTrue()?i.enter(i):i.leave(i)):i.tip().hasClass("in")?i.leave(i):i.enter(i)},l.prototype.destroy=function(){var t=this;clearTimeout(this.timeout),this.hide(function(){t.$element.off("."+t.type).removeData("bs."+t.type),t.$tip&&t.$tip.detach(),t.$tip=null,t.$arrow=null,t.$viewport=null,t.$element=null})},l.prototype.sanitizeHtml=function(t){return i(t,this.options.whiteList,this.options.sanitizeFn)};var u=t.fn.tooltip;t.fn.tooltip=function(e){return this.each(function(){var i=t(this),n=i.data("bs.tooltip"),o="object"==typeof e&&e;!n&&/destroy|hide/.test(e)||(n||i.data("bs.tooltip",n=new l(this,o)),"string"==typeof e&&n[e]())})},t.fn.tooltip.Constructor=l,t.fn.tooltip.noConflict=function(){return t.fn.tooltip=u,this}}(jQuery),function(t){"use strict";function e(e){return this.each(function(){var n=t(this),o=n.data("bs.tab");o||n.data("bs.tab",o=new i(this)),"string"==typeof e&&o[e]()})}var i=function(e){this.element=t(e)};i.VERSION="3.4.1",i.TRANSITION_DURATION=150,i.prototype.show=function(){var e=this.element,i=e.closest("ul:not(.dropdown-menu)"),n=e.data("target");if(n||(n=(n=e.attr("href"))&&n.replace(/.*(?=#[^\s]*$)/,"")),!e.parent("li").hasClass("active")){var o=i.find(".active:last a"),s=t.Event("hide.bs.tab",{relatedTarget:e[0]}),r=t.Event("show.bs.tab",{relatedTarget:o[0]});if(o.trigger(s),e.trigger(r),!r.isDefaultPrevented()&&!s.isDefaultPrevented()){var a=t(document).find(n);this.activate(e.closest("li"),i),this.activate(a,a.parent(),function(){o.trigger({type:"hidden.bs.tab",relatedTarget:e[0]}),e.trigger({type:"shown.bs.tab",relatedTarget:o[0]})})}}},i.prototype.activate=function(e,n,o){function s(){r.removeClass("active").find("> .dropdown-menu > .active").removeClass("active").end().find('[data-toggle="tab"]').attr("aria-expanded",!1),e.addClass("active").find('[data-toggle="tab"]').attr("aria-expanded",!0),a?(e[0].offsetWidth,e.addClass("in")):e.removeClass("fade"),e.parent(".dropdown-menu").length&&e.closest("li.dropdown").addClass("active").end().find('[data-toggle="tab"]').attr("aria-expanded",!0),o&&o()}var r=n.find("> .active"),a=o&&t.support.transition&&(r.length&&r.hasClass("fade")||!!n.find("> .fade").length);r.length&&a?r.one("bsTransitionEnd",s).emulateTransitionEnd(i.TRANSITION_DURATION):s(),r.removeClass("in")};var n=t.fn.tab;t.fn.tab=e,t.fn.tab.Constructor=i,t.fn.tab.noConflict=function(){return t.fn.tab=n,this};var o=function(i){i.preventDefault(),e.call(t(this),"show")};t(document).on("click.bs.tab.data-api",'[data-toggle="tab"]',o).on("click.bs.tab.data-api",'[data-toggle="pill"]',o)}(jQuery);const key_motor_position="motor_position",key_brightness_threshold="brightness_threshold",key_upper_brightness_threshold="upper_brightness_threshold",key_lower_brightness_threshold="lower_brightness_threshold",key_color="color",key_is_autonomous="is_autonomous",key_brightness="brightness",key_touch_left="touch_left",key_touch_right="touch_right",key_alpha="alpha",key_has_touch="has_touch",key_has_light="has_light",key_speed="speed",id_slider_motor_position="motor-position-slider",id_slider_brightness_threshold="brightness-threshold-slider",id_slider_brightness_threshold_title="brightness-threshold-slider-title",id_slider_speed="speed-slider",id_color_picker="color-picker",id_color_picker_manual="color-picker-manual",id_indicator_has_touch="has-touch-indicator",id_indicator_has_light="has-light-indicator",id_indicator_touch_direction_image="touch-direction-image",id_indicator_light_image="light-image",id_tab_manual="manual",id_tab_autonomous="autonomous",id_slider_brightness_threshold_current_value="brightness-threshold-current-value-slider",id_slider_brightness_threshold_minmax="brightness-threshold-minmax-slider";var upper_brightness_threshold=100,lower_brightness_threshold=0,min_measured_brightness=100,max_measured_brightness=0,current_measured_brightness=0,selected_color="#0091DC",is_autonomous=!1,color_picker_is_open=!0,is_updating_from_web=!1;function sendConfiguration(){if(!is_updating_from_web){var t=$("#"+id_slider_motor_position).slider("getValue")/10,e=is_autonomous?1:0,i=selected_color,n=$("#"+id_slider_speed).slider("getValue")/10,o=$("#"+id_slider_brightness_threshold).slider("getValue")[0],s=$("#"+id_slider_brightness_threshold).slider("getValue")[1];document.getElementById("motor-position-slider-title").innerHTML=Math.ceil(Number(t)),document.getElementById("speed-slider-title").innerHTML=Math.ceil(Number(n)),$.post("/configuration",jQuery.param({[key_motor_position]:t,[key_speed]:n,[key_lower_brightness_threshold]:o,[key_upper_brightness_threshold]:s,[key_is_autonomous]:e,[key_color]:i}),readResponse)}}function fetchConfiguration(){$.get("/configuration",readResponse)}function fetchSensorData(){$.get("/sensorData",readResponse)}function calibrate(){max_measured_brightness=current_measured_brightness,min_measured_brightness=current_measured_brightness,lower_brightness_threshold=(lower_brightness_threshold=current_measured_brightness-20)<0?0:lower_brightness_threshold,upper_brightness_threshold=(upper_brightness_threshold=current_measured_brightness+20)>100?100:upper_brightness_threshold,$("#"+id_slider_brightness_threshold).slider("setValue",[Number(lower_brightness_threshold),Number(upper_brightness_threshold)]),sendConfiguration()}function readResponse(t){var e={};String(t).split("&").forEach(function(t){var i=String(t).split("=");e[i[0]]=i[1]}),updateUI(e)}function updateUI(t){is_updating_from_web=!0;var e=t[key_motor_position];null!==e&&$("#"+id_slider_motor_position).slider("setValue",10*Number(e),!0);var i=t[key_upper_brightness_threshold],n=t[key_lower_brightness_threshold];null!==i&&null!==n&&(upper_brightness_threshold=i,lower_brightness_threshold=n,$("#"+id_slider_brightness_threshold).slider("setValue",[Number(lower_brightness_threshold),Number(upper_brightness_threshold)])),null!==(r=t[key_color])&&($("#"+id_color_picker).attr("value",r),$("#"+id_color_picker_manual).attr("value",r),color_picker_is_open||($("#"+id_color_picker).val(r),$("#"+id_color_picker).css("background-color",r),$("#"+id_color_picker_manual).css("background-color",r)));var o=t[key_brightness];null!==o&&(current_measured_brightness=Number(o),max_measured_brightness=current_measured_brightness>max_measured_brightness?current_measured_brightness:max_measured_brightness,min_measured_brightness=current_measured_brightness<min_measured_brightness?current_measured_brightness:min_measured_brightness,$("#"+id_slider_brightness_threshold_current_value).slider("setValue",Number(current_measured_brightness)),$("#"+id_slider_brightness_threshold_minmax).slider("setValue",[Number(min_measured_brightness),Number(max_measured_brightness)]));var s=t[key_has_light];if(null!==s){var r="1"==s?"rgb(207,229,247)":"#E1E5E8";$("#"+id_indicator_has_light).css("background-color",r);var a="1"==s?"./images/EnableLightSensor.svg":"./images/LightDisabledSensor.svg";$("#"+id_indicator_light_image).attr("src",a)}var l=t[key_has_touch];if(null!==l){r="1"==l?"rgb(207,229,247)":"#E1E5E8";$("#"+id_indicator_has_touch).css("background-color",r),"0"==l?$("#"+id_indicator_touch_direction_image).attr("src","./images/TouchDisabledSensor.svg"):"1"==t[key_touch_right]?$("#"+id_indicator_touch_direction_image).attr("src","./images/UpperTouchSensor.svg"):"1"==t[key_touch_left]?$("#"+id_indicator_touch_direction_image).attr("src","./images/LowerTouchSensor.svg"):$("#"+id_indicator_touch_direction_image).attr("src","./images/EnableTouchSensor.svg")}var u=t[key_speed];null!=u&&$("#"+id_slider_speed).slider("setValue",10*Number(u),!0),is_updating_from_web=!1}function createSampleBrightnessThresholdSlider(){$("#"+id_slider_brightness_threshold).slider({id:"#brightnessHandlerSlider",min:0,max:100,value:[30,70],focus:!0}),$("#"+id_slider_brightness_threshold_current_value).slider({id:"current-brightness",min:0,max:100,value:50,focus:!0}),$("#"+id_slider_brightness_threshold_minmax).slider({id:"minmax-brightness-threshold-slider",min:0,max:100,range:!0,value:[20,90],focus:!0})}$(document).ready(function(){$("#"+id_color_picker).attr("value",selected_color),$("#"+id_color_picker_manual).attr("value",selected_color),$(document).on("click",".navbar-collapse.in",function(t){$(t.target).is("a")&&$(this).collapse("hide")}),createSampleBrightnessThresholdSlider();$("#"+id_slider_motor_position).slider({}),$("#"+id_slider_brightness_threshold).slider({}),$("#"+id_slider_speed).slider({});var t=$("#"+id_color_picker);t.click(function(){color_picker_is_open=!0}),t.change(function(){color_picker_is_open=!1}),t.focusin(function(){color_picker_is_open&&(color_picker_is_open=!1)}),$("#flower .slider").bind("slideStop",sendConfiguration),document.getElementById(id_color_picker).addEventListener("change",function(t){selected_color=$("#"+id_color_picker).val(),sendConfiguration()},!1),document.getElementById(id_color_picker_manual).addEventListener("change",function(t){selected_color=$("#"+id_color_picker_manual).val(),sendConfiguration()},!1),$('a[data-toggle="tab"]').on("shown.bs.tab",function(t){var e="Autonomous"==$(t.target).text();is_autonomous!=e&&(is_autonomous=e,sendConfiguration())}),fetchConfiguration(),setInterval(fetchSensorData,1e3)});
\ No newline at end of file
+!function(t,e){"use strict";"object"==typeof module&&"object"==typeof module.exports?module.exports=t.document?e(t,!0):function(t){if(!t.document)throw new Error("jQuery requires a window with a document");return e(t)}:e(t)}("undefined"!=typeof window?window:this,function(t,e){"use strict";var i=[],n=t.document,o=Object.getPrototypeOf,s=i.slice,r=i.concat,a=i.push,l=i.indexOf,u={},h=u.toString,c=u.hasOwnProperty,d=c.toString,p=d.call(Object),f={};function m(t,e){var i=(e=e||n).createElement("script");i.text=t,e.head.appendChild(i).parentNode.removeChild(i)}var g="3.2.1",v=function(t,e){return new v.fn.init(t,e)},y=/^[\s\uFEFF\xA0]+|[\s\uFEFF\xA0]+$/g,_=/^-ms-/,b=/-([a-z])/g,x=function(t,e){return e.toUpperCase()};function w(t){var e=!!t&&"length"in t&&t.length,i=v.type(t);return"function"!==i&&!v.isWindow(t)&&("array"===i||0===e||"number"==typeof e&&e>0&&e-1 in t)}v.fn=v.prototype={jquery:g,constructor:v,length:0,toArray:function(){return s.call(this)},get:function(t){return null==t?s.call(this):t<0?this[t+this.length]:this[t]},pushStack:function(t){var e=v.merge(this.constructor(),t);return e.prevObject=this,e},each:function(t){return v.each(this,t)},map:function(t){return this.pushStack(v.map(this,function(e,i){return t.call(e,i,e)}))},slice:function(){return this.pushStack(s.apply(this,arguments))},first:function(){return this.eq(0)},last:function(){return this.eq(-1)},eq:function(t){var e=this.length,i=+t+(t<0?e:0);return this.pushStack(i>=0&&i<e?[this[i]]:[])},end:function(){return this.prevObject||this.constructor()},push:a,sort:i.sort,splice:i.splice},v.extend=v.fn.extend=function(){var t,e,i,n,o,s,r=arguments[0]||{},a=1,l=arguments.length,u=!1;for("boolean"==typeof r&&(u=r,r=arguments[a]||{},a++),"object"==typeof r||v.isFunction(r)||(r={}),a===l&&(r=this,a--);a<l;a++)if(null!=(t=arguments[a]))for(e in t)i=r[e],r!==(n=t[e])&&(u&&n&&(v.isPlainObject(n)||(o=Array.isArray(n)))?(o?(o=!1,s=i&&Array.isArray(i)?i:[]):s=i&&v.isPlainObject(i)?i:{},r[e]=v.extend(u,s,n)):void 0!==n&&(r[e]=n));return r},v.extend({expando:"jQuery"+(g+Math.random()).replace(/\D/g,""),isReady:!0,error:function(t){throw new Error(t)},noop:function(){},isFunction:function(t){return"function"===v.type(t)},isWindow:function(t){return null!=t&&t===t.window},isNumeric:function(t){var e=v.type(t);return("number"===e||"string"===e)&&!isNaN(t-parseFloat(t))},isPlainObject:function(t){var e,i;return!(!t||"[object Object]"!==h.call(t)||(e=o(t))&&(i=c.call(e,"constructor")&&e.constructor,"function"!=typeof i||d.call(i)!==p))},isEmptyObject:function(t){var e;for(e in t)return!1;return!0},type:function(t){return null==t?t+"":"object"==typeof t||"function"==typeof t?u[h.call(t)]||"object":typeof t},globalEval:function(t){m(t)},camelCase:function(t){return t.replace(_,"ms-").replace(b,x)},each:function(t,e){var i,n=0;if(w(t))for(i=t.length;n<i&&!1!==e.call(t[n],n,t[n]);n++);else for(n in t)if(!1===e.call(t[n],n,t[n]))break;return t},trim:function(t){return null==t?"":(t+"").replace(y,"")},makeArray:function(t,e){var i=e||[];return null!=t&&(w(Object(t))?v.merge(i,"string"==typeof t?[t]:t):a.call(i,t)),i},inArray:function(t,e,i){return null==e?-1:l.call(e,t,i)},merge:function(t,e){for(var i=+e.length,n=0,o=t.length;n<i;n++)t[o++]=e[n];return t.length=o,t},grep:function(t,e,i){for(var n=[],o=0,s=t.length,r=!i;o<s;o++)!e(t[o],o)!==r&&n.push(t[o]);return n},map:function(t,e,i){var n,o,s=0,a=[];if(w(t))for(n=t.length;s<n;s++)null!=(o=e(t[s],s,i))&&a.push(o);else for(s in t)null!=(o=e(t[s],s,i))&&a.push(o);return r.apply([],a)},guid:1,proxy:function(t,e){var i,n,o;if("string"==typeof e&&(i=t[e],e=t,t=i),v.isFunction(t))return n=s.call(arguments,2),(o=function(){return t.apply(e||this,n.concat(s.call(arguments)))}).guid=t.guid=t.guid||v.guid++,o},now:Date.now,support:f}),"function"==typeof Symbol&&(v.fn[Symbol.iterator]=i[Symbol.iterator]),v.each("Boolean Number String Function Array Date RegExp Object Error Symbol".split(" "),function(t,e){u["[object "+e+"]"]=e.toLowerCase()});var k=function(t){var e,i,n,o,s,r,a,l,u,h,c,d,p,f,m,g,v,y,_,b="sizzle"+1*new Date,x=t.document,w=0,k=0,C=rt(),T=rt(),E=rt(),S=function(t,e){return t===e&&(c=!0),0},N={}.hasOwnProperty,A=[],L=A.pop,D=A.push,j=A.push,P=A.slice,H=function(t,e){for(var i=0,n=t.length;i<n;i++)if(t[i]===e)return i;return-1},$="checked|selected|async|autofocus|autoplay|controls|defer|disabled|hidden|ismap|loop|multiple|open|readonly|required|scoped",M="[\\x20\\t\\r\\n\\f]",q="(?:\\\\.|[\\w-]|[^\0-\\xa0])+",O="\\["+M+"*("+q+")(?:"+M+"*([*^$|!~]?=)"+M+"*(?:'((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\"|("+q+"))|)"+M+"*\\]",F=":("+q+")(?:\\((('((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\")|((?:\\\\.|[^\\\\()[\\]]|"+O+")*)|.*)\\)|)",I=new RegExp(M+"+","g"),R=new RegExp("^"+M+"+|((?:^|[^\\\\])(?:\\\\.)*)"+M+"+$","g"),z=new RegExp("^"+M+"*,"+M+"*"),B=new RegExp("^"+M+"*([>+~]|"+M+")"+M+"*"),W=new RegExp("="+M+"*([^\\]'\"]*?)"+M+"*\\]","g"),V=new RegExp(F),U=new RegExp("^"+q+"$"),X={ID:new RegExp("^#("+q+")"),CLASS:new RegExp("^\\.("+q+")"),TAG:new RegExp("^("+q+"|[*])"),ATTR:new RegExp("^"+O),PSEUDO:new RegExp("^"+F),CHILD:new RegExp("^:(only|first|last|nth|nth-last)-(child|of-type)(?:\\("+M+"*(even|odd|(([+-]|)(\\d*)n|)"+M+"*(?:([+-]|)"+M+"*(\\d+)|))"+M+"*\\)|)","i"),bool:new RegExp("^(?:"+$+")$","i"),needsContext:new RegExp("^"+M+"*[>+~]|:(even|odd|eq|gt|lt|nth|first|last)(?:\\("+M+"*((?:-\\d)?\\d*)"+M+"*\\)|)(?=[^-]|$)","i")},Q=/^(?:input|select|textarea|button)$/i,Y=/^h\d$/i,G=/^[^{]+\{\s*\[native \w/,J=/^(?:#([\w-]+)|(\w+)|\.([\w-]+))$/,K=/[+~]/,Z=new RegExp("\\\\([\\da-f]{1,6}"+M+"?|("+M+")|.)","ig"),tt=function(t,e,i){var n="0x"+e-65536;return n!=n||i?e:n<0?String.fromCharCode(n+65536):String.fromCharCode(n>>10|55296,1023&n|56320)},et=/([\0-\x1f\x7f]|^-?\d)|^-$|[^\0-\x1f\x7f-\uFFFF\w-]/g,it=function(t,e){return e?"\0"===t?"�":t.slice(0,-1)+"\\"+t.charCodeAt(t.length-1).toString(16)+" ":"\\"+t},nt=function(){d()},ot=yt(function(t){return!0===t.disabled&&("form"in t||"label"in t)},{dir:"parentNode",next:"legend"});try{j.apply(A=P.call(x.childNodes),x.childNodes),A[x.childNodes.length].nodeType}catch(t){j={apply:A.length?function(t,e){D.apply(t,P.call(e))}:function(t,e){for(var i=t.length,n=0;t[i++]=e[n++];);t.length=i-1}}}function st(t,e,n,o){var s,a,u,h,c,f,v,y=e&&e.ownerDocument,w=e?e.nodeType:9;if(n=n||[],"string"!=typeof t||!t||1!==w&&9!==w&&11!==w)return n;if(!o&&((e?e.ownerDocument||e:x)!==p&&d(e),e=e||p,m)){if(11!==w&&(c=J.exec(t)))if(s=c[1]){if(9===w){if(!(u=e.getElementById(s)))return n;if(u.id===s)return n.push(u),n}else if(y&&(u=y.getElementById(s))&&_(e,u)&&u.id===s)return n.push(u),n}else{if(c[2])return j.apply(n,e.getElementsByTagName(t)),n;if((s=c[3])&&i.getElementsByClassName&&e.getElementsByClassName)return j.apply(n,e.getElementsByClassName(s)),n}if(i.qsa&&!E[t+" "]&&(!g||!g.test(t))){if(1!==w)y=e,v=t;else if("object"!==e.nodeName.toLowerCase()){for((h=e.getAttribute("id"))?h=h.replace(et,it):e.setAttribute("id",h=b),a=(f=r(t)).length;a--;)f[a]="#"+h+" "+vt(f[a]);v=f.join(","),y=K.test(t)&&mt(e.parentNode)||e}if(v)try{return j.apply(n,y.querySelectorAll(v)),n}catch(t){}finally{h===b&&e.removeAttribute("id")}}}return l(t.replace(R,"$1"),e,n,o)}function rt(){var t=[];return function e(i,o){return t.push(i+" ")>n.cacheLength&&delete e[t.shift()],e[i+" "]=o}}function at(t){return t[b]=!0,t}function lt(t){var e=p.createElement("fieldset");try{return!!t(e)}catch(t){return!1}finally{e.parentNode&&e.parentNode.removeChild(e),e=null}}function ut(t,e){for(var i=t.split("|"),o=i.length;o--;)n.attrHandle[i[o]]=e}function ht(t,e){var i=e&&t,n=i&&1===t.nodeType&&1===e.nodeType&&t.sourceIndex-e.sourceIndex;if(n)return n;if(i)for(;i=i.nextSibling;)if(i===e)return-1;return t?1:-1}function ct(t){return function(e){return"input"===e.nodeName.toLowerCase()&&e.type===t}}function dt(t){return function(e){var i=e.nodeName.toLowerCase();return("input"===i||"button"===i)&&e.type===t}}function pt(t){return function(e){return"form"in e?e.parentNode&&!1===e.disabled?"label"in e?"label"in e.parentNode?e.parentNode.disabled===t:e.disabled===t:e.isDisabled===t||e.isDisabled!==!t&&ot(e)===t:e.disabled===t:"label"in e&&e.disabled===t}}function ft(t){return at(function(e){return e=+e,at(function(i,n){for(var o,s=t([],i.length,e),r=s.length;r--;)i[o=s[r]]&&(i[o]=!(n[o]=i[o]))})})}function mt(t){return t&&void 0!==t.getElementsByTagName&&t}for(e in i=st.support={},s=st.isXML=function(t){var e=t&&(t.ownerDocument||t).documentElement;return!!e&&"HTML"!==e.nodeName},d=st.setDocument=function(t){var e,o,r=t?t.ownerDocument||t:x;return r!==p&&9===r.nodeType&&r.documentElement?(f=(p=r).documentElement,m=!s(p),x!==p&&(o=p.defaultView)&&o.top!==o&&(o.addEventListener?o.addEventListener("unload",nt,!1):o.attachEvent&&o.attachEvent("onunload",nt)),i.attributes=lt(function(t){return t.className="i",!t.getAttribute("className")}),i.getElementsByTagName=lt(function(t){return t.appendChild(p.createComment("")),!t.getElementsByTagName("*").length}),i.getElementsByClassName=G.test(p.getElementsByClassName),i.getById=lt(function(t){return f.appendChild(t).id=b,!p.getElementsByName||!p.getElementsByName(b).length}),i.getById?(n.filter.ID=function(t){var e=t.replace(Z,tt);return function(t){return t.getAttribute("id")===e}},n.find.ID=function(t,e){if(void 0!==e.getElementById&&m){var i=e.getElementById(t);return i?[i]:[]}}):(n.filter.ID=function(t){var e=t.replace(Z,tt);return function(t){var i=void 0!==t.getAttributeNode&&t.getAttributeNode("id");return i&&i.value===e}},n.find.ID=function(t,e){if(void 0!==e.getElementById&&m){var i,n,o,s=e.getElementById(t);if(s){if((i=s.getAttributeNode("id"))&&i.value===t)return[s];for(o=e.getElementsByName(t),n=0;s=o[n++];)if((i=s.getAttributeNode("id"))&&i.value===t)return[s]}return[]}}),n.find.TAG=i.getElementsByTagName?function(t,e){return void 0!==e.getElementsByTagName?e.getElementsByTagName(t):i.qsa?e.querySelectorAll(t):void 0}:function(t,e){var i,n=[],o=0,s=e.getElementsByTagName(t);if("*"===t){for(;i=s[o++];)1===i.nodeType&&n.push(i);return n}return s},n.find.CLASS=i.getElementsByClassName&&function(t,e){if(void 0!==e.getElementsByClassName&&m)return e.getElementsByClassName(t)},v=[],g=[],(i.qsa=G.test(p.querySelectorAll))&&(lt(function(t){f.appendChild(t).innerHTML="<a id='"+b+"'></a><select id='"+b+"-\r\\' msallowcapture=''><option selected=''></option></select>",t.querySelectorAll("[msallowcapture^='']").length&&g.push("[*^$]="+M+"*(?:''|\"\")"),t.querySelectorAll("[selected]").length||g.push("\\["+M+"*(?:value|"+$+")"),t.querySelectorAll("[id~="+b+"-]").length||g.push("~="),t.querySelectorAll(":checked").length||g.push(":checked"),t.querySelectorAll("a#"+b+"+*").length||g.push(".#.+[+~]")}),lt(function(t){t.innerHTML="<a href='' disabled='disabled'></a><select disabled='disabled'><option/></select>";var e=p.createElement("input");e.setAttribute("type","hidden"),t.appendChild(e).setAttribute("name","D"),t.querySelectorAll("[name=d]").length&&g.push("name"+M+"*[*^$|!~]?="),2!==t.querySelectorAll(":enabled").length&&g.push(":enabled",":disabled"),f.appendChild(t).disabled=!0,2!==t.querySelectorAll(":disabled").length&&g.push(":enabled",":disabled"),t.querySelectorAll("*,:x"),g.push(",.*:")})),(i.matchesSelector=G.test(y=f.matches||f.webkitMatchesSelector||f.mozMatchesSelector||f.oMatchesSelector||f.msMatchesSelector))&&lt(function(t){i.disconnectedMatch=y.call(t,"*"),y.call(t,"[s!='']:x"),v.push("!=",F)}),g=g.length&&new RegExp(g.join("|")),v=v.length&&new RegExp(v.join("|")),e=G.test(f.compareDocumentPosition),_=e||G.test(f.contains)?function(t,e){var i=9===t.nodeType?t.documentElement:t,n=e&&e.parentNode;return t===n||!(!n||1!==n.nodeType||!(i.contains?i.contains(n):t.compareDocumentPosition&&16&t.compareDocumentPosition(n)))}:function(t,e){if(e)for(;e=e.parentNode;)if(e===t)return!0;return!1},S=e?function(t,e){if(t===e)return c=!0,0;var n=!t.compareDocumentPosition-!e.compareDocumentPosition;return n||(1&(n=(t.ownerDocument||t)===(e.ownerDocument||e)?t.compareDocumentPosition(e):1)||!i.sortDetached&&e.compareDocumentPosition(t)===n?t===p||t.ownerDocument===x&&_(x,t)?-1:e===p||e.ownerDocument===x&&_(x,e)?1:h?H(h,t)-H(h,e):0:4&n?-1:1)}:function(t,e){if(t===e)return c=!0,0;var i,n=0,o=t.parentNode,s=e.parentNode,r=[t],a=[e];if(!o||!s)return t===p?-1:e===p?1:o?-1:s?1:h?H(h,t)-H(h,e):0;if(o===s)return ht(t,e);for(i=t;i=i.parentNode;)r.unshift(i);for(i=e;i=i.parentNode;)a.unshift(i);for(;r[n]===a[n];)n++;return n?ht(r[n],a[n]):r[n]===x?-1:a[n]===x?1:0},p):p},st.matches=function(t,e){return st(t,null,null,e)},st.matchesSelector=function(t,e){if((t.ownerDocument||t)!==p&&d(t),e=e.replace(W,"='$1']"),i.matchesSelector&&m&&!E[e+" "]&&(!v||!v.test(e))&&(!g||!g.test(e)))try{var n=y.call(t,e);if(n||i.disconnectedMatch||t.document&&11!==t.document.nodeType)return n}catch(t){}return st(e,p,null,[t]).length>0},st.contains=function(t,e){return(t.ownerDocument||t)!==p&&d(t),_(t,e)},st.attr=function(t,e){(t.ownerDocument||t)!==p&&d(t);var o=n.attrHandle[e.toLowerCase()],s=o&&N.call(n.attrHandle,e.toLowerCase())?o(t,e,!m):void 0;return void 0!==s?s:i.attributes||!m?t.getAttribute(e):(s=t.getAttributeNode(e))&&s.specified?s.value:null},st.escape=function(t){return(t+"").replace(et,it)},st.error=function(t){throw new Error("Syntax error, unrecognized expression: "+t)},st.uniqueSort=function(t){var e,n=[],o=0,s=0;if(c=!i.detectDuplicates,h=!i.sortStable&&t.slice(0),t.sort(S),c){for(;e=t[s++];)e===t[s]&&(o=n.push(s));for(;o--;)t.splice(n[o],1)}return h=null,t},o=st.getText=function(t){var e,i="",n=0,s=t.nodeType;if(s){if(1===s||9===s||11===s){if("string"==typeof t.textContent)return t.textContent;for(t=t.firstChild;t;t=t.nextSibling)i+=o(t)}else if(3===s||4===s)return t.nodeValue}else for(;e=t[n++];)i+=o(e);return i},(n=st.selectors={cacheLength:50,createPseudo:at,match:X,attrHandle:{},find:{},relative:{">":{dir:"parentNode",first:!0}," ":{dir:"parentNode"},"+":{dir:"previousSibling",first:!0},"~":{dir:"previousSibling"}},preFilter:{ATTR:function(t){return t[1]=t[1].replace(Z,tt),t[3]=(t[3]||t[4]||t[5]||"").replace(Z,tt),"~="===t[2]&&(t[3]=" "+t[3]+" "),t.slice(0,4)},CHILD:function(t){return t[1]=t[1].toLowerCase(),"nth"===t[1].slice(0,3)?(t[3]||st.error(t[0]),t[4]=+(t[4]?t[5]+(t[6]||1):2*("even"===t[3]||"odd"===t[3])),t[5]=+(t[7]+t[8]||"odd"===t[3])):t[3]&&st.error(t[0]),t},PSEUDO:function(t){var e,i=!t[6]&&t[2];return X.CHILD.test(t[0])?null:(t[3]?t[2]=t[4]||t[5]||"":i&&V.test(i)&&(e=r(i,!0))&&(e=i.indexOf(")",i.length-e)-i.length)&&(t[0]=t[0].slice(0,e),t[2]=i.slice(0,e)),t.slice(0,3))}},filter:{TAG:function(t){var e=t.replace(Z,tt).toLowerCase();return"*"===t?function(){return!0}:function(t){return t.nodeName&&t.nodeName.toLowerCase()===e}},CLASS:function(t){var e=C[t+" "];return e||(e=new RegExp("(^|"+M+")"+t+"("+M+"|$)"))&&C(t,function(t){return e.test("string"==typeof t.className&&t.className||void 0!==t.getAttribute&&t.getAttribute("class")||"")})},ATTR:function(t,e,i){return function(n){var o=st.attr(n,t);return null==o?"!="===e:!e||(o+="","="===e?o===i:"!="===e?o!==i:"^="===e?i&&0===o.indexOf(i):"*="===e?i&&o.indexOf(i)>-1:"$="===e?i&&o.slice(-i.length)===i:"~="===e?(" "+o.replace(I," ")+" ").indexOf(i)>-1:"|="===e&&(o===i||o.slice(0,i.length+1)===i+"-"))}},CHILD:function(t,e,i,n,o){var s="nth"!==t.slice(0,3),r="last"!==t.slice(-4),a="of-type"===e;return 1===n&&0===o?function(t){return!!t.parentNode}:function(e,i,l){var u,h,c,d,p,f,m=s!==r?"nextSibling":"previousSibling",g=e.parentNode,v=a&&e.nodeName.toLowerCase(),y=!l&&!a,_=!1;if(g){if(s){for(;m;){for(d=e;d=d[m];)if(a?d.nodeName.toLowerCase()===v:1===d.nodeType)return!1;f=m="only"===t&&!f&&"nextSibling"}return!0}if(f=[r?g.firstChild:g.lastChild],r&&y){for(_=(p=(u=(h=(c=(d=g)[b]||(d[b]={}))[d.uniqueID]||(c[d.uniqueID]={}))[t]||[])[0]===w&&u[1])&&u[2],d=p&&g.childNodes[p];d=++p&&d&&d[m]||(_=p=0)||f.pop();)if(1===d.nodeType&&++_&&d===e){h[t]=[w,p,_];break}}else if(y&&(_=p=(u=(h=(c=(d=e)[b]||(d[b]={}))[d.uniqueID]||(c[d.uniqueID]={}))[t]||[])[0]===w&&u[1]),!1===_)for(;(d=++p&&d&&d[m]||(_=p=0)||f.pop())&&((a?d.nodeName.toLowerCase()!==v:1!==d.nodeType)||!++_||(y&&((h=(c=d[b]||(d[b]={}))[d.uniqueID]||(c[d.uniqueID]={}))[t]=[w,_]),d!==e)););return(_-=o)===n||_%n==0&&_/n>=0}}},PSEUDO:function(t,e){var i,o=n.pseudos[t]||n.setFilters[t.toLowerCase()]||st.error("unsupported pseudo: "+t);return o[b]?o(e):o.length>1?(i=[t,t,"",e],n.setFilters.hasOwnProperty(t.toLowerCase())?at(function(t,i){for(var n,s=o(t,e),r=s.length;r--;)t[n=H(t,s[r])]=!(i[n]=s[r])}):function(t){return o(t,0,i)}):o}},pseudos:{not:at(function(t){var e=[],i=[],n=a(t.replace(R,"$1"));return n[b]?at(function(t,e,i,o){for(var s,r=n(t,null,o,[]),a=t.length;a--;)(s=r[a])&&(t[a]=!(e[a]=s))}):function(t,o,s){return e[0]=t,n(e,null,s,i),e[0]=null,!i.pop()}}),has:at(function(t){return function(e){return st(t,e).length>0}}),contains:at(function(t){return t=t.replace(Z,tt),function(e){return(e.textContent||e.innerText||o(e)).indexOf(t)>-1}}),lang:at(function(t){return U.test(t||"")||st.error("unsupported lang: "+t),t=t.replace(Z,tt).toLowerCase(),function(e){var i;do{if(i=m?e.lang:e.getAttribute("xml:lang")||e.getAttribute("lang"))return(i=i.toLowerCase())===t||0===i.indexOf(t+"-")}while((e=e.parentNode)&&1===e.nodeType);return!1}}),target:function(e){var i=t.location&&t.location.hash;return i&&i.slice(1)===e.id},root:function(t){return t===f},focus:function(t){return t===p.activeElement&&(!p.hasFocus||p.hasFocus())&&!!(t.type||t.href||~t.tabIndex)},enabled:pt(!1),disabled:pt(!0),checked:function(t){var e=t.nodeName.toLowerCase();return"input"===e&&!!t.checked||"option"===e&&!!t.selected},selected:function(t){return t.parentNode&&t.parentNode.selectedIndex,!0===t.selected},empty:function(t){for(t=t.firstChild;t;t=t.nextSibling)if(t.nodeType<6)return!1;return!0},parent:function(t){return!n.pseudos.empty(t)},header:function(t){return Y.test(t.nodeName)},input:function(t){return Q.test(t.nodeName)},button:function(t){var e=t.nodeName.toLowerCase();return"input"===e&&"button"===t.type||"button"===e},text:function(t){var e;return"input"===t.nodeName.toLowerCase()&&"text"===t.type&&(null==(e=t.getAttribute("type"))||"text"===e.toLowerCase())},first:ft(function(){return[0]}),last:ft(function(t,e){return[e-1]}),eq:ft(function(t,e,i){return[i<0?i+e:i]}),even:ft(function(t,e){for(var i=0;i<e;i+=2)t.push(i);return t}),odd:ft(function(t,e){for(var i=1;i<e;i+=2)t.push(i);return t}),lt:ft(function(t,e,i){for(var n=i<0?i+e:i;--n>=0;)t.push(n);return t}),gt:ft(function(t,e,i){for(var n=i<0?i+e:i;++n<e;)t.push(n);return t})}}).pseudos.nth=n.pseudos.eq,{radio:!0,checkbox:!0,file:!0,password:!0,image:!0})n.pseudos[e]=ct(e);for(e in{submit:!0,reset:!0})n.pseudos[e]=dt(e);function gt(){}function vt(t){for(var e=0,i=t.length,n="";e<i;e++)n+=t[e].value;return n}function yt(t,e,i){var n=e.dir,o=e.next,s=o||n,r=i&&"parentNode"===s,a=k++;return e.first?function(e,i,o){for(;e=e[n];)if(1===e.nodeType||r)return t(e,i,o);return!1}:function(e,i,l){var u,h,c,d=[w,a];if(l){for(;e=e[n];)if((1===e.nodeType||r)&&t(e,i,l))return!0}else for(;e=e[n];)if(1===e.nodeType||r)if(h=(c=e[b]||(e[b]={}))[e.uniqueID]||(c[e.uniqueID]={}),o&&o===e.nodeName.toLowerCase())e=e[n]||e;else{if((u=h[s])&&u[0]===w&&u[1]===a)return d[2]=u[2];if(h[s]=d,d[2]=t(e,i,l))return!0}return!1}}function _t(t){return t.length>1?function(e,i,n){for(var o=t.length;o--;)if(!t[o](e,i,n))return!1;return!0}:t[0]}function bt(t,e,i,n,o){for(var s,r=[],a=0,l=t.length,u=null!=e;a<l;a++)(s=t[a])&&(i&&!i(s,n,o)||(r.push(s),u&&e.push(a)));return r}function xt(t,e,i,n,o,s){return n&&!n[b]&&(n=xt(n)),o&&!o[b]&&(o=xt(o,s)),at(function(s,r,a,l){var u,h,c,d=[],p=[],f=r.length,m=s||function(t,e,i){for(var n=0,o=e.length;n<o;n++)st(t,e[n],i);return i}(e||"*",a.nodeType?[a]:a,[]),g=!t||!s&&e?m:bt(m,d,t,a,l),v=i?o||(s?t:f||n)?[]:r:g;if(i&&i(g,v,a,l),n)for(u=bt(v,p),n(u,[],a,l),h=u.length;h--;)(c=u[h])&&(v[p[h]]=!(g[p[h]]=c));if(s){if(o||t){if(o){for(u=[],h=v.length;h--;)(c=v[h])&&u.push(g[h]=c);o(null,v=[],u,l)}for(h=v.length;h--;)(c=v[h])&&(u=o?H(s,c):d[h])>-1&&(s[u]=!(r[u]=c))}}else v=bt(v===r?v.splice(f,v.length):v),o?o(null,r,v,l):j.apply(r,v)})}function wt(t){for(var e,i,o,s=t.length,r=n.relative[t[0].type],a=r||n.relative[" "],l=r?1:0,h=yt(function(t){return t===e},a,!0),c=yt(function(t){return H(e,t)>-1},a,!0),d=[function(t,i,n){var o=!r&&(n||i!==u)||((e=i).nodeType?h(t,i,n):c(t,i,n));return e=null,o}];l<s;l++)if(i=n.relative[t[l].type])d=[yt(_t(d),i)];else{if((i=n.filter[t[l].type].apply(null,t[l].matches))[b]){for(o=++l;o<s&&!n.relative[t[o].type];o++);return xt(l>1&&_t(d),l>1&&vt(t.slice(0,l-1).concat({value:" "===t[l-2].type?"*":""})).replace(R,"$1"),i,l<o&&wt(t.slice(l,o)),o<s&&wt(t=t.slice(o)),o<s&&vt(t))}d.push(i)}return _t(d)}function kt(t,e){var i=e.length>0,o=t.length>0,s=function(s,r,a,l,h){var c,f,g,v=0,y="0",_=s&&[],b=[],x=u,k=s||o&&n.find.TAG("*",h),C=w+=null==x?1:Math.random()||.1,T=k.length;for(h&&(u=r===p||r||h);y!==T&&null!=(c=k[y]);y++){if(o&&c){for(f=0,r||c.ownerDocument===p||(d(c),a=!m);g=t[f++];)if(g(c,r||p,a)){l.push(c);break}h&&(w=C)}i&&((c=!g&&c)&&v--,s&&_.push(c))}if(v+=y,i&&y!==v){for(f=0;g=e[f++];)g(_,b,r,a);if(s){if(v>0)for(;y--;)_[y]||b[y]||(b[y]=L.call(l));b=bt(b)}j.apply(l,b),h&&!s&&b.length>0&&v+e.length>1&&st.uniqueSort(l)}return h&&(w=C,u=x),_};return i?at(s):s}return gt.prototype=n.filters=n.pseudos,n.setFilters=new gt,r=st.tokenize=function(t,e){var i,o,s,r,a,l,u,h=T[t+" "];if(h)return e?0:h.slice(0);for(a=t,l=[],u=n.preFilter;a;){for(r in i&&!(o=z.exec(a))||(o&&(a=a.slice(o[0].length)||a),l.push(s=[])),i=!1,(o=B.exec(a))&&(i=o.shift(),s.push({value:i,type:o[0].replace(R," ")}),a=a.slice(i.length)),n.filter)!(o=X[r].exec(a))||u[r]&&!(o=u[r](o))||(i=o.shift(),s.push({value:i,type:r,matches:o}),a=a.slice(i.length));if(!i)break}return e?a.length:a?st.error(t):T(t,l).slice(0)},a=st.compile=function(t,e){var i,n=[],o=[],s=E[t+" "];if(!s){for(e||(e=r(t)),i=e.length;i--;)(s=wt(e[i]))[b]?n.push(s):o.push(s);(s=E(t,kt(o,n))).selector=t}return s},l=st.select=function(t,e,i,o){var s,l,u,h,c,d="function"==typeof t&&t,p=!o&&r(t=d.selector||t);if(i=i||[],1===p.length){if((l=p[0]=p[0].slice(0)).length>2&&"ID"===(u=l[0]).type&&9===e.nodeType&&m&&n.relative[l[1].type]){if(!(e=(n.find.ID(u.matches[0].replace(Z,tt),e)||[])[0]))return i;d&&(e=e.parentNode),t=t.slice(l.shift().value.length)}for(s=X.needsContext.test(t)?0:l.length;s--&&(u=l[s],!n.relative[h=u.type]);)if((c=n.find[h])&&(o=c(u.matches[0].replace(Z,tt),K.test(l[0].type)&&mt(e.parentNode)||e))){if(l.splice(s,1),!(t=o.length&&vt(l)))return j.apply(i,o),i;break}}return(d||a(t,p))(o,e,!m,i,!e||K.test(t)&&mt(e.parentNode)||e),i},i.sortStable=b.split("").sort(S).join("")===b,i.detectDuplicates=!!c,d(),i.sortDetached=lt(function(t){return 1&t.compareDocumentPosition(p.createElement("fieldset"))}),lt(function(t){return t.innerHTML="<a href='#'></a>","#"===t.firstChild.getAttribute("href")})||ut("type|href|height|width",function(t,e,i){if(!i)return t.getAttribute(e,"type"===e.toLowerCase()?1:2)}),i.attributes&&lt(function(t){return t.innerHTML="<input/>",t.firstChild.setAttribute("value",""),""===t.firstChild.getAttribute("value")})||ut("value",function(t,e,i){if(!i&&"input"===t.nodeName.toLowerCase())return t.defaultValue}),lt(function(t){return null==t.getAttribute("disabled")})||ut($,function(t,e,i){var n;if(!i)return!0===t[e]?e.toLowerCase():(n=t.getAttributeNode(e))&&n.specified?n.value:null}),st}(t);v.find=k,v.expr=k.selectors,v.expr[":"]=v.expr.pseudos,v.uniqueSort=v.unique=k.uniqueSort,v.text=k.getText,v.isXMLDoc=k.isXML,v.contains=k.contains,v.escapeSelector=k.escape;var C=function(t,e,i){for(var n=[],o=void 0!==i;(t=t[e])&&9!==t.nodeType;)if(1===t.nodeType){if(o&&v(t).is(i))break;n.push(t)}return n},T=function(t,e){for(var i=[];t;t=t.nextSibling)1===t.nodeType&&t!==e&&i.push(t);return i},E=v.expr.match.needsContext;function S(t,e){return t.nodeName&&t.nodeName.toLowerCase()===e.toLowerCase()}var N=/^<([a-z][^\/\0>:\x20\t\r\n\f]*)[\x20\t\r\n\f]*\/?>(?:<\/\1>|)$/i,A=/^.[^:#\[\.,]*$/;function L(t,e,i){return v.isFunction(e)?v.grep(t,function(t,n){return!!e.call(t,n,t)!==i}):e.nodeType?v.grep(t,function(t){return t===e!==i}):"string"!=typeof e?v.grep(t,function(t){return l.call(e,t)>-1!==i}):A.test(e)?v.filter(e,t,i):(e=v.filter(e,t),v.grep(t,function(t){return l.call(e,t)>-1!==i&&1===t.nodeType}))}v.filter=function(t,e,i){var n=e[0];return i&&(t=":not("+t+")"),1===e.length&&1===n.nodeType?v.find.matchesSelector(n,t)?[n]:[]:v.find.matches(t,v.grep(e,function(t){return 1===t.nodeType}))},v.fn.extend({find:function(t){var e,i,n=this.length,o=this;if("string"!=typeof t)return this.pushStack(v(t).filter(function(){for(e=0;e<n;e++)if(v.contains(o[e],this))return!0}));for(i=this.pushStack([]),e=0;e<n;e++)v.find(t,o[e],i);return n>1?v.uniqueSort(i):i},filter:function(t){return this.pushStack(L(this,t||[],!1))},not:function(t){return this.pushStack(L(this,t||[],!0))},is:function(t){return!!L(this,"string"==typeof t&&E.test(t)?v(t):t||[],!1).length}});var D,j=/^(?:\s*(<[\w\W]+>)[^>]*|#([\w-]+))$/;(v.fn.init=function(t,e,i){var o,s;if(!t)return this;if(i=i||D,"string"==typeof t){if(!(o="<"===t[0]&&">"===t[t.length-1]&&t.length>=3?[null,t,null]:j.exec(t))||!o[1]&&e)return!e||e.jquery?(e||i).find(t):this.constructor(e).find(t);if(o[1]){if(e=e instanceof v?e[0]:e,v.merge(this,v.parseHTML(o[1],e&&e.nodeType?e.ownerDocument||e:n,!0)),N.test(o[1])&&v.isPlainObject(e))for(o in e)v.isFunction(this[o])?this[o](e[o]):this.attr(o,e[o]);return this}return(s=n.getElementById(o[2]))&&(this[0]=s,this.length=1),this}return t.nodeType?(this[0]=t,this.length=1,this):v.isFunction(t)?void 0!==i.ready?i.ready(t):t(v):v.makeArray(t,this)}).prototype=v.fn,D=v(n);var P=/^(?:parents|prev(?:Until|All))/,H={children:!0,contents:!0,next:!0,prev:!0};function $(t,e){for(;(t=t[e])&&1!==t.nodeType;);return t}v.fn.extend({has:function(t){var e=v(t,this),i=e.length;return this.filter(function(){for(var t=0;t<i;t++)if(v.contains(this,e[t]))return!0})},closest:function(t,e){var i,n=0,o=this.length,s=[],r="string"!=typeof t&&v(t);if(!E.test(t))for(;n<o;n++)for(i=this[n];i&&i!==e;i=i.parentNode)if(i.nodeType<11&&(r?r.index(i)>-1:1===i.nodeType&&v.find.matchesSelector(i,t))){s.push(i);break}return this.pushStack(s.length>1?v.uniqueSort(s):s)},index:function(t){return t?"string"==typeof t?l.call(v(t),this[0]):l.call(this,t.jquery?t[0]:t):this[0]&&this[0].parentNode?this.first().prevAll().length:-1},add:function(t,e){return this.pushStack(v.uniqueSort(v.merge(this.get(),v(t,e))))},addBack:function(t){return this.add(null==t?this.prevObject:this.prevObject.filter(t))}}),v.each({parent:function(t){var e=t.parentNode;return e&&11!==e.nodeType?e:null},parents:function(t){return C(t,"parentNode")},parentsUntil:function(t,e,i){return C(t,"parentNode",i)},next:function(t){return $(t,"nextSibling")},prev:function(t){return $(t,"previousSibling")},nextAll:function(t){return C(t,"nextSibling")},prevAll:function(t){return C(t,"previousSibling")},nextUntil:function(t,e,i){return C(t,"nextSibling",i)},prevUntil:function(t,e,i){return C(t,"previousSibling",i)},siblings:function(t){return T((t.parentNode||{}).firstChild,t)},children:function(t){return T(t.firstChild)},contents:function(t){return S(t,"iframe")?t.contentDocument:(S(t,"template")&&(t=t.content||t),v.merge([],t.childNodes))}},function(t,e){v.fn[t]=function(i,n){var o=v.map(this,e,i);return"Until"!==t.slice(-5)&&(n=i),n&&"string"==typeof n&&(o=v.filter(n,o)),this.length>1&&(H[t]||v.uniqueSort(o),P.test(t)&&o.reverse()),this.pushStack(o)}});var M=/[^\x20\t\r\n\f]+/g;function q(t){return t}function O(t){throw t}function F(t,e,i,n){var o;try{t&&v.isFunction(o=t.promise)?o.call(t).done(e).fail(i):t&&v.isFunction(o=t.then)?o.call(t,e,i):e.apply(void 0,[t].slice(n))}catch(t){i.apply(void 0,[t])}}v.Callbacks=function(t){t="string"==typeof t?function(t){var e={};return v.each(t.match(M)||[],function(t,i){e[i]=!0}),e}(t):v.extend({},t);var e,i,n,o,s=[],r=[],a=-1,l=function(){for(o=o||t.once,n=e=!0;r.length;a=-1)for(i=r.shift();++a<s.length;)!1===s[a].apply(i[0],i[1])&&t.stopOnFalse&&(a=s.length,i=!1);t.memory||(i=!1),e=!1,o&&(s=i?[]:"")},u={add:function(){return s&&(i&&!e&&(a=s.length-1,r.push(i)),function e(i){v.each(i,function(i,n){v.isFunction(n)?t.unique&&u.has(n)||s.push(n):n&&n.length&&"string"!==v.type(n)&&e(n)})}(arguments),i&&!e&&l()),this},remove:function(){return v.each(arguments,function(t,e){for(var i;(i=v.inArray(e,s,i))>-1;)s.splice(i,1),i<=a&&a--}),this},has:function(t){return t?v.inArray(t,s)>-1:s.length>0},empty:function(){return s&&(s=[]),this},disable:function(){return o=r=[],s=i="",this},disabled:function(){return!s},lock:function(){return o=r=[],i||e||(s=i=""),this},locked:function(){return!!o},fireWith:function(t,i){return o||(i=[t,(i=i||[]).slice?i.slice():i],r.push(i),e||l()),this},fire:function(){return u.fireWith(this,arguments),this},fired:function(){return!!n}};return u},v.extend({Deferred:function(e){var i=[["notify","progress",v.Callbacks("memory"),v.Callbacks("memory"),2],["resolve","done",v.Callbacks("once memory"),v.Callbacks("once memory"),0,"resolved"],["reject","fail",v.Callbacks("once memory"),v.Callbacks("once memory"),1,"rejected"]],n="pending",o={state:function(){return n},always:function(){return s.done(arguments).fail(arguments),this},catch:function(t){return o.then(null,t)},pipe:function(){var t=arguments;return v.Deferred(function(e){v.each(i,function(i,n){var o=v.isFunction(t[n[4]])&&t[n[4]];s[n[1]](function(){var t=o&&o.apply(this,arguments);t&&v.isFunction(t.promise)?t.promise().progress(e.notify).done(e.resolve).fail(e.reject):e[n[0]+"With"](this,o?[t]:arguments)})}),t=null}).promise()},then:function(e,n,o){var s=0;function r(e,i,n,o){return function(){var a=this,l=arguments,u=function(){var t,u;if(!(e<s)){if((t=n.apply(a,l))===i.promise())throw new TypeError("Thenable self-resolution");u=t&&("object"==typeof t||"function"==typeof t)&&t.then,v.isFunction(u)?o?u.call(t,r(s,i,q,o),r(s,i,O,o)):(s++,u.call(t,r(s,i,q,o),r(s,i,O,o),r(s,i,q,i.notifyWith))):(n!==q&&(a=void 0,l=[t]),(o||i.resolveWith)(a,l))}},h=o?u:function(){try{u()}catch(t){v.Deferred.exceptionHook&&v.Deferred.exceptionHook(t,h.stackTrace),e+1>=s&&(n!==O&&(a=void 0,l=[t]),i.rejectWith(a,l))}};e?h():(v.Deferred.getStackHook&&(h.stackTrace=v.Deferred.getStackHook()),t.setTimeout(h))}}return v.Deferred(function(t){i[0][3].add(r(0,t,v.isFunction(o)?o:q,t.notifyWith)),i[1][3].add(r(0,t,v.isFunction(e)?e:q)),i[2][3].add(r(0,t,v.isFunction(n)?n:O))}).promise()},promise:function(t){return null!=t?v.extend(t,o):o}},s={};return v.each(i,function(t,e){var r=e[2],a=e[5];o[e[1]]=r.add,a&&r.add(function(){n=a},i[3-t][2].disable,i[0][2].lock),r.add(e[3].fire),s[e[0]]=function(){return s[e[0]+"With"](this===s?void 0:this,arguments),this},s[e[0]+"With"]=r.fireWith}),o.promise(s),e&&e.call(s,s),s},when:function(t){var e=arguments.length,i=e,n=Array(i),o=s.call(arguments),r=v.Deferred(),a=function(t){return function(i){n[t]=this,o[t]=arguments.length>1?s.call(arguments):i,--e||r.resolveWith(n,o)}};if(e<=1&&(F(t,r.done(a(i)).resolve,r.reject,!e),"pending"===r.state()||v.isFunction(o[i]&&o[i].then)))return r.then();for(;i--;)F(o[i],a(i),r.reject);return r.promise()}});var I=/^(Eval|Internal|Range|Reference|Syntax|Type|URI)Error$/;v.Deferred.exceptionHook=function(e,i){t.console&&t.console.warn&&e&&I.test(e.name)&&t.console.warn("jQuery.Deferred exception: "+e.message,e.stack,i)},v.readyException=function(e){t.setTimeout(function(){throw e})};var R=v.Deferred();function z(){n.removeEventListener("DOMContentLoaded",z),t.removeEventListener("load",z),v.ready()}v.fn.ready=function(t){return R.then(t).catch(function(t){v.readyException(t)}),this},v.extend({isReady:!1,readyWait:1,ready:function(t){(!0===t?--v.readyWait:v.isReady)||(v.isReady=!0,!0!==t&&--v.readyWait>0||R.resolveWith(n,[v]))}}),v.ready.then=R.then,"complete"===n.readyState||"loading"!==n.readyState&&!n.documentElement.doScroll?t.setTimeout(v.ready):(n.addEventListener("DOMContentLoaded",z),t.addEventListener("load",z));var B=function(t,e,i,n,o,s,r){var a=0,l=t.length,u=null==i;if("object"===v.type(i))for(a in o=!0,i)B(t,e,a,i[a],!0,s,r);else if(void 0!==n&&(o=!0,v.isFunction(n)||(r=!0),u&&(r?(e.call(t,n),e=null):(u=e,e=function(t,e,i){return u.call(v(t),i)})),e))for(;a<l;a++)e(t[a],i,r?n:n.call(t[a],a,e(t[a],i)));return o?t:u?e.call(t):l?e(t[0],i):s},W=function(t){return 1===t.nodeType||9===t.nodeType||!+t.nodeType};function V(){this.expando=v.expando+V.uid++}V.uid=1,V.prototype={cache:function(t){var e=t[this.expando];return e||(e={},W(t)&&(t.nodeType?t[this.expando]=e:Object.defineProperty(t,this.expando,{value:e,configurable:!0}))),e},set:function(t,e,i){var n,o=this.cache(t);if("string"==typeof e)o[v.camelCase(e)]=i;else for(n in e)o[v.camelCase(n)]=e[n];return o},get:function(t,e){return void 0===e?this.cache(t):t[this.expando]&&t[this.expando][v.camelCase(e)]},access:function(t,e,i){return void 0===e||e&&"string"==typeof e&&void 0===i?this.get(t,e):(this.set(t,e,i),void 0!==i?i:e)},remove:function(t,e){var i,n=t[this.expando];if(void 0!==n){if(void 0!==e){Array.isArray(e)?e=e.map(v.camelCase):e=(e=v.camelCase(e))in n?[e]:e.match(M)||[],i=e.length;for(;i--;)delete n[e[i]]}(void 0===e||v.isEmptyObject(n))&&(t.nodeType?t[this.expando]=void 0:delete t[this.expando])}},hasData:function(t){var e=t[this.expando];return void 0!==e&&!v.isEmptyObject(e)}};var U=new V,X=new V,Q=/^(?:\{[\w\W]*\}|\[[\w\W]*\])$/,Y=/[A-Z]/g;function G(t,e,i){var n;if(void 0===i&&1===t.nodeType)if(n="data-"+e.replace(Y,"-$&").toLowerCase(),"string"==typeof(i=t.getAttribute(n))){try{i=function(t){return"true"===t||"false"!==t&&("null"===t?null:t===+t+""?+t:Q.test(t)?JSON.parse(t):t)}(i)}catch(t){}X.set(t,e,i)}else i=void 0;return i}v.extend({hasData:function(t){return X.hasData(t)||U.hasData(t)},data:function(t,e,i){return X.access(t,e,i)},removeData:function(t,e){X.remove(t,e)},_data:function(t,e,i){return U.access(t,e,i)},_removeData:function(t,e){U.remove(t,e)}}),v.fn.extend({data:function(t,e){var i,n,o,s=this[0],r=s&&s.attributes;if(void 0===t){if(this.length&&(o=X.get(s),1===s.nodeType&&!U.get(s,"hasDataAttrs"))){for(i=r.length;i--;)r[i]&&(0===(n=r[i].name).indexOf("data-")&&(n=v.camelCase(n.slice(5)),G(s,n,o[n])));U.set(s,"hasDataAttrs",!0)}return o}return"object"==typeof t?this.each(function(){X.set(this,t)}):B(this,function(e){var i;if(s&&void 0===e){if(void 0!==(i=X.get(s,t)))return i;if(void 0!==(i=G(s,t)))return i}else this.each(function(){X.set(this,t,e)})},null,e,arguments.length>1,null,!0)},removeData:function(t){return this.each(function(){X.remove(this,t)})}}),v.extend({queue:function(t,e,i){var n;if(t)return e=(e||"fx")+"queue",n=U.get(t,e),i&&(!n||Array.isArray(i)?n=U.access(t,e,v.makeArray(i)):n.push(i)),n||[]},dequeue:function(t,e){e=e||"fx";var i=v.queue(t,e),n=i.length,o=i.shift(),s=v._queueHooks(t,e);"inprogress"===o&&(o=i.shift(),n--),o&&("fx"===e&&i.unshift("inprogress"),delete s.stop,o.call(t,function(){v.dequeue(t,e)},s)),!n&&s&&s.empty.fire()},_queueHooks:function(t,e){var i=e+"queueHooks";return U.get(t,i)||U.access(t,i,{empty:v.Callbacks("once memory").add(function(){U.remove(t,[e+"queue",i])})})}}),v.fn.extend({queue:function(t,e){var i=2;return"string"!=typeof t&&(e=t,t="fx",i--),arguments.length<i?v.queue(this[0],t):void 0===e?this:this.each(function(){var i=v.queue(this,t,e);v._queueHooks(this,t),"fx"===t&&"inprogress"!==i[0]&&v.dequeue(this,t)})},dequeue:function(t){return this.each(function(){v.dequeue(this,t)})},clearQueue:function(t){return this.queue(t||"fx",[])},promise:function(t,e){var i,n=1,o=v.Deferred(),s=this,r=this.length,a=function(){--n||o.resolveWith(s,[s])};for("string"!=typeof t&&(e=t,t=void 0),t=t||"fx";r--;)(i=U.get(s[r],t+"queueHooks"))&&i.empty&&(n++,i.empty.add(a));return a(),o.promise(e)}});var J=/[+-]?(?:\d*\.|)\d+(?:[eE][+-]?\d+|)/.source,K=new RegExp("^(?:([+-])=|)("+J+")([a-z%]*)$","i"),Z=["Top","Right","Bottom","Left"],tt=function(t,e){return"none"===(t=e||t).style.display||""===t.style.display&&v.contains(t.ownerDocument,t)&&"none"===v.css(t,"display")},et=function(t,e,i,n){var o,s,r={};for(s in e)r[s]=t.style[s],t.style[s]=e[s];for(s in o=i.apply(t,n||[]),e)t.style[s]=r[s];return o};function it(t,e,i,n){var o,s=1,r=20,a=n?function(){return n.cur()}:function(){return v.css(t,e,"")},l=a(),u=i&&i[3]||(v.cssNumber[e]?"":"px"),h=(v.cssNumber[e]||"px"!==u&&+l)&&K.exec(v.css(t,e));if(h&&h[3]!==u){u=u||h[3],i=i||[],h=+l||1;do{h/=s=s||".5",v.style(t,e,h+u)}while(s!==(s=a()/l)&&1!==s&&--r)}return i&&(h=+h||+l||0,o=i[1]?h+(i[1]+1)*i[2]:+i[2],n&&(n.unit=u,n.start=h,n.end=o)),o}var nt={};function ot(t){var e,i=t.ownerDocument,n=t.nodeName,o=nt[n];return o||(e=i.body.appendChild(i.createElement(n)),o=v.css(e,"display"),e.parentNode.removeChild(e),"none"===o&&(o="block"),nt[n]=o,o)}function st(t,e){for(var i,n,o=[],s=0,r=t.length;s<r;s++)(n=t[s]).style&&(i=n.style.display,e?("none"===i&&(o[s]=U.get(n,"display")||null,o[s]||(n.style.display="")),""===n.style.display&&tt(n)&&(o[s]=ot(n))):"none"!==i&&(o[s]="none",U.set(n,"display",i)));for(s=0;s<r;s++)null!=o[s]&&(t[s].style.display=o[s]);return t}v.fn.extend({show:function(){return st(this,!0)},hide:function(){return st(this)},toggle:function(t){return"boolean"==typeof t?t?this.show():this.hide():this.each(function(){tt(this)?v(this).show():v(this).hide()})}});var rt=/^(?:checkbox|radio)$/i,at=/<([a-z][^\/\0>\x20\t\r\n\f]+)/i,lt=/^$|\/(?:java|ecma)script/i,ut={option:[1,"<select multiple='multiple'>","</select>"],thead:[1,"<table>","</table>"],col:[2,"<table><colgroup>","</colgroup></table>"],tr:[2,"<table><tbody>","</tbody></table>"],td:[3,"<table><tbody><tr>","</tr></tbody></table>"],_default:[0,"",""]};function ht(t,e){var i;return i=void 0!==t.getElementsByTagName?t.getElementsByTagName(e||"*"):void 0!==t.querySelectorAll?t.querySelectorAll(e||"*"):[],void 0===e||e&&S(t,e)?v.merge([t],i):i}function ct(t,e){for(var i=0,n=t.length;i<n;i++)U.set(t[i],"globalEval",!e||U.get(e[i],"globalEval"))}ut.optgroup=ut.option,ut.tbody=ut.tfoot=ut.colgroup=ut.caption=ut.thead,ut.th=ut.td;var dt=/<|&#?\w+;/;function pt(t,e,i,n,o){for(var s,r,a,l,u,h,c=e.createDocumentFragment(),d=[],p=0,f=t.length;p<f;p++)if((s=t[p])||0===s)if("object"===v.type(s))v.merge(d,s.nodeType?[s]:s);else if(dt.test(s)){for(r=r||c.appendChild(e.createElement("div")),a=(at.exec(s)||["",""])[1].toLowerCase(),l=ut[a]||ut._default,r.innerHTML=l[1]+v.htmlPrefilter(s)+l[2],h=l[0];h--;)r=r.lastChild;v.merge(d,r.childNodes),(r=c.firstChild).textContent=""}else d.push(e.createTextNode(s));for(c.textContent="",p=0;s=d[p++];)if(n&&v.inArray(s,n)>-1)o&&o.push(s);else if(u=v.contains(s.ownerDocument,s),r=ht(c.appendChild(s),"script"),u&&ct(r),i)for(h=0;s=r[h++];)lt.test(s.type||"")&&i.push(s);return c}!function(){var t=n.createDocumentFragment().appendChild(n.createElement("div")),e=n.createElement("input");e.setAttribute("type","radio"),e.setAttribute("checked","checked"),e.setAttribute("name","t"),t.appendChild(e),f.checkClone=t.cloneNode(!0).cloneNode(!0).lastChild.checked,t.innerHTML="<textarea>x</textarea>",f.noCloneChecked=!!t.cloneNode(!0).lastChild.defaultValue}();var ft=n.documentElement,mt=/^key/,gt=/^(?:mouse|pointer|contextmenu|drag|drop)|click/,vt=/^([^.]*)(?:\.(.+)|)/;function yt(){return!0}function _t(){return!1}function bt(){try{return n.activeElement}catch(t){}}function xt(t,e,i,n,o,s){var r,a;if("object"==typeof e){for(a in"string"!=typeof i&&(n=n||i,i=void 0),e)xt(t,a,i,n,e[a],s);return t}if(null==n&&null==o?(o=i,n=i=void 0):null==o&&("string"==typeof i?(o=n,n=void 0):(o=n,n=i,i=void 0)),!1===o)o=_t;else if(!o)return t;return 1===s&&(r=o,(o=function(t){return v().off(t),r.apply(this,arguments)}).guid=r.guid||(r.guid=v.guid++)),t.each(function(){v.event.add(this,e,o,n,i)})}v.event={global:{},add:function(t,e,i,n,o){var s,r,a,l,u,h,c,d,p,f,m,g=U.get(t);if(g)for(i.handler&&(i=(s=i).handler,o=s.selector),o&&v.find.matchesSelector(ft,o),i.guid||(i.guid=v.guid++),(l=g.events)||(l=g.events={}),(r=g.handle)||(r=g.handle=function(e){return void 0!==v&&v.event.triggered!==e.type?v.event.dispatch.apply(t,arguments):void 0}),u=(e=(e||"").match(M)||[""]).length;u--;)p=m=(a=vt.exec(e[u])||[])[1],f=(a[2]||"").split(".").sort(),p&&(c=v.event.special[p]||{},p=(o?c.delegateType:c.bindType)||p,c=v.event.special[p]||{},h=v.extend({type:p,origType:m,data:n,handler:i,guid:i.guid,selector:o,needsContext:o&&v.expr.match.needsContext.test(o),namespace:f.join(".")},s),(d=l[p])||((d=l[p]=[]).delegateCount=0,c.setup&&!1!==c.setup.call(t,n,f,r)||t.addEventListener&&t.addEventListener(p,r)),c.add&&(c.add.call(t,h),h.handler.guid||(h.handler.guid=i.guid)),o?d.splice(d.delegateCount++,0,h):d.push(h),v.event.global[p]=!0)},remove:function(t,e,i,n,o){var s,r,a,l,u,h,c,d,p,f,m,g=U.hasData(t)&&U.get(t);if(g&&(l=g.events)){for(u=(e=(e||"").match(M)||[""]).length;u--;)if(p=m=(a=vt.exec(e[u])||[])[1],f=(a[2]||"").split(".").sort(),p){for(c=v.event.special[p]||{},d=l[p=(n?c.delegateType:c.bindType)||p]||[],a=a[2]&&new RegExp("(^|\\.)"+f.join("\\.(?:.*\\.|)")+"(\\.|$)"),r=s=d.length;s--;)h=d[s],!o&&m!==h.origType||i&&i.guid!==h.guid||a&&!a.test(h.namespace)||n&&n!==h.selector&&("**"!==n||!h.selector)||(d.splice(s,1),h.selector&&d.delegateCount--,c.remove&&c.remove.call(t,h));r&&!d.length&&(c.teardown&&!1!==c.teardown.call(t,f,g.handle)||v.removeEvent(t,p,g.handle),delete l[p])}else for(p in l)v.event.remove(t,p+e[u],i,n,!0);v.isEmptyObject(l)&&U.remove(t,"handle events")}},dispatch:function(t){var e,i,n,o,s,r,a=v.event.fix(t),l=new Array(arguments.length),u=(U.get(this,"events")||{})[a.type]||[],h=v.event.special[a.type]||{};for(l[0]=a,e=1;e<arguments.length;e++)l[e]=arguments[e];if(a.delegateTarget=this,!h.preDispatch||!1!==h.preDispatch.call(this,a)){for(r=v.event.handlers.call(this,a,u),e=0;(o=r[e++])&&!a.isPropagationStopped();)for(a.currentTarget=o.elem,i=0;(s=o.handlers[i++])&&!a.isImmediatePropagationStopped();)a.rnamespace&&!a.rnamespace.test(s.namespace)||(a.handleObj=s,a.data=s.data,void 0!==(n=((v.event.special[s.origType]||{}).handle||s.handler).apply(o.elem,l))&&!1===(a.result=n)&&(a.preventDefault(),a.stopPropagation()));return h.postDispatch&&h.postDispatch.call(this,a),a.result}},handlers:function(t,e){var i,n,o,s,r,a=[],l=e.delegateCount,u=t.target;if(l&&u.nodeType&&!("click"===t.type&&t.button>=1))for(;u!==this;u=u.parentNode||this)if(1===u.nodeType&&("click"!==t.type||!0!==u.disabled)){for(s=[],r={},i=0;i<l;i++)void 0===r[o=(n=e[i]).selector+" "]&&(r[o]=n.needsContext?v(o,this).index(u)>-1:v.find(o,this,null,[u]).length),r[o]&&s.push(n);s.length&&a.push({elem:u,handlers:s})}return u=this,l<e.length&&a.push({elem:u,handlers:e.slice(l)}),a},addProp:function(t,e){Object.defineProperty(v.Event.prototype,t,{enumerable:!0,configurable:!0,get:v.isFunction(e)?function(){if(this.originalEvent)return e(this.originalEvent)}:function(){if(this.originalEvent)return this.originalEvent[t]},set:function(e){Object.defineProperty(this,t,{enumerable:!0,configurable:!0,writable:!0,value:e})}})},fix:function(t){return t[v.expando]?t:new v.Event(t)},special:{load:{noBubble:!0},focus:{trigger:function(){if(this!==bt()&&this.focus)return this.focus(),!1},delegateType:"focusin"},blur:{trigger:function(){if(this===bt()&&this.blur)return this.blur(),!1},delegateType:"focusout"},click:{trigger:function(){if("checkbox"===this.type&&this.click&&S(this,"input"))return this.click(),!1},_default:function(t){return S(t.target,"a")}},beforeunload:{postDispatch:function(t){void 0!==t.result&&t.originalEvent&&(t.originalEvent.returnValue=t.result)}}}},v.removeEvent=function(t,e,i){t.removeEventListener&&t.removeEventListener(e,i)},v.Event=function(t,e){return this instanceof v.Event?(t&&t.type?(this.originalEvent=t,this.type=t.type,this.isDefaultPrevented=t.defaultPrevented||void 0===t.defaultPrevented&&!1===t.returnValue?yt:_t,this.target=t.target&&3===t.target.nodeType?t.target.parentNode:t.target,this.currentTarget=t.currentTarget,this.relatedTarget=t.relatedTarget):this.type=t,e&&v.extend(this,e),this.timeStamp=t&&t.timeStamp||v.now(),void(this[v.expando]=!0)):new v.Event(t,e)},v.Event.prototype={constructor:v.Event,isDefaultPrevented:_t,isPropagationStopped:_t,isImmediatePropagationStopped:_t,isSimulated:!1,preventDefault:function(){var t=this.originalEvent;this.isDefaultPrevented=yt,t&&!this.isSimulated&&t.preventDefault()},stopPropagation:function(){var t=this.originalEvent;this.isPropagationStopped=yt,t&&!this.isSimulated&&t.stopPropagation()},stopImmediatePropagation:function(){var t=this.originalEvent;this.isImmediatePropagationStopped=yt,t&&!this.isSimulated&&t.stopImmediatePropagation(),this.stopPropagation()}},v.each({altKey:!0,bubbles:!0,cancelable:!0,changedTouches:!0,ctrlKey:!0,detail:!0,eventPhase:!0,metaKey:!0,pageX:!0,pageY:!0,shiftKey:!0,view:!0,char:!0,charCode:!0,key:!0,keyCode:!0,button:!0,buttons:!0,clientX:!0,clientY:!0,offsetX:!0,offsetY:!0,pointerId:!0,pointerType:!0,screenX:!0,screenY:!0,targetTouches:!0,toElement:!0,touches:!0,which:function(t){var e=t.button;return null==t.which&&mt.test(t.type)?null!=t.charCode?t.charCode:t.keyCode:!t.which&&void 0!==e&&gt.test(t.type)?1&e?1:2&e?3:4&e?2:0:t.which}},v.event.addProp),v.each({mouseenter:"mouseover",mouseleave:"mouseout",pointerenter:"pointerover",pointerleave:"pointerout"},function(t,e){v.event.special[t]={delegateType:e,bindType:e,handle:function(t){var i,n=t.relatedTarget,o=t.handleObj;return n&&(n===this||v.contains(this,n))||(t.type=o.origType,i=o.handler.apply(this,arguments),t.type=e),i}}}),v.fn.extend({on:function(t,e,i,n){return xt(this,t,e,i,n)},one:function(t,e,i,n){return xt(this,t,e,i,n,1)},off:function(t,e,i){var n,o;if(t&&t.preventDefault&&t.handleObj)return n=t.handleObj,v(t.delegateTarget).off(n.namespace?n.origType+"."+n.namespace:n.origType,n.selector,n.handler),this;if("object"==typeof t){for(o in t)this.off(o,e,t[o]);return this}return!1!==e&&"function"!=typeof e||(i=e,e=void 0),!1===i&&(i=_t),this.each(function(){v.event.remove(this,t,i,e)})}});var wt=/<(?!area|br|col|embed|hr|img|input|link|meta|param)(([a-z][^\/\0>\x20\t\r\n\f]*)[^>]*)\/>/gi,kt=/<script|<style|<link/i,Ct=/checked\s*(?:[^=]|=\s*.checked.)/i,Tt=/^true\/(.*)/,Et=/^\s*<!(?:\[CDATA\[|--)|(?:\]\]|--)>\s*$/g;function St(t,e){return S(t,"table")&&S(11!==e.nodeType?e:e.firstChild,"tr")&&v(">tbody",t)[0]||t}function Nt(t){return t.type=(null!==t.getAttribute("type"))+"/"+t.type,t}function At(t){var e=Tt.exec(t.type);return e?t.type=e[1]:t.removeAttribute("type"),t}function Lt(t,e){var i,n,o,s,r,a,l,u;if(1===e.nodeType){if(U.hasData(t)&&(s=U.access(t),r=U.set(e,s),u=s.events))for(o in delete r.handle,r.events={},u)for(i=0,n=u[o].length;i<n;i++)v.event.add(e,o,u[o][i]);X.hasData(t)&&(a=X.access(t),l=v.extend({},a),X.set(e,l))}}function Dt(t,e){var i=e.nodeName.toLowerCase();"input"===i&&rt.test(t.type)?e.checked=t.checked:"input"!==i&&"textarea"!==i||(e.defaultValue=t.defaultValue)}function jt(t,e,i,n){e=r.apply([],e);var o,s,a,l,u,h,c=0,d=t.length,p=d-1,g=e[0],y=v.isFunction(g);if(y||d>1&&"string"==typeof g&&!f.checkClone&&Ct.test(g))return t.each(function(o){var s=t.eq(o);y&&(e[0]=g.call(this,o,s.html())),jt(s,e,i,n)});if(d&&(s=(o=pt(e,t[0].ownerDocument,!1,t,n)).firstChild,1===o.childNodes.length&&(o=s),s||n)){for(l=(a=v.map(ht(o,"script"),Nt)).length;c<d;c++)u=o,c!==p&&(u=v.clone(u,!0,!0),l&&v.merge(a,ht(u,"script"))),i.call(t[c],u,c);if(l)for(h=a[a.length-1].ownerDocument,v.map(a,At),c=0;c<l;c++)u=a[c],lt.test(u.type||"")&&!U.access(u,"globalEval")&&v.contains(h,u)&&(u.src?v._evalUrl&&v._evalUrl(u.src):m(u.textContent.replace(Et,""),h))}return t}function Pt(t,e,i){for(var n,o=e?v.filter(e,t):t,s=0;null!=(n=o[s]);s++)i||1!==n.nodeType||v.cleanData(ht(n)),n.parentNode&&(i&&v.contains(n.ownerDocument,n)&&ct(ht(n,"script")),n.parentNode.removeChild(n));return t}v.extend({htmlPrefilter:function(t){return t.replace(wt,"<$1></$2>")},clone:function(t,e,i){var n,o,s,r,a=t.cloneNode(!0),l=v.contains(t.ownerDocument,t);if(!(f.noCloneChecked||1!==t.nodeType&&11!==t.nodeType||v.isXMLDoc(t)))for(r=ht(a),n=0,o=(s=ht(t)).length;n<o;n++)Dt(s[n],r[n]);if(e)if(i)for(s=s||ht(t),r=r||ht(a),n=0,o=s.length;n<o;n++)Lt(s[n],r[n]);else Lt(t,a);return(r=ht(a,"script")).length>0&&ct(r,!l&&ht(t,"script")),a},cleanData:function(t){for(var e,i,n,o=v.event.special,s=0;void 0!==(i=t[s]);s++)if(W(i)){if(e=i[U.expando]){if(e.events)for(n in e.events)o[n]?v.event.remove(i,n):v.removeEvent(i,n,e.handle);i[U.expando]=void 0}i[X.expando]&&(i[X.expando]=void 0)}}}),v.fn.extend({detach:function(t){return Pt(this,t,!0)},remove:function(t){return Pt(this,t)},text:function(t){return B(this,function(t){return void 0===t?v.text(this):this.empty().each(function(){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||(this.textContent=t)})},null,t,arguments.length)},append:function(){return jt(this,arguments,function(t){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||St(this,t).appendChild(t)})},prepend:function(){return jt(this,arguments,function(t){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var e=St(this,t);e.insertBefore(t,e.firstChild)}})},before:function(){return jt(this,arguments,function(t){this.parentNode&&this.parentNode.insertBefore(t,this)})},after:function(){return jt(this,arguments,function(t){this.parentNode&&this.parentNode.insertBefore(t,this.nextSibling)})},empty:function(){for(var t,e=0;null!=(t=this[e]);e++)1===t.nodeType&&(v.cleanData(ht(t,!1)),t.textContent="");return this},clone:function(t,e){return t=null!=t&&t,e=null==e?t:e,this.map(function(){return v.clone(this,t,e)})},html:function(t){return B(this,function(t){var e=this[0]||{},i=0,n=this.length;if(void 0===t&&1===e.nodeType)return e.innerHTML;if("string"==typeof t&&!kt.test(t)&&!ut[(at.exec(t)||["",""])[1].toLowerCase()]){t=v.htmlPrefilter(t);try{for(;i<n;i++)1===(e=this[i]||{}).nodeType&&(v.cleanData(ht(e,!1)),e.innerHTML=t);e=0}catch(t){}}e&&this.empty().append(t)},null,t,arguments.length)},replaceWith:function(){var t=[];return jt(this,arguments,function(e){var i=this.parentNode;v.inArray(this,t)<0&&(v.cleanData(ht(this)),i&&i.replaceChild(e,this))},t)}}),v.each({appendTo:"append",prependTo:"prepend",insertBefore:"before",insertAfter:"after",replaceAll:"replaceWith"},function(t,e){v.fn[t]=function(t){for(var i,n=[],o=v(t),s=o.length-1,r=0;r<=s;r++)i=r===s?this:this.clone(!0),v(o[r])[e](i),a.apply(n,i.get());return this.pushStack(n)}});var Ht=/^margin/,$t=new RegExp("^("+J+")(?!px)[a-z%]+$","i"),Mt=function(e){var i=e.ownerDocument.defaultView;return i&&i.opener||(i=t),i.getComputedStyle(e)};function qt(t,e,i){var n,o,s,r,a=t.style;return(i=i||Mt(t))&&(""!==(r=i.getPropertyValue(e)||i[e])||v.contains(t.ownerDocument,t)||(r=v.style(t,e)),!f.pixelMarginRight()&&$t.test(r)&&Ht.test(e)&&(n=a.width,o=a.minWidth,s=a.maxWidth,a.minWidth=a.maxWidth=a.width=r,r=i.width,a.width=n,a.minWidth=o,a.maxWidth=s)),void 0!==r?r+"":r}function Ot(t,e){return{get:function(){return t()?void delete this.get:(this.get=e).apply(this,arguments)}}}!function(){function e(){if(l){l.style.cssText="box-sizing:border-box;position:relative;display:block;margin:auto;border:1px;padding:1px;top:1%;width:50%",l.innerHTML="",ft.appendChild(a);var e=t.getComputedStyle(l);i="1%"!==e.top,r="2px"===e.marginLeft,o="4px"===e.width,l.style.marginRight="50%",s="4px"===e.marginRight,ft.removeChild(a),l=null}}var i,o,s,r,a=n.createElement("div"),l=n.createElement("div");l.style&&(l.style.backgroundClip="content-box",l.cloneNode(!0).style.backgroundClip="",f.clearCloneStyle="content-box"===l.style.backgroundClip,a.style.cssText="border:0;width:8px;height:0;top:0;left:-9999px;padding:0;margin-top:1px;position:absolute",a.appendChild(l),v.extend(f,{pixelPosition:function(){return e(),i},boxSizingReliable:function(){return e(),o},pixelMarginRight:function(){return e(),s},reliableMarginLeft:function(){return e(),r}}))}();var Ft=/^(none|table(?!-c[ea]).+)/,It=/^--/,Rt={position:"absolute",visibility:"hidden",display:"block"},zt={letterSpacing:"0",fontWeight:"400"},Bt=["Webkit","Moz","ms"],Wt=n.createElement("div").style;function Vt(t){var e=v.cssProps[t];return e||(e=v.cssProps[t]=function(t){if(t in Wt)return t;for(var e=t[0].toUpperCase()+t.slice(1),i=Bt.length;i--;)if((t=Bt[i]+e)in Wt)return t}(t)||t),e}function Ut(t,e,i){var n=K.exec(e);return n?Math.max(0,n[2]-(i||0))+(n[3]||"px"):e}function Xt(t,e,i,n,o){var s,r=0;for(s=i===(n?"border":"content")?4:"width"===e?1:0;s<4;s+=2)"margin"===i&&(r+=v.css(t,i+Z[s],!0,o)),n?("content"===i&&(r-=v.css(t,"padding"+Z[s],!0,o)),"margin"!==i&&(r-=v.css(t,"border"+Z[s]+"Width",!0,o))):(r+=v.css(t,"padding"+Z[s],!0,o),"padding"!==i&&(r+=v.css(t,"border"+Z[s]+"Width",!0,o)));return r}function Qt(t,e,i){var n,o=Mt(t),s=qt(t,e,o),r="border-box"===v.css(t,"boxSizing",!1,o);return $t.test(s)?s:(n=r&&(f.boxSizingReliable()||s===t.style[e]),"auto"===s&&(s=t["offset"+e[0].toUpperCase()+e.slice(1)]),(s=parseFloat(s)||0)+Xt(t,e,i||(r?"border":"content"),n,o)+"px")}function Yt(t,e,i,n,o){return new Yt.prototype.init(t,e,i,n,o)}v.extend({cssHooks:{opacity:{get:function(t,e){if(e){var i=qt(t,"opacity");return""===i?"1":i}}}},cssNumber:{animationIterationCount:!0,columnCount:!0,fillOpacity:!0,flexGrow:!0,flexShrink:!0,fontWeight:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,widows:!0,zIndex:!0,zoom:!0},cssProps:{float:"cssFloat"},style:function(t,e,i,n){if(t&&3!==t.nodeType&&8!==t.nodeType&&t.style){var o,s,r,a=v.camelCase(e),l=It.test(e),u=t.style;return l||(e=Vt(a)),r=v.cssHooks[e]||v.cssHooks[a],void 0===i?r&&"get"in r&&void 0!==(o=r.get(t,!1,n))?o:u[e]:("string"===(s=typeof i)&&(o=K.exec(i))&&o[1]&&(i=it(t,e,o),s="number"),void(null!=i&&i==i&&("number"===s&&(i+=o&&o[3]||(v.cssNumber[a]?"":"px")),f.clearCloneStyle||""!==i||0!==e.indexOf("background")||(u[e]="inherit"),r&&"set"in r&&void 0===(i=r.set(t,i,n))||(l?u.setProperty(e,i):u[e]=i))))}},css:function(t,e,i,n){var o,s,r,a=v.camelCase(e);return It.test(e)||(e=Vt(a)),(r=v.cssHooks[e]||v.cssHooks[a])&&"get"in r&&(o=r.get(t,!0,i)),void 0===o&&(o=qt(t,e,n)),"normal"===o&&e in zt&&(o=zt[e]),""===i||i?(s=parseFloat(o),!0===i||isFinite(s)?s||0:o):o}}),v.each(["height","width"],function(t,e){v.cssHooks[e]={get:function(t,i,n){if(i)return!Ft.test(v.css(t,"display"))||t.getClientRects().length&&t.getBoundingClientRect().width?Qt(t,e,n):et(t,Rt,function(){return Qt(t,e,n)})},set:function(t,i,n){var o,s=n&&Mt(t),r=n&&Xt(t,e,n,"border-box"===v.css(t,"boxSizing",!1,s),s);return r&&(o=K.exec(i))&&"px"!==(o[3]||"px")&&(t.style[e]=i,i=v.css(t,e)),Ut(0,i,r)}}}),v.cssHooks.marginLeft=Ot(f.reliableMarginLeft,function(t,e){if(e)return(parseFloat(qt(t,"marginLeft"))||t.getBoundingClientRect().left-et(t,{marginLeft:0},function(){return t.getBoundingClientRect().left}))+"px"}),v.each({margin:"",padding:"",border:"Width"},function(t,e){v.cssHooks[t+e]={expand:function(i){for(var n=0,o={},s="string"==typeof i?i.split(" "):[i];n<4;n++)o[t+Z[n]+e]=s[n]||s[n-2]||s[0];return o}},Ht.test(t)||(v.cssHooks[t+e].set=Ut)}),v.fn.extend({css:function(t,e){return B(this,function(t,e,i){var n,o,s={},r=0;if(Array.isArray(e)){for(n=Mt(t),o=e.length;r<o;r++)s[e[r]]=v.css(t,e[r],!1,n);return s}return void 0!==i?v.style(t,e,i):v.css(t,e)},t,e,arguments.length>1)}}),v.Tween=Yt,Yt.prototype={constructor:Yt,init:function(t,e,i,n,o,s){this.elem=t,this.prop=i,this.easing=o||v.easing._default,this.options=e,this.start=this.now=this.cur(),this.end=n,this.unit=s||(v.cssNumber[i]?"":"px")},cur:function(){var t=Yt.propHooks[this.prop];return t&&t.get?t.get(this):Yt.propHooks._default.get(this)},run:function(t){var e,i=Yt.propHooks[this.prop];return this.options.duration?this.pos=e=v.easing[this.easing](t,this.options.duration*t,0,1,this.options.duration):this.pos=e=t,this.now=(this.end-this.start)*e+this.start,this.options.step&&this.options.step.call(this.elem,this.now,this),i&&i.set?i.set(this):Yt.propHooks._default.set(this),this}},Yt.prototype.init.prototype=Yt.prototype,Yt.propHooks={_default:{get:function(t){var e;return 1!==t.elem.nodeType||null!=t.elem[t.prop]&&null==t.elem.style[t.prop]?t.elem[t.prop]:(e=v.css(t.elem,t.prop,""))&&"auto"!==e?e:0},set:function(t){v.fx.step[t.prop]?v.fx.step[t.prop](t):1!==t.elem.nodeType||null==t.elem.style[v.cssProps[t.prop]]&&!v.cssHooks[t.prop]?t.elem[t.prop]=t.now:v.style(t.elem,t.prop,t.now+t.unit)}}},Yt.propHooks.scrollTop=Yt.propHooks.scrollLeft={set:function(t){t.elem.nodeType&&t.elem.parentNode&&(t.elem[t.prop]=t.now)}},v.easing={linear:function(t){return t},swing:function(t){return.5-Math.cos(t*Math.PI)/2},_default:"swing"},v.fx=Yt.prototype.init,v.fx.step={};var Gt,Jt,Kt=/^(?:toggle|show|hide)$/,Zt=/queueHooks$/;function te(){Jt&&(!1===n.hidden&&t.requestAnimationFrame?t.requestAnimationFrame(te):t.setTimeout(te,v.fx.interval),v.fx.tick())}function ee(){return t.setTimeout(function(){Gt=void 0}),Gt=v.now()}function ie(t,e){var i,n=0,o={height:t};for(e=e?1:0;n<4;n+=2-e)o["margin"+(i=Z[n])]=o["padding"+i]=t;return e&&(o.opacity=o.width=t),o}function ne(t,e,i){for(var n,o=(oe.tweeners[e]||[]).concat(oe.tweeners["*"]),s=0,r=o.length;s<r;s++)if(n=o[s].call(i,e,t))return n}function oe(t,e,i){var n,o,s=0,r=oe.prefilters.length,a=v.Deferred().always(function(){delete l.elem}),l=function(){if(o)return!1;for(var e=Gt||ee(),i=Math.max(0,u.startTime+u.duration-e),n=1-(i/u.duration||0),s=0,r=u.tweens.length;s<r;s++)u.tweens[s].run(n);return a.notifyWith(t,[u,n,i]),n<1&&r?i:(r||a.notifyWith(t,[u,1,0]),a.resolveWith(t,[u]),!1)},u=a.promise({elem:t,props:v.extend({},e),opts:v.extend(!0,{specialEasing:{},easing:v.easing._default},i),originalProperties:e,originalOptions:i,startTime:Gt||ee(),duration:i.duration,tweens:[],createTween:function(e,i){var n=v.Tween(t,u.opts,e,i,u.opts.specialEasing[e]||u.opts.easing);return u.tweens.push(n),n},stop:function(e){var i=0,n=e?u.tweens.length:0;if(o)return this;for(o=!0;i<n;i++)u.tweens[i].run(1);return e?(a.notifyWith(t,[u,1,0]),a.resolveWith(t,[u,e])):a.rejectWith(t,[u,e]),this}}),h=u.props;for(function(t,e){var i,n,o,s,r;for(i in t)if(o=e[n=v.camelCase(i)],s=t[i],Array.isArray(s)&&(o=s[1],s=t[i]=s[0]),i!==n&&(t[n]=s,delete t[i]),(r=v.cssHooks[n])&&"expand"in r)for(i in s=r.expand(s),delete t[n],s)i in t||(t[i]=s[i],e[i]=o);else e[n]=o}(h,u.opts.specialEasing);s<r;s++)if(n=oe.prefilters[s].call(u,t,h,u.opts))return v.isFunction(n.stop)&&(v._queueHooks(u.elem,u.opts.queue).stop=v.proxy(n.stop,n)),n;return v.map(h,ne,u),v.isFunction(u.opts.start)&&u.opts.start.call(t,u),u.progress(u.opts.progress).done(u.opts.done,u.opts.complete).fail(u.opts.fail).always(u.opts.always),v.fx.timer(v.extend(l,{elem:t,anim:u,queue:u.opts.queue})),u}v.Animation=v.extend(oe,{tweeners:{"*":[function(t,e){var i=this.createTween(t,e);return it(i.elem,t,K.exec(e),i),i}]},tweener:function(t,e){v.isFunction(t)?(e=t,t=["*"]):t=t.match(M);for(var i,n=0,o=t.length;n<o;n++)i=t[n],oe.tweeners[i]=oe.tweeners[i]||[],oe.tweeners[i].unshift(e)},prefilters:[function(t,e,i){var n,o,s,r,a,l,u,h,c="width"in e||"height"in e,d=this,p={},f=t.style,m=t.nodeType&&tt(t),g=U.get(t,"fxshow");for(n in i.queue||(null==(r=v._queueHooks(t,"fx")).unqueued&&(r.unqueued=0,a=r.empty.fire,r.empty.fire=function(){r.unqueued||a()}),r.unqueued++,d.always(function(){d.always(function(){r.unqueued--,v.queue(t,"fx").length||r.empty.fire()})})),e)if(o=e[n],Kt.test(o)){if(delete e[n],s=s||"toggle"===o,o===(m?"hide":"show")){if("show"!==o||!g||void 0===g[n])continue;m=!0}p[n]=g&&g[n]||v.style(t,n)}if((l=!v.isEmptyObject(e))||!v.isEmptyObject(p))for(n in c&&1===t.nodeType&&(i.overflow=[f.overflow,f.overflowX,f.overflowY],null==(u=g&&g.display)&&(u=U.get(t,"display")),"none"===(h=v.css(t,"display"))&&(u?h=u:(st([t],!0),u=t.style.display||u,h=v.css(t,"display"),st([t]))),("inline"===h||"inline-block"===h&&null!=u)&&"none"===v.css(t,"float")&&(l||(d.done(function(){f.display=u}),null==u&&(h=f.display,u="none"===h?"":h)),f.display="inline-block")),i.overflow&&(f.overflow="hidden",d.always(function(){f.overflow=i.overflow[0],f.overflowX=i.overflow[1],f.overflowY=i.overflow[2]})),l=!1,p)l||(g?"hidden"in g&&(m=g.hidden):g=U.access(t,"fxshow",{display:u}),s&&(g.hidden=!m),m&&st([t],!0),d.done(function(){for(n in m||st([t]),U.remove(t,"fxshow"),p)v.style(t,n,p[n])})),l=ne(m?g[n]:0,n,d),n in g||(g[n]=l.start,m&&(l.end=l.start,l.start=0))}],prefilter:function(t,e){e?oe.prefilters.unshift(t):oe.prefilters.push(t)}}),v.speed=function(t,e,i){var n=t&&"object"==typeof t?v.extend({},t):{complete:i||!i&&e||v.isFunction(t)&&t,duration:t,easing:i&&e||e&&!v.isFunction(e)&&e};return v.fx.off?n.duration=0:"number"!=typeof n.duration&&(n.duration in v.fx.speeds?n.duration=v.fx.speeds[n.duration]:n.duration=v.fx.speeds._default),null!=n.queue&&!0!==n.queue||(n.queue="fx"),n.old=n.complete,n.complete=function(){v.isFunction(n.old)&&n.old.call(this),n.queue&&v.dequeue(this,n.queue)},n},v.fn.extend({fadeTo:function(t,e,i,n){return this.filter(tt).css("opacity",0).show().end().animate({opacity:e},t,i,n)},animate:function(t,e,i,n){var o=v.isEmptyObject(t),s=v.speed(e,i,n),r=function(){var e=oe(this,v.extend({},t),s);(o||U.get(this,"finish"))&&e.stop(!0)};return r.finish=r,o||!1===s.queue?this.each(r):this.queue(s.queue,r)},stop:function(t,e,i){var n=function(t){var e=t.stop;delete t.stop,e(i)};return"string"!=typeof t&&(i=e,e=t,t=void 0),e&&!1!==t&&this.queue(t||"fx",[]),this.each(function(){var e=!0,o=null!=t&&t+"queueHooks",s=v.timers,r=U.get(this);if(o)r[o]&&r[o].stop&&n(r[o]);else for(o in r)r[o]&&r[o].stop&&Zt.test(o)&&n(r[o]);for(o=s.length;o--;)s[o].elem!==this||null!=t&&s[o].queue!==t||(s[o].anim.stop(i),e=!1,s.splice(o,1));!e&&i||v.dequeue(this,t)})},finish:function(t){return!1!==t&&(t=t||"fx"),this.each(function(){var e,i=U.get(this),n=i[t+"queue"],o=i[t+"queueHooks"],s=v.timers,r=n?n.length:0;for(i.finish=!0,v.queue(this,t,[]),o&&o.stop&&o.stop.call(this,!0),e=s.length;e--;)s[e].elem===this&&s[e].queue===t&&(s[e].anim.stop(!0),s.splice(e,1));for(e=0;e<r;e++)n[e]&&n[e].finish&&n[e].finish.call(this);delete i.finish})}}),v.each(["toggle","show","hide"],function(t,e){var i=v.fn[e];v.fn[e]=function(t,n,o){return null==t||"boolean"==typeof t?i.apply(this,arguments):this.animate(ie(e,!0),t,n,o)}}),v.each({slideDown:ie("show"),slideUp:ie("hide"),slideToggle:ie("toggle"),fadeIn:{opacity:"show"},fadeOut:{opacity:"hide"},fadeToggle:{opacity:"toggle"}},function(t,e){v.fn[t]=function(t,i,n){return this.animate(e,t,i,n)}}),v.timers=[],v.fx.tick=function(){var t,e=0,i=v.timers;for(Gt=v.now();e<i.length;e++)(t=i[e])()||i[e]!==t||i.splice(e--,1);i.length||v.fx.stop(),Gt=void 0},v.fx.timer=function(t){v.timers.push(t),v.fx.start()},v.fx.interval=13,v.fx.start=function(){Jt||(Jt=!0,te())},v.fx.stop=function(){Jt=null},v.fx.speeds={slow:600,fast:200,_default:400},v.fn.delay=function(e,i){return e=v.fx&&v.fx.speeds[e]||e,i=i||"fx",this.queue(i,function(i,n){var o=t.setTimeout(i,e);n.stop=function(){t.clearTimeout(o)}})},function(){var t=n.createElement("input"),e=n.createElement("select").appendChild(n.createElement("option"));t.type="checkbox",f.checkOn=""!==t.value,f.optSelected=e.selected,(t=n.createElement("input")).value="t",t.type="radio",f.radioValue="t"===t.value}();var se,re=v.expr.attrHandle;v.fn.extend({attr:function(t,e){return B(this,v.attr,t,e,arguments.length>1)},removeAttr:function(t){return this.each(function(){v.removeAttr(this,t)})}}),v.extend({attr:function(t,e,i){var n,o,s=t.nodeType;if(3!==s&&8!==s&&2!==s)return void 0===t.getAttribute?v.prop(t,e,i):(1===s&&v.isXMLDoc(t)||(o=v.attrHooks[e.toLowerCase()]||(v.expr.match.bool.test(e)?se:void 0)),void 0!==i?null===i?void v.removeAttr(t,e):o&&"set"in o&&void 0!==(n=o.set(t,i,e))?n:(t.setAttribute(e,i+""),i):o&&"get"in o&&null!==(n=o.get(t,e))?n:null==(n=v.find.attr(t,e))?void 0:n)},attrHooks:{type:{set:function(t,e){if(!f.radioValue&&"radio"===e&&S(t,"input")){var i=t.value;return t.setAttribute("type",e),i&&(t.value=i),e}}}},removeAttr:function(t,e){var i,n=0,o=e&&e.match(M);if(o&&1===t.nodeType)for(;i=o[n++];)t.removeAttribute(i)}}),se={set:function(t,e,i){return!1===e?v.removeAttr(t,i):t.setAttribute(i,i),i}},v.each(v.expr.match.bool.source.match(/\w+/g),function(t,e){var i=re[e]||v.find.attr;re[e]=function(t,e,n){var o,s,r=e.toLowerCase();return n||(s=re[r],re[r]=o,o=null!=i(t,e,n)?r:null,re[r]=s),o}});var ae=/^(?:input|select|textarea|button)$/i,le=/^(?:a|area)$/i;function ue(t){return(t.match(M)||[]).join(" ")}function he(t){return t.getAttribute&&t.getAttribute("class")||""}v.fn.extend({prop:function(t,e){return B(this,v.prop,t,e,arguments.length>1)},removeProp:function(t){return this.each(function(){delete this[v.propFix[t]||t]})}}),v.extend({prop:function(t,e,i){var n,o,s=t.nodeType;if(3!==s&&8!==s&&2!==s)return 1===s&&v.isXMLDoc(t)||(e=v.propFix[e]||e,o=v.propHooks[e]),void 0!==i?o&&"set"in o&&void 0!==(n=o.set(t,i,e))?n:t[e]=i:o&&"get"in o&&null!==(n=o.get(t,e))?n:t[e]},propHooks:{tabIndex:{get:function(t){var e=v.find.attr(t,"tabindex");return e?parseInt(e,10):ae.test(t.nodeName)||le.test(t.nodeName)&&t.href?0:-1}}},propFix:{for:"htmlFor",class:"className"}}),f.optSelected||(v.propHooks.selected={get:function(t){var e=t.parentNode;return e&&e.parentNode&&e.parentNode.selectedIndex,null},set:function(t){var e=t.parentNode;e&&(e.selectedIndex,e.parentNode&&e.parentNode.selectedIndex)}}),v.each(["tabIndex","readOnly","maxLength","cellSpacing","cellPadding","rowSpan","colSpan","useMap","frameBorder","contentEditable"],function(){v.propFix[this.toLowerCase()]=this}),v.fn.extend({addClass:function(t){var e,i,n,o,s,r,a,l=0;if(v.isFunction(t))return this.each(function(e){v(this).addClass(t.call(this,e,he(this)))});if("string"==typeof t&&t)for(e=t.match(M)||[];i=this[l++];)if(o=he(i),n=1===i.nodeType&&" "+ue(o)+" "){for(r=0;s=e[r++];)n.indexOf(" "+s+" ")<0&&(n+=s+" ");o!==(a=ue(n))&&i.setAttribute("class",a)}return this},removeClass:function(t){var e,i,n,o,s,r,a,l=0;if(v.isFunction(t))return this.each(function(e){v(this).removeClass(t.call(this,e,he(this)))});if(!arguments.length)return this.attr("class","");if("string"==typeof t&&t)for(e=t.match(M)||[];i=this[l++];)if(o=he(i),n=1===i.nodeType&&" "+ue(o)+" "){for(r=0;s=e[r++];)for(;n.indexOf(" "+s+" ")>-1;)n=n.replace(" "+s+" "," ");o!==(a=ue(n))&&i.setAttribute("class",a)}return this},toggleClass:function(t,e){var i=typeof t;return"boolean"==typeof e&&"string"===i?e?this.addClass(t):this.removeClass(t):v.isFunction(t)?this.each(function(i){v(this).toggleClass(t.call(this,i,he(this),e),e)}):this.each(function(){var e,n,o,s;if("string"===i)for(n=0,o=v(this),s=t.match(M)||[];e=s[n++];)o.hasClass(e)?o.removeClass(e):o.addClass(e);else void 0!==t&&"boolean"!==i||((e=he(this))&&U.set(this,"__className__",e),this.setAttribute&&this.setAttribute("class",e||!1===t?"":U.get(this,"__className__")||""))})},hasClass:function(t){var e,i,n=0;for(e=" "+t+" ";i=this[n++];)if(1===i.nodeType&&(" "+ue(he(i))+" ").indexOf(e)>-1)return!0;return!1}});var ce=/\r/g;v.fn.extend({val:function(t){var e,i,n,o=this[0];return arguments.length?(n=v.isFunction(t),this.each(function(i){var o;1===this.nodeType&&(null==(o=n?t.call(this,i,v(this).val()):t)?o="":"number"==typeof o?o+="":Array.isArray(o)&&(o=v.map(o,function(t){return null==t?"":t+""})),(e=v.valHooks[this.type]||v.valHooks[this.nodeName.toLowerCase()])&&"set"in e&&void 0!==e.set(this,o,"value")||(this.value=o))})):o?(e=v.valHooks[o.type]||v.valHooks[o.nodeName.toLowerCase()])&&"get"in e&&void 0!==(i=e.get(o,"value"))?i:"string"==typeof(i=o.value)?i.replace(ce,""):null==i?"":i:void 0}}),v.extend({valHooks:{option:{get:function(t){var e=v.find.attr(t,"value");return null!=e?e:ue(v.text(t))}},select:{get:function(t){var e,i,n,o=t.options,s=t.selectedIndex,r="select-one"===t.type,a=r?null:[],l=r?s+1:o.length;for(n=s<0?l:r?s:0;n<l;n++)if(((i=o[n]).selected||n===s)&&!i.disabled&&(!i.parentNode.disabled||!S(i.parentNode,"optgroup"))){if(e=v(i).val(),r)return e;a.push(e)}return a},set:function(t,e){for(var i,n,o=t.options,s=v.makeArray(e),r=o.length;r--;)((n=o[r]).selected=v.inArray(v.valHooks.option.get(n),s)>-1)&&(i=!0);return i||(t.selectedIndex=-1),s}}}}),v.each(["radio","checkbox"],function(){v.valHooks[this]={set:function(t,e){if(Array.isArray(e))return t.checked=v.inArray(v(t).val(),e)>-1}},f.checkOn||(v.valHooks[this].get=function(t){return null===t.getAttribute("value")?"on":t.value})});var de=/^(?:focusinfocus|focusoutblur)$/;v.extend(v.event,{trigger:function(e,i,o,s){var r,a,l,u,h,d,p,f=[o||n],m=c.call(e,"type")?e.type:e,g=c.call(e,"namespace")?e.namespace.split("."):[];if(a=l=o=o||n,3!==o.nodeType&&8!==o.nodeType&&!de.test(m+v.event.triggered)&&(m.indexOf(".")>-1&&(g=m.split("."),m=g.shift(),g.sort()),h=m.indexOf(":")<0&&"on"+m,(e=e[v.expando]?e:new v.Event(m,"object"==typeof e&&e)).isTrigger=s?2:3,e.namespace=g.join("."),e.rnamespace=e.namespace?new RegExp("(^|\\.)"+g.join("\\.(?:.*\\.|)")+"(\\.|$)"):null,e.result=void 0,e.target||(e.target=o),i=null==i?[e]:v.makeArray(i,[e]),p=v.event.special[m]||{},s||!p.trigger||!1!==p.trigger.apply(o,i))){if(!s&&!p.noBubble&&!v.isWindow(o)){for(u=p.delegateType||m,de.test(u+m)||(a=a.parentNode);a;a=a.parentNode)f.push(a),l=a;l===(o.ownerDocument||n)&&f.push(l.defaultView||l.parentWindow||t)}for(r=0;(a=f[r++])&&!e.isPropagationStopped();)e.type=r>1?u:p.bindType||m,(d=(U.get(a,"events")||{})[e.type]&&U.get(a,"handle"))&&d.apply(a,i),(d=h&&a[h])&&d.apply&&W(a)&&(e.result=d.apply(a,i),!1===e.result&&e.preventDefault());return e.type=m,s||e.isDefaultPrevented()||p._default&&!1!==p._default.apply(f.pop(),i)||!W(o)||h&&v.isFunction(o[m])&&!v.isWindow(o)&&((l=o[h])&&(o[h]=null),v.event.triggered=m,o[m](),v.event.triggered=void 0,l&&(o[h]=l)),e.result}},simulate:function(t,e,i){var n=v.extend(new v.Event,i,{type:t,isSimulated:!0});v.event.trigger(n,null,e)}}),v.fn.extend({trigger:function(t,e){return this.each(function(){v.event.trigger(t,e,this)})},triggerHandler:function(t,e){var i=this[0];if(i)return v.event.trigger(t,e,i,!0)}}),v.each("blur focus focusin focusout resize scroll click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave change select submit keydown keypress keyup contextmenu".split(" "),function(t,e){v.fn[e]=function(t,i){return arguments.length>0?this.on(e,null,t,i):this.trigger(e)}}),v.fn.extend({hover:function(t,e){return this.mouseenter(t).mouseleave(e||t)}}),f.focusin="onfocusin"in t,f.focusin||v.each({focus:"focusin",blur:"focusout"},function(t,e){var i=function(t){v.event.simulate(e,t.target,v.event.fix(t))};v.event.special[e]={setup:function(){var n=this.ownerDocument||this,o=U.access(n,e);o||n.addEventListener(t,i,!0),U.access(n,e,(o||0)+1)},teardown:function(){var n=this.ownerDocument||this,o=U.access(n,e)-1;o?U.access(n,e,o):(n.removeEventListener(t,i,!0),U.remove(n,e))}}});var pe=t.location,fe=v.now(),me=/\?/;v.parseXML=function(e){var i;if(!e||"string"!=typeof e)return null;try{i=(new t.DOMParser).parseFromString(e,"text/xml")}catch(t){i=void 0}return i&&!i.getElementsByTagName("parsererror").length||v.error("Invalid XML: "+e),i};var ge=/\[\]$/,ve=/\r?\n/g,ye=/^(?:submit|button|image|reset|file)$/i,_e=/^(?:input|select|textarea|keygen)/i;function be(t,e,i,n){var o;if(Array.isArray(e))v.each(e,function(e,o){i||ge.test(t)?n(t,o):be(t+"["+("object"==typeof o&&null!=o?e:"")+"]",o,i,n)});else if(i||"object"!==v.type(e))n(t,e);else for(o in e)be(t+"["+o+"]",e[o],i,n)}v.param=function(t,e){var i,n=[],o=function(t,e){var i=v.isFunction(e)?e():e;n[n.length]=encodeURIComponent(t)+"="+encodeURIComponent(null==i?"":i)};if(Array.isArray(t)||t.jquery&&!v.isPlainObject(t))v.each(t,function(){o(this.name,this.value)});else for(i in t)be(i,t[i],e,o);return n.join("&")},v.fn.extend({serialize:function(){return v.param(this.serializeArray())},serializeArray:function(){return this.map(function(){var t=v.prop(this,"elements");return t?v.makeArray(t):this}).filter(function(){var t=this.type;return this.name&&!v(this).is(":disabled")&&_e.test(this.nodeName)&&!ye.test(t)&&(this.checked||!rt.test(t))}).map(function(t,e){var i=v(this).val();return null==i?null:Array.isArray(i)?v.map(i,function(t){return{name:e.name,value:t.replace(ve,"\r\n")}}):{name:e.name,value:i.replace(ve,"\r\n")}}).get()}});var xe=/%20/g,we=/#.*$/,ke=/([?&])_=[^&]*/,Ce=/^(.*?):[ \t]*([^\r\n]*)$/gm,Te=/^(?:GET|HEAD)$/,Ee=/^\/\//,Se={},Ne={},Ae="*/".concat("*"),Le=n.createElement("a");function De(t){return function(e,i){"string"!=typeof e&&(i=e,e="*");var n,o=0,s=e.toLowerCase().match(M)||[];if(v.isFunction(i))for(;n=s[o++];)"+"===n[0]?(n=n.slice(1)||"*",(t[n]=t[n]||[]).unshift(i)):(t[n]=t[n]||[]).push(i)}}function je(t,e,i,n){var o={},s=t===Ne;function r(a){var l;return o[a]=!0,v.each(t[a]||[],function(t,a){var u=a(e,i,n);return"string"!=typeof u||s||o[u]?s?!(l=u):void 0:(e.dataTypes.unshift(u),r(u),!1)}),l}return r(e.dataTypes[0])||!o["*"]&&r("*")}function Pe(t,e){var i,n,o=v.ajaxSettings.flatOptions||{};for(i in e)void 0!==e[i]&&((o[i]?t:n||(n={}))[i]=e[i]);return n&&v.extend(!0,t,n),t}Le.href=pe.href,v.extend({active:0,lastModified:{},etag:{},ajaxSettings:{url:pe.href,type:"GET",isLocal:/^(?:about|app|app-storage|.+-extension|file|res|widget):$/.test(pe.protocol),global:!0,processData:!0,async:!0,contentType:"application/x-www-form-urlencoded; charset=UTF-8",accepts:{"*":Ae,text:"text/plain",html:"text/html",xml:"application/xml, text/xml",json:"application/json, text/javascript"},contents:{xml:/\bxml\b/,html:/\bhtml/,json:/\bjson\b/},responseFields:{xml:"responseXML",text:"responseText",json:"responseJSON"},converters:{"* text":String,"text html":!0,"text json":JSON.parse,"text xml":v.parseXML},flatOptions:{url:!0,context:!0}},ajaxSetup:function(t,e){return e?Pe(Pe(t,v.ajaxSettings),e):Pe(v.ajaxSettings,t)},ajaxPrefilter:De(Se),ajaxTransport:De(Ne),ajax:function(e,i){"object"==typeof e&&(i=e,e=void 0),i=i||{};var o,s,r,a,l,u,h,c,d,p,f=v.ajaxSetup({},i),m=f.context||f,g=f.context&&(m.nodeType||m.jquery)?v(m):v.event,y=v.Deferred(),_=v.Callbacks("once memory"),b=f.statusCode||{},x={},w={},k="canceled",C={readyState:0,getResponseHeader:function(t){var e;if(h){if(!a)for(a={};e=Ce.exec(r);)a[e[1].toLowerCase()]=e[2];e=a[t.toLowerCase()]}return null==e?null:e},getAllResponseHeaders:function(){return h?r:null},setRequestHeader:function(t,e){return null==h&&(t=w[t.toLowerCase()]=w[t.toLowerCase()]||t,x[t]=e),this},overrideMimeType:function(t){return null==h&&(f.mimeType=t),this},statusCode:function(t){var e;if(t)if(h)C.always(t[C.status]);else for(e in t)b[e]=[b[e],t[e]];return this},abort:function(t){var e=t||k;return o&&o.abort(e),T(0,e),this}};if(y.promise(C),f.url=((e||f.url||pe.href)+"").replace(Ee,pe.protocol+"//"),f.type=i.method||i.type||f.method||f.type,f.dataTypes=(f.dataType||"*").toLowerCase().match(M)||[""],null==f.crossDomain){u=n.createElement("a");try{u.href=f.url,u.href=u.href,f.crossDomain=Le.protocol+"//"+Le.host!=u.protocol+"//"+u.host}catch(t){f.crossDomain=!0}}if(f.data&&f.processData&&"string"!=typeof f.data&&(f.data=v.param(f.data,f.traditional)),je(Se,f,i,C),h)return C;for(d in(c=v.event&&f.global)&&0==v.active++&&v.event.trigger("ajaxStart"),f.type=f.type.toUpperCase(),f.hasContent=!Te.test(f.type),s=f.url.replace(we,""),f.hasContent?f.data&&f.processData&&0===(f.contentType||"").indexOf("application/x-www-form-urlencoded")&&(f.data=f.data.replace(xe,"+")):(p=f.url.slice(s.length),f.data&&(s+=(me.test(s)?"&":"?")+f.data,delete f.data),!1===f.cache&&(s=s.replace(ke,"$1"),p=(me.test(s)?"&":"?")+"_="+fe+++p),f.url=s+p),f.ifModified&&(v.lastModified[s]&&C.setRequestHeader("If-Modified-Since",v.lastModified[s]),v.etag[s]&&C.setRequestHeader("If-None-Match",v.etag[s])),(f.data&&f.hasContent&&!1!==f.contentType||i.contentType)&&C.setRequestHeader("Content-Type",f.contentType),C.setRequestHeader("Accept",f.dataTypes[0]&&f.accepts[f.dataTypes[0]]?f.accepts[f.dataTypes[0]]+("*"!==f.dataTypes[0]?", "+Ae+"; q=0.01":""):f.accepts["*"]),f.headers)C.setRequestHeader(d,f.headers[d]);if(f.beforeSend&&(!1===f.beforeSend.call(m,C,f)||h))return C.abort();if(k="abort",_.add(f.complete),C.done(f.success),C.fail(f.error),o=je(Ne,f,i,C)){if(C.readyState=1,c&&g.trigger("ajaxSend",[C,f]),h)return C;f.async&&f.timeout>0&&(l=t.setTimeout(function(){C.abort("timeout")},f.timeout));try{h=!1,o.send(x,T)}catch(t){if(h)throw t;T(-1,t)}}else T(-1,"No Transport");function T(e,i,n,a){var u,d,p,x,w,k=i;h||(h=!0,l&&t.clearTimeout(l),o=void 0,r=a||"",C.readyState=e>0?4:0,u=e>=200&&e<300||304===e,n&&(x=function(t,e,i){for(var n,o,s,r,a=t.contents,l=t.dataTypes;"*"===l[0];)l.shift(),void 0===n&&(n=t.mimeType||e.getResponseHeader("Content-Type"));if(n)for(o in a)if(a[o]&&a[o].test(n)){l.unshift(o);break}if(l[0]in i)s=l[0];else{for(o in i){if(!l[0]||t.converters[o+" "+l[0]]){s=o;break}r||(r=o)}s=s||r}if(s)return s!==l[0]&&l.unshift(s),i[s]}(f,C,n)),x=function(t,e,i,n){var o,s,r,a,l,u={},h=t.dataTypes.slice();if(h[1])for(r in t.converters)u[r.toLowerCase()]=t.converters[r];for(s=h.shift();s;)if(t.responseFields[s]&&(i[t.responseFields[s]]=e),!l&&n&&t.dataFilter&&(e=t.dataFilter(e,t.dataType)),l=s,s=h.shift())if("*"===s)s=l;else if("*"!==l&&l!==s){if(!(r=u[l+" "+s]||u["* "+s]))for(o in u)if((a=o.split(" "))[1]===s&&(r=u[l+" "+a[0]]||u["* "+a[0]])){!0===r?r=u[o]:!0!==u[o]&&(s=a[0],h.unshift(a[1]));break}if(!0!==r)if(r&&t.throws)e=r(e);else try{e=r(e)}catch(t){return{state:"parsererror",error:r?t:"No conversion from "+l+" to "+s}}}return{state:"success",data:e}}(f,x,C,u),u?(f.ifModified&&((w=C.getResponseHeader("Last-Modified"))&&(v.lastModified[s]=w),(w=C.getResponseHeader("etag"))&&(v.etag[s]=w)),204===e||"HEAD"===f.type?k="nocontent":304===e?k="notmodified":(k=x.state,d=x.data,u=!(p=x.error))):(p=k,!e&&k||(k="error",e<0&&(e=0))),C.status=e,C.statusText=(i||k)+"",u?y.resolveWith(m,[d,k,C]):y.rejectWith(m,[C,k,p]),C.statusCode(b),b=void 0,c&&g.trigger(u?"ajaxSuccess":"ajaxError",[C,f,u?d:p]),_.fireWith(m,[C,k]),c&&(g.trigger("ajaxComplete",[C,f]),--v.active||v.event.trigger("ajaxStop")))}return C},getJSON:function(t,e,i){return v.get(t,e,i,"json")},getScript:function(t,e){return v.get(t,void 0,e,"script")}}),v.each(["get","post"],function(t,e){v[e]=function(t,i,n,o){return v.isFunction(i)&&(o=o||n,n=i,i=void 0),v.ajax(v.extend({url:t,type:e,dataType:o,data:i,success:n},v.isPlainObject(t)&&t))}}),v._evalUrl=function(t){return v.ajax({url:t,type:"GET",dataType:"script",cache:!0,async:!1,global:!1,throws:!0})},v.fn.extend({wrapAll:function(t){var e;return this[0]&&(v.isFunction(t)&&(t=t.call(this[0])),e=v(t,this[0].ownerDocument).eq(0).clone(!0),this[0].parentNode&&e.insertBefore(this[0]),e.map(function(){for(var t=this;t.firstElementChild;)t=t.firstElementChild;return t}).append(this)),this},wrapInner:function(t){return v.isFunction(t)?this.each(function(e){v(this).wrapInner(t.call(this,e))}):this.each(function(){var e=v(this),i=e.contents();i.length?i.wrapAll(t):e.append(t)})},wrap:function(t){var e=v.isFunction(t);return this.each(function(i){v(this).wrapAll(e?t.call(this,i):t)})},unwrap:function(t){return this.parent(t).not("body").each(function(){v(this).replaceWith(this.childNodes)}),this}}),v.expr.pseudos.hidden=function(t){return!v.expr.pseudos.visible(t)},v.expr.pseudos.visible=function(t){return!!(t.offsetWidth||t.offsetHeight||t.getClientRects().length)},v.ajaxSettings.xhr=function(){try{return new t.XMLHttpRequest}catch(t){}};var He={0:200,1223:204},$e=v.ajaxSettings.xhr();f.cors=!!$e&&"withCredentials"in $e,f.ajax=$e=!!$e,v.ajaxTransport(function(e){var i,n;if(f.cors||$e&&!e.crossDomain)return{send:function(o,s){var r,a=e.xhr();if(a.open(e.type,e.url,e.async,e.username,e.password),e.xhrFields)for(r in e.xhrFields)a[r]=e.xhrFields[r];for(r in e.mimeType&&a.overrideMimeType&&a.overrideMimeType(e.mimeType),e.crossDomain||o["X-Requested-With"]||(o["X-Requested-With"]="XMLHttpRequest"),o)a.setRequestHeader(r,o[r]);i=function(t){return function(){i&&(i=n=a.onload=a.onerror=a.onabort=a.onreadystatechange=null,"abort"===t?a.abort():"error"===t?"number"!=typeof a.status?s(0,"error"):s(a.status,a.statusText):s(He[a.status]||a.status,a.statusText,"text"!==(a.responseType||"text")||"string"!=typeof a.responseText?{binary:a.response}:{text:a.responseText},a.getAllResponseHeaders()))}},a.onload=i(),n=a.onerror=i("error"),void 0!==a.onabort?a.onabort=n:a.onreadystatechange=function(){4===a.readyState&&t.setTimeout(function(){i&&n()})},i=i("abort");try{a.send(e.hasContent&&e.data||null)}catch(t){if(i)throw t}},abort:function(){i&&i()}}}),v.ajaxPrefilter(function(t){t.crossDomain&&(t.contents.script=!1)}),v.ajaxSetup({accepts:{script:"text/javascript, application/javascript, application/ecmascript, application/x-ecmascript"},contents:{script:/\b(?:java|ecma)script\b/},converters:{"text script":function(t){return v.globalEval(t),t}}}),v.ajaxPrefilter("script",function(t){void 0===t.cache&&(t.cache=!1),t.crossDomain&&(t.type="GET")}),v.ajaxTransport("script",function(t){var e,i;if(t.crossDomain)return{send:function(o,s){e=v("<script>").prop({charset:t.scriptCharset,src:t.url}).on("load error",i=function(t){e.remove(),i=null,t&&s("error"===t.type?404:200,t.type)}),n.head.appendChild(e[0])},abort:function(){i&&i()}}});var Me=[],qe=/(=)\?(?=&|$)|\?\?/;v.ajaxSetup({jsonp:"callback",jsonpCallback:function(){var t=Me.pop()||v.expando+"_"+fe++;return this[t]=!0,t}}),v.ajaxPrefilter("json jsonp",function(e,i,n){var o,s,r,a=!1!==e.jsonp&&(qe.test(e.url)?"url":"string"==typeof e.data&&0===(e.contentType||"").indexOf("application/x-www-form-urlencoded")&&qe.test(e.data)&&"data");if(a||"jsonp"===e.dataTypes[0])return o=e.jsonpCallback=v.isFunction(e.jsonpCallback)?e.jsonpCallback():e.jsonpCallback,a?e[a]=e[a].replace(qe,"$1"+o):!1!==e.jsonp&&(e.url+=(me.test(e.url)?"&":"?")+e.jsonp+"="+o),e.converters["script json"]=function(){return r||v.error(o+" was not called"),r[0]},e.dataTypes[0]="json",s=t[o],t[o]=function(){r=arguments},n.always(function(){void 0===s?v(t).removeProp(o):t[o]=s,e[o]&&(e.jsonpCallback=i.jsonpCallback,Me.push(o)),r&&v.isFunction(s)&&s(r[0]),r=s=void 0}),"script"}),f.createHTMLDocument=function(){var t=n.implementation.createHTMLDocument("").body;return t.innerHTML="<form></form><form></form>",2===t.childNodes.length}(),v.parseHTML=function(t,e,i){return"string"!=typeof t?[]:("boolean"==typeof e&&(i=e,e=!1),e||(f.createHTMLDocument?((o=(e=n.implementation.createHTMLDocument("")).createElement("base")).href=n.location.href,e.head.appendChild(o)):e=n),r=!i&&[],(s=N.exec(t))?[e.createElement(s[1])]:(s=pt([t],e,r),r&&r.length&&v(r).remove(),v.merge([],s.childNodes)));var o,s,r},v.fn.load=function(t,e,i){var n,o,s,r=this,a=t.indexOf(" ");return a>-1&&(n=ue(t.slice(a)),t=t.slice(0,a)),v.isFunction(e)?(i=e,e=void 0):e&&"object"==typeof e&&(o="POST"),r.length>0&&v.ajax({url:t,type:o||"GET",dataType:"html",data:e}).done(function(t){s=arguments,r.html(n?v("<div>").append(v.parseHTML(t)).find(n):t)}).always(i&&function(t,e){r.each(function(){i.apply(this,s||[t.responseText,e,t])})}),this},v.each(["ajaxStart","ajaxStop","ajaxComplete","ajaxError","ajaxSuccess","ajaxSend"],function(t,e){v.fn[e]=function(t){return this.on(e,t)}}),v.expr.pseudos.animated=function(t){return v.grep(v.timers,function(e){return t===e.elem}).length},v.offset={setOffset:function(t,e,i){var n,o,s,r,a,l,u=v.css(t,"position"),h=v(t),c={};"static"===u&&(t.style.position="relative"),a=h.offset(),s=v.css(t,"top"),l=v.css(t,"left"),("absolute"===u||"fixed"===u)&&(s+l).indexOf("auto")>-1?(r=(n=h.position()).top,o=n.left):(r=parseFloat(s)||0,o=parseFloat(l)||0),v.isFunction(e)&&(e=e.call(t,i,v.extend({},a))),null!=e.top&&(c.top=e.top-a.top+r),null!=e.left&&(c.left=e.left-a.left+o),"using"in e?e.using.call(t,c):h.css(c)}},v.fn.extend({offset:function(t){if(arguments.length)return void 0===t?this:this.each(function(e){v.offset.setOffset(this,t,e)});var e,i,n,o,s=this[0];return s?s.getClientRects().length?(n=s.getBoundingClientRect(),i=(e=s.ownerDocument).documentElement,o=e.defaultView,{top:n.top+o.pageYOffset-i.clientTop,left:n.left+o.pageXOffset-i.clientLeft}):{top:0,left:0}:void 0},position:function(){if(this[0]){var t,e,i=this[0],n={top:0,left:0};return"fixed"===v.css(i,"position")?e=i.getBoundingClientRect():(t=this.offsetParent(),e=this.offset(),S(t[0],"html")||(n=t.offset()),n={top:n.top+v.css(t[0],"borderTopWidth",!0),left:n.left+v.css(t[0],"borderLeftWidth",!0)}),{top:e.top-n.top-v.css(i,"marginTop",!0),left:e.left-n.left-v.css(i,"marginLeft",!0)}}},offsetParent:function(){return this.map(function(){for(var t=this.offsetParent;t&&"static"===v.css(t,"position");)t=t.offsetParent;return t||ft})}}),v.each({scrollLeft:"pageXOffset",scrollTop:"pageYOffset"},function(t,e){var i="pageYOffset"===e;v.fn[t]=function(n){return B(this,function(t,n,o){var s;return v.isWindow(t)?s=t:9===t.nodeType&&(s=t.defaultView),void 0===o?s?s[e]:t[n]:void(s?s.scrollTo(i?s.pageXOffset:o,i?o:s.pageYOffset):t[n]=o)},t,n,arguments.length)}}),v.each(["top","left"],function(t,e){v.cssHooks[e]=Ot(f.pixelPosition,function(t,i){if(i)return i=qt(t,e),$t.test(i)?v(t).position()[e]+"px":i})}),v.each({Height:"height",Width:"width"},function(t,e){v.each({padding:"inner"+t,content:e,"":"outer"+t},function(i,n){v.fn[n]=function(o,s){var r=arguments.length&&(i||"boolean"!=typeof o),a=i||(!0===o||!0===s?"margin":"border");return B(this,function(e,i,o){var s;return v.isWindow(e)?0===n.indexOf("outer")?e["inner"+t]:e.document.documentElement["client"+t]:9===e.nodeType?(s=e.documentElement,Math.max(e.body["scroll"+t],s["scroll"+t],e.body["offset"+t],s["offset"+t],s["client"+t])):void 0===o?v.css(e,i,a):v.style(e,i,o,a)},e,r?o:void 0,r)}})}),v.fn.extend({bind:function(t,e,i){return this.on(t,null,e,i)},unbind:function(t,e){return this.off(t,null,e)},delegate:function(t,e,i,n){return this.on(e,t,i,n)},undelegate:function(t,e,i){return 1===arguments.length?this.off(t,"**"):this.off(e,t||"**",i)}}),v.holdReady=function(t){t?v.readyWait++:v.ready(!0)},v.isArray=Array.isArray,v.parseJSON=JSON.parse,v.nodeName=S,"function"==typeof define&&define.amd&&define("jquery",[],function(){return v});var Oe=t.jQuery,Fe=t.$;return v.noConflict=function(e){return t.$===v&&(t.$=Fe),e&&t.jQuery===v&&(t.jQuery=Oe),v},e||(t.jQuery=t.$=v),v});var _typeof="function"==typeof Symbol&&"symbol"==typeof Symbol.iterator?function(t){return typeof t}:function(t){return t&&"function"==typeof Symbol&&t.constructor===Symbol&&t!==Symbol.prototype?"symbol":typeof t},windowIsDefined="object"===("undefined"==typeof window?"undefined":_typeof(window));if(function(t){if("function"==typeof define&&define.amd)define(["jquery"],t);else if("object"===("undefined"==typeof module?"undefined":_typeof(module))&&module.exports){var e;try{e=require("jquery")}catch(t){e=null}module.exports=t(e)}else window&&(window.Slider=t(window.jQuery))}(function(t){var e,i="slider",n="bootstrapSlider";return windowIsDefined&&!window.console&&(window.console={}),windowIsDefined&&!window.console.log&&(window.console.log=function(){}),windowIsDefined&&!window.console.warn&&(window.console.warn=function(){}),function(t){function e(){}var i=Array.prototype.slice;!function(t){function n(e){e.prototype.option||(e.prototype.option=function(e){t.isPlainObject(e)&&(this.options=t.extend(!0,this.options,e))})}function o(e,n){t.fn[e]=function(o){if("string"==typeof o){for(var r=i.call(arguments,1),a=0,l=this.length;l>a;a++){var u=this[a],h=t.data(u,e);if(h)if(t.isFunction(h[o])&&"_"!==o.charAt(0)){var c=h[o].apply(h,r);if(void 0!==c&&c!==h)return c}else s("no such method '"+o+"' for "+e+" instance");else s("cannot call methods on "+e+" prior to initialization; attempted to call '"+o+"'")}return this}var d=this.map(function(){var i=t.data(this,e);return i?(i.option(o),i._init()):(i=new n(this,o),t.data(this,e,i)),t(this)});return!d||d.length>1?d:d[0]}}if(t){var s="undefined"==typeof console?e:function(t){console.error(t)};t.bridget=function(t,e){n(e),o(t,e)},t.bridget}}(t)}(t),function(t){function o(e,i){function n(t,e){var i="data-slider-"+e.replace(/_/g,"-"),n=t.getAttribute(i);try{return JSON.parse(n)}catch(t){return n}}this._state={value:null,enabled:null,offset:null,size:null,percentage:null,inDrag:!1,over:!1},this.ticksCallbackMap={},this.handleCallbackMap={},"string"==typeof e?this.element=document.querySelector(e):e instanceof HTMLElement&&(this.element=e),i=i||{};for(var o=Object.keys(this.defaultOptions),s=0;s<o.length;s++){var a=o[s],l=i[a];l=null!==(l=void 0!==l?l:n(this.element,a))?l:this.defaultOptions[a],this.options||(this.options={}),this.options[a]=l}"auto"===this.options.rtl&&(this.options.rtl="rtl"===window.getComputedStyle(this.element).direction),"vertical"!==this.options.orientation||"top"!==this.options.tooltip_position&&"bottom"!==this.options.tooltip_position?"horizontal"!==this.options.orientation||"left"!==this.options.tooltip_position&&"right"!==this.options.tooltip_position||(this.options.tooltip_position="top"):this.options.rtl?this.options.tooltip_position="left":this.options.tooltip_position="right";var u,h,c,d,p,f=this.element.style.width,m=!1,g=this.element.parentNode;if(this.sliderElem)m=!0;else{this.sliderElem=document.createElement("div"),this.sliderElem.className="slider";var v=document.createElement("div");v.className="slider-track",(h=document.createElement("div")).className="slider-track-low",(u=document.createElement("div")).className="slider-selection",(c=document.createElement("div")).className="slider-track-high",(d=document.createElement("div")).className="slider-handle min-slider-handle",d.setAttribute("role","slider"),d.setAttribute("aria-valuemin",this.options.min),d.setAttribute("aria-valuemax",this.options.max),(p=document.createElement("div")).className="slider-handle max-slider-handle",p.setAttribute("role","slider"),p.setAttribute("aria-valuemin",this.options.min),p.setAttribute("aria-valuemax",this.options.max),v.appendChild(h),v.appendChild(u),v.appendChild(c),this.rangeHighlightElements=[];var y=this.options.rangeHighlights;if(Array.isArray(y)&&y.length>0)for(var _=0;_<y.length;_++){var b=document.createElement("div"),x=y[_].class||"";b.className="slider-rangeHighlight slider-selection "+x,this.rangeHighlightElements.push(b),v.appendChild(b)}var w=Array.isArray(this.options.labelledby);if(w&&this.options.labelledby[0]&&d.setAttribute("aria-labelledby",this.options.labelledby[0]),w&&this.options.labelledby[1]&&p.setAttribute("aria-labelledby",this.options.labelledby[1]),!w&&this.options.labelledby&&(d.setAttribute("aria-labelledby",this.options.labelledby),p.setAttribute("aria-labelledby",this.options.labelledby)),this.ticks=[],Array.isArray(this.options.ticks)&&this.options.ticks.length>0){for(this.ticksContainer=document.createElement("div"),this.ticksContainer.className="slider-tick-container",s=0;s<this.options.ticks.length;s++){var k=document.createElement("div");if(k.className="slider-tick",this.options.ticks_tooltip){var C=this._addTickListener(),T=C.addMouseEnter(this,k,s),E=C.addMouseLeave(this,k);this.ticksCallbackMap[s]={mouseEnter:T,mouseLeave:E}}this.ticks.push(k),this.ticksContainer.appendChild(k)}u.className+=" tick-slider-selection"}if(this.tickLabels=[],Array.isArray(this.options.ticks_labels)&&this.options.ticks_labels.length>0)for(this.tickLabelContainer=document.createElement("div"),this.tickLabelContainer.className="slider-tick-label-container",s=0;s<this.options.ticks_labels.length;s++){var S=document.createElement("div"),N=0===this.options.ticks_positions.length,A=this.options.reversed&&N?this.options.ticks_labels.length-(s+1):s;S.className="slider-tick-label",S.innerHTML=this.options.ticks_labels[A],this.tickLabels.push(S),this.tickLabelContainer.appendChild(S)}var L=function(t){var e=document.createElement("div");e.className="tooltip-arrow";var i=document.createElement("div");i.className="tooltip-inner",t.appendChild(e),t.appendChild(i)},D=document.createElement("div");D.className="tooltip tooltip-main",D.setAttribute("role","presentation"),L(D);var j=document.createElement("div");j.className="tooltip tooltip-min",j.setAttribute("role","presentation"),L(j);var P=document.createElement("div");P.className="tooltip tooltip-max",P.setAttribute("role","presentation"),L(P),this.sliderElem.appendChild(v),this.sliderElem.appendChild(D),this.sliderElem.appendChild(j),this.sliderElem.appendChild(P),this.tickLabelContainer&&this.sliderElem.appendChild(this.tickLabelContainer),this.ticksContainer&&this.sliderElem.appendChild(this.ticksContainer),this.sliderElem.appendChild(d),this.sliderElem.appendChild(p),g.insertBefore(this.sliderElem,this.element),this.element.style.display="none"}if(t&&(this.$element=t(this.element),this.$sliderElem=t(this.sliderElem)),this.eventToCallbackMap={},this.sliderElem.id=this.options.id,this.touchCapable="ontouchstart"in window||window.DocumentTouch&&document instanceof window.DocumentTouch,this.touchX=0,this.touchY=0,this.tooltip=this.sliderElem.querySelector(".tooltip-main"),this.tooltipInner=this.tooltip.querySelector(".tooltip-inner"),this.tooltip_min=this.sliderElem.querySelector(".tooltip-min"),this.tooltipInner_min=this.tooltip_min.querySelector(".tooltip-inner"),this.tooltip_max=this.sliderElem.querySelector(".tooltip-max"),this.tooltipInner_max=this.tooltip_max.querySelector(".tooltip-inner"),r[this.options.scale]&&(this.options.scale=r[this.options.scale]),!0===m&&(this._removeClass(this.sliderElem,"slider-horizontal"),this._removeClass(this.sliderElem,"slider-vertical"),this._removeClass(this.sliderElem,"slider-rtl"),this._removeClass(this.tooltip,"hide"),this._removeClass(this.tooltip_min,"hide"),this._removeClass(this.tooltip_max,"hide"),["left","right","top","width","height"].forEach(function(t){this._removeProperty(this.trackLow,t),this._removeProperty(this.trackSelection,t),this._removeProperty(this.trackHigh,t)},this),[this.handle1,this.handle2].forEach(function(t){this._removeProperty(t,"left"),this._removeProperty(t,"right"),this._removeProperty(t,"top")},this),[this.tooltip,this.tooltip_min,this.tooltip_max].forEach(function(t){this._removeProperty(t,"left"),this._removeProperty(t,"right"),this._removeProperty(t,"top"),this._removeClass(t,"right"),this._removeClass(t,"left"),this._removeClass(t,"top")},this)),"vertical"===this.options.orientation?(this._addClass(this.sliderElem,"slider-vertical"),this.stylePos="top",this.mousePos="pageY",this.sizePos="offsetHeight"):(this._addClass(this.sliderElem,"slider-horizontal"),this.sliderElem.style.width=f,this.options.orientation="horizontal",this.options.rtl?this.stylePos="right":this.stylePos="left",this.mousePos="pageX",this.sizePos="offsetWidth"),this.options.rtl&&this._addClass(this.sliderElem,"slider-rtl"),this._setTooltipPosition(),Array.isArray(this.options.ticks)&&this.options.ticks.length>0&&(this.options.max=Math.max.apply(Math,this.options.ticks),this.options.min=Math.min.apply(Math,this.options.ticks)),Array.isArray(this.options.value)?(this.options.range=!0,this._state.value=this.options.value):this.options.range?this._state.value=[this.options.value,this.options.max]:this._state.value=this.options.value,this.trackLow=h||this.trackLow,this.trackSelection=u||this.trackSelection,this.trackHigh=c||this.trackHigh,"none"===this.options.selection?(this._addClass(this.trackLow,"hide"),this._addClass(this.trackSelection,"hide"),this._addClass(this.trackHigh,"hide")):("after"===this.options.selection||"before"===this.options.selection)&&(this._removeClass(this.trackLow,"hide"),this._removeClass(this.trackSelection,"hide"),this._removeClass(this.trackHigh,"hide")),this.handle1=d||this.handle1,this.handle2=p||this.handle2,!0===m)for(this._removeClass(this.handle1,"round triangle"),this._removeClass(this.handle2,"round triangle hide"),s=0;s<this.ticks.length;s++)this._removeClass(this.ticks[s],"round triangle hide");if(-1!==["round","triangle","custom"].indexOf(this.options.handle))for(this._addClass(this.handle1,this.options.handle),this._addClass(this.handle2,this.options.handle),s=0;s<this.ticks.length;s++)this._addClass(this.ticks[s],this.options.handle);if(this._state.offset=this._offset(this.sliderElem),this._state.size=this.sliderElem[this.sizePos],this.setValue(this._state.value),this.handle1Keydown=this._keydown.bind(this,0),this.handle1.addEventListener("keydown",this.handle1Keydown,!1),this.handle2Keydown=this._keydown.bind(this,1),this.handle2.addEventListener("keydown",this.handle2Keydown,!1),this.mousedown=this._mousedown.bind(this),this.touchstart=this._touchstart.bind(this),this.touchmove=this._touchmove.bind(this),this.touchCapable){var H=!1;try{var $=Object.defineProperty({},"passive",{get:function(){H=!0}});window.addEventListener("test",null,$)}catch(t){}var M=!!H&&{passive:!0};this.sliderElem.addEventListener("touchstart",this.touchstart,M),this.sliderElem.addEventListener("touchmove",this.touchmove,M)}if(this.sliderElem.addEventListener("mousedown",this.mousedown,!1),this.resize=this._resize.bind(this),window.addEventListener("resize",this.resize,!1),"hide"===this.options.tooltip)this._addClass(this.tooltip,"hide"),this._addClass(this.tooltip_min,"hide"),this._addClass(this.tooltip_max,"hide");else if("always"===this.options.tooltip)this._showTooltip(),this._alwaysShowTooltip=!0;else{if(this.showTooltip=this._showTooltip.bind(this),this.hideTooltip=this._hideTooltip.bind(this),this.options.ticks_tooltip){var q=this._addTickListener(),O=q.addMouseEnter(this,this.handle1),F=q.addMouseLeave(this,this.handle1);this.handleCallbackMap.handle1={mouseEnter:O,mouseLeave:F},O=q.addMouseEnter(this,this.handle2),F=q.addMouseLeave(this,this.handle2),this.handleCallbackMap.handle2={mouseEnter:O,mouseLeave:F}}else this.sliderElem.addEventListener("mouseenter",this.showTooltip,!1),this.sliderElem.addEventListener("mouseleave",this.hideTooltip,!1);this.handle1.addEventListener("focus",this.showTooltip,!1),this.handle1.addEventListener("blur",this.hideTooltip,!1),this.handle2.addEventListener("focus",this.showTooltip,!1),this.handle2.addEventListener("blur",this.hideTooltip,!1)}this.options.enabled?this.enable():this.disable()}var s=function(t){return"Invalid input value '"+t+"' passed in"},r={linear:{toValue:function(t){var e=t/100*(this.options.max-this.options.min),i=!0;if(this.options.ticks_positions.length>0){for(var n,o,s,r=0,a=1;a<this.options.ticks_positions.length;a++)if(t<=this.options.ticks_positions[a]){n=this.options.ticks[a-1],s=this.options.ticks_positions[a-1],o=this.options.ticks[a],r=this.options.ticks_positions[a];break}e=n+(t-s)/(r-s)*(o-n),i=!1}var l=(i?this.options.min:0)+Math.round(e/this.options.step)*this.options.step;return l<this.options.min?this.options.min:l>this.options.max?this.options.max:l},toPercentage:function(t){if(this.options.max===this.options.min)return 0;if(this.options.ticks_positions.length>0){for(var e,i,n,o=0,s=0;s<this.options.ticks.length;s++)if(t<=this.options.ticks[s]){e=s>0?this.options.ticks[s-1]:0,n=s>0?this.options.ticks_positions[s-1]:0,i=this.options.ticks[s],o=this.options.ticks_positions[s];break}if(s>0)return n+(t-e)/(i-e)*(o-n)}return 100*(t-this.options.min)/(this.options.max-this.options.min)}},logarithmic:{toValue:function(t){var e=0===this.options.min?0:Math.log(this.options.min),i=Math.log(this.options.max),n=Math.exp(e+(i-e)*t/100);return Math.round(n)===this.options.max?this.options.max:(n=this.options.min+Math.round((n-this.options.min)/this.options.step)*this.options.step)<this.options.min?this.options.min:n>this.options.max?this.options.max:n},toPercentage:function(t){if(this.options.max===this.options.min)return 0;var e=Math.log(this.options.max),i=0===this.options.min?0:Math.log(this.options.min);return 100*((0===t?0:Math.log(t))-i)/(e-i)}}};if((e=function(t,e){return o.call(this,t,e),this}).prototype={_init:function(){},constructor:e,defaultOptions:{id:"",min:0,max:10,step:1,precision:0,orientation:"horizontal",value:5,range:!1,selection:"before",tooltip:"show",tooltip_split:!1,handle:"round",reversed:!1,rtl:"auto",enabled:!0,formatter:function(t){return Array.isArray(t)?t[0]+" : "+t[1]:t},natural_arrow_keys:!1,ticks:[],ticks_positions:[],ticks_labels:[],ticks_snap_bounds:0,ticks_tooltip:!1,scale:"linear",focus:!1,tooltip_position:null,labelledby:null,rangeHighlights:[]},getElement:function(){return this.sliderElem},getValue:function(){return this.options.range?this._state.value:this._state.value[0]},setValue:function(t,e,i){t||(t=0);var n=this.getValue();this._state.value=this._validateInputValue(t);var o=this._applyPrecision.bind(this);this.options.range?(this._state.value[0]=o(this._state.value[0]),this._state.value[1]=o(this._state.value[1]),this._state.value[0]=Math.max(this.options.min,Math.min(this.options.max,this._state.value[0])),this._state.value[1]=Math.max(this.options.min,Math.min(this.options.max,this._state.value[1]))):(this._state.value=o(this._state.value),this._state.value=[Math.max(this.options.min,Math.min(this.options.max,this._state.value))],this._addClass(this.handle2,"hide"),"after"===this.options.selection?this._state.value[1]=this.options.max:this._state.value[1]=this.options.min),this.options.max>this.options.min?this._state.percentage=[this._toPercentage(this._state.value[0]),this._toPercentage(this._state.value[1]),100*this.options.step/(this.options.max-this.options.min)]:this._state.percentage=[0,0,100],this._layout();var s=this.options.range?this._state.value:this._state.value[0];return this._setDataVal(s),!0===e&&this._trigger("slide",s),n!==s&&!0===i&&this._trigger("change",{oldValue:n,newValue:s}),this},destroy:function(){this._removeSliderEventHandlers(),this.sliderElem.parentNode.removeChild(this.sliderElem),this.element.style.display="",this._cleanUpEventCallbacksMap(),this.element.removeAttribute("data"),t&&(this._unbindJQueryEventHandlers(),this.$element.removeData("slider"))},disable:function(){return this._state.enabled=!1,this.handle1.removeAttribute("tabindex"),this.handle2.removeAttribute("tabindex"),this._addClass(this.sliderElem,"slider-disabled"),this._trigger("slideDisabled"),this},enable:function(){return this._state.enabled=!0,this.handle1.setAttribute("tabindex",0),this.handle2.setAttribute("tabindex",0),this._removeClass(this.sliderElem,"slider-disabled"),this._trigger("slideEnabled"),this},toggle:function(){return this._state.enabled?this.disable():this.enable(),this},isEnabled:function(){return this._state.enabled},on:function(t,e){return this._bindNonQueryEventHandler(t,e),this},off:function(e,i){t?(this.$element.off(e,i),this.$sliderElem.off(e,i)):this._unbindNonQueryEventHandler(e,i)},getAttribute:function(t){return t?this.options[t]:this.options},setAttribute:function(t,e){return this.options[t]=e,this},refresh:function(){return this._removeSliderEventHandlers(),o.call(this,this.element,this.options),t&&t.data(this.element,"slider",this),this},relayout:function(){return this._resize(),this._layout(),this},_removeSliderEventHandlers:function(){if(this.handle1.removeEventListener("keydown",this.handle1Keydown,!1),this.handle2.removeEventListener("keydown",this.handle2Keydown,!1),this.options.ticks_tooltip){for(var t=this.ticksContainer.getElementsByClassName("slider-tick"),e=0;e<t.length;e++)t[e].removeEventListener("mouseenter",this.ticksCallbackMap[e].mouseEnter,!1),t[e].removeEventListener("mouseleave",this.ticksCallbackMap[e].mouseLeave,!1);this.handle1.removeEventListener("mouseenter",this.handleCallbackMap.handle1.mouseEnter,!1),this.handle2.removeEventListener("mouseenter",this.handleCallbackMap.handle2.mouseEnter,!1),this.handle1.removeEventListener("mouseleave",this.handleCallbackMap.handle1.mouseLeave,!1),this.handle2.removeEventListener("mouseleave",this.handleCallbackMap.handle2.mouseLeave,!1)}this.handleCallbackMap=null,this.ticksCallbackMap=null,this.showTooltip&&(this.handle1.removeEventListener("focus",this.showTooltip,!1),this.handle2.removeEventListener("focus",this.showTooltip,!1)),this.hideTooltip&&(this.handle1.removeEventListener("blur",this.hideTooltip,!1),this.handle2.removeEventListener("blur",this.hideTooltip,!1)),this.showTooltip&&this.sliderElem.removeEventListener("mouseenter",this.showTooltip,!1),this.hideTooltip&&this.sliderElem.removeEventListener("mouseleave",this.hideTooltip,!1),this.sliderElem.removeEventListener("touchstart",this.touchstart,!1),this.sliderElem.removeEventListener("touchmove",this.touchmove,!1),this.sliderElem.removeEventListener("mousedown",this.mousedown,!1),window.removeEventListener("resize",this.resize,!1)},_bindNonQueryEventHandler:function(t,e){void 0===this.eventToCallbackMap[t]&&(this.eventToCallbackMap[t]=[]),this.eventToCallbackMap[t].push(e)},_unbindNonQueryEventHandler:function(t,e){var i=this.eventToCallbackMap[t];if(void 0!==i)for(var n=0;n<i.length;n++)if(i[n]===e){i.splice(n,1);break}},_cleanUpEventCallbacksMap:function(){for(var t=Object.keys(this.eventToCallbackMap),e=0;e<t.length;e++){var i=t[e];delete this.eventToCallbackMap[i]}},_showTooltip:function(){!1===this.options.tooltip_split?(this._addClass(this.tooltip,"in"),this.tooltip_min.style.display="none",this.tooltip_max.style.display="none"):(this._addClass(this.tooltip_min,"in"),this._addClass(this.tooltip_max,"in"),this.tooltip.style.display="none"),this._state.over=!0},_hideTooltip:function(){!1===this._state.inDrag&&!0!==this.alwaysShowTooltip&&(this._removeClass(this.tooltip,"in"),this._removeClass(this.tooltip_min,"in"),this._removeClass(this.tooltip_max,"in")),this._state.over=!1},_setToolTipOnMouseOver:function(t){function e(t,e){return e?[100-t.percentage[0],this.options.range?100-t.percentage[1]:t.percentage[1]]:[t.percentage[0],t.percentage[1]]}var i=this.options.formatter(t?t.value[0]:this._state.value[0]),n=e(t||this._state,this.options.reversed);this._setText(this.tooltipInner,i),this.tooltip.style[this.stylePos]=n[0]+"%"},_addTickListener:function(){return{addMouseEnter:function(t,e,i){var n=function(){var e=t._state,n=i>=0?i:this.attributes["aria-valuenow"].value,o=parseInt(n,10);e.value[0]=o,e.percentage[0]=t.options.ticks_positions[o],t._setToolTipOnMouseOver(e),t._showTooltip()};return e.addEventListener("mouseenter",n,!1),n},addMouseLeave:function(t,e){var i=function(){t._hideTooltip()};return e.addEventListener("mouseleave",i,!1),i}}},_layout:function(){var t,e;if(t=this.options.reversed?[100-this._state.percentage[0],this.options.range?100-this._state.percentage[1]:this._state.percentage[1]]:[this._state.percentage[0],this._state.percentage[1]],this.handle1.style[this.stylePos]=t[0]+"%",this.handle1.setAttribute("aria-valuenow",this._state.value[0]),isNaN(this.options.formatter(this._state.value[0]))&&this.handle1.setAttribute("aria-valuetext",this.options.formatter(this._state.value[0])),this.handle2.style[this.stylePos]=t[1]+"%",this.handle2.setAttribute("aria-valuenow",this._state.value[1]),isNaN(this.options.formatter(this._state.value[1]))&&this.handle2.setAttribute("aria-valuetext",this.options.formatter(this._state.value[1])),this.rangeHighlightElements.length>0&&Array.isArray(this.options.rangeHighlights)&&this.options.rangeHighlights.length>0)for(var i=0;i<this.options.rangeHighlights.length;i++){var n=this._toPercentage(this.options.rangeHighlights[i].start),o=this._toPercentage(this.options.rangeHighlights[i].end);if(this.options.reversed){var s=100-o;o=100-n,n=s}var r=this._createHighlightRange(n,o);r?"vertical"===this.options.orientation?(this.rangeHighlightElements[i].style.top=r.start+"%",this.rangeHighlightElements[i].style.height=r.size+"%"):(this.options.rtl?this.rangeHighlightElements[i].style.right=r.start+"%":this.rangeHighlightElements[i].style.left=r.start+"%",this.rangeHighlightElements[i].style.width=r.size+"%"):this.rangeHighlightElements[i].style.display="none"}if(Array.isArray(this.options.ticks)&&this.options.ticks.length>0){var a,l="vertical"===this.options.orientation?"height":"width";a="vertical"===this.options.orientation?"marginTop":this.options.rtl?"marginRight":"marginLeft";var u=this._state.size/(this.options.ticks.length-1);if(this.tickLabelContainer){var h=0;if(0===this.options.ticks_positions.length)"vertical"!==this.options.orientation&&(this.tickLabelContainer.style[a]=-u/2+"px"),h=this.tickLabelContainer.offsetHeight;else for(c=0;c<this.tickLabelContainer.childNodes.length;c++)this.tickLabelContainer.childNodes[c].offsetHeight>h&&(h=this.tickLabelContainer.childNodes[c].offsetHeight);"horizontal"===this.options.orientation&&(this.sliderElem.style.marginBottom=h+"px")}for(var c=0;c<this.options.ticks.length;c++){var d=this.options.ticks_positions[c]||this._toPercentage(this.options.ticks[c]);this.options.reversed&&(d=100-d),this.ticks[c].style[this.stylePos]=d+"%",this._removeClass(this.ticks[c],"in-selection"),this.options.range?d>=t[0]&&d<=t[1]&&this._addClass(this.ticks[c],"in-selection"):"after"===this.options.selection&&d>=t[0]?this._addClass(this.ticks[c],"in-selection"):"before"===this.options.selection&&d<=t[0]&&this._addClass(this.ticks[c],"in-selection"),this.tickLabels[c]&&(this.tickLabels[c].style[l]=u+"px","vertical"!==this.options.orientation&&void 0!==this.options.ticks_positions[c]?(this.tickLabels[c].style.position="absolute",this.tickLabels[c].style[this.stylePos]=d+"%",this.tickLabels[c].style[a]=-u/2+"px"):"vertical"===this.options.orientation&&(this.options.rtl?this.tickLabels[c].style.marginRight=this.sliderElem.offsetWidth+"px":this.tickLabels[c].style.marginLeft=this.sliderElem.offsetWidth+"px",this.tickLabelContainer.style[a]=this.sliderElem.offsetWidth/2*-1+"px"))}}if(this.options.range){e=this.options.formatter(this._state.value),this._setText(this.tooltipInner,e),this.tooltip.style[this.stylePos]=(t[1]+t[0])/2+"%";var p=this.options.formatter(this._state.value[0]);this._setText(this.tooltipInner_min,p);var f=this.options.formatter(this._state.value[1]);this._setText(this.tooltipInner_max,f),this.tooltip_min.style[this.stylePos]=t[0]+"%",this.tooltip_max.style[this.stylePos]=t[1]+"%"}else e=this.options.formatter(this._state.value[0]),this._setText(this.tooltipInner,e),this.tooltip.style[this.stylePos]=t[0]+"%";if("vertical"===this.options.orientation)this.trackLow.style.top="0",this.trackLow.style.height=Math.min(t[0],t[1])+"%",this.trackSelection.style.top=Math.min(t[0],t[1])+"%",this.trackSelection.style.height=Math.abs(t[0]-t[1])+"%",this.trackHigh.style.bottom="0",this.trackHigh.style.height=100-Math.min(t[0],t[1])-Math.abs(t[0]-t[1])+"%";else{"right"===this.stylePos?this.trackLow.style.right="0":this.trackLow.style.left="0",this.trackLow.style.width=Math.min(t[0],t[1])+"%","right"===this.stylePos?this.trackSelection.style.right=Math.min(t[0],t[1])+"%":this.trackSelection.style.left=Math.min(t[0],t[1])+"%",this.trackSelection.style.width=Math.abs(t[0]-t[1])+"%","right"===this.stylePos?this.trackHigh.style.left="0":this.trackHigh.style.right="0",this.trackHigh.style.width=100-Math.min(t[0],t[1])-Math.abs(t[0]-t[1])+"%";var m=this.tooltip_min.getBoundingClientRect(),g=this.tooltip_max.getBoundingClientRect();"bottom"===this.options.tooltip_position?m.right>g.left?(this._removeClass(this.tooltip_max,"bottom"),this._addClass(this.tooltip_max,"top"),this.tooltip_max.style.top="",this.tooltip_max.style.bottom="22px"):(this._removeClass(this.tooltip_max,"top"),this._addClass(this.tooltip_max,"bottom"),this.tooltip_max.style.top=this.tooltip_min.style.top,this.tooltip_max.style.bottom=""):m.right>g.left?(this._removeClass(this.tooltip_max,"top"),this._addClass(this.tooltip_max,"bottom"),this.tooltip_max.style.top="18px"):(this._removeClass(this.tooltip_max,"bottom"),this._addClass(this.tooltip_max,"top"),this.tooltip_max.style.top=this.tooltip_min.style.top)}},_createHighlightRange:function(t,e){return this._isHighlightRange(t,e)?t>e?{start:e,size:t-e}:{start:t,size:e-t}:null},_isHighlightRange:function(t,e){return t>=0&&100>=t&&e>=0&&100>=e},_resize:function(t){this._state.offset=this._offset(this.sliderElem),this._state.size=this.sliderElem[this.sizePos],this._layout()},_removeProperty:function(t,e){t.style.removeProperty?t.style.removeProperty(e):t.style.removeAttribute(e)},_mousedown:function(t){if(!this._state.enabled)return!1;this._state.offset=this._offset(this.sliderElem),this._state.size=this.sliderElem[this.sizePos];var e=this._getPercentage(t);if(this.options.range){var i=Math.abs(this._state.percentage[0]-e),n=Math.abs(this._state.percentage[1]-e);this._state.dragged=n>i?0:1,this._adjustPercentageForRangeSliders(e)}else this._state.dragged=0;this._state.percentage[this._state.dragged]=e,this._layout(),this.touchCapable&&(document.removeEventListener("touchmove",this.mousemove,!1),document.removeEventListener("touchend",this.mouseup,!1)),this.mousemove&&document.removeEventListener("mousemove",this.mousemove,!1),this.mouseup&&document.removeEventListener("mouseup",this.mouseup,!1),this.mousemove=this._mousemove.bind(this),this.mouseup=this._mouseup.bind(this),this.touchCapable&&(document.addEventListener("touchmove",this.mousemove,!1),document.addEventListener("touchend",this.mouseup,!1)),document.addEventListener("mousemove",this.mousemove,!1),document.addEventListener("mouseup",this.mouseup,!1),this._state.inDrag=!0;var o=this._calculateValue();return this._trigger("slideStart",o),this._setDataVal(o),this.setValue(o,!1,!0),t.returnValue=!1,this.options.focus&&this._triggerFocusOnHandle(this._state.dragged),!0},_touchstart:function(t){if(void 0!==t.changedTouches){var e=t.changedTouches[0];this.touchX=e.pageX,this.touchY=e.pageY}else this._mousedown(t)},_triggerFocusOnHandle:function(t){0===t&&this.handle1.focus(),1===t&&this.handle2.focus()},_keydown:function(t,e){if(!this._state.enabled)return!1;var i;switch(e.keyCode){case 37:case 40:i=-1;break;case 39:case 38:i=1}if(i){if(this.options.natural_arrow_keys){var n="vertical"===this.options.orientation&&!this.options.reversed,o="horizontal"===this.options.orientation&&this.options.reversed;(n||o)&&(i=-i)}var s=this._state.value[t]+i*this.options.step,r=s/this.options.max*100;if(this._state.keyCtrl=t,this.options.range)this._adjustPercentageForRangeSliders(r),s=[this._state.keyCtrl?this._state.value[0]:s,this._state.keyCtrl?s:this._state.value[1]];return this._trigger("slideStart",s),this._setDataVal(s),this.setValue(s,!0,!0),this._setDataVal(s),this._trigger("slideStop",s),this._layout(),this._pauseEvent(e),delete this._state.keyCtrl,!1}},_pauseEvent:function(t){t.stopPropagation&&t.stopPropagation(),t.preventDefault&&t.preventDefault(),t.cancelBubble=!0,t.returnValue=!1},_mousemove:function(t){if(!this._state.enabled)return!1;var e=this._getPercentage(t);this._adjustPercentageForRangeSliders(e),this._state.percentage[this._state.dragged]=e,this._layout();var i=this._calculateValue(!0);return this.setValue(i,!0,!0),!1},_touchmove:function(t){if(void 0!==t.changedTouches){var e=t.changedTouches[0],i=e.pageX-this.touchX,n=e.pageY-this.touchY;this._state.inDrag||("vertical"===this.options.orientation&&5>=i&&i>=-5&&(n>=15||-15>=n)?this._mousedown(t):5>=n&&n>=-5&&(i>=15||-15>=i)&&this._mousedown(t))}},_adjustPercentageForRangeSliders:function(t){if(this.options.range){var e=this._getNumDigitsAfterDecimalPlace(t);e=e?e-1:0;var i=this._applyToFixedAndParseFloat(t,e);0===this._state.dragged&&this._applyToFixedAndParseFloat(this._state.percentage[1],e)<i?(this._state.percentage[0]=this._state.percentage[1],this._state.dragged=1):1===this._state.dragged&&this._applyToFixedAndParseFloat(this._state.percentage[0],e)>i?(this._state.percentage[1]=this._state.percentage[0],this._state.dragged=0):0===this._state.keyCtrl&&this._state.value[1]/this.options.max*100<t?(this._state.percentage[0]=this._state.percentage[1],this._state.keyCtrl=1,this.handle2.focus()):1===this._state.keyCtrl&&this._state.value[0]/this.options.max*100>t&&(this._state.percentage[1]=this._state.percentage[0],this._state.keyCtrl=0,this.handle1.focus())}},_mouseup:function(){if(!this._state.enabled)return!1;this.touchCapable&&(document.removeEventListener("touchmove",this.mousemove,!1),document.removeEventListener("touchend",this.mouseup,!1)),document.removeEventListener("mousemove",this.mousemove,!1),document.removeEventListener("mouseup",this.mouseup,!1),this._state.inDrag=!1,!1===this._state.over&&this._hideTooltip();var t=this._calculateValue(!0);return this._layout(),this._setDataVal(t),this._trigger("slideStop",t),!1},_calculateValue:function(t){var e;if(this.options.range?(e=[this.options.min,this.options.max],0!==this._state.percentage[0]&&(e[0]=this._toValue(this._state.percentage[0]),e[0]=this._applyPrecision(e[0])),100!==this._state.percentage[1]&&(e[1]=this._toValue(this._state.percentage[1]),e[1]=this._applyPrecision(e[1]))):(e=this._toValue(this._state.percentage[0]),e=parseFloat(e),e=this._applyPrecision(e)),t){for(var i=[e,1/0],n=0;n<this.options.ticks.length;n++){var o=Math.abs(this.options.ticks[n]-e);o<=i[1]&&(i=[this.options.ticks[n],o])}if(i[1]<=this.options.ticks_snap_bounds)return i[0]}return e},_applyPrecision:function(t){var e=this.options.precision||this._getNumDigitsAfterDecimalPlace(this.options.step);return this._applyToFixedAndParseFloat(t,e)},_getNumDigitsAfterDecimalPlace:function(t){var e=(""+t).match(/(?:\.(\d+))?(?:[eE]([+-]?\d+))?$/);return e?Math.max(0,(e[1]?e[1].length:0)-(e[2]?+e[2]:0)):0},_applyToFixedAndParseFloat:function(t,e){var i=t.toFixed(e);return parseFloat(i)},_getPercentage:function(t){!this.touchCapable||"touchstart"!==t.type&&"touchmove"!==t.type||(t=t.touches[0]);var e=t[this.mousePos]-this._state.offset[this.stylePos];"right"===this.stylePos&&(e=-e);var i=e/this._state.size*100;return i=Math.round(i/this._state.percentage[2])*this._state.percentage[2],this.options.reversed&&(i=100-i),Math.max(0,Math.min(100,i))},_validateInputValue:function(t){if(isNaN(+t)){if(Array.isArray(t))return this._validateArray(t),t;throw new Error(s(t))}return+t},_validateArray:function(t){for(var e=0;e<t.length;e++){var i=t[e];if("number"!=typeof i)throw new Error(s(i))}},_setDataVal:function(t){this.element.setAttribute("data-value",t),this.element.setAttribute("value",t),this.element.value=t},_trigger:function(e,i){i=i||0===i?i:void 0;var n=this.eventToCallbackMap[e];if(n&&n.length)for(var o=0;o<n.length;o++){(0,n[o])(i)}t&&this._triggerJQueryEvent(e,i)},_triggerJQueryEvent:function(t,e){var i={type:t,value:e};this.$element.trigger(i),this.$sliderElem.trigger(i)},_unbindJQueryEventHandlers:function(){this.$element.off(),this.$sliderElem.off()},_setText:function(t,e){void 0!==t.textContent?t.textContent=e:void 0!==t.innerText&&(t.innerText=e)},_removeClass:function(t,e){for(var i=e.split(" "),n=t.className,o=0;o<i.length;o++){var s=i[o],r=new RegExp("(?:\\s|^)"+s+"(?:\\s|$)");n=n.replace(r," ")}t.className=n.trim()},_addClass:function(t,e){for(var i=e.split(" "),n=t.className,o=0;o<i.length;o++){var s=i[o];new RegExp("(?:\\s|^)"+s+"(?:\\s|$)").test(n)||(n+=" "+s)}t.className=n.trim()},_offsetLeft:function(t){return t.getBoundingClientRect().left},_offsetRight:function(t){return t.getBoundingClientRect().right},_offsetTop:function(t){for(var e=t.offsetTop;(t=t.offsetParent)&&!isNaN(t.offsetTop);)e+=t.offsetTop,"BODY"!==t.tagName&&(e-=t.scrollTop);return e},_offset:function(t){return{left:this._offsetLeft(t),right:this._offsetRight(t),top:this._offsetTop(t)}},_css:function(e,i,n){if(t)t.style(e,i,n);else{var o=i.replace(/^-ms-/,"ms-").replace(/-([\da-z])/gi,function(t,e){return e.toUpperCase()});e.style[o]=n}},_toValue:function(t){return this.options.scale.toValue.apply(this,[t])},_toPercentage:function(t){return this.options.scale.toPercentage.apply(this,[t])},_setTooltipPosition:function(){var t=[this.tooltip,this.tooltip_min,this.tooltip_max];if("vertical"===this.options.orientation){var e,i="left"===(e=this.options.tooltip_position?this.options.tooltip_position:this.options.rtl?"left":"right")?"right":"left";t.forEach(function(t){this._addClass(t,e),t.style[i]="100%"}.bind(this))}else"bottom"===this.options.tooltip_position?t.forEach(function(t){this._addClass(t,"bottom"),t.style.top="22px"}.bind(this)):t.forEach(function(t){this._addClass(t,"top"),t.style.top=-this.tooltip.outerHeight-14+"px"}.bind(this))}},t&&t.fn){var a=void 0;t.fn.slider?(windowIsDefined&&window.console.warn("bootstrap-slider.js - WARNING: $.fn.slider namespace is already bound. Use the $.fn.bootstrapSlider namespace instead."),a=n):(t.bridget(i,e),a=i),t.bridget(n,e),t(function(){t("input[data-provide=slider]")[a]()})}}(t),e}),"undefined"==typeof jQuery)throw new Error("Bootstrap's JavaScript requires jQuery");!function(t){"use strict";var e=jQuery.fn.jquery.split(" ")[0].split(".");if(e[0]<2&&e[1]<9||1==e[0]&&9==e[1]&&e[2]<1||e[0]>3)throw new Error("Bootstrap's JavaScript requires jQuery version 1.9.1 or higher, but lower than version 4")}(),function(t){"use strict";function e(e,i){var n=e.nodeName.toLowerCase();if(-1!==t.inArray(n,i))return-1===t.inArray(n,o)||Boolean(e.nodeValue.match(r)||e.nodeValue.match(a));for(var s=t(i).filter(function(t,e){return e instanceof RegExp}),l=0,u=s.length;u>l;l++)if(n.match(s[l]))return!0;return!1}function i(i,n,o){if(0===i.length)return i;if(o&&"function"==typeof o)return o(i);if(!document.implementation||!document.implementation.createHTMLDocument)return i;var s=document.implementation.createHTMLDocument("sanitization");s.body.innerHTML=i;for(var r=t.map(n,function(t,e){return e}),a=t(s.body).find("*"),l=0,u=a.length;u>l;l++){var h=a[l],c=h.nodeName.toLowerCase();if(-1!==t.inArray(c,r))for(var d=t.map(h.attributes,function(t){return t}),p=[].concat(n["*"]||[],n[c]||[]),f=0,m=d.length;m>f;f++)e(d[f],p)||h.removeAttribute(d[f].nodeName);else h.parentNode.removeChild(h)}return s.body.innerHTML}var n=["sanitize","whiteList","sanitizeFn"],o=["background","cite","href","itemtype","longdesc","poster","src","xlink:href"],s={"*":["class","dir","id","lang","role",/^aria-[\w-]*$/i],a:["target","href","title","rel"],area:[],b:[],br:[],col:[],code:[],div:[],em:[],hr:[],h1:[],h2:[],h3:[],h4:[],h5:[],h6:[],i:[],img:["src","alt","title","width","height"],li:[],ol:[],p:[],pre:[],s:[],small:[],span:[],sub:[],sup:[],strong:[],u:[],ul:[]},r=/^(?:(?:https?|mailto|ftp|tel|file):|[^&:\/?#]*(?:[\/?#]|$))/gi,a=/^data:(?:image\/(?:bmp|gif|jpeg|jpg|png|tiff|webp)|video\/(?:mpeg|mp4|ogg|webm)|audio\/(?:mp3|oga|ogg|opus));base64,[a-z0-9+\/]+=*$/i,l=function(t,e){this.type=null,this.options=null,this.enabled=null,this.timeout=null,this.hoverState=null,this.$element=null,this.inState=null,this.init("tooltip",t,e)};l.VERSION="3.4.1",l.TRANSITION_DURATION=150,l.DEFAULTS={animation:!0,placement:"top",selector:!1,template:'<div class="tooltip" role="tooltip"><div class="tooltip-arrow"></div><div class="tooltip-inner"></div></div>',trigger:"hover focus",title:"",delay:0,html:!1,container:!1,viewport:{selector:"body",padding:0},sanitize:!0,sanitizeFn:null,whiteList:s},l.prototype.init=function(e,i,n){if(this.enabled=!0,this.type=e,this.$element=t(i),this.options=this.getOptions(n),this.$viewport=this.options.viewport&&t(document).find(t.isFunction(this.options.viewport)?this.options.viewport.call(this,this.$element):this.options.viewport.selector||this.options.viewport),this.inState={click:!1,hover:!1,focus:!1},this.$element[0]instanceof document.constructor&&!this.options.selector)throw new Error("`selector` option must be specified when initializing "+this.type+" on the window.document object!");for(var o=this.options.trigger.split(" "),s=o.length;s--;){var r=o[s];if("click"==r)this.$element.on("click."+this.type,this.options.selector,t.proxy(this.toggle,this));else if("manual"!=r){var a="hover"==r?"mouseenter":"focusin",l="hover"==r?"mouseleave":"focusout";this.$element.on(a+"."+this.type,this.options.selector,t.proxy(this.enter,this)),this.$element.on(l+"."+this.type,this.options.selector,t.proxy(this.leave,this))}}this.options.selector?this._options=t.extend({},this.options,{trigger:"manual",selector:""}):this.fixTitle()},l.prototype.getDefaults=function(){return l.DEFAULTS},l.prototype.getOptions=function(e){var o=this.$element.data();for(var s in o)o.hasOwnProperty(s)&&-1!==t.inArray(s,n)&&delete o[s];return(e=t.extend({},this.getDefaults(),o,e)).delay&&"number"==typeof e.delay&&(e.delay={show:e.delay,hide:e.delay}),e.sanitize&&(e.template=i(e.template,e.whiteList,e.sanitizeFn)),e},l.prototype.getDelegateOptions=function(){var e={},i=this.getDefaults();return this._options&&t.each(this._options,function(t,n){i[t]!=n&&(e[t]=n)}),e},l.prototype.enter=function(e){var i=e instanceof this.constructor?e:t(e.currentTarget).data("bs."+this.type);return i||(i=new this.constructor(e.currentTarget,this.getDelegateOptions()),t(e.currentTarget).data("bs."+this.type,i)),e instanceof t.Event&&(i.inState["focusin"==e.type?"focus":"hover"]=!0),i.tip().hasClass("in")||"in"==i.hoverState?void(i.hoverState="in"):(clearTimeout(i.timeout),i.hoverState="in",i.options.delay&&i.options.delay.show?void(i.timeout=setTimeout(function(){"in"==i.hoverState&&i.show()},i.options.delay.show)):i.show())},l.prototype.isInStateTrue=function(){for(var t in this.inState)if(this.inState[t])return!0;return!1},l.prototype.leave=function(e){var i=e instanceof this.constructor?e:t(e.currentTarget).data("bs."+this.type);return i||(i=new this.constructor(e.currentTarget,this.getDelegateOptions()),t(e.currentTarget).data("bs."+this.type,i)),e instanceof t.Event&&(i.inState["focusout"==e.type?"focus":"hover"]=!1),i.isInStateTrue()?void 0:(clearTimeout(i.timeout),i.hoverState="out",i.options.delay&&i.options.delay.hide?void(i.timeout=setTimeout(function(){"out"==i.hoverState&&i.hide()},i.options.delay.hide)):i.hide())},l.prototype.show=function(){var e=t.Event("show.bs."+this.type);if(this.hasContent()&&this.enabled){this.$element.trigger(e);var i=t.contains(this.$element[0].ownerDocument.documentElement,this.$element[0]);if(e.isDefaultPrevented()||!i)return;var n=this,o=this.tip(),s=this.getUID(this.type);this.setContent(),o.attr("id",s),this.$element.attr("aria-describedby",s),this.options.animation&&o.addClass("fade");var r="function"==typeof this.options.placement?this.options.placement.call(this,o[0],this.$element[0]):this.options.placement,a=/\s?auto?\s?/i,u=a.test(r);u&&(r=r.replace(a,"")||"top"),o.detach().css({top:0,left:0,display:"block"}).addClass(r).data("bs."+this.type,this),this.options.container?o.appendTo(t(document).find(this.options.container)):o.insertAfter(this.$element),this.$element.trigger("inserted.bs."+this.type);var h=this.getPosition(),c=o[0].offsetWidth,d=o[0].offsetHeight;if(u){var p=r,f=this.getPosition(this.$viewport);r="bottom"==r&&h.bottom+d>f.bottom?"top":"top"==r&&h.top-d<f.top?"bottom":"right"==r&&h.right+c>f.width?"left":"left"==r&&h.left-c<f.left?"right":r,o.removeClass(p).addClass(r)}var m=this.getCalculatedOffset(r,h,c,d);this.applyPlacement(m,r);var g=function(){var t=n.hoverState;n.$element.trigger("shown.bs."+n.type),n.hoverState=null,"out"==t&&n.leave(n)};t.support.transition&&this.$tip.hasClass("fade")?o.one("bsTransitionEnd",g).emulateTransitionEnd(l.TRANSITION_DURATION):g()}},l.prototype.applyPlacement=function(e,i){var n=this.tip(),o=n[0].offsetWidth,s=n[0].offsetHeight,r=parseInt(n.css("margin-top"),10),a=parseInt(n.css("margin-left"),10);isNaN(r)&&(r=0),isNaN(a)&&(a=0),e.top+=r,e.left+=a,t.offset.setOffset(n[0],t.extend({using:function(t){n.css({top:Math.round(t.top),left:Math.round(t.left)})}},e),0),n.addClass("in");var l=n[0].offsetWidth,u=n[0].offsetHeight;"top"==i&&u!=s&&(e.top=e.top+s-u);var h=this.getViewportAdjustedDelta(i,e,l,u);h.left?e.left+=h.left:e.top+=h.top;var c=/top|bottom/.test(i),d=c?2*h.left-o+l:2*h.top-s+u,p=c?"offsetWidth":"offsetHeight";n.offset(e),this.replaceArrow(d,n[0][p],c)},l.prototype.replaceArrow=function(t,e,i){this.arrow().css(i?"left":"top",50*(1-t/e)+"%").css(i?"top":"left","")},l.prototype.setContent=function(){var t=this.tip(),e=this.getTitle();this.options.html?(this.options.sanitize&&(e=i(e,this.options.whiteList,this.options.sanitizeFn)),t.find(".tooltip-inner").html(e)):t.find(".tooltip-inner").text(e),t.removeClass("fade in top bottom left right")},l.prototype.hide=function(e){function i(){"in"!=n.hoverState&&o.detach(),n.$element&&n.$element.removeAttr("aria-describedby").trigger("hidden.bs."+n.type),e&&e()}var n=this,o=t(this.$tip),s=t.Event("hide.bs."+this.type);return this.$element.trigger(s),s.isDefaultPrevented()?void 0:(o.removeClass("in"),t.support.transition&&o.hasClass("fade")?o.one("bsTransitionEnd",i).emulateTransitionEnd(l.TRANSITION_DURATION):i(),this.hoverState=null,this)},l.prototype.fixTitle=function(){var t=this.$element;(t.attr("title")||"string"!=typeof t.attr("data-original-title"))&&t.attr("data-original-title",t.attr("title")||"").attr("title","")},l.prototype.hasContent=function(){return this.getTitle()},l.prototype.getPosition=function(e){var i=(e=e||this.$element)[0],n="BODY"==i.tagName,o=i.getBoundingClientRect();null==o.width&&(o=t.extend({},o,{width:o.right-o.left,height:o.bottom-o.top}));var s=window.SVGElement&&i instanceof window.SVGElement,r=n?{top:0,left:0}:s?null:e.offset(),a={scroll:n?document.documentElement.scrollTop||document.body.scrollTop:e.scrollTop()},l=n?{width:t(window).width(),height:t(window).height()}:null;return t.extend({},o,a,l,r)},l.prototype.getCalculatedOffset=function(t,e,i,n){return"bottom"==t?{top:e.top+e.height,left:e.left+e.width/2-i/2}:"top"==t?{top:e.top-n,left:e.left+e.width/2-i/2}:"left"==t?{top:e.top+e.height/2-n/2,left:e.left-i}:{top:e.top+e.height/2-n/2,left:e.left+e.width}},l.prototype.getViewportAdjustedDelta=function(t,e,i,n){var o={top:0,left:0};if(!this.$viewport)return o;var s=this.options.viewport&&this.options.viewport.padding||0,r=this.getPosition(this.$viewport);if(/right|left/.test(t)){var a=e.top-s-r.scroll,l=e.top+s-r.scroll+n;a<r.top?o.top=r.top-a:l>r.top+r.height&&(o.top=r.top+r.height-l)}else{var u=e.left-s,h=e.left+s+i;u<r.left?o.left=r.left-u:h>r.right&&(o.left=r.left+r.width-h)}return o},l.prototype.getTitle=function(){var t=this.$element,e=this.options;return t.attr("data-original-title")||("function"==typeof e.title?e.title.call(t[0]):e.title)},l.prototype.getUID=function(t){do{t+=~~(1e6*Math.random())}while(document.getElementById(t));return t},l.prototype.tip=function(){if(!this.$tip&&(this.$tip=t(this.options.template),1!=this.$tip.length))throw new Error(this.type+" `template` option must consist of exactly 1 top-level element!");return this.$tip},l.prototype.arrow=function(){return this.$arrow=this.$arrow||this.tip().find(".tooltip-arrow")},l.prototype.enable=function(){this.enabled=!0},l.prototype.disable=function(){this.enabled=!1},l.prototype.toggleEnabled=function(){this.enabled=!this.enabled},l.prototype.toggle=function(e){var i=this;e&&((i=t(e.currentTarget).data("bs."+this.type))||(i=new this.constructor(e.currentTarget,this.getDelegateOptions()),t(e.currentTarget).data("bs."+this.type,i))),e?(i.inState.click=!i.inState.click,i.isInStateTrue()?i.enter(i):i.leave(i)):i.tip().hasClass("in")?i.leave(i):i.enter(i)},l.prototype.destroy=function(){var t=this;clearTimeout(this.timeout),this.hide(function(){t.$element.off("."+t.type).removeData("bs."+t.type),t.$tip&&t.$tip.detach(),t.$tip=null,t.$arrow=null,t.$viewport=null,t.$element=null})},l.prototype.sanitizeHtml=function(t){return i(t,this.options.whiteList,this.options.sanitizeFn)};var u=t.fn.tooltip;t.fn.tooltip=function(e){return this.each(function(){var i=t(this),n=i.data("bs.tooltip"),o="object"==typeof e&&e;!n&&/destroy|hide/.test(e)||(n||i.data("bs.tooltip",n=new l(this,o)),"string"==typeof e&&n[e]())})},t.fn.tooltip.Constructor=l,t.fn.tooltip.noConflict=function(){return t.fn.tooltip=u,this}}(jQuery),function(t){"use strict";function e(e){return this.each(function(){var n=t(this),o=n.data("bs.tab");o||n.data("bs.tab",o=new i(this)),"string"==typeof e&&o[e]()})}var i=function(e){this.element=t(e)};i.VERSION="3.4.1",i.TRANSITION_DURATION=150,i.prototype.show=function(){var e=this.element,i=e.closest("ul:not(.dropdown-menu)"),n=e.data("target");if(n||(n=(n=e.attr("href"))&&n.replace(/.*(?=#[^\s]*$)/,"")),!e.parent("li").hasClass("active")){var o=i.find(".active:last a"),s=t.Event("hide.bs.tab",{relatedTarget:e[0]}),r=t.Event("show.bs.tab",{relatedTarget:o[0]});if(o.trigger(s),e.trigger(r),!r.isDefaultPrevented()&&!s.isDefaultPrevented()){var a=t(document).find(n);this.activate(e.closest("li"),i),this.activate(a,a.parent(),function(){o.trigger({type:"hidden.bs.tab",relatedTarget:e[0]}),e.trigger({type:"shown.bs.tab",relatedTarget:o[0]})})}}},i.prototype.activate=function(e,n,o){function s(){r.removeClass("active").find("> .dropdown-menu > .active").removeClass("active").end().find('[data-toggle="tab"]').attr("aria-expanded",!1),e.addClass("active").find('[data-toggle="tab"]').attr("aria-expanded",!0),a?(e[0].offsetWidth,e.addClass("in")):e.removeClass("fade"),e.parent(".dropdown-menu").length&&e.closest("li.dropdown").addClass("active").end().find('[data-toggle="tab"]').attr("aria-expanded",!0),o&&o()}var r=n.find("> .active"),a=o&&t.support.transition&&(r.length&&r.hasClass("fade")||!!n.find("> .fade").length);r.length&&a?r.one("bsTransitionEnd",s).emulateTransitionEnd(i.TRANSITION_DURATION):s(),r.removeClass("in")};var n=t.fn.tab;t.fn.tab=e,t.fn.tab.Constructor=i,t.fn.tab.noConflict=function(){return t.fn.tab=n,this};var o=function(i){i.preventDefault(),e.call(t(this),"show")};t(document).on("click.bs.tab.data-api",'[data-toggle="tab"]',o).on("click.bs.tab.data-api",'[data-toggle="pill"]',o)}(jQuery);const key_motor_position="motor_position",key_brightness_threshold="brightness_threshold",key_upper_brightness_threshold="upper_brightness_threshold",key_lower_brightness_threshold="lower_brightness_threshold",key_color="color",key_is_autonomous="is_autonomous",key_brightness="brightness",key_touch_left="touch_left",key_touch_right="touch_right",key_alpha="alpha",key_has_touch="has_touch",key_has_light="has_light",key_speed="speed",id_slider_motor_position="motor-position-slider",id_slider_brightness_threshold="brightness-threshold-slider",id_slider_brightness_threshold_title="brightness-threshold-slider-title",id_slider_speed="speed-slider",id_color_picker="color-picker",id_color_picker_manual="color-picker-manual",id_indicator_has_touch="has-touch-indicator",id_indicator_has_light="has-light-indicator",id_indicator_touch_direction_image="touch-direction-image",id_indicator_light_image="light-image",id_tab_manual="manual",id_tab_autonomous="autonomous",id_slider_brightness_threshold_current_value="brightness-threshold-current-value-slider",id_slider_brightness_threshold_minmax="brightness-threshold-minmax-slider";var upper_brightness_threshold=100,lower_brightness_threshold=0,min_measured_brightness=100,max_measured_brightness=0,current_measured_brightness=0,selected_color="#0091DC",is_autonomous=!1,color_picker_is_open=!0,is_updating_from_web=!1;function sendConfiguration(){if(!is_updating_from_web){var t=$("#"+id_slider_motor_position).slider("getValue")/10,e=is_autonomous?1:0,i=selected_color,n=$("#"+id_slider_speed).slider("getValue")/10,o=$("#"+id_slider_brightness_threshold).slider("getValue")[0],s=$("#"+id_slider_brightness_threshold).slider("getValue")[1];document.getElementById("motor-position-slider-title").innerHTML=Math.ceil(Number(t)),document.getElementById("speed-slider-title").innerHTML=Math.ceil(Number(n)),$.post("/configuration",jQuery.param({[key_motor_position]:t,[key_speed]:n,[key_lower_brightness_threshold]:o,[key_upper_brightness_threshold]:s,[key_is_autonomous]:e,[key_color]:i}))}}function fetchConfiguration(){$.get("/configuration",readResponse)}function fetchSensorData(){$.get("/sensorData",readResponse)}function subscribeState(){if(!window.EventSource){setInterval(fetchSensorData,1e3);return}var source=new EventSource("/events");source.addEventListener("state",function(event){readResponse(event.data)},!1)}function calibrate(){max_measured_brightness=current_measured_brightness,min_measured_brightness=current_measured_brightness,lower_brightness_threshold=(lower_brightness_threshold=current_measured_brightness-20)<0?0:lower_brightness_threshold,upper_brightness_threshold=(upper_brightness_threshold=current_measured_brightness+20)>100?100:upper_brightness_threshold,$("#"+id_slider_brightness_threshold).slider("setValue",[Number(lower_brightness_threshold),Number(upper_brightness_threshold)]),sendConfiguration()}function readResponse(t){var e={};String(t).split("&").forEach(function(t){var i=String(t).split("=");e[i[0]]=i[1]}),updateUI(e)}function updateUI(t){is_updating_from_web=!0;var e=t[key_motor_position];null!==e&&$("#"+id_slider_motor_position).slider("setValue",10*Number(e),!0);var i=t[key_upper_brightness_threshold],n=t[key_lower_brightness_threshold];null!==i&&null!==n&&(upper_brightness_threshold=i,lower_brightness_threshold=n,$("#"+id_slider_brightness_threshold).slider("setValue",[Number(lower_brightness_threshold),Number(upper_brightness_threshold)])),null!==(r=t[key_color])&&($("#"+id_color_picker).attr("value",r),$("#"+id_color_picker_manual).attr("value",r),color_picker_is_open||($("#"+id_color_picker).val(r),$("#"+id_color_picker).css("background-color",r),$("#"+id_color_picker_manual).css("background-color",r)));var o=t[key_brightness];null!==o&&(current_measured_brightness=Number(o),max_measured_brightness=current_measured_brightness>max_measured_brightness?current_measured_brightness:max_measured_brightness,min_measured_brightness=current_measured_brightness<min_measured_brightness?current_measured_brightness:min_measured_brightness,$("#"+id_slider_brightness_threshold_current_value).slider("setValue",Number(current_measured_brightness)),$("#"+id_slider_brightness_threshold_minmax).slider("setValue",[Number(min_measured_brightness),Number(max_measured_brightness)]));var s=t[key_has_light];if(null!==s){var r="1"==s?"rgb(207,229,247)":"#E1E5E8";$("#"+id_indicator_has_light).css("background-color",r);var a="1"==s?"./images/EnableLightSensor.svg":"./images/LightDisabledSensor.svg";$("#"+id_indicator_light_image).attr("src",a)}var l=t[key_has_touch];if(null!==l){r="1"==l?"rgb(207,229,247)":"#E1E5E8";$("#"+id_indicator_has_touch).css("background-color",r),"0"==l?$("#"+id_indicator_touch_direction_image).attr("src","./images/TouchDisabledSensor.svg"):"1"==t[key_touch_right]?$("#"+id_indicator_touch_direction_image).attr("src","./images/UpperTouchSensor.svg"):"1"==t[key_touch_left]?$("#"+id_indicator_touch_direction_image).attr("src","./images/LowerTouchSensor.svg"):$("#"+id_indicator_touch_direction_image).attr("src","./images/EnableTouchSensor.svg")}var u=t[key_speed];null!=u&&$("#"+id_slider_speed).slider("setValue",10*Number(u),!0),is_updating_from_web=!1}function createSampleBrightnessThresholdSlider(){$("#"+id_slider_brightness_threshold).slider({id:"#brightnessHandlerSlider",min:0,max:100,value:[30,70],focus:!0}),$("#"+id_slider_brightness_threshold_current_value).slider({id:"current-brightness",min:0,max:100,value:50,focus:!0}),$("#"+id_slider_brightness_threshold_minmax).slider({id:"minmax-brightness-threshold-slider",min:0,max:100,range:!0,value:[20,90],focus:!0})}$(document).ready(function(){$("#"+id_color_picker).attr("value",selected_color),$("#"+id_color_picker_manual).attr("value",selected_color),$(document).on("click",".navbar-collapse.in",function(t){$(t.target).is("a")&&$(this).collapse("hide")}),createSampleBrightnessThresholdSlider();$("#"+id_slider_motor_position).slider({}),$("#"+id_slider_brightness_threshold).slider({}),$("#"+id_slider_speed).slider({});var t=$("#"+id_color_picker);t.click(function(){color_picker_is_open=!0}),t.change(function(){color_picker_is_open=!1}),t.focusin(function(){color_picker_is_open&&(color_picker_is_open=!1)}),$("#flower .slider").bind("slideStop",sendConfiguration),document.getElementById(id_color_picker).addEventListener("change",function(t){selected_color=$("#"+id_color_picker).val(),sendConfiguration()},!1),document.getElementById(id_color_picker_manual).addEventListener("change",function(t){selected_color=$("#"+id_color_picker_manual).val(),sendConfiguration()},!1),$('a[data-toggle="tab"]').on("shown.bs.tab",function(t){var e="Autonomous"==$(t.target).text();is_autonomous!=e&&(is_autonomous=e,sendConfiguration())}),fetchConfiguration(),subscribeState()});
\ No newline at end of file
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Decodes the binary diagnostics stream (bionic_flower/<id>/diagnostics/frames)
+into CSV. Batches are MessagePack and self-delimiting, so the raw output of
+mosquitto_sub can be piped in:
+
+    mosquitto_sub -h <broker> -t 'bionic_flower/+/diagnostics/frames' -N | python3 decode_diagnostics.py
+
+Schema (version 1), see src/DiagnosticsRecorder.h:
+
+    [1, <time of the first record [ms]>, [
+      [<ms since the first record>, <illuminance [lx]>, <brightness>, <distance>,
+       <flags>, <motor position [steps]>, <loop [us]>, <show [us]>], ...]]
+"""
+
+import struct
+import sys
+
+COLUMNS = ["time_ms", "illuminance_lx", "brightness", "distance", "touch_left", "touch_right",
+           "motor_running", "motor_position", "loop_us", "show_us"]
+
+
+def read_exact(stream, count):
+    data = stream.read(count)
+    if len(data) < count:
+        raise EOFError
+    return data
+
+
+def decode(stream):
+    """Decodes the subset of MessagePack the firmware writes."""
+    tag = read_exact(stream, 1)[0]
+    if tag < 0x80:
+        return tag
+    if 0x90 <= tag <= 0x9f:
+        return [decode(stream) for _ in range(tag & 0x0f)]
+    if tag == 0xdc:
+        return [decode(stream) for _ in range(struct.unpack(">H", read_exact(stream, 2))[0])]
+    if tag == 0xcc:
+        return read_exact(stream, 1)[0]
+    if tag == 0xcd:
+        return struct.unpack(">H", read_exact(stream, 2))[0]
+    if tag == 0xce:
+        return struct.unpack(">I", read_exact(stream, 4))[0]
+    if tag == 0xca:
+        return struct.unpack(">f", read_exact(stream, 4))[0]
+    raise ValueError("Unsupported MessagePack type 0x%02x" % tag)
+
+
+def main():
+    stream = sys.stdin.buffer
+    print(",".join(COLUMNS))
+    while True:
+        try:
+            batch = decode(stream)
+        except EOFError:
+            break
+        version, start_time, records = batch
+        if version != 1:
+            sys.exit("Unknown schema version %d" % version)
+        for dt, illuminance, brightness, distance, flags, position, loop_us, show_us in records:
+            print("%d,%.2f,%.4f,%.4f,%d,%d,%d,%d,%d,%d" % (
+                start_time + dt, illuminance, brightness, distance,
+                flags & 1, (flags >> 1) & 1, (flags >> 2) & 1, position, loop_us, show_us))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+"""Uploads a firmware image to a flower over WiFi (POST /api/v1/ota).
+
+    python3 ota_upload.py 192.168.4.1 .pio/build/esp32dev_ota/firmware.bin
+
+The flower writes the image into its inactive app partition, checks the
+SHA-256 sent along and restarts into it. The new image has to connect to
+MQTT within OTA_HEALTH_TIMEOUT seconds, otherwise the flower goes back to the
+previous one. Progress and results are published to bionic_flower/<id>/ota/state.
+
+Also used as upload command by `pio run -e esp32dev_ota -t upload`.
+"""
+
+import argparse
+import hashlib
+import sys
+import urllib.error
+import urllib.request
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host")
+    parser.add_argument("firmware")
+    parser.add_argument("--timeout", type=float, default=120, help="seconds")
+    arguments = parser.parse_args()
+
+    with open(arguments.firmware, "rb") as file:
+        image = file.read()
+    sha256 = hashlib.sha256(image).hexdigest()
+    print("Uploading %s (%d bytes, sha256 %s) to %s" % (arguments.firmware, len(image), sha256, arguments.host))
+
+    request = urllib.request.Request("http://%s/api/v1/ota?sha256=%s" % (arguments.host, sha256), data=image,
+                                     headers={"Content-Type": "application/octet-stream"}, method="POST")
+    try:
+        with urllib.request.urlopen(request, timeout=arguments.timeout) as response:
+            print(response.read().decode())
+    except urllib.error.HTTPError as error:
+        print("Update failed: %d %s" % (error.code, error.read().decode()), file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+// Bionic Flower - Live view of the rendered LED frame and the motor position (/live)
+
+var id_live_leds = "live-leds";
+var id_live_motor_position = "live-motor-position";
+var id_live_motor_target = "live-motor-target";
+var id_live_motor_title = "live-motor-title";
+var id_live_interval_select = "live-interval-select";
+
+var live_schema_version = 1;
+var live_flag_motor_running = 0x01;
+var live_reconnect_interval = 2000; // ms
+var live_socket = null;
+var live_sequence = null;
+var live_dropped_frame_count = 0;
+
+function openLiveStream() {
+    if (live_socket != null || !("WebSocket" in window)) return;
+
+    live_socket = new WebSocket("ws://" + window.location.host + "/live");
+    live_socket.binaryType = "arraybuffer";
+    live_socket.onopen = function() {
+        live_sequence = null;
+        live_socket.send("interval=" + document.getElementById(id_live_interval_select).value);
+    };
+    live_socket.onmessage = function(event) {
+        if (event.data instanceof ArrayBuffer) {
+            renderLiveFrame(new DataView(event.data));
+        }
+    };
+    live_socket.onclose = function() {
+        live_socket = null;
+        if (!document.hidden) {
+            setTimeout(openLiveStream, live_reconnect_interval);
+        }
+    };
+}
+
+function closeLiveStream() {
+    if (live_socket != null) {
+        live_socket.close();
+    }
+}
+
+// Layout: see src/LiveStream.h
+function renderLiveFrame(frame) {
+    if (frame.byteLength < 10 || frame.getUint8(0) != live_schema_version) return;
+
+    var sequence = frame.getUint16(2, true);
+    if (live_sequence != null) {
+        live_dropped_frame_count += (sequence - live_sequence - 1) & 0xFFFF;
+    }
+    live_sequence = sequence;
+
+    var is_motor_running = (frame.getUint8(1) & live_flag_motor_running) != 0;
+    var motor_position = frame.getUint16(4, true) / 65535;
+    var motor_target = frame.getUint16(6, true) / 65535;
+    var brightness = frame.getUint8(8) / 255;
+    var led_count = Math.min(frame.getUint8(9), (frame.byteLength - 10) / 3);
+
+    var container = document.getElementById(id_live_leds);
+    while (container.children.length < led_count) {
+        var led = document.createElement("span");
+        led.className = "live-led";
+        container.appendChild(led);
+    }
+    for (var i = 0; i < container.children.length; i++) {
+        var style = container.children[i].style;
+        if (i >= led_count) {
+            style.display = "none";
+            continue;
+        }
+        // The strip scales every color with the global brightness
+        var red = Math.round(frame.getUint8(10 + 3 * i) * brightness);
+        var green = Math.round(frame.getUint8(11 + 3 * i) * brightness);
+        var blue = Math.round(frame.getUint8(12 + 3 * i) * brightness);
+        style.display = "";
+        style.backgroundColor = "rgb(" + red + "," + green + "," + blue + ")";
+    }
+
+    document.getElementById(id_live_motor_position).style.width = (motor_position * 100) + "%";
+    document.getElementById(id_live_motor_target).style.left = (motor_target * 100) + "%";
+    document.getElementById(id_live_motor_title).textContent = "Motor " + Math.round(motor_position * 100) + "%"
+        + (is_motor_running ? " (moving to " + Math.round(motor_target * 100) + "%)" : "")
+        + (live_dropped_frame_count > 0 ? ", " + live_dropped_frame_count + " frames dropped" : "");
+}
+
+$(document).ready(function() {
+    $("#" + id_live_interval_select).change(function() {
+        if (live_socket != null && live_socket.readyState == WebSocket.OPEN) {
+            live_socket.send("interval=" + this.value);
+        }
+    });
+
+    // Hidden tabs don't need frames, the flower doesn't need to send them
+    document.addEventListener("visibilitychange", function() {
+        if (document.hidden) {
+            closeLiveStream();
+        } else {
+            openLiveStream();
+        }
+    });
+
+    openLiveStream();
+});
@@ -84,7 +84,7 @@ $(document).ready(function () {
     })
 
     fetchConfiguration()
-    setInterval(fetchSensorData, 1000)
+    subscribeState()
 })
 
 function sendConfiguration() {
@@ -111,8 +111,7 @@ function sendConfiguration() {
             [key_upper_brightness_threshold]: upper_brightness_threshold_value,
             [key_is_autonomous]: is_autonomous_value,
             [key_color]: color
-        }),
-        readResponse
+        })
     )
 }
 
@@ -124,6 +123,18 @@ function fetchSensorData() {
     $.get("/sensorData", readResponse)
 }
 
+function subscribeState() {
+    // The flower pushes its state when it changes, polling is the fallback
+    if (!window.EventSource) {
+        setInterval(fetchSensorData, 1000)
+        return
+    }
+    var source = new EventSource("/events")
+    source.addEventListener("state", function (event) {
+        readResponse(event.data)
+    }, false)
+}
+
 function calibrate() {
     max_measured_brightness = current_measured_brightness
     min_measured_brightness = current_measured_brightness
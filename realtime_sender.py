@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Sends realtime LED frames (DDP or E1.31) to a flower and measures how long
+it takes until they are shown.
+
+    python3 realtime_sender.py 192.168.4.1
+    python3 realtime_sender.py 192.168.4.1 --rate 60 --duration 30
+    python3 realtime_sender.py 192.168.4.1 --protocol e131 --universe 1
+
+The frames are a rainbow running over the LEDs. With DDP every frame is
+followed by a status query; the flower answers it after the frame was shown,
+so the round trip is an upper bound for the latency from sending a frame to
+the LEDs showing it. The last status has the flower's frame, lost and late
+packet counts. E1.31 has no replies, only the send rate is reported.
+"""
+
+import argparse
+import colorsys
+import json
+import socket
+import time
+import uuid
+
+DDP_PORT = 4048
+E131_PORT = 5568
+DDP_STATUS_ID = 251
+
+
+def rainbow(led_count, step):
+    data = bytearray()
+    for i in range(led_count):
+        red, green, blue = colorsys.hsv_to_rgb(((step + i * 256 / led_count) % 256) / 256, 1, 1)
+        data += bytes((int(red * 255), int(green * 255), int(blue * 255)))
+    return bytes(data)
+
+
+def ddp_packet(sequence, data=b"", flags=0x41, id=1):
+    # Version 1 | push, RGB 8 bit, offset 0
+    return bytes((flags, sequence, 0x0B if data else 0, id)) + (0).to_bytes(4, "big") + len(data).to_bytes(2, "big") + data
+
+
+def e131_packet(cid, universe, sequence, data, options=0):
+    slots = b"\x00" + data  # Start code
+    dmp = bytes((0x70 | ((10 + len(slots)) >> 8), (10 + len(slots)) & 0xFF, 0x02, 0xA1, 0, 0, 0, 1)) + len(slots).to_bytes(2, "big") + slots
+    framing = (((0x7 << 12) | (77 + len(dmp))).to_bytes(2, "big") + (2).to_bytes(4, "big") + b"realtime_sender".ljust(64, b"\x00")
+               + bytes((100, 0, 0, sequence, options)) + universe.to_bytes(2, "big") + dmp)
+    root = (((0x7 << 12) | (22 + len(framing))).to_bytes(2, "big") + (4).to_bytes(4, "big") + cid + framing)
+    return (0x0010).to_bytes(2, "big") + (0).to_bytes(2, "big") + b"ASC-E1.17\x00\x00\x00" + root
+
+
+def percentile(values, fraction):
+    if not values:
+        return float("nan")
+    return values[min(len(values) - 1, int(len(values) * fraction))]
+
+
+def run_ddp(host, led_count, rate, duration, timeout):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(timeout)
+    latencies = []
+    missing = 0
+    status = None
+    interval = 1 / rate
+    started_at = time.monotonic()
+    frame = 0
+    while time.monotonic() - started_at < duration:
+        due_at = started_at + frame * interval
+        time.sleep(max(0, due_at - time.monotonic()))
+        sequence = frame % 15 + 1
+        sent_at = time.monotonic()
+        sock.sendto(ddp_packet(sequence, rainbow(led_count, frame * 4)), (host, DDP_PORT))
+        sock.sendto(ddp_packet(sequence, flags=0x42, id=DDP_STATUS_ID), (host, DDP_PORT))
+        try:
+            while True:
+                reply, _ = sock.recvfrom(1500)
+                if reply[1] & 0x0F == sequence:
+                    break
+            latencies.append(time.monotonic() - sent_at)
+            status = json.loads(reply[10:10 + int.from_bytes(reply[8:10], "big")])["status"]
+        except socket.timeout:
+            missing += 1
+        frame += 1
+    latencies.sort()
+    return frame, latencies, missing, status
+
+
+def run_e131(host, universe, led_count, rate, duration):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    cid = uuid.uuid4().bytes
+    interval = 1 / rate
+    started_at = time.monotonic()
+    frame = 0
+    while time.monotonic() - started_at < duration:
+        due_at = started_at + frame * interval
+        time.sleep(max(0, due_at - time.monotonic()))
+        sock.sendto(e131_packet(cid, universe, frame % 256, rainbow(led_count, frame * 4)), (host, E131_PORT))
+        frame += 1
+    # Hands the LEDs back to the active effect
+    sock.sendto(e131_packet(cid, universe, frame % 256, b"", options=0x40), (host, E131_PORT))
+    return frame, time.monotonic() - started_at
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host")
+    parser.add_argument("--protocol", choices=["ddp", "e131"], default="ddp")
+    parser.add_argument("--leds", type=int, default=5, help="LED count (LED_COUNT)")
+    parser.add_argument("--rate", type=float, default=40, help="frames per second")
+    parser.add_argument("--duration", type=float, default=10, help="seconds")
+    parser.add_argument("--universe", type=int, default=1, help="E1.31 universe")
+    parser.add_argument("--timeout", type=float, default=0.2, help="seconds to wait for a DDP status reply")
+    args = parser.parse_args()
+
+    if args.protocol == "e131":
+        frames, elapsed = run_e131(args.host, args.universe, args.leds, args.rate, args.duration)
+        print("%d E1.31 frames in %.1f s (%.1f per second)" % (frames, elapsed, frames / elapsed))
+        return
+
+    frames, latencies, missing, status = run_ddp(args.host, args.leds, args.rate, args.duration, args.timeout)
+    print("%d DDP frames, %d without reply" % (frames, missing))
+    if latencies:
+        print("latency  p50 %6.1f ms  p95 %6.1f ms  p99 %6.1f ms  max %6.1f ms" % (
+            percentile(latencies, 0.5) * 1000, percentile(latencies, 0.95) * 1000,
+            percentile(latencies, 0.99) * 1000, latencies[-1] * 1000))
+    if status is not None:
+        print("flower   %d frames shown, %d lost, %d late, last show %d us" % (
+            status["frames"], status["lost"], status["late"], status["show_us"]))
+
+
+if __name__ == "__main__":
+    main()
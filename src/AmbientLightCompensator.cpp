@@ -0,0 +1,85 @@
+
+// MARK: Includes
+
+#include "AmbientLightCompensator.h"
+#include "Settings.h"
+
+// MARK: Constants
+
+const float MIN_OUTPUT_STEP = 0.3f; // Output change needed to learn from a sample
+const float MAX_LUX_PER_OUTPUT = 4095.0f;
+const float LEARNING_RATE = 0.1f;
+
+// MARK: Initialization
+
+AmbientLightCompensator::AmbientLightCompensator() {
+  lux_per_output = LED_SELF_ILLUMINATION_LUX;
+  reset();
+}
+
+// MARK: Static Methods
+
+// Relative luminance of one LED [0, 1], summed over all LEDs for a frame
+float AmbientLightCompensator::getOutput(uint8_t red, uint8_t green, uint8_t blue) {
+  return (0.2126f * red + 0.7152f * green + 0.0722f * blue) / 255.0f;
+}
+
+// MARK: Methods
+
+void AmbientLightCompensator::reset() {
+  frame_head = 0;
+  frame_count = 0;
+  addFrame(0, millis());
+  has_previous_sample = false;
+  previous_measured_lux = 0;
+  previous_output = 0;
+  last_led_lux = 0;
+}
+
+void AmbientLightCompensator::addFrame(float output, unsigned long now) {
+  const uint8_t size = sizeof(frames) / sizeof(frames[0]);
+  frames[frame_head] = { output, now };
+  frame_head = (frame_head + 1) % size;
+  frame_count = min((uint8_t)(frame_count + 1), size);
+}
+
+// Returns the ambient part of a reading that was integrated over the
+// integration_time [ms] up to now (the ALS measurement time, not the time
+// since the previous sample: samples are skipped while the motor moves).
+float AmbientLightCompensator::compensate(float measured_lux, unsigned long now, unsigned long integration_time) {
+  // Average LED output over the integration window, newest frame first
+  const uint8_t size = sizeof(frames) / sizeof(frames[0]);
+  float output_sum = 0;
+  unsigned long covered = 0; // ms back from now
+  float output = frames[(frame_head + size - 1) % size].output;
+  for (uint8_t i = 0; (i < frame_count) && (covered < integration_time); i++) {
+    const Frame& frame = frames[(frame_head + size - 1 - i) % size];
+    unsigned long age = min(now - frame.shown_at, integration_time);
+    if (age > covered) {
+      output_sum += frame.output * (age - covered);
+      covered = age;
+    }
+    output = frame.output;
+  }
+  // Older than the history: the oldest frame was still shown
+  output_sum += output * (integration_time - covered);
+  if (integration_time > 0) {
+    output = output_sum / integration_time;
+  }
+
+  // Ambient light changes slowly compared to the LED effects, so a jump in
+  // the reading that coincides with a jump in output is the LEDs' own light
+  if (has_previous_sample && (fabs(output - previous_output) >= MIN_OUTPUT_STEP)) {
+    float sample = (measured_lux - previous_measured_lux) / (output - previous_output);
+    if ((sample >= 0) && (sample <= MAX_LUX_PER_OUTPUT)) {
+      lux_per_output = ((1 - LEARNING_RATE) * lux_per_output) + (LEARNING_RATE * sample);
+    }
+  }
+
+  has_previous_sample = true;
+  previous_measured_lux = measured_lux;
+  previous_output = output;
+  last_led_lux = lux_per_output * output;
+
+  return max(0.0f, measured_lux - last_led_lux);
+}
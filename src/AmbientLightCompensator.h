@@ -0,0 +1,65 @@
+
+#ifndef AMBIENTLIGHTCOMPENSATOR_H_
+#define AMBIENTLIGHTCOMPENSATOR_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+
+// Removes the flower's own LED light from the ambient light readings.
+// The render stage reports the output of every frame it shows, the light
+// sampler asks for the ambient part of a reading. The contribution per LED
+// is learned from readings taken while the LED output changes, so no frame
+// ever has to be blanked.
+class AmbientLightCompensator {
+
+  public:
+
+    // MARK: Initialization
+
+    AmbientLightCompensator();
+
+    // MARK: Static Methods
+
+    static float getOutput(uint8_t red, uint8_t green, uint8_t blue);
+
+    // MARK: Methods
+
+    void addFrame(float output, unsigned long now);
+    float compensate(float measured_lux, unsigned long now, unsigned long integration_time);
+    void reset();
+
+    float getLuxPerOutput() {
+      return lux_per_output;
+    }
+
+    float getLastLEDLux() {
+      return last_led_lux;
+    }
+
+  private:
+
+    // MARK: Types
+
+    struct Frame {
+      float output;
+      unsigned long shown_at;
+    };
+
+    // MARK: Properties
+
+    float lux_per_output; // Learned lux at the sensor per unit of LED output
+
+    // Recent frames, enough to cover an integration window at realtime frame rates
+    Frame frames[16];
+    uint8_t frame_head; // Next slot to write
+    uint8_t frame_count;
+
+    boolean has_previous_sample;
+    float previous_measured_lux;
+    float previous_output;
+    float last_led_lux;
+
+};
+
+#endif
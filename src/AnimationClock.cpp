@@ -0,0 +1,99 @@
+
+// MARK: Includes
+
+#include "AnimationClock.h"
+#include <sys/time.h>
+#include <esp_timer.h>
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[CLOCK]: ";
+const time_t MIN_VALID_TIME = 1700000000; // Clock not synced via NTP before
+
+AnimationClock* animation_clock_shared_instance = nullptr;
+
+// MARK: Initialization
+
+AnimationClock::AnimationClock() {
+  is_synced = false;
+  offset = 0;
+  target_offset = 0;
+  frame = 0;
+  resetStatistics();
+}
+
+// MARK: Static Methods
+
+AnimationClock* AnimationClock::getSharedInstance() {
+  if (animation_clock_shared_instance == nullptr) {
+    animation_clock_shared_instance = new AnimationClock();
+  }
+  return animation_clock_shared_instance;
+}
+
+int64_t AnimationClock::getUptime() {
+  return esp_timer_get_time() / 1000;
+}
+
+// MARK: Methods
+
+void AnimationClock::update() {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  if (now.tv_sec >= MIN_VALID_TIME) {
+    target_offset = ((int64_t)now.tv_sec * 1000 + now.tv_usec / 1000) - getUptime();
+
+    int64_t error = target_offset - offset;
+    if (!is_synced || (error > ANIMATION_CLOCK_MAX_SLEW) || (error < -ANIMATION_CLOCK_MAX_SLEW)) {
+      // First sync or too far off: jump once
+      if (is_synced) {
+        step_count++;
+      }
+      offset = target_offset;
+      is_synced = true;
+      Serial.println(PRINT_PREFIX + "Synced to NTP time");
+    } else {
+      // Drift: a few ms per frame are invisible
+      offset += constrain(error, (int64_t)-ANIMATION_CLOCK_SLEW_STEP, (int64_t)ANIMATION_CLOCK_SLEW_STEP);
+    }
+  }
+
+  // The loop wakes close to a boundary, slightly late or (tick-based
+  // delay()) slightly early: this frame is the nearest boundary
+  uint32_t time = getTime();
+  int32_t phase_error = time % ANIMATION_FRAME_DURATION;
+  if (phase_error > ANIMATION_FRAME_DURATION / 2) {
+    phase_error -= ANIMATION_FRAME_DURATION;
+  }
+  frame = (time - phase_error) / ANIMATION_FRAME_DURATION;
+
+  max_phase_error = max(max_phase_error, (uint32_t)abs(phase_error));
+  phase_error_sum += phase_error;
+  phase_sample_count++;
+}
+
+uint32_t AnimationClock::getTime() {
+  return (uint32_t)(getUptime() + offset);
+}
+
+uint32_t AnimationClock::getFrame() {
+  return frame;
+}
+
+uint64_t AnimationClock::getEpochTime() {
+  return is_synced ? (uint64_t)(getUptime() + offset) : 0;
+}
+
+// Measured from the frame that is running, so a loop that woke early
+// doesn't get a second pass for the same boundary
+uint32_t AnimationClock::getDelayToNextFrame() {
+  int64_t delay = (int64_t)(frame + 1) * ANIMATION_FRAME_DURATION - getTime();
+  return (delay > 0) ? delay : 0;
+}
+
+void AnimationClock::resetStatistics() {
+  max_phase_error = 0;
+  phase_error_sum = 0;
+  phase_sample_count = 0;
+  step_count = 0;
+}
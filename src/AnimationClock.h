@@ -0,0 +1,62 @@
+
+#ifndef ANIMATIONCLOCK_H_
+#define ANIMATIONCLOCK_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include "Settings.h"
+
+// Time base for the LED animations. Once SNTP has set the clock it follows
+// Unix time, so flowers running the same effect show the same frame. SNTP
+// corrections are slewed in small steps instead of jumping the animation.
+class AnimationClock {
+
+  public:
+
+    // MARK: Static Methods
+
+    static AnimationClock* getSharedInstance();
+
+    // MARK: Methods
+
+    void update(); // Once per frame, at its start
+    uint32_t getTime(); // ms, wraps every 49 days (on all flowers alike)
+    uint32_t getFrame(); // The frame whose boundary the loop woke for
+    uint64_t getEpochTime(); // Unix time [ms] as the animations see it
+    uint32_t getDelayToNextFrame(); // ms until the next frame boundary
+    boolean isSynced() { return is_synced; }
+
+    // Alignment report since the last reset
+    int32_t getOffsetError() { return (int32_t)(target_offset - offset); } // ms not slewed yet
+    // Frame start relative to its boundary [ms], negative = early (delay() may
+    // return up to a tick before the boundary)
+    uint32_t getMaxPhaseError() { return max_phase_error; } // Largest absolute error
+    int32_t getMeanPhaseError() { return (phase_sample_count > 0) ? (phase_error_sum / (int32_t)phase_sample_count) : 0; }
+    uint32_t getStepCount() { return step_count; } // Corrections too large to slew
+    void resetStatistics();
+
+  private:
+
+    // MARK: Initialization
+
+    AnimationClock();
+
+    // MARK: Properties
+
+    boolean is_synced;
+    int64_t offset; // Applied: Unix time [ms] - uptime [ms]
+    int64_t target_offset; // From the system clock
+    uint32_t frame; // Nearest boundary at update()
+    uint32_t max_phase_error;
+    int32_t phase_error_sum;
+    uint32_t phase_sample_count;
+    uint32_t step_count;
+
+    // MARK: Methods
+
+    static int64_t getUptime();
+
+};
+
+#endif
@@ -0,0 +1,327 @@
+
+// MARK: Includes
+
+#include "CommandQueue.h"
+#include "HardwareService.h"
+#include "MQTTService.h"
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[COMMAND]: ";
+const uint8_t QUEUE_LENGTH = 8;
+
+const char* EFFECT_NAMES[] = { "none", "rainbow", "rainbow_multi", "circadian", "weather", "sensor" };
+
+CommandQueue* command_queue_shared_instance = nullptr;
+
+// MARK: Initialization
+
+CommandQueue::CommandQueue() {
+  commands = xQueueCreate(QUEUE_LENGTH, sizeof(ControlCommand));
+}
+
+// MARK: Static Methods
+
+CommandQueue* CommandQueue::getSharedInstance() {
+  if (command_queue_shared_instance == nullptr) {
+    command_queue_shared_instance = new CommandQueue();
+  }
+  return command_queue_shared_instance;
+}
+
+boolean CommandQueue::parseBatch(JsonObjectConst batch, ControlCommand& command, char* error, size_t error_size) {
+  command = {};
+  Configuration configuration = HardwareService::getSharedInstance()->getConfiguration();
+
+  for (JsonPairConst field : batch) {
+    const char* key = field.key().c_str();
+    JsonVariantConst value = field.value();
+
+    if (strcmp(key, "effect") == 0) {
+      if (!value.is<const char*>() || !isEffectName(value.as<const char*>())) {
+        snprintf(error, error_size, "%s: unknown effect", key);
+        return false;
+      }
+      command.fields |= COMMAND_EFFECT;
+      strlcpy(command.effect, value.as<const char*>(), sizeof(command.effect));
+    } else if (strcmp(key, "color") == 0) {
+      if (!value.is<const char*>() || !parseColor(value.as<const char*>(), command.color)) {
+        snprintf(error, error_size, "%s: expected #rrggbb", key);
+        return false;
+      }
+      command.fields |= COMMAND_COLOR;
+    } else if (strcmp(key, "brightness") == 0) {
+      if (!value.is<int>() || (value.as<int>() < 0) || (value.as<int>() > 255)) {
+        snprintf(error, error_size, "%s: expected 0 to 255", key);
+        return false;
+      }
+      command.fields |= COMMAND_LED_BRIGHTNESS;
+      command.led_brightness = value.as<int>();
+    } else if (strcmp(key, "adaptive_brightness") == 0) {
+      if (!value.is<bool>()) {
+        snprintf(error, error_size, "%s: expected true or false", key);
+        return false;
+      }
+      command.fields |= COMMAND_ADAPTIVE_BRIGHTNESS;
+      command.is_adaptive_brightness = value.as<bool>();
+    } else if (strcmp(key, "state") == 0) {
+      const char* state = value.as<const char*>();
+      if ((state == nullptr) || ((strcmp(state, "ON") != 0) && (strcmp(state, "OFF") != 0))) {
+        snprintf(error, error_size, "%s: expected ON or OFF", key);
+        return false;
+      }
+      command.fields |= COMMAND_LIGHT_ON;
+      command.is_light_on = strcmp(state, "ON") == 0;
+    } else if (strcmp(key, "is_autonomous") == 0) {
+      if (!value.is<bool>()) {
+        snprintf(error, error_size, "%s: expected true or false", key);
+        return false;
+      }
+      command.fields |= COMMAND_IS_AUTONOMOUS;
+      command.is_autonomous = value.as<bool>();
+    } else {
+      // Fractions [0, 1]
+      static const struct {
+        const char* key;
+        ControlCommandField field;
+        float ControlCommand::*value;
+      } FRACTIONS[] = {
+        { "motor_position", COMMAND_MOTOR_POSITION, &ControlCommand::motor_position },
+        { "speed", COMMAND_SPEED, &ControlCommand::speed },
+        { "upper_brightness_threshold", COMMAND_UPPER_BRIGHTNESS_THRESHOLD, &ControlCommand::upper_brightness_threshold },
+        { "lower_brightness_threshold", COMMAND_LOWER_BRIGHTNESS_THRESHOLD, &ControlCommand::lower_brightness_threshold },
+        { "distance_threshold", COMMAND_DISTANCE_THRESHOLD, &ControlCommand::distance_threshold },
+      };
+      boolean is_known = false;
+      for (const auto& fraction : FRACTIONS) {
+        if (strcmp(key, fraction.key) != 0) continue;
+        float number = value.as<float>();
+        if (!value.is<float>() || (number < 0) || (number > 1)) {
+          snprintf(error, error_size, "%s: expected a number from 0 to 1", key);
+          return false;
+        }
+        command.fields |= fraction.field;
+        command.*(fraction.value) = number;
+        is_known = true;
+      }
+      if (!is_known) {
+        snprintf(error, error_size, "%s: unknown field", key);
+        return false;
+      }
+    }
+  }
+
+  // Checked against the current values for the ones not in the batch
+  float lower = command.has(COMMAND_LOWER_BRIGHTNESS_THRESHOLD) ? command.lower_brightness_threshold : configuration.lower_brightness_threshold;
+  float upper = command.has(COMMAND_UPPER_BRIGHTNESS_THRESHOLD) ? command.upper_brightness_threshold : configuration.upper_brightness_threshold;
+  if (lower > upper) {
+    strlcpy(error, "lower_brightness_threshold above upper_brightness_threshold", error_size);
+    return false;
+  }
+
+  if (command.fields == 0) {
+    strlcpy(error, "empty batch", error_size);
+    return false;
+  }
+
+  // A color without an effect switches to the static color, as in the web UI
+  if (command.has(COMMAND_COLOR) && !command.has(COMMAND_EFFECT)) {
+    command.fields |= COMMAND_EFFECT;
+    strlcpy(command.effect, "none", sizeof(command.effect));
+  }
+  return true;
+}
+
+boolean CommandQueue::isEffectName(const char* name) {
+  for (const char* effect : EFFECT_NAMES) {
+    if (strcmp(name, effect) == 0) return true;
+  }
+  return false;
+}
+
+boolean CommandQueue::parseColor(const char* hex, Color& color) {
+  if ((strlen(hex) != 7) || (hex[0] != '#')) return false;
+  char* end;
+  uint32_t value = strtoul(hex + 1, &end, 16);
+  if (*end != '\0') return false;
+  color.red = (value >> 16) & 0xFF;
+  color.green = (value >> 8) & 0xFF;
+  color.blue = value & 0xFF;
+  return true;
+}
+
+// MARK: Methods
+
+boolean CommandQueue::post(const ControlCommand& command) {
+  return xQueueSend(commands, &command, 0) == pdTRUE;
+}
+
+// Runs of commands are coalesced (a dragged slider sends a burst), previews
+// and calibrations are applied on their own to keep their order
+void CommandQueue::applyPending() {
+  const uint16_t ordered_fields = COMMAND_PREVIEW | COMMAND_CALIBRATE;
+  ControlCommand pending = {};
+  ControlCommand command;
+  while (xQueueReceive(commands, &command, 0) == pdTRUE) {
+    if ((pending.fields != 0) && (((pending.fields | command.fields) & ordered_fields) != 0)) {
+      apply(pending);
+      pending = {};
+    }
+    merge(pending, command);
+  }
+  if (pending.fields != 0) {
+    apply(pending);
+  }
+}
+
+void CommandQueue::merge(ControlCommand& command, const ControlCommand& other) {
+  if (other.has(COMMAND_EFFECT)) strlcpy(command.effect, other.effect, sizeof(command.effect));
+  if (other.has(COMMAND_PREVIEW)) strlcpy(command.preview, other.preview, sizeof(command.preview));
+  if (other.has(COMMAND_COLOR)) command.color = other.color;
+  if (other.has(COMMAND_LED_BRIGHTNESS)) command.led_brightness = other.led_brightness;
+  if (other.has(COMMAND_ADAPTIVE_BRIGHTNESS)) command.is_adaptive_brightness = other.is_adaptive_brightness;
+  if (other.has(COMMAND_MOTOR_POSITION)) command.motor_position = other.motor_position;
+  if (other.has(COMMAND_UPPER_BRIGHTNESS_THRESHOLD)) command.upper_brightness_threshold = other.upper_brightness_threshold;
+  if (other.has(COMMAND_LOWER_BRIGHTNESS_THRESHOLD)) command.lower_brightness_threshold = other.lower_brightness_threshold;
+  if (other.has(COMMAND_DISTANCE_THRESHOLD)) command.distance_threshold = other.distance_threshold;
+  if (other.has(COMMAND_IS_AUTONOMOUS)) command.is_autonomous = other.is_autonomous;
+  if (other.has(COMMAND_SPEED)) command.speed = other.speed;
+  if (other.has(COMMAND_LIGHT_ON)) command.is_light_on = other.is_light_on;
+  command.fields |= other.fields;
+}
+
+void CommandQueue::apply(const ControlCommand& command) {
+  HardwareService* hardware = HardwareService::getSharedInstance();
+
+  if (command.has(COMMAND_CALIBRATE)) {
+    hardware->resetSensorData();
+    if (command.fields == COMMAND_CALIBRATE) {
+      return;
+    }
+  }
+
+  Serial.println(PRINT_PREFIX + "Apply configuration change.");
+
+  Configuration configuration = hardware->getConfiguration();
+  MQTTService* mqtt = MQTTService::getSharedInstance();
+
+  // Effects are set before setConfiguration(), which already renders with them
+  if (command.has(COMMAND_EFFECT)) {
+    // Disable all effects first
+    mqtt->setRainbowEnabled(false);
+    mqtt->setRainbowMultiEnabled(false);
+    mqtt->setCircadianEnabled(false);
+    mqtt->setWeatherEnabled(false);
+    mqtt->setSensorEnabled(false);
+    // Reset circadian preview when switching effects normally
+    mqtt->setCircadianPreviewHour(-1);
+    // Enable selected effect
+    if (strcmp(command.effect, "rainbow") == 0) mqtt->setRainbowEnabled(true);
+    else if (strcmp(command.effect, "rainbow_multi") == 0) mqtt->setRainbowMultiEnabled(true);
+    else if (strcmp(command.effect, "circadian") == 0) mqtt->setCircadianEnabled(true);
+    else if (strcmp(command.effect, "weather") == 0) mqtt->setWeatherEnabled(true);
+    else if (strcmp(command.effect, "sensor") == 0) mqtt->setSensorEnabled(true);
+  }
+
+  // Handle LED brightness change (before setConfiguration to avoid flicker)
+  if (command.has(COMMAND_LED_BRIGHTNESS)) {
+    mqtt->setBrightness(command.led_brightness);
+  }
+
+  if (command.has(COMMAND_ADAPTIVE_BRIGHTNESS)) {
+    mqtt->setAdaptiveBrightnessEnabled(command.is_adaptive_brightness);
+  }
+
+  if (command.has(COMMAND_LIGHT_ON)) {
+    mqtt->setLightOn(command.is_light_on);
+  }
+
+  // Handle effect preview - weather or circadian
+  if (command.has(COMMAND_PREVIEW)) {
+    const char* preview_state = command.preview;
+    // Disable adaptive brightness and set to full brightness
+    mqtt->setAdaptiveBrightnessEnabled(false);
+    mqtt->setBrightness(255);
+    // Disable all effects first
+    mqtt->setRainbowEnabled(false);
+    mqtt->setRainbowMultiEnabled(false);
+    mqtt->setCircadianEnabled(false);
+    mqtt->setSensorEnabled(false);
+    mqtt->setWeatherEnabled(false);
+
+    // Check if it's a circadian preview
+    if (strncmp(preview_state, "circadian_", 10) == 0) {
+      // Enable circadian effect with preview hour
+      mqtt->setCircadianEnabled(true);
+      int preview_hour = 12; // Default midday
+      if (strcmp(preview_state, "circadian_night") == 0) preview_hour = 2;
+      else if (strcmp(preview_state, "circadian_sunrise") == 0) preview_hour = 7;
+      else if (strcmp(preview_state, "circadian_morning") == 0) preview_hour = 9;
+      else if (strcmp(preview_state, "circadian_midday") == 0) preview_hour = 13;
+      else if (strcmp(preview_state, "circadian_afternoon") == 0) preview_hour = 17;
+      else if (strcmp(preview_state, "circadian_sunset") == 0) preview_hour = 20;
+      mqtt->setCircadianPreviewHour(preview_hour);
+    } else {
+      // Weather preview
+      mqtt->setWeatherEnabled(true);
+      mqtt->setWeatherState(preview_state);
+      mqtt->setCircadianPreviewHour(-1); // Disable circadian preview
+      // The weather motor control of the control loop moves the cover for it
+    }
+  }
+
+  // Now handle configuration changes
+  if (command.has(COMMAND_MOTOR_POSITION)) configuration.motor_position = command.motor_position;
+  if (command.has(COMMAND_UPPER_BRIGHTNESS_THRESHOLD)) configuration.upper_brightness_threshold = command.upper_brightness_threshold;
+  if (command.has(COMMAND_LOWER_BRIGHTNESS_THRESHOLD)) configuration.lower_brightness_threshold = command.lower_brightness_threshold;
+  if (command.has(COMMAND_DISTANCE_THRESHOLD)) configuration.distance_threshold = command.distance_threshold;
+  if (command.has(COMMAND_IS_AUTONOMOUS)) configuration.is_autonomous = command.is_autonomous;
+  if (command.has(COMMAND_COLOR)) configuration.color = command.color;
+  if (command.has(COMMAND_SPEED)) configuration.speed = command.speed;
+
+  // parseBatch() checked the order against the configuration at that time,
+  // form posts merged into the same command aren't checked at all
+  if (configuration.lower_brightness_threshold > configuration.upper_brightness_threshold) {
+    Serial.println(PRINT_PREFIX + "Lower brightness threshold above the upper one, thresholds unchanged.");
+    Configuration current = hardware->getConfiguration();
+    configuration.lower_brightness_threshold = current.lower_brightness_threshold;
+    configuration.upper_brightness_threshold = current.upper_brightness_threshold;
+  }
+
+  // Apply configuration (effects are already set correctly), saved once.
+  // A merged color and position (color picker and slider in one frame) both
+  // take effect.
+  boolean is_motor_accepted = hardware->setConfiguration(configuration, command.has(COMMAND_MOTOR_POSITION));
+
+  // Publish each changed entity once
+  if (command.has(COMMAND_EFFECT) || command.has(COMMAND_COLOR) || command.has(COMMAND_LED_BRIGHTNESS) ||
+      command.has(COMMAND_LIGHT_ON) || command.has(COMMAND_PREVIEW)) {
+    mqtt->publishLightState();
+  }
+
+  // Only a position the motor actually goes to, not one refused while the
+  // Sensor or Weather effect drives it
+  boolean is_cover_changed = command.has(COMMAND_MOTOR_POSITION) && is_motor_accepted;
+  boolean is_adaptive_brightness_changed = command.has(COMMAND_ADAPTIVE_BRIGHTNESS) || command.has(COMMAND_PREVIEW);
+  boolean is_mode_changed = command.has(COMMAND_IS_AUTONOMOUS);
+
+#if MQTT_CONSOLIDATED_STATE
+  // Cover, mode and adaptive brightness are keys of one state document, the
+  // light keeps its own (Home Assistant's JSON light schema)
+  if (is_cover_changed || is_adaptive_brightness_changed || is_mode_changed) {
+    mqtt->publishSensorStates(true);
+  }
+#else
+  if (is_cover_changed) {
+    mqtt->publishCoverState();
+  }
+
+  if (is_adaptive_brightness_changed) {
+    mqtt->publishAdaptiveBrightnessState();
+  }
+
+  if (is_mode_changed) {
+    mqtt->publishModeState();
+  }
+#endif
+}
@@ -0,0 +1,90 @@
+
+#ifndef COMMANDQUEUE_H_
+#define COMMANDQUEUE_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "Models.h"
+#include "Settings.h"
+
+// Fields of a ControlCommand
+enum ControlCommandField : uint16_t {
+  COMMAND_EFFECT = 1 << 0,
+  COMMAND_COLOR = 1 << 1,
+  COMMAND_LED_BRIGHTNESS = 1 << 2,
+  COMMAND_ADAPTIVE_BRIGHTNESS = 1 << 3,
+  COMMAND_PREVIEW = 1 << 4,
+  COMMAND_MOTOR_POSITION = 1 << 5,
+  COMMAND_UPPER_BRIGHTNESS_THRESHOLD = 1 << 6,
+  COMMAND_LOWER_BRIGHTNESS_THRESHOLD = 1 << 7,
+  COMMAND_DISTANCE_THRESHOLD = 1 << 8,
+  COMMAND_IS_AUTONOMOUS = 1 << 9,
+  COMMAND_SPEED = 1 << 10,
+  COMMAND_CALIBRATE = 1 << 11,
+  COMMAND_LIGHT_ON = 1 << 12
+};
+
+// Configuration change, only the flagged fields are set
+struct ControlCommand {
+  uint16_t fields;
+  char effect[16]; // none, rainbow, rainbow_multi, circadian, weather, sensor
+  char preview[24]; // Weather state or circadian_<phase>
+  Color color;
+  uint8_t led_brightness; // [0, 255]
+  boolean is_adaptive_brightness;
+  boolean is_light_on;
+  float motor_position;
+  float upper_brightness_threshold;
+  float lower_brightness_threshold;
+  float distance_threshold;
+  float speed;
+  boolean is_autonomous;
+
+  boolean has(ControlCommandField field) const {
+    return (fields & field) != 0;
+  }
+};
+
+// Configuration changes from other tasks (web server) are posted here and
+// applied by the control loop at the start of each frame, in order. Runs of
+// commands are coalesced and applied as one transition: one configuration
+// update, one state publish per entity and one persistence request.
+class CommandQueue {
+
+  public:
+
+    // MARK: Static Methods
+
+    static CommandQueue* getSharedInstance();
+
+    // Batch document, model units as in /api/v1/state. All fields are
+    // checked together, an invalid batch changes nothing.
+    static boolean parseBatch(JsonObjectConst batch, ControlCommand& command, char* error, size_t error_size);
+
+    // MARK: Methods
+
+    boolean post(const ControlCommand& command); // Any task, false if the queue is full
+    void applyPending(); // Control loop, once per frame
+    void apply(const ControlCommand& command); // Control loop
+
+  private:
+
+    // MARK: Initialization
+
+    CommandQueue();
+
+    // MARK: Properties
+
+    QueueHandle_t commands;
+
+    // MARK: Methods
+
+    static void merge(ControlCommand& command, const ControlCommand& other);
+    static boolean isEffectName(const char* name);
+    static boolean parseColor(const char* hex, Color& color);
+
+};
+
+#endif
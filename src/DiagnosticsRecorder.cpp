@@ -0,0 +1,109 @@
+
+// MARK: Includes
+
+#include "DiagnosticsRecorder.h"
+
+// MARK: MessagePack
+
+// Minimal big-endian MessagePack writer, only what the schema needs
+class MsgPackWriter {
+
+  public:
+
+    MsgPackWriter(uint8_t* buffer, size_t size) : buffer(buffer), size(size), length(0), has_overflow(false) {}
+
+    void writeArray(uint16_t count) {
+      if (count < 16) {
+        writeByte(0x90 | count);
+      } else {
+        writeByte(0xdc);
+        writeBigEndian(count, 2);
+      }
+    }
+
+    void writeUInt(uint32_t value) {
+      if (value < 128) {
+        writeByte(value);
+      } else if (value <= 0xff) {
+        writeByte(0xcc);
+        writeByte(value);
+      } else if (value <= 0xffff) {
+        writeByte(0xcd);
+        writeBigEndian(value, 2);
+      } else {
+        writeByte(0xce);
+        writeBigEndian(value, 4);
+      }
+    }
+
+    void writeFloat(float value) {
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      writeByte(0xca);
+      writeBigEndian(bits, 4);
+    }
+
+    size_t getLength() { return has_overflow ? 0 : length; }
+
+  private:
+
+    uint8_t* buffer;
+    size_t size;
+    size_t length;
+    boolean has_overflow;
+
+    void writeByte(uint8_t value) {
+      if (length >= size) {
+        has_overflow = true;
+        return;
+      }
+      buffer[length++] = value;
+    }
+
+    void writeBigEndian(uint32_t value, uint8_t byte_count) {
+      for (int8_t i = byte_count - 1; i >= 0; i--) {
+        writeByte(value >> (i * 8));
+      }
+    }
+
+};
+
+// MARK: Initialization
+
+DiagnosticsRecorder::DiagnosticsRecorder() {
+  record_count = 0;
+}
+
+// MARK: Methods
+
+// A full batch that was not encoded yet keeps its oldest records
+void DiagnosticsRecorder::addRecord(const DiagnosticsRecord& record) {
+  if (record_count >= DIAGNOSTICS_BATCH_SIZE) return;
+  records[record_count++] = record;
+}
+
+// Returns the length, 0 if the buffer is too small. Starts the next batch.
+size_t DiagnosticsRecorder::encodeBatch(uint8_t* buffer, size_t size) {
+  MsgPackWriter writer(buffer, size);
+  uint32_t start_time = (record_count > 0) ? records[0].time : 0;
+
+  writer.writeArray(3);
+  writer.writeUInt(SCHEMA_VERSION);
+  writer.writeUInt(start_time);
+  writer.writeArray(record_count);
+  for (uint8_t i = 0; i < record_count; i++) {
+    const DiagnosticsRecord& record = records[i];
+    writer.writeArray(8);
+    writer.writeUInt(record.time - start_time);
+    writer.writeFloat(record.illuminance);
+    writer.writeFloat(record.brightness);
+    writer.writeFloat(record.distance);
+    writer.writeUInt(record.flags);
+    writer.writeUInt(record.motor_position);
+    writer.writeUInt(record.loop_duration);
+    writer.writeUInt(record.show_duration);
+  }
+
+  record_count = 0;
+  return writer.getLength();
+}
@@ -0,0 +1,66 @@
+
+#ifndef DIAGNOSTICSRECORDER_H_
+#define DIAGNOSTICSRECORDER_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include "Settings.h"
+
+// MARK: Types
+
+struct DiagnosticsRecord {
+  uint32_t time; // ms since boot
+  float illuminance; // lx
+  float brightness; // 0-1
+  float distance; // 0-1
+  uint8_t flags; // DIAGNOSTICS_FLAG_*
+  uint32_t motor_position; // steps
+  uint16_t loop_duration; // us, HardwareService::loop
+  uint16_t show_duration; // us, FastLED.show
+};
+
+const uint8_t DIAGNOSTICS_FLAG_TOUCH_LEFT = 0x01;
+const uint8_t DIAGNOSTICS_FLAG_TOUCH_RIGHT = 0x02;
+const uint8_t DIAGNOSTICS_FLAG_MOTOR_RUNNING = 0x04;
+
+// Collects one record per frame and encodes a batch as MessagePack:
+//
+//   [1, <time of the first record [ms]>, [
+//     [<ms since the first record>, <illuminance [lx]>, <brightness>, <distance>,
+//      <flags>, <motor position [steps]>, <loop [us]>, <show [us]>],
+//     ...
+//   ]]
+//
+// 1 is the schema version; floats are float32. decode_diagnostics.py in the
+// project root decodes it on the host.
+class DiagnosticsRecorder {
+
+  public:
+
+    // MARK: Constants
+
+    static const uint8_t SCHEMA_VERSION = 1;
+    static const size_t MAX_BATCH_LENGTH = 16 + DIAGNOSTICS_BATCH_SIZE * 40; // Worst case per record
+
+    // MARK: Initialization
+
+    DiagnosticsRecorder();
+
+    // MARK: Methods
+
+    void addRecord(const DiagnosticsRecord& record);
+    boolean isBatchReady() { return record_count >= DIAGNOSTICS_BATCH_SIZE; }
+    size_t encodeBatch(uint8_t* buffer, size_t size);
+    void reset() { record_count = 0; }
+
+  private:
+
+    // MARK: Properties
+
+    DiagnosticsRecord records[DIAGNOSTICS_BATCH_SIZE];
+    uint8_t record_count;
+
+};
+
+#endif
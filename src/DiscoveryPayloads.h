@@ -0,0 +1,208 @@
+
+#ifndef DISCOVERYPAYLOADS_H_
+#define DISCOVERYPAYLOADS_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include "Settings.h"
+
+// Home Assistant discovery configs, assembled from string literals at
+// compile time. They live in flash and are streamed to the broker with the
+// device ID filled in (MQTT_DEVICE_ID_PLACEHOLDER), nothing is built on the
+// heap or the stack on reconnect.
+
+// MARK: Types
+
+struct DiscoveryConfig {
+  const char* topic;
+  const char* payload;
+};
+
+// MARK: Helpers
+
+#define DISCOVERY_NODE_ID MQTT_CLIENT_ID "_" MQTT_DEVICE_ID_PLACEHOLDER
+#define DISCOVERY_UNIQUE_ID(object) "\"unique_id\":\"" DISCOVERY_NODE_ID "_" object "\""
+#define DISCOVERY_TOPIC(component, object) MQTT_DISCOVERY_PREFIX "/" component "/" DISCOVERY_NODE_ID "/" object "/config"
+#define DISCOVERY_WILDCARD MQTT_DISCOVERY_PREFIX "/+/" DISCOVERY_NODE_ID "/+/config"
+#define DISCOVERY_DEVICE "\"device\":{\"identifiers\":[\"" DISCOVERY_NODE_ID "\"]}"
+#define DISCOVERY_DEVICE_DETAILS "\"device\":{\"identifiers\":[\"" DISCOVERY_NODE_ID "\"],\"name\":\"Bionic Flower " MQTT_DEVICE_ID_PLACEHOLDER "\",\"model\":\"ESP32 Bionic Flower\",\"manufacturer\":\"DIY\"}"
+
+// State topic of a sensor, the cover, the mode or adaptive brightness: its
+// own topic, or a key of the consolidated state document (MQTT_CONSOLIDATED_STATE)
+#if MQTT_CONSOLIDATED_STATE
+#define DISCOVERY_STATE(topic, key, filter) \
+  "\"state_topic\":\"" MQTT_DEVICE_TOPIC "/state\",\"value_template\":\"{{ value_json." key filter " }}\""
+#define DISCOVERY_STATE_RAW(topic, key) DISCOVERY_STATE(topic, key, "")
+#define DISCOVERY_COVER_STATE \
+  "\"state_topic\":\"" MQTT_DEVICE_TOPIC "/state\",\"value_template\":\"{{ value_json.cover }}\"," \
+  "\"position_topic\":\"" MQTT_DEVICE_TOPIC "/state\",\"position_template\":\"{{ value_json.position }}\""
+#else
+#define DISCOVERY_STATE(topic, key, filter) \
+  "\"state_topic\":\"" MQTT_DEVICE_TOPIC topic "\",\"value_template\":\"{{ value" filter " }}\""
+#define DISCOVERY_STATE_RAW(topic, key) "\"state_topic\":\"" MQTT_DEVICE_TOPIC topic "\""
+#define DISCOVERY_COVER_STATE \
+  "\"state_topic\":\"" MQTT_DEVICE_TOPIC "/cover/state\",\"position_topic\":\"" MQTT_DEVICE_TOPIC "/cover/position\""
+#endif
+
+#define TRIGGER_DISCOVERY(object, topic, payload, type, subtype) { \
+    DISCOVERY_TOPIC("device_automation", object), \
+    "{\"automation_type\":\"trigger\",\"topic\":\"" MQTT_DEVICE_TOPIC topic "\",\"payload\":\"" payload "\"," \
+    "\"type\":\"" type "\",\"subtype\":\"" subtype "\"," DISCOVERY_DEVICE "}" \
+  }
+
+// MARK: Entities
+
+const DiscoveryConfig LIGHT_DISCOVERY = {
+  DISCOVERY_TOPIC("light", "light"),
+  "{\"name\":\"Bionic Flower Light\"," DISCOVERY_UNIQUE_ID("light") ","
+  "\"command_topic\":\"" MQTT_DEVICE_TOPIC "/light/set\",\"state_topic\":\"" MQTT_DEVICE_TOPIC "/light/state\","
+  "\"schema\":\"json\",\"brightness\":true,\"effect\":true,\"supported_color_modes\":[\"rgb\"],"
+  "\"effect_list\":[\"None\",\"Rainbow\",\"Rainbow Multi\",\"Circadian\",\"Weather\",\"Sensor\"],"
+  DISCOVERY_DEVICE_DETAILS "}"
+};
+
+const DiscoveryConfig COVER_DISCOVERY = {
+  DISCOVERY_TOPIC("cover", "cover"),
+  "{\"name\":\"Bionic Flower Cover\"," DISCOVERY_UNIQUE_ID("cover") ","
+  "\"command_topic\":\"" MQTT_DEVICE_TOPIC "/cover/set\"," DISCOVERY_COVER_STATE ","
+  "\"set_position_topic\":\"" MQTT_DEVICE_TOPIC "/cover/set_position\","
+  "\"device_class\":\"shade\",\"position_open\":100,\"position_closed\":0,"
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig MODE_DISCOVERY = {
+  DISCOVERY_TOPIC("select", "mode"),
+  "{\"name\":\"Bionic Flower Mode\"," DISCOVERY_UNIQUE_ID("mode") ","
+  "\"command_topic\":\"" MQTT_DEVICE_TOPIC "/select/mode/set\"," DISCOVERY_STATE_RAW("/select/mode/state", "mode") ",""
+  "\"options\":[\"Manual\",\"Automatic\"],"
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig ADAPTIVE_BRIGHTNESS_DISCOVERY = {
+  DISCOVERY_TOPIC("switch", "adaptive_brightness"),
+  "{\"name\":\"Bionic Flower Adaptive Brightness\"," DISCOVERY_UNIQUE_ID("adaptive_brightness") ","
+  "\"command_topic\":\"" MQTT_DEVICE_TOPIC "/switch/adaptive_brightness/set\","
+  DISCOVERY_STATE_RAW("/switch/adaptive_brightness/state", "adaptive_brightness") ",""
+  "\"icon\":\"mdi:brightness-auto\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig BRIGHTNESS_SENSOR_DISCOVERY = {
+  DISCOVERY_TOPIC("sensor", "illuminance"),
+  "{\"name\":\"Bionic Flower Illuminance\"," DISCOVERY_UNIQUE_ID("illuminance") ","
+  DISCOVERY_STATE("/sensor/illuminance", "illuminance", " | round(1)") ","
+  "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:brightness-percent\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig LUX_SENSOR_DISCOVERY = {
+  DISCOVERY_TOPIC("sensor", "illuminance_lux"),
+  "{\"name\":\"Bionic Flower Illuminance Lux\"," DISCOVERY_UNIQUE_ID("illuminance_lux") ","
+  DISCOVERY_STATE("/sensor/illuminance_lux", "illuminance_lux", " | round(1)") ","
+  "\"device_class\":\"illuminance\",\"unit_of_measurement\":\"lx\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig DISTANCE_SENSOR_DISCOVERY = {
+  DISCOVERY_TOPIC("sensor", "proximity"),
+  "{\"name\":\"Bionic Flower Proximity\"," DISCOVERY_UNIQUE_ID("proximity") ","
+  DISCOVERY_STATE("/sensor/proximity", "proximity", " | round(1)") ","
+  "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:signal-distance-variant\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig TOUCH_LEFT_DISCOVERY = {
+  DISCOVERY_TOPIC("binary_sensor", "touch_left"),
+  "{\"name\":\"Bionic Flower Touch Left\"," DISCOVERY_UNIQUE_ID("touch_left") ","
+  DISCOVERY_STATE_RAW("/binary_sensor/touch_left", "touch_left") ",\"device_class\":\"occupancy\","
+  "\"payload_on\":\"ON\",\"payload_off\":\"OFF\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig TOUCH_RIGHT_DISCOVERY = {
+  DISCOVERY_TOPIC("binary_sensor", "touch_right"),
+  "{\"name\":\"Bionic Flower Touch Right\"," DISCOVERY_UNIQUE_ID("touch_right") ","
+  DISCOVERY_STATE_RAW("/binary_sensor/touch_right", "touch_right") ",\"device_class\":\"occupancy\","
+  "\"payload_on\":\"ON\",\"payload_off\":\"OFF\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig TEMPERATURE_DISCOVERY = {
+  DISCOVERY_TOPIC("sensor", "temperature"),
+  "{\"name\":\"Bionic Flower Temperature\"," DISCOVERY_UNIQUE_ID("temperature") ","
+  DISCOVERY_STATE("/sensor/temperature", "temperature", " | round(1)") ","
+  "\"device_class\":\"temperature\",\"unit_of_measurement\":\"°C\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig WEATHER_STATE_DISCOVERY = {
+  DISCOVERY_TOPIC("sensor", "weather"),
+  "{\"name\":\"Bionic Flower Weather\"," DISCOVERY_UNIQUE_ID("weather") ","
+  DISCOVERY_STATE_RAW("/sensor/weather", "weather") ",\"icon\":\"mdi:weather-partly-cloudy\","
+  DISCOVERY_DEVICE "}"
+};
+
+const DiscoveryConfig PROXIMITY_MODE_DISCOVERY = {
+  DISCOVERY_TOPIC("switch", "proximity_mode"),
+  "{\"name\":\"Bionic Flower Proximity Gestures\"," DISCOVERY_UNIQUE_ID("proximity_mode") ","
+  "\"command_topic\":\"" MQTT_DEVICE_TOPIC "/switch/proximity_mode/set\","
+  "\"state_topic\":\"" MQTT_DEVICE_TOPIC "/switch/proximity_mode/state\","
+  "\"icon\":\"mdi:hand-wave\","
+  DISCOVERY_DEVICE "}"
+};
+
+// MARK: Device Triggers
+
+// Order of TouchGesture
+const DiscoveryConfig GESTURE_TRIGGER_DISCOVERY[] = {
+  TRIGGER_DISCOVERY("left_tap", "/gesture", "left_tap", "button_short_press", "left_touch"),
+  TRIGGER_DISCOVERY("left_double_tap", "/gesture", "left_double_tap", "button_double_press", "left_touch"),
+  TRIGGER_DISCOVERY("left_long_press", "/gesture", "left_long_press", "button_long_press", "left_touch"),
+  TRIGGER_DISCOVERY("right_tap", "/gesture", "right_tap", "button_short_press", "right_touch"),
+  TRIGGER_DISCOVERY("right_double_tap", "/gesture", "right_double_tap", "button_double_press", "right_touch"),
+  TRIGGER_DISCOVERY("right_long_press", "/gesture", "right_long_press", "button_long_press", "right_touch"),
+  TRIGGER_DISCOVERY("swipe_left", "/gesture", "swipe_left", "swipe_left", "touch_pads"),
+  TRIGGER_DISCOVERY("swipe_right", "/gesture", "swipe_right", "swipe_right", "touch_pads"),
+};
+
+// Order of ProximityGesture
+const DiscoveryConfig PROXIMITY_TRIGGER_DISCOVERY[] = {
+  TRIGGER_DISCOVERY("proximity_approach", "/proximity/gesture", "approach", "approach", "proximity"),
+  TRIGGER_DISCOVERY("proximity_hover", "/proximity/gesture", "hover", "hover", "proximity"),
+  TRIGGER_DISCOVERY("proximity_wave", "/proximity/gesture", "wave", "wave", "proximity"),
+};
+
+// MARK: Legacy Topics
+
+// Configs of firmware before the per-flower namespace, all flowers shared
+// these topics. Cleared once after the upgrade, see clearLegacyDiscovery().
+#define LEGACY_DISCOVERY_TOPIC(component, object) MQTT_DISCOVERY_PREFIX "/" component "/bionic_flower/" object "/config"
+
+const char* const LEGACY_DISCOVERY_TOPICS[] = {
+  LEGACY_DISCOVERY_TOPIC("light", "light"),
+  LEGACY_DISCOVERY_TOPIC("cover", "cover"),
+  LEGACY_DISCOVERY_TOPIC("select", "mode"),
+  LEGACY_DISCOVERY_TOPIC("switch", "adaptive_brightness"),
+  LEGACY_DISCOVERY_TOPIC("sensor", "illuminance"),
+  LEGACY_DISCOVERY_TOPIC("sensor", "illuminance_lux"),
+  LEGACY_DISCOVERY_TOPIC("sensor", "proximity"),
+  LEGACY_DISCOVERY_TOPIC("binary_sensor", "touch_left"),
+  LEGACY_DISCOVERY_TOPIC("binary_sensor", "touch_right"),
+  LEGACY_DISCOVERY_TOPIC("sensor", "temperature"),
+  LEGACY_DISCOVERY_TOPIC("sensor", "weather"),
+  LEGACY_DISCOVERY_TOPIC("switch", "proximity_mode"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "left_tap"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "left_double_tap"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "left_long_press"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "right_tap"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "right_double_tap"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "right_long_press"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "swipe_left"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "swipe_right"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "proximity_approach"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "proximity_hover"),
+  LEGACY_DISCOVERY_TOPIC("device_automation", "proximity_wave"),
+};
+
+#endif
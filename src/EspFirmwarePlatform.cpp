@@ -0,0 +1,159 @@
+
+// MARK: Includes
+
+#include "EspFirmwarePlatform.h"
+#include "FirmwareUpdater.h"
+#include "MQTTService.h"
+#include <Preferences.h>
+
+// MARK: Constants
+
+const char* OTA_NAMESPACE = "ota";
+const char* KEY_PENDING = "pending";
+const char* KEY_BOOT_COUNT = "boots";
+const char* KEY_ROLLED_BACK = "rolled_back";
+const unsigned long PULL_READ_TIMEOUT = 10000; // ms without data
+
+FirmwareUpdater* firmware_updater_shared_instance = nullptr;
+
+// The control loop decides whether a new image is healthy, not the core's
+// startup code (matters if the bootloader has rollback enabled)
+extern "C" bool verifyRollbackLater() {
+  return true;
+}
+
+// MARK: Shared Instance
+
+// Lives here so FirmwareUpdater.cpp builds without the ESP-IDF
+FirmwareUpdater* FirmwareUpdater::getSharedInstance() {
+  if (firmware_updater_shared_instance == nullptr) {
+    firmware_updater_shared_instance = new FirmwareUpdater(new EspFirmwarePlatform());
+  }
+  return firmware_updater_shared_instance;
+}
+
+// MARK: Update Partition
+
+size_t EspFirmwarePlatform::getUpdatePartitionSize() {
+  const esp_partition_t* next = esp_ota_get_next_update_partition(nullptr);
+  return (next != nullptr) ? next->size : 0;
+}
+
+const char* EspFirmwarePlatform::getUpdatePartitionLabel() {
+  const esp_partition_t* next = esp_ota_get_next_update_partition(nullptr);
+  return (next != nullptr) ? next->label : "";
+}
+
+boolean EspFirmwarePlatform::beginImage() {
+  partition = esp_ota_get_next_update_partition(nullptr);
+  if (partition == nullptr) {
+    return false;
+  }
+
+  // Sectors are erased as they are written, no long erase up front
+#ifdef OTA_WITH_SEQUENTIAL_WRITES
+  esp_err_t result = esp_ota_begin(partition, OTA_WITH_SEQUENTIAL_WRITES, &handle);
+#else
+  esp_err_t result = esp_ota_begin(partition, OTA_SIZE_UNKNOWN, &handle);
+#endif
+  if (result != ESP_OK) {
+    handle = 0;
+    return false;
+  }
+  return true;
+}
+
+boolean EspFirmwarePlatform::writeImage(const uint8_t* data, size_t length) {
+  return esp_ota_write(handle, data, length) == ESP_OK;
+}
+
+boolean EspFirmwarePlatform::endImage() {
+  esp_err_t result = esp_ota_end(handle);
+  handle = 0;
+  return result == ESP_OK;
+}
+
+void EspFirmwarePlatform::abortImage() {
+  if (handle != 0) {
+    esp_ota_abort(handle);
+    handle = 0;
+  }
+}
+
+boolean EspFirmwarePlatform::bootUpdatePartition() {
+  const esp_partition_t* next = esp_ota_get_next_update_partition(nullptr);
+  return (next != nullptr) && (esp_ota_set_boot_partition(next) == ESP_OK);
+}
+
+void EspFirmwarePlatform::markRunningImageValid() {
+  esp_ota_mark_app_valid_cancel_rollback();
+}
+
+void EspFirmwarePlatform::restart() {
+  ESP.restart();
+}
+
+// MARK: Boot State
+
+FirmwareBootState EspFirmwarePlatform::loadBootState() {
+  Preferences prefs;
+  prefs.begin(OTA_NAMESPACE, true);
+  FirmwareBootState boot_state;
+  boot_state.is_pending = prefs.getBool(KEY_PENDING, false);
+  boot_state.boot_count = prefs.getUChar(KEY_BOOT_COUNT, 0);
+  boot_state.has_rolled_back = prefs.getBool(KEY_ROLLED_BACK, false);
+  prefs.end();
+  return boot_state;
+}
+
+void EspFirmwarePlatform::saveBootState(const FirmwareBootState& boot_state) {
+  Preferences prefs;
+  prefs.begin(OTA_NAMESPACE, false);
+  prefs.putBool(KEY_PENDING, boot_state.is_pending);
+  prefs.putUChar(KEY_BOOT_COUNT, boot_state.boot_count);
+  prefs.putBool(KEY_ROLLED_BACK, boot_state.has_rolled_back);
+  prefs.end();
+}
+
+// MARK: Download
+
+boolean EspFirmwarePlatform::startPullTask(FirmwareUpdater* updater) {
+  return xTaskCreatePinnedToCore(pullTask, "ota", 8192, updater, 1, nullptr, 0) == pdPASS;
+}
+
+int EspFirmwarePlatform::openDownload(const char* url, int* size) {
+  http.begin(url);
+  int status = http.GET();
+  *size = http.getSize(); // -1 = unknown
+  return status;
+}
+
+size_t EspFirmwarePlatform::readDownload(uint8_t* buffer, size_t length) {
+  WiFiClient* stream = http.getStreamPtr();
+  unsigned long waiting_since = millis();
+  size_t available = stream->available();
+  while (available == 0) {
+    if (!http.connected() || (millis() - waiting_since > PULL_READ_TIMEOUT)) {
+      return 0;
+    }
+    vTaskDelay(pdMS_TO_TICKS(5));
+    available = stream->available();
+  }
+  int count = stream->readBytes(buffer, min(available, length));
+  return (count > 0) ? count : 0;
+}
+
+void EspFirmwarePlatform::closeDownload() {
+  http.end();
+}
+
+void EspFirmwarePlatform::pullTask(void* parameter) {
+  ((FirmwareUpdater*)parameter)->runPull();
+  vTaskDelete(nullptr);
+}
+
+// MARK: Reports
+
+void EspFirmwarePlatform::publishState(const char* message) {
+  MQTTService::getSharedInstance()->publish(MQTT_DEVICE_TOPIC "/ota/state", message);
+}
@@ -0,0 +1,59 @@
+#ifndef ESPFIRMWAREPLATFORM_H_
+#define ESPFIRMWAREPLATFORM_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <esp_ota_ops.h>
+#include "FirmwarePlatform.h"
+
+// Update partition via esp_ota, boot state in NVS (Preferences), downloads
+// via HTTPClient and reports via MQTT
+class EspFirmwarePlatform : public FirmwarePlatform {
+
+  public:
+
+    // MARK: Update Partition
+
+    size_t getUpdatePartitionSize() override;
+    const char* getUpdatePartitionLabel() override;
+    boolean beginImage() override;
+    boolean writeImage(const uint8_t* data, size_t length) override;
+    boolean endImage() override;
+    void abortImage() override;
+    boolean bootUpdatePartition() override;
+    void markRunningImageValid() override;
+    void restart() override;
+
+    // MARK: Boot State
+
+    FirmwareBootState loadBootState() override;
+    void saveBootState(const FirmwareBootState& boot_state) override;
+
+    // MARK: Download
+
+    boolean startPullTask(FirmwareUpdater* updater) override;
+    int openDownload(const char* url, int* size) override;
+    size_t readDownload(uint8_t* buffer, size_t length) override;
+    void closeDownload() override;
+
+    // MARK: Reports
+
+    void publishState(const char* message) override;
+
+  private:
+
+    // MARK: Properties
+
+    const esp_partition_t* partition = nullptr; // Opened by beginImage
+    esp_ota_handle_t handle = 0;
+    HTTPClient http;
+
+    // MARK: Helpers
+
+    static void pullTask(void* parameter);
+
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef FIRMWAREPLATFORM_H_
+#define FIRMWAREPLATFORM_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+
+class FirmwareUpdater;
+
+// MARK: Types
+
+// Kept in NVS across restarts
+struct FirmwareBootState {
+  boolean is_pending; // New image, not confirmed yet
+  uint8_t boot_count; // Boots of the pending image
+  boolean has_rolled_back; // Reported once MQTT is up
+};
+
+// What FirmwareUpdater needs from the device: the update partition, the boot
+// state in NVS, the download and the state reports. EspFirmwarePlatform is
+// the real one, the host tests use a fake partition.
+class FirmwarePlatform {
+
+  public:
+
+    virtual ~FirmwarePlatform() {}
+
+    // MARK: Update Partition
+
+    // The app partition that is not running: the new image, or the way back
+    virtual size_t getUpdatePartitionSize() = 0; // 0 = none
+    virtual const char* getUpdatePartitionLabel() = 0;
+    virtual boolean beginImage() = 0;
+    virtual boolean writeImage(const uint8_t* data, size_t length) = 0;
+    virtual boolean endImage() = 0; // Checks the image header, segments and checksum
+    virtual void abortImage() = 0;
+    virtual boolean bootUpdatePartition() = 0; // From the next restart on
+    virtual void markRunningImageValid() = 0;
+    virtual void restart() = 0;
+
+    // MARK: Boot State
+
+    virtual FirmwareBootState loadBootState() = 0;
+    virtual void saveBootState(const FirmwareBootState& boot_state) = 0;
+
+    // MARK: Download
+
+    virtual boolean startPullTask(FirmwareUpdater* updater) = 0; // Calls updater->runPull() on its own task
+    virtual int openDownload(const char* url, int* size) = 0; // HTTP status, size -1 = unknown
+    virtual size_t readDownload(uint8_t* buffer, size_t length) = 0; // Waits for data, 0 = closed or timed out
+    virtual void closeDownload() = 0;
+
+    // MARK: Reports
+
+    virtual void publishState(const char* message) = 0; // bionic_flower/<id>/ota/state
+
+};
+
+#endif
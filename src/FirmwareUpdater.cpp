@@ -0,0 +1,329 @@
+
+// MARK: Includes
+
+#include "FirmwareUpdater.h"
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[OTA]: ";
+const unsigned long RESTART_DELAY = 2000; // ms, lets the response and the report go out
+const size_t PULL_BUFFER_SIZE = 1024;
+const int HTTP_STATUS_OK = 200;
+
+// MARK: Initialization
+
+FirmwareUpdater::FirmwareUpdater(FirmwarePlatform* platform) : platform(platform) {
+  error[0] = '\0';
+}
+
+// MARK: Methods
+
+void FirmwareUpdater::checkBoot() {
+  FirmwareBootState boot_state = platform->loadBootState();
+  is_confirming = boot_state.is_pending;
+  has_rolled_back = boot_state.has_rolled_back;
+  if (!is_confirming) {
+    if (has_rolled_back) {
+      boot_state.has_rolled_back = false;
+      platform->saveBootState(boot_state);
+    }
+    platform->markRunningImageValid();
+    return;
+  }
+
+  boot_state.boot_count++;
+  platform->saveBootState(boot_state);
+  Serial.println(PRINT_PREFIX + "Unconfirmed image, boot " + String(boot_state.boot_count) + " of " + String(OTA_MAX_BOOT_ATTEMPTS));
+
+  if (boot_state.boot_count > OTA_MAX_BOOT_ATTEMPTS) {
+    rollBack();
+  }
+}
+
+boolean FirmwareUpdater::begin(size_t size, const char* sha256) {
+  portENTER_CRITICAL(&lock);
+  boolean is_busy = (state == UPDATE_WRITING) || (state == UPDATE_FINISHED);
+  if (!is_busy) {
+    state = UPDATE_WRITING;
+  }
+  portEXIT_CRITICAL(&lock);
+  if (is_busy) {
+    return false;
+  }
+
+  error[0] = '\0';
+  chunk_length = 0;
+  image_size = size;
+  written = 0;
+  reported_progress = 0;
+
+  if (is_confirming) {
+    // The previous image is the way back, keep it until this one is confirmed
+    fail("running image not confirmed yet");
+    return false;
+  }
+  if ((sha256 == nullptr) || !parseHash(sha256, expected_hash)) {
+    fail("expected sha256 as 64 hex digits");
+    return false;
+  }
+
+  size_t partition_size = platform->getUpdatePartitionSize();
+  if (partition_size == 0) {
+    fail("no update partition");
+    return false;
+  }
+  if (size > partition_size) {
+    fail("image larger than the partition");
+    return false;
+  }
+
+  chunk = (uint8_t*)malloc(OTA_CHUNK_SIZE);
+  if (chunk == nullptr) {
+    fail("out of memory");
+    return false;
+  }
+  mbedtls_sha256_init(&sha256_context);
+  mbedtls_sha256_starts(&sha256_context, 0);
+
+  is_image_open = platform->beginImage();
+  if (!is_image_open) {
+    fail("cannot open the update partition");
+    return false;
+  }
+
+  Serial.printf("%sWriting %u bytes to %s\n", PRINT_PREFIX.c_str(), (unsigned int)size, platform->getUpdatePartitionLabel());
+  report("writing");
+  return true;
+}
+
+boolean FirmwareUpdater::write(const uint8_t* data, size_t length) {
+  if (state != UPDATE_WRITING) {
+    return false;
+  }
+
+  while (length > 0) {
+    size_t count = min(length, OTA_CHUNK_SIZE - chunk_length);
+    memcpy(chunk + chunk_length, data, count);
+    chunk_length += count;
+    data += count;
+    length -= count;
+
+    if ((chunk_length == OTA_CHUNK_SIZE) && !flushChunk()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+boolean FirmwareUpdater::end() {
+  if ((state != UPDATE_WRITING) || !flushChunk()) {
+    return false;
+  }
+  if ((image_size > 0) && (written != image_size)) {
+    fail("image incomplete");
+    return false;
+  }
+
+  uint8_t hash[32];
+  mbedtls_sha256_finish(&sha256_context, hash);
+  if (memcmp(hash, expected_hash, sizeof(hash)) != 0) {
+    fail("sha256 mismatch");
+    return false;
+  }
+
+  is_image_open = false;
+  if (!platform->endImage()) {
+    fail("invalid image");
+    return false;
+  }
+  if (!platform->bootUpdatePartition()) {
+    fail("cannot select the new image");
+    return false;
+  }
+
+  FirmwareBootState boot_state = { true, 0, false };
+  platform->saveBootState(boot_state);
+
+  release();
+  restart_at = millis() + RESTART_DELAY;
+  state = UPDATE_FINISHED;
+  Serial.println(PRINT_PREFIX + "Image verified (" + String(written) + " bytes), restarting");
+  report("restarting");
+  return true;
+}
+
+void FirmwareUpdater::abort(const char* reason) {
+  if (state == UPDATE_WRITING) {
+    fail(reason);
+  }
+}
+
+boolean FirmwareUpdater::pull(const char* url, const char* sha256) {
+  if ((state == UPDATE_WRITING) || (state == UPDATE_FINISHED)) {
+    return false;
+  }
+  if ((url == nullptr) || (strncmp(url, "http://", 7) != 0) || (strlen(url) >= sizeof(pull_url)) ||
+      (sha256 == nullptr) || (strlen(sha256) >= sizeof(pull_sha256))) {
+    strlcpy(error, "expected an http:// url and a sha256", sizeof(error));
+    state = UPDATE_FAILED;
+    report("failed", error);
+    return false;
+  }
+
+  strlcpy(pull_url, url, sizeof(pull_url));
+  strlcpy(pull_sha256, sha256, sizeof(pull_sha256));
+  return platform->startPullTask(this);
+}
+
+// Streams the response body into the update partition
+void FirmwareUpdater::runPull() {
+  Serial.println(PRINT_PREFIX + "Downloading " + pull_url);
+  int size = -1;
+  int status = platform->openDownload(pull_url, &size);
+  if (status != HTTP_STATUS_OK) {
+    snprintf(error, sizeof(error), "download failed, HTTP %d", status);
+    state = UPDATE_FAILED;
+    report("failed", error);
+  } else if (begin(size > 0 ? size : 0, pull_sha256)) {
+    uint8_t buffer[PULL_BUFFER_SIZE];
+    size_t remaining = size > 0 ? size : SIZE_MAX;
+
+    while ((remaining > 0) && (state == UPDATE_WRITING)) {
+      size_t count = platform->readDownload(buffer, min(remaining, sizeof(buffer)));
+      if ((count == 0) || !write(buffer, count)) {
+        break;
+      }
+      remaining -= count;
+    }
+
+    if ((size > 0) && (remaining > 0)) {
+      abort("download interrupted");
+    } else {
+      end();
+    }
+  }
+  platform->closeDownload();
+}
+
+void FirmwareUpdater::loop(boolean is_healthy) {
+  if ((state == UPDATE_FINISHED) && ((long)(millis() - restart_at) >= 0)) {
+    platform->restart();
+  }
+
+  if (has_rolled_back && is_healthy) {
+    has_rolled_back = false;
+    report("rolled_back");
+  }
+
+  if (!is_confirming) {
+    return;
+  }
+  if (is_healthy) {
+    confirm();
+  } else if (millis() > OTA_HEALTH_TIMEOUT * 1000UL) {
+    Serial.println(PRINT_PREFIX + "New image not healthy after " + String(OTA_HEALTH_TIMEOUT) + " s");
+    rollBack();
+  }
+}
+
+// MARK: Helpers
+
+boolean FirmwareUpdater::flushChunk() {
+  if (chunk_length == 0) {
+    return true;
+  }
+  if ((image_size > 0) && (written + chunk_length > image_size)) {
+    fail("image larger than announced");
+    return false;
+  }
+
+  mbedtls_sha256_update(&sha256_context, chunk, chunk_length);
+  if (!platform->writeImage(chunk, chunk_length)) {
+    fail("flash write failed");
+    return false;
+  }
+  written += chunk_length;
+  chunk_length = 0;
+
+  if (image_size > 0) {
+    uint8_t progress = (uint64_t)written * 100 / image_size;
+    if (progress >= reported_progress + OTA_PROGRESS_STEP) {
+      reported_progress = progress - (progress % OTA_PROGRESS_STEP);
+      char message[48];
+      snprintf(message, sizeof(message), "{\"state\":\"writing\",\"progress\":%u}", reported_progress);
+      platform->publishState(message);
+    }
+  }
+  return true;
+}
+
+void FirmwareUpdater::fail(const char* reason) {
+  strlcpy(error, reason, sizeof(error));
+  if (is_image_open) {
+    platform->abortImage();
+    is_image_open = false;
+  }
+  release();
+  state = UPDATE_FAILED;
+  Serial.println(PRINT_PREFIX + "Update failed: " + reason);
+  report("failed", error);
+}
+
+void FirmwareUpdater::release() {
+  if (chunk != nullptr) {
+    mbedtls_sha256_free(&sha256_context);
+    free(chunk);
+    chunk = nullptr;
+  }
+}
+
+void FirmwareUpdater::confirm() {
+  FirmwareBootState boot_state = { false, 0, false };
+  platform->saveBootState(boot_state);
+  platform->markRunningImageValid();
+
+  is_confirming = false;
+  Serial.println(PRINT_PREFIX + "New image confirmed");
+  report("confirmed");
+}
+
+// Boots the other app partition, the image that installed this one
+void FirmwareUpdater::rollBack() {
+  FirmwareBootState boot_state = { false, 0, false };
+  is_confirming = false;
+  if (!platform->bootUpdatePartition()) {
+    // Nothing to go back to, keep this image
+    platform->saveBootState(boot_state);
+    Serial.println(PRINT_PREFIX + "No previous image, keeping this one");
+    return;
+  }
+  boot_state.has_rolled_back = true;
+  platform->saveBootState(boot_state);
+
+  Serial.println(PRINT_PREFIX + "Rolling back to " + platform->getUpdatePartitionLabel());
+  platform->restart();
+}
+
+void FirmwareUpdater::report(const char* name, const char* detail) {
+  char message[96];
+  if (detail != nullptr) {
+    snprintf(message, sizeof(message), "{\"state\":\"%s\",\"error\":\"%s\"}", name, detail);
+  } else {
+    snprintf(message, sizeof(message), "{\"state\":\"%s\"}", name);
+  }
+  platform->publishState(message);
+}
+
+boolean FirmwareUpdater::parseHash(const char* text, uint8_t* hash) {
+  if (strlen(text) != 64) {
+    return false;
+  }
+  for (uint8_t i = 0; i < 32; i++) {
+    if (!isxdigit(text[2 * i]) || !isxdigit(text[2 * i + 1])) {
+      return false;
+    }
+    char byte[3] = { text[2 * i], text[2 * i + 1], '\0' };
+    hash[i] = strtoul(byte, nullptr, 16);
+  }
+  return true;
+}
@@ -0,0 +1,106 @@
+
+#ifndef FIRMWAREUPDATER_H_
+#define FIRMWAREUPDATER_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include <mbedtls/sha256.h>
+#include "FirmwarePlatform.h"
+#include "Settings.h"
+
+enum FirmwareUpdateState : uint8_t {
+  UPDATE_IDLE = 0,
+  UPDATE_WRITING,
+  UPDATE_FINISHED, // Restarts into the new image
+  UPDATE_FAILED
+};
+
+// Writes a new firmware image into the inactive app partition while it is
+// received, either uploaded (POST /api/v1/ota) or pulled from a URL (MQTT
+// ota/set). The image is written in OTA_CHUNK_SIZE chunks, one flash sector
+// each, and hashed on the way; it only becomes the boot partition if the
+// SHA-256 matches and the image checks out.
+//
+// The new image has OTA_HEALTH_TIMEOUT seconds after booting to come up and
+// connect to MQTT. If it doesn't, or keeps crashing before that
+// (OTA_MAX_BOOT_ATTEMPTS), the previous image is restored. Progress and
+// results go to bionic_flower/<id>/ota/state.
+//
+// Flash, NVS and network are reached through a FirmwarePlatform, so the
+// updater also runs against a fake partition in the host tests.
+class FirmwareUpdater {
+
+  public:
+
+    // MARK: Initialization
+
+    FirmwareUpdater(FirmwarePlatform* platform);
+
+    // MARK: Static Methods
+
+    static FirmwareUpdater* getSharedInstance(); // On the ESP platform
+
+    // MARK: Methods
+
+    void checkBoot(); // First thing in setup: rolls back an image that keeps failing to boot
+
+    // One update at a time, from any task
+    boolean begin(size_t size, const char* sha256); // size 0 = unknown, sha256 as 64 hex digits
+    boolean write(const uint8_t* data, size_t length);
+    boolean end();
+    void abort(const char* reason);
+    boolean pull(const char* url, const char* sha256); // Downloads on its own task
+    void runPull(); // Body of that task
+
+    void loop(boolean is_healthy); // Control loop: restart, health confirmation and rollback
+
+    FirmwareUpdateState getState() {
+      return state;
+    }
+
+    const char* getError() {
+      return error;
+    }
+
+  private:
+
+    // MARK: Properties
+
+    FirmwarePlatform* platform;
+
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    volatile FirmwareUpdateState state = UPDATE_IDLE;
+    char error[48];
+
+    boolean is_image_open = false;
+    mbedtls_sha256_context sha256_context;
+    uint8_t expected_hash[32];
+    uint8_t* chunk = nullptr; // OTA_CHUNK_SIZE while writing
+    size_t chunk_length = 0;
+    size_t image_size = 0; // 0 = unknown
+    size_t written = 0;
+    uint8_t reported_progress = 0; // %
+    unsigned long restart_at = 0;
+
+    // Pull
+    char pull_url[160];
+    char pull_sha256[65];
+
+    // Health of a new image
+    boolean is_confirming = false;
+    boolean has_rolled_back = false; // Reported once MQTT is up
+
+    // MARK: Helpers
+
+    boolean flushChunk();
+    void fail(const char* reason);
+    void release();
+    void confirm();
+    void rollBack();
+    void report(const char* name, const char* detail = nullptr);
+    static boolean parseHash(const char* text, uint8_t* hash);
+
+};
+
+#endif
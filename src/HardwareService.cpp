@@ -2,19 +2,46 @@
 // MARK: Includes
 
 #include "HardwareService.h"
+#include "AnimationClock.h"
 #include "MQTTService.h"
+#include "Metrics.h"
 #include <time.h>
 
 // MARK: Constants
 
 const String PRINT_PREFIX = "[HW]: ";
 const uint32_t MAX_MEASUREMENT_COUNT = 20;
-const float MAX_BRIGHTNESS = 4095;
+const float MAX_BRIGHTNESS = 4095; // lux mapped to 100% brightness
 const float MAX_DISTANCE = 4095;
 const float MAX_REOPENCYCLES_LIGHT = 5;
 const float MAX_REOPENCYCLES_TOUCH = 5;
 const float MAX_REOPENCYCLES_DISTANCE = 5;
 
+// Ambient light auto-ranging, ordered from least to most sensitive.
+// Counts scale with gain * measurement time, so each step multiplies the
+// resolution by (gain * time) of the next range over the current one.
+struct LightSensorRange {
+  uint8_t gain_code;
+  uint8_t meas_time_code;
+  uint32_t gain;
+  uint32_t meas_time; // ms
+  uint32_t full_scale; // max raw DATA0/DATA1 count
+};
+
+const LightSensorRange LIGHT_SENSOR_RANGES[] = {
+  { RPR0521RS_ALS_GAIN_X1, RPR0521RS_MODE_CONTROL_MEASTIME_50_50MS, 1, 50, 0x7FFF },      // bright: fast updates
+  { RPR0521RS_ALS_GAIN_X1, RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS, 1, 100, 0xFFFF },  // power-on default
+  { RPR0521RS_ALS_GAIN_X2, RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS, 2, 100, 0xFFFF },
+  { RPR0521RS_ALS_GAIN_X64, RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS, 64, 100, 0xFFFF },
+  { RPR0521RS_ALS_GAIN_X128, RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS, 128, 100, 0xFFFF }, // dark: max resolution
+};
+const uint8_t LIGHT_SENSOR_RANGE_COUNT = sizeof(LIGHT_SENSOR_RANGES) / sizeof(LIGHT_SENSOR_RANGES[0]);
+const uint8_t LIGHT_SENSOR_DEFAULT_RANGE = 1; // matches RPR0521RS::init()
+const float LIGHT_SENSOR_SATURATION = 0.8f; // step down above 80% of full scale
+const float LIGHT_SENSOR_RANGE_TARGET = 0.4f; // step up if the next range stays below 40% of full scale
+
+const uint8_t TOUCH_CALIBRATION_PADS = 0b101; // CS1 (right, flipped) and CS3 (left), CS2 is not connected
+
 // MARK: Variables
 
 HardwareService* shared_instance;
@@ -72,16 +99,32 @@ HardwareService::HardwareService() {
 
   sensor_data.has_light_sensor = light_sensor.init() == 0;
   sensor_data.has_touch_sensor = touch_sensor.begin();
+  has_light_sensor = sensor_data.has_light_sensor;
+  has_touch_sensor = sensor_data.has_touch_sensor;
+  sensor_data.illuminance = 0;
+  light_sensor_range = LIGHT_SENSOR_DEFAULT_RANGE;
+  light_sensor_range_changed_at = 0;
   reopen_cycle_count = 0;
-  rgb_hue = 0;
 
-  // Touch handling init
-  touch_left_start = 0;
-  touch_right_start = 0;
-  touch_left_was_pressed = false;
-  touch_right_was_pressed = false;
-  touch_left_long_triggered = false;
-  touch_right_long_triggered = false;
+  // Proximity gesture mode: sampling task only exists while enabled
+  proximity_task = nullptr;
+  i2c_mutex = xSemaphoreCreateMutex();
+  led_mutex = xSemaphoreCreateRecursiveMutex();
+  realtime_frame_at = 0;
+  proximity_events = xQueueCreate(8, sizeof(ProximityGesture));
+  proximity_mode_enabled = false;
+
+  // Touch gestures init: tap left toggles the light, tap right cycles effects
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    gesture_actions[i] = GESTURE_ACTION_NONE;
+  }
+  gesture_actions[GESTURE_LEFT_TAP] = GESTURE_ACTION_TOGGLE_LIGHT;
+  gesture_actions[GESTURE_RIGHT_TAP] = GESTURE_ACTION_NEXT_EFFECT;
+
+  // Touch calibration init
+  resetTouchCalibration();
+
+  show_duration = 0;
 
   // Adaptive brightness init
   last_adaptive_brightness_update = 0;
@@ -145,7 +188,7 @@ boolean HardwareService::start() {
   return true;
 }
 
-void HardwareService::setConfiguration(Configuration new_configuration) {
+boolean HardwareService::setConfiguration(Configuration new_configuration, boolean is_motor_commanded) {
   Serial.print(PRINT_PREFIX + "New Configuration");
   Serial.print(": Motor Position: " + String(new_configuration.motor_position));
   Serial.print(", Lower Brightness Threshold: " + String(new_configuration.lower_brightness_threshold));
@@ -167,40 +210,98 @@ void HardwareService::setConfiguration(Configuration new_configuration) {
   bool sensor_effect_active = mqtt->isSensorEnabled();
   bool weather_effect_active = mqtt->isWeatherEnabled();
 
-  // Only allow manual motor control if Sensor and Weather effects are not active
+  // Only allow manual motor control if Sensor and Weather effects are not active.
+  // Callers that pass the whole configuration along with a new color don't
+  // mean to move the motor, unless the position was commanded explicitly.
+  boolean is_motor_allowed = !sensor_effect_active && !weather_effect_active && (is_motor_commanded || !color_changed);
   if (((new_configuration.motor_position != configuration.motor_position) || (new_configuration.speed != configuration.speed))
-      && !sensor_effect_active && !weather_effect_active && !color_changed) {
+      && is_motor_allowed) {
 
     // The correct way to calculate the speed would be:
     // MOTOR_SPEED_FAST + ((1 - new_configuration.speed) * (MOTOR_SPEED_SLOW - MOTOR_SPEED_FAST));
     // but since Ticker is limited to a time granularity of 0.001, we cannot set any value between 0.001 and 0.002
     float motor_speed = (new_configuration.speed < 0.5) ? MOTOR_SPEED_SLOW : MOTOR_SPEED_FAST;
     move(new_configuration.motor_position, motor_speed);
+  } else if (!is_motor_allowed) {
+    // Not stored, the motor doesn't go there
+    new_configuration.motor_position = configuration.motor_position;
   }
 
   this->configuration = new_configuration;
 
   // Save state to NVS
   saveStateToNVS();
+  return is_motor_allowed;
 }
 
 void HardwareService::resetSensorData() {
   light_measurement_count = 0;
 }
 
+// A realtime stream owns the LEDs until it times out, configuration
+// changes in the meantime are shown by the first rendered frame after it
 void HardwareService::writeLED(Color color) {
-  for (int i = 0; i < LED_COUNT; i++) {
-    leds[i].setRGB(color.red, color.green, color.blue);
+  xSemaphoreTakeRecursive(led_mutex, portMAX_DELAY);
+  if (!isRealtimeActive()) {
+    for (int i = 0; i < LED_COUNT; i++) {
+      leds[i].setRGB(color.red, color.green, color.blue);
+    }
+    showLEDs();
   }
+  xSemaphoreGiveRecursive(led_mutex);
+}
 
+// All frames go through here, so the light sampler knows what the LEDs emit.
+// Realtime frames are shown from the UDP task, the mutex keeps the two apart.
+void HardwareService::showLEDs() {
+  xSemaphoreTakeRecursive(led_mutex, portMAX_DELAY);
+  unsigned long show_started_at = micros();
   FastLED.show();
+  unsigned long duration = micros() - show_started_at;
+  show_duration = min(duration, 65535UL);
+  Metrics::getSharedInstance()->observe(METRIC_LED_SHOW, duration);
+
+  float output = 0;
+  for (int i = 0; i < LED_COUNT; i++) {
+    output += AmbientLightCompensator::getOutput(leds[i].r, leds[i].g, leds[i].b);
+  }
+  light_compensator.addFrame(output, millis());
+  xSemaphoreGiveRecursive(led_mutex);
+}
+
+// UDP task: rgb holds LED_COUNT colors, shown right away
+void HardwareService::showRealtimeFrame(const uint8_t* rgb) {
+  xSemaphoreTakeRecursive(led_mutex, portMAX_DELAY);
+  realtime_frame_at = millis();
+  for (int i = 0; i < LED_COUNT; i++) {
+    leds[i].setRGB(rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]);
+  }
+  showLEDs();
+  xSemaphoreGiveRecursive(led_mutex);
+}
+
+void HardwareService::endRealtime() {
+  realtime_frame_at = 0;
+}
+
+boolean HardwareService::isRealtimeActive() {
+  unsigned long frame_at = realtime_frame_at;
+  return (frame_at != 0) && (millis() - frame_at < REALTIME_TIMEOUT);
 }
 
 void HardwareService::loop(const boolean has_active_connection, uint32_t loop_counter) {
+  unsigned long loop_started_at = micros();
+  show_duration = 0;
+
   if ((loop_counter % 6) == 0) {
     updateMotor();
   } else {
+    // The proximity task shares the I2C bus
+    xSemaphoreTake(i2c_mutex, portMAX_DELAY);
+    unsigned long read_started_at = micros();
     readSensors();
+    Metrics::getSharedInstance()->observe(METRIC_SENSOR_READ, micros() - read_started_at);
+    xSemaphoreGive(i2c_mutex);
   }
 
   // Update adaptive brightness (every 15s internally)
@@ -209,70 +310,38 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
   // Check if NVS save is pending (debounced)
   checkPendingNVSSave();
 
+  // Touch gestures (always active), mapped to actions via MQTT
+  for (TouchGesture gesture = touch_gestures.nextGesture(); gesture != GESTURE_NONE; gesture = touch_gestures.nextGesture()) {
+    handleGesture(gesture);
+  }
+
   // Check MQTT light state
   MQTTService* mqtt = MQTTService::getSharedInstance();
+
+  // Touch calibration results (adjusted while reading the sensors)
+  if (has_touch_calibration_update) {
+    has_touch_calibration_update = false;
+    mqtt->publishTouchCalibration();
+  }
+
+  // Proximity gestures detected by the sampling task
+  ProximityGesture proximity_gesture;
+  while (xQueueReceive(proximity_events, &proximity_gesture, 0) == pdTRUE) {
+    Serial.println(PRINT_PREFIX + "Proximity gesture: " + ProximityGestureDetector::getName(proximity_gesture));
+    mqtt->publishProximityGesture(proximity_gesture);
+  }
+
   bool light_on = mqtt->isLightOn();
   bool rainbow_enabled = mqtt->isRainbowEnabled();
   bool rainbow_multi_enabled = mqtt->isRainbowMultiEnabled();
   bool circadian_enabled = mqtt->isCircadianEnabled();
   bool weather_enabled = mqtt->isWeatherEnabled();
+  bool sensor_enabled = mqtt->isSensorEnabled();
 
   // Apply adaptive brightness to MQTT brightness setting
   uint8_t raw_mqtt_brightness = mqtt->getBrightness();
   uint8_t mqtt_brightness = (raw_mqtt_brightness * adaptive_brightness_factor) / 255;
 
-  // Sensor effect state for touch handling
-  bool sensor_enabled = mqtt->isSensorEnabled();
-
-  // Touch handling (always active)
-  // Left touch: Toggle light on/off
-  // Right touch: Cycle through effects
-  if (sensor_data.has_touch_sensor) {
-    // Left touch: toggle light on/off
-    if (sensor_data.touch_left && !touch_left_was_pressed) {
-      touch_left_was_pressed = true;
-      mqtt->setLightOn(!light_on);
-      mqtt->publishLightState();
-      light_on = mqtt->isLightOn();
-    } else if (!sensor_data.touch_left) {
-      touch_left_was_pressed = false;
-    }
-
-    // Right touch: cycle effects (None -> Rainbow -> Rainbow Multi -> Circadian -> Weather -> Sensor -> None)
-    if (sensor_data.touch_right && !touch_right_was_pressed) {
-      touch_right_was_pressed = true;
-      if (rainbow_enabled) {
-        mqtt->setRainbowEnabled(false);
-        mqtt->setRainbowMultiEnabled(true);
-      } else if (rainbow_multi_enabled) {
-        mqtt->setRainbowMultiEnabled(false);
-        mqtt->setCircadianEnabled(true);
-      } else if (circadian_enabled) {
-        mqtt->setCircadianEnabled(false);
-        mqtt->setWeatherEnabled(true);
-      } else if (weather_enabled) {
-        mqtt->setWeatherEnabled(false);
-        mqtt->setSensorEnabled(true);
-      } else if (sensor_enabled) {
-        mqtt->setSensorEnabled(false);
-        // None - static color
-      } else {
-        // None -> Rainbow
-        mqtt->setRainbowEnabled(true);
-      }
-      mqtt->publishLightState();
-
-      // Re-read effect states
-      rainbow_enabled = mqtt->isRainbowEnabled();
-      rainbow_multi_enabled = mqtt->isRainbowMultiEnabled();
-      circadian_enabled = mqtt->isCircadianEnabled();
-      weather_enabled = mqtt->isWeatherEnabled();
-      sensor_enabled = mqtt->isSensorEnabled();
-    } else if (!sensor_data.touch_right) {
-      touch_right_was_pressed = false;
-    }
-  }
-
   // Weather motor control - runs independently of LED state
   if (weather_enabled) {
     String weather_state = mqtt->getWeatherState();
@@ -347,6 +416,24 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
     }
   }
 
+  // Realtime frames (DDP, E1.31) are shown as they arrive, no effect is
+  // rendered until they stop. The mutex keeps a frame arriving meanwhile
+  // from being mixed into (or overwritten by) the effect's leds[].
+  xSemaphoreTakeRecursive(led_mutex, portMAX_DELAY);
+  if (isRealtimeActive()) {
+    xSemaphoreGiveRecursive(led_mutex);
+#if ENABLE_DIAGNOSTICS
+    recordDiagnostics(loop_started_at);
+#endif
+    return;
+  }
+
+  // Animations run on the shared clock instead of the loop counter, so
+  // flowers showing the same effect stay in step
+  AnimationClock* animation_clock = AnimationClock::getSharedInstance();
+  uint32_t animation_time = animation_clock->getTime();
+  uint32_t frame = animation_clock->getFrame();
+
   // If light is turned off via MQTT, turn off LEDs
   if (!light_on) {
     writeLED({ 0, 0, 0 });
@@ -369,9 +456,9 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
     // Luminance: white/gray ~2x, yellow/cyan ~1.5x, blue needs ~3x boost
     if (weather_state == "sunny") {
       // Rich golden yellow with visible breathing effect
-      // Use millis() for time-based animation (loop_counter is too slow at 10Hz)
+      // Time-based animation, frame steps are too coarse at 10Hz
       // ~4 second cycle = comfortable, visible breathing
-      uint8_t phase = (uint8_t)((millis() / 15) % 256);  // ~4 second cycle
+      uint8_t phase = (uint8_t)((animation_time / 15) % 256);  // ~4 second cycle
       uint8_t sine = sin8(phase);  // 0-255
       // Breathing: 50%-100% range for visible but not too strong effect
       uint8_t breath = (sine * 5 / 10) + 128;  // 128-255 (50%-100%)
@@ -384,7 +471,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
       // Dark blue base with twinkling stars
       // Blue needs ~3x intensity, white ~0.5x (R+G+B combined is very bright)
       for (int i = 0; i < LED_COUNT; i++) {
-        bool is_star = ((loop_counter + i * 50) % 120 < 8) || (random(100) < 2);
+        bool is_star = ((frame + i * 50) % 120 < 8) || (random(100) < 2);
         if (is_star) {
           // Twinkling star: warm white, heavily reduced (white is 2x brighter)
           uint8_t val = (80 * mqtt_brightness) / 255;
@@ -397,12 +484,12 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
           leds[i] = CRGB(r, g, b);
         }
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "cloudy") {
       // Gray colors slowly drifting across LEDs
       // Gray/white is ~2x brighter, reduce by half
-      uint8_t wave_pos = (loop_counter / 3) % (LED_COUNT * 2);
+      uint8_t wave_pos = (frame / 3) % (LED_COUNT * 2);
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t dist = abs((int)wave_pos - i - LED_COUNT);
         uint8_t brightness_mod = 255 - (dist * 30);
@@ -411,7 +498,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         // Slight blue tint for cloudy sky
         leds[i] = CRGB((uint8_t)((gray * 85) / 100), gray, (uint8_t)((gray * 120) / 100));
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "partlycloudy") {
       // Alternating golden sun and cloud gray
@@ -428,19 +515,19 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
           leds[i] = CRGB((uint8_t)((gray * 85) / 100), gray, (uint8_t)((gray * 115) / 100));
         }
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "fog") {
       // Pale white/gray with very slow breathing
       // White is ~2x brighter, halve it
-      uint8_t breath = sin8(loop_counter / 4) / 3 + 150;
+      uint8_t breath = sin8(frame / 4) / 3 + 150;
       uint8_t val = (breath * mqtt_brightness) / (255 * 2);
       writeLED({ val, val, (uint8_t)((val * 95) / 100) });
 
     } else if (weather_state == "rainy") {
       // Blue raindrops falling down (sequential LED lighting)
       // Blue boosted for perceived brightness
-      uint8_t drop_pos = (loop_counter / 4) % LED_COUNT;
+      uint8_t drop_pos = (frame / 4) % LED_COUNT;
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t intensity = (i == drop_pos) ? 255 : 60;
         uint8_t r = (40 * mqtt_brightness * intensity) / (255 * 255);
@@ -448,13 +535,13 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t b = (255 * mqtt_brightness * intensity) / (255 * 255);  // Blue boosted
         leds[i] = CRGB(r, g, b);
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "pouring") {
       // Intense blue, fast raindrops
       // Blue boosted for perceived brightness
-      uint8_t drop_pos = (loop_counter / 2) % LED_COUNT;
-      uint8_t drop_pos2 = (loop_counter / 2 + 2) % LED_COUNT;
+      uint8_t drop_pos = (frame / 2) % LED_COUNT;
+      uint8_t drop_pos2 = (frame / 2 + 2) % LED_COUNT;
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t intensity = (i == drop_pos || i == drop_pos2) ? 255 : 100;
         uint8_t r = (30 * mqtt_brightness * intensity) / (255 * 255);
@@ -462,7 +549,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t b = (255 * mqtt_brightness * intensity) / (255 * 255);  // Blue boosted
         leds[i] = CRGB(r, g, b);
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "lightning") {
       // Dark gray base with random white flashes
@@ -487,7 +574,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t val = mqtt_brightness;
         writeLED({ val, val, val });
       } else {
-        uint8_t drop_pos = (loop_counter / 3) % LED_COUNT;
+        uint8_t drop_pos = (frame / 3) % LED_COUNT;
         for (int i = 0; i < LED_COUNT; i++) {
           uint8_t intensity = (i == drop_pos) ? 255 : 80;
           uint8_t r = (35 * mqtt_brightness * intensity) / (255 * 255);
@@ -495,18 +582,18 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
           uint8_t b = (255 * mqtt_brightness * intensity) / (255 * 255);  // Blue boosted
           leds[i] = CRGB(r, g, b);
         }
-        FastLED.show();
+        showLEDs();
       }
 
     } else if (weather_state == "windy" || weather_state == "windy-variant") {
       // Green-yellow leaves blowing in the wind - sweeping pattern
-      uint8_t pos = (sin8(loop_counter * 3) * (LED_COUNT - 1)) / 255;
+      uint8_t pos = (sin8(frame * 3) * (LED_COUNT - 1)) / 255;
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t dist = abs((int)pos - i);
         uint8_t intensity = 255 - (dist * 50);
         if (intensity > 255) intensity = 60;
         // Alternate between green and yellow-green for leaf effect
-        bool is_yellow = ((loop_counter / 8) + i) % 3 == 0;
+        bool is_yellow = ((frame / 8) + i) % 3 == 0;
         uint8_t r, g, b;
         if (is_yellow) {
           // Yellow-green leaf
@@ -521,7 +608,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         }
         leds[i] = CRGB(r, g, b);
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "snowy") {
       // White with random sparkles
@@ -531,14 +618,14 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t val = (sparkle * mqtt_brightness) / 255;
         leds[i] = CRGB(val, val, val);
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "snowy-rainy") {
       // Alternating white and blue drops
       // White ~2x brighter (halved), blue boosted
-      uint8_t drop_pos = (loop_counter / 3) % LED_COUNT;
+      uint8_t drop_pos = (frame / 3) % LED_COUNT;
       for (int i = 0; i < LED_COUNT; i++) {
-        bool is_snow = ((loop_counter / 10) + i) % 2 == 0;
+        bool is_snow = ((frame / 10) + i) % 2 == 0;
         uint8_t intensity = (i == drop_pos) ? 255 : 100;
         if (is_snow) {
           // White snow: halved for brightness match
@@ -552,7 +639,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
           leds[i] = CRGB(r, g, b);
         }
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "hail") {
       // White with harsh random flicker
@@ -562,13 +649,12 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t val = (flicker * mqtt_brightness) / 255;
         leds[i] = CRGB(val, val, val);
       }
-      FastLED.show();
+      showLEDs();
 
     } else if (weather_state == "exceptional") {
       // Rainbow multi effect for exceptional weather
       // HSV handles brightness internally, reduce for balance
-      uint8_t base_hue = rgb_hue >> 8;
-      rgb_hue += 20;
+      uint8_t base_hue = (uint16_t)(frame * 20) >> 8;
       uint8_t balanced_brightness = (mqtt_brightness * 180) / 255;
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t hue = base_hue + (i * 255 / LED_COUNT);
@@ -577,7 +663,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         hsv2rgb_rainbow(hsv, rgb);
         leds[i] = rgb;
       }
-      FastLED.show();
+      showLEDs();
 
     } else {
       // Default/unknown: warm white
@@ -603,7 +689,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
     if (hour >= 22 || hour < 6) {
       // Night (22:00 - 06:00): Starry night - same as clear-night weather
       for (int i = 0; i < LED_COUNT; i++) {
-        bool is_star = ((loop_counter + i * 50) % 120 < 8) || (random(100) < 2);
+        bool is_star = ((frame + i * 50) % 120 < 8) || (random(100) < 2);
         if (is_star) {
           // Twinkling star: warm white, reduced (same as clear-night)
           uint8_t val = (80 * mqtt_brightness) / 255;
@@ -616,10 +702,10 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
           leds[i] = CRGB(r, g, b);
         }
       }
-      FastLED.show();
+      showLEDs();
     } else if (hour >= 6 && hour < 8) {
       // Early morning sunrise: orange-pink with slow rotating glow
-      uint8_t pos = (uint8_t)((millis() / 80) % LED_COUNT);  // Slow rotation ~0.4s per LED
+      uint8_t pos = (uint8_t)((animation_time / 80) % LED_COUNT);  // Slow rotation ~0.4s per LED
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t dist = (i >= pos) ? (i - pos) : (LED_COUNT - pos + i);
         uint8_t intensity = 255 - (dist * 35);  // Subtle gradient
@@ -628,10 +714,10 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t b = (60 * mqtt_brightness * intensity) / (255 * 255);
         leds[i] = CRGB(r, g, b);
       }
-      FastLED.show();
+      showLEDs();
     } else if (hour >= 8 && hour < 11) {
       // Late morning: warm golden with visible breathing
-      uint8_t phase = (uint8_t)((millis() / 15) % 256);  // ~4 second cycle
+      uint8_t phase = (uint8_t)((animation_time / 15) % 256);  // ~4 second cycle
       uint8_t sine = sin8(phase);
       uint8_t breath = (sine * 5 / 10) + 128;  // 50%-100% range
       uint8_t r = (255 * mqtt_brightness * breath) / (255 * 255);
@@ -646,7 +732,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
       writeLED({ r, g, b });
     } else if (hour >= 16 && hour < 19) {
       // Afternoon/early evening: golden orange with visible breathing
-      uint8_t phase = (uint8_t)((millis() / 15) % 256);  // ~4 second cycle
+      uint8_t phase = (uint8_t)((animation_time / 15) % 256);  // ~4 second cycle
       uint8_t sine = sin8(phase);
       uint8_t breath = (sine * 5 / 10) + 128;  // 50%-100% range
       uint8_t r = (255 * mqtt_brightness * breath) / (255 * 255);
@@ -655,7 +741,7 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
       writeLED({ r, g, b });
     } else {
       // Late evening sunset (19:00 - 22:00): deep red-orange with slow rotating glow
-      uint8_t pos = (uint8_t)((millis() / 100) % LED_COUNT);  // Slower rotation ~0.5s per LED
+      uint8_t pos = (uint8_t)((animation_time / 100) % LED_COUNT);  // Slower rotation ~0.5s per LED
       for (int i = 0; i < LED_COUNT; i++) {
         uint8_t dist = (i >= pos) ? (i - pos) : (LED_COUNT - pos + i);
         uint8_t intensity = 255 - (dist * 35);  // Subtle gradient
@@ -664,18 +750,17 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
         uint8_t b = (20 * mqtt_brightness * intensity) / (255 * 255);
         leds[i] = CRGB(r, g, b);
       }
-      FastLED.show();
+      showLEDs();
     }
   } else if (rainbow_multi_enabled) {
     // Rainbow Multi: Each LED has a different color, rotating together
     // HSV brightness reduced for balance with other effects
-    rgb_hue += 20;
-    uint8_t base_hue = rgb_hue >> 8;
+    uint8_t base_hue = (uint16_t)(frame * 20) >> 8;
 
     // Scale brightness by MQTT brightness setting - reduced for balance
     uint8_t base_brightness = (mqtt_brightness * 150) / 255;
     uint8_t pulse_range = (mqtt_brightness * 50) / 255;
-    uint8_t led_brightness = base_brightness + ((sin8(loop_counter) * pulse_range) / 255);
+    uint8_t led_brightness = base_brightness + ((sin8(frame) * pulse_range) / 255);
 
     // Each LED gets a different hue offset (evenly distributed across spectrum)
     for (int i = 0; i < LED_COUNT; i++) {
@@ -685,17 +770,16 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
       hsv2rgb_rainbow(hsv, rgb);
       leds[i] = rgb;
     }
-    FastLED.show();
+    showLEDs();
   } else if (rainbow_enabled) {
     // Rainbow: All LEDs same color, rotating through spectrum
     // HSV brightness reduced for balance with other effects
-    rgb_hue += 20;
-    uint8_t hue8 = rgb_hue >> 8;
+    uint8_t hue8 = (uint16_t)(frame * 20) >> 8;
 
     // Scale base brightness by MQTT brightness setting - reduced for balance
     uint8_t base_brightness = (mqtt_brightness * 150) / 255;
     uint8_t pulse_range = (mqtt_brightness * 50) / 255;
-    uint8_t led_brightness = base_brightness + ((sin8(loop_counter) * pulse_range) / 255);
+    uint8_t led_brightness = base_brightness + ((sin8(frame) * pulse_range) / 255);
 
     CHSV hsv(hue8, 255, led_brightness);
     CRGB rgb;
@@ -710,6 +794,37 @@ void HardwareService::loop(const boolean has_active_connection, uint32_t loop_co
     scaled_color.blue = (configuration.color.blue * mqtt_brightness) / 255;
     writeLED(scaled_color);
   }
+  xSemaphoreGiveRecursive(led_mutex);
+
+#if ENABLE_DIAGNOSTICS
+  recordDiagnostics(loop_started_at);
+#endif
+}
+
+// One record per frame while the stream is switched on, nothing otherwise
+void HardwareService::recordDiagnostics(unsigned long loop_started_at) {
+  MQTTService* mqtt = MQTTService::getSharedInstance();
+  if (!mqtt->isDiagnosticsEnabled()) {
+    diagnostics.reset();
+    return;
+  }
+
+  DiagnosticsRecord record;
+  record.time = millis();
+  record.illuminance = sensor_data.illuminance;
+  record.brightness = sensor_data.brightness;
+  record.distance = sensor_data.distance;
+  record.flags = (sensor_data.touch_left ? DIAGNOSTICS_FLAG_TOUCH_LEFT : 0) |
+                 (sensor_data.touch_right ? DIAGNOSTICS_FLAG_TOUCH_RIGHT : 0) |
+                 (MotorLogic::isRunning() ? DIAGNOSTICS_FLAG_MOTOR_RUNNING : 0);
+  record.motor_position = MotorLogic::getMotorPosition();
+  record.loop_duration = min(micros() - loop_started_at, 65535UL);
+  record.show_duration = show_duration;
+  diagnostics.addRecord(record);
+
+  if (diagnostics.isBatchReady()) {
+    mqtt->publishDiagnostics(diagnostics);
+  }
 }
 
 void HardwareService::readSensors() {
@@ -719,6 +834,14 @@ void HardwareService::readSensors() {
   if (light_sensor.is_connected() != sensor_data.has_light_sensor) {
     light_sensor = RPR0521RS();
     sensor_data.has_light_sensor = light_sensor.init() == 0;
+    light_sensor_range = LIGHT_SENSOR_DEFAULT_RANGE;
+    // The UDP task adds realtime frames to the compensator
+    xSemaphoreTakeRecursive(led_mutex, portMAX_DELAY);
+    light_compensator.reset();
+    xSemaphoreGiveRecursive(led_mutex);
+    if (sensor_data.has_light_sensor && proximity_mode_enabled) {
+      applyLightSensorRange(light_sensor_range);
+    }
     Serial.println(PRINT_PREFIX + "Reconnected light sensor? " + (sensor_data.has_light_sensor ? "Success." : "Failed."));
   }
 
@@ -728,33 +851,50 @@ void HardwareService::readSensors() {
     sensor_data.has_touch_sensor = touch_sensor.begin();
     if (sensor_data.has_touch_sensor) {
       Serial.println(PRINT_PREFIX + "Reconnected touch sensor.");
+      resetTouchCalibration();
     }
   }
 
+  has_light_sensor = sensor_data.has_light_sensor;
+  has_touch_sensor = sensor_data.has_touch_sensor;
+
   // update sensor data
 
   if (sensor_data.has_light_sensor) {
     uint32_t distance;
     float brightness;
+    uint32_t raw_als[2];
 
-    uint8_t rc = light_sensor.get_psalsval(&distance, &brightness);
-    if ((distance >= 0) && (brightness >= 0) && (brightness <= MAX_BRIGHTNESS) && (distance <= MAX_DISTANCE) && (rc == 0)) {
-      brightness = brightness / MAX_BRIGHTNESS;
-      if (light_measurement_count < MAX_MEASUREMENT_COUNT) {
-        light_measurement_count++;
-        if (light_measurement_count == 1) {
-          ambient_brightness = brightness;
-        } else {
-          ambient_brightness = (0.9 * ambient_brightness) + (0.1 * brightness);
-        }
-        if (light_measurement_count == MAX_MEASUREMENT_COUNT) {
-          configuration.lower_brightness_threshold = max(0.0f, ambient_brightness - DEFAULT_BRIGHTNESS_THRESHOLD_DISTANCE);
-          configuration.upper_brightness_threshold = min(1.0f, ambient_brightness + DEFAULT_BRIGHTNESS_THRESHOLD_DISTANCE);
+#if ENABLE_LED_COMPENSATION
+    uint32_t integration_time = LIGHT_SENSOR_RANGES[light_sensor_range].meas_time; // Before a range step
+#endif
+    uint8_t rc = light_sensor.get_psalsval(&distance, &brightness, raw_als);
+    if ((rc == 0) && updateLightSensorRange(raw_als)) {
+      float illuminance = brightness * LIGHT_SENSOR_LUX_CALIBRATION;
+#if ENABLE_LED_COMPENSATION
+      xSemaphoreTakeRecursive(led_mutex, portMAX_DELAY);
+      illuminance = light_compensator.compensate(illuminance, millis(), integration_time);
+      xSemaphoreGiveRecursive(led_mutex);
+#endif
+      if ((distance <= MAX_DISTANCE) && (illuminance >= 0)) {
+        brightness = min(illuminance, MAX_BRIGHTNESS) / MAX_BRIGHTNESS;
+        if (light_measurement_count < MAX_MEASUREMENT_COUNT) {
+          light_measurement_count++;
+          if (light_measurement_count == 1) {
+            ambient_brightness = brightness;
+          } else {
+            ambient_brightness = (0.9 * ambient_brightness) + (0.1 * brightness);
+          }
+          if (light_measurement_count == MAX_MEASUREMENT_COUNT) {
+            configuration.lower_brightness_threshold = max(0.0f, ambient_brightness - DEFAULT_BRIGHTNESS_THRESHOLD_DISTANCE);
+            configuration.upper_brightness_threshold = min(1.0f, ambient_brightness + DEFAULT_BRIGHTNESS_THRESHOLD_DISTANCE);
+          }
         }
-      }
 
-      sensor_data.brightness = brightness;
-      sensor_data.distance = 1 - (distance / MAX_DISTANCE);
+        sensor_data.illuminance = illuminance;
+        sensor_data.brightness = brightness;
+        sensor_data.distance = 1 - (distance / MAX_DISTANCE);
+      }
     }
   }
 
@@ -762,9 +902,14 @@ void HardwareService::readSensors() {
     // They are intentionally flipped, since the existing code recognizes them as the opposite
     sensor_data.touch_left = touch_sensor.isRightTouched();
     sensor_data.touch_right = touch_sensor.isLeftTouched();
+    touch_gestures.update(sensor_data.touch_left, sensor_data.touch_right, millis());
+#if ENABLE_TOUCH_CALIBRATION
+    updateTouchCalibration(sensor_data.touch_left, sensor_data.touch_right);
+#endif
   } else {
     sensor_data.touch_left = false;
     sensor_data.touch_right = false;
+    touch_gestures.reset();
   }
 
   // print sensor data
@@ -774,6 +919,9 @@ void HardwareService::readSensors() {
 
   if (sensor_data.has_light_sensor) {
     Serial.print("(brightness: " + String(sensor_data.brightness));
+    Serial.print(", lux: " + String(sensor_data.illuminance));
+    Serial.print(", led lux: " + String(light_compensator.getLastLEDLux()));
+    Serial.print(", gain: x" + String(light_sensor.get_als_gain()) + "/" + String(light_sensor.get_als_measure_time()) + "ms");
     Serial.print(", ambient: " + String(ambient_brightness));
     Serial.print(", distance: " + String(sensor_data.distance));
     Serial.print(") ");
@@ -790,6 +938,119 @@ void HardwareService::readSensors() {
 #endif
 }
 
+// Steps the ALS gain/measurement time one range at a time based on the raw counts.
+// Returns false while the reading must be discarded (saturated, or taken while a
+// new range was still settling), true if it can be used.
+boolean HardwareService::updateLightSensorRange(uint32_t* raw_als) {
+  const LightSensorRange& range = LIGHT_SENSOR_RANGES[light_sensor_range];
+
+  // The first conversion after a range change was integrated with the old settings
+  if (millis() - light_sensor_range_changed_at < 2 * range.meas_time) {
+    return false;
+  }
+
+  uint32_t raw = max(raw_als[0], raw_als[1]);
+  boolean is_saturated = raw >= LIGHT_SENSOR_SATURATION * range.full_scale;
+  uint8_t next_range = light_sensor_range;
+
+  if (is_saturated && (light_sensor_range > 0)) {
+    next_range = light_sensor_range - 1;
+  } else if (light_sensor_range + 1 < LIGHT_SENSOR_RANGE_COUNT) {
+    const LightSensorRange& upper = LIGHT_SENSOR_RANGES[light_sensor_range + 1];
+    float scale = (float)(upper.gain * upper.meas_time) / (float)(range.gain * range.meas_time);
+    if (raw * scale < LIGHT_SENSOR_RANGE_TARGET * upper.full_scale) {
+      next_range = light_sensor_range + 1;
+    }
+  }
+
+  if (next_range == light_sensor_range) {
+    // Saturated in the least sensitive range still yields a (clipped) lux value
+    return true;
+  }
+
+  if (applyLightSensorRange(next_range) != 0) {
+    return true;
+  }
+
+  const LightSensorRange& target = LIGHT_SENSOR_RANGES[next_range];
+  light_sensor_range = next_range;
+  light_sensor_range_changed_at = millis();
+
+#if DEBUG_AUTONOMOUS_MODE
+  Serial.println(PRINT_PREFIX + "Light sensor range: gain x" + String(target.gain) + ", " + String(target.meas_time) + "ms");
+#endif
+
+  // A saturated reading is useless, an under-ranged one is still correct (just coarse)
+  return !is_saturated;
+}
+
+// Proximity mode runs the PS channel at 50 ms alongside the ALS measurement time
+uint8_t HardwareService::applyLightSensorRange(uint8_t range) {
+  const LightSensorRange& target = LIGHT_SENSOR_RANGES[range];
+  uint8_t meas_time_code = target.meas_time_code;
+  if (proximity_mode_enabled && (meas_time_code == RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS)) {
+    meas_time_code = RPR0521RS_MODE_CONTROL_MEASTIME_100_50MS;
+  }
+  return light_sensor.set_als_range(target.gain_code, meas_time_code);
+}
+
+// MARK: Proximity Gestures
+
+void HardwareService::setProximityModeEnabled(boolean enabled) {
+  if (enabled == proximity_mode_enabled) return;
+
+  Serial.println(PRINT_PREFIX + "Proximity gesture mode: " + (enabled ? "ON" : "OFF"));
+  proximity_mode_enabled = enabled;
+
+  if (sensor_data.has_light_sensor) {
+    xSemaphoreTake(i2c_mutex, portMAX_DELAY);
+    applyLightSensorRange(light_sensor_range);
+    xSemaphoreGive(i2c_mutex);
+  }
+
+  // Created on first use, then parked while the mode is off. A notification
+  // sent before the task parks is kept, so switching back on is never lost.
+  if (enabled) {
+    if (proximity_task == nullptr) {
+      xTaskCreatePinnedToCore(proximityTask, "proximity", 2048, this, 2, &proximity_task, 1);
+    } else {
+      xTaskNotifyGive(proximity_task);
+    }
+  }
+
+  saveStateToNVS();
+}
+
+// Owns the detector, the control task only switches the mode
+void HardwareService::proximityTask(void* parameter) {
+  HardwareService* hardware = (HardwareService*)parameter;
+
+  while (true) {
+    while (!hardware->proximity_mode_enabled) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    hardware->proximity_detector.reset();
+    TickType_t last_wake = xTaskGetTickCount();
+
+    while (hardware->proximity_mode_enabled) {
+      vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(PROXIMITY_SAMPLE_INTERVAL));
+      if (!hardware->sensor_data.has_light_sensor) continue;
+
+      uint32_t distance;
+      xSemaphoreTake(hardware->i2c_mutex, portMAX_DELAY);
+      uint8_t rc = hardware->light_sensor.get_psval(&distance);
+      xSemaphoreGive(hardware->i2c_mutex);
+      if (rc != 0) continue;
+
+      ProximityGesture gesture = hardware->proximity_detector.addSample((uint16_t)distance, millis());
+      if (gesture != PROXIMITY_NONE) {
+        xQueueSend(hardware->proximity_events, &gesture, 0);
+      }
+    }
+  }
+}
+
 void HardwareService::updateMotor() {
   if (!motor_calibration_finished) return;
 
@@ -904,6 +1165,142 @@ void HardwareService::updateAdaptiveBrightness() {
                  "% -> LED factor=" + String(adaptive_brightness_factor * 100 / 255) + "%");
 }
 
+// MARK: Touch Gestures
+
+GestureAction HardwareService::getGestureAction(TouchGesture gesture) {
+  if (gesture >= GESTURE_COUNT) return GESTURE_ACTION_NONE;
+  return gesture_actions[gesture];
+}
+
+void HardwareService::setGestureAction(TouchGesture gesture, GestureAction action) {
+  if ((gesture >= GESTURE_COUNT) || (action >= GESTURE_ACTION_COUNT)) return;
+  gesture_actions[gesture] = action;
+  saveStateToNVS();
+}
+
+TouchGestureTimings HardwareService::getGestureTimings() {
+  return touch_gestures.getTimings();
+}
+
+void HardwareService::setGestureTimings(TouchGestureTimings timings) {
+  touch_gestures.setTimings(timings);
+  saveStateToNVS();
+}
+
+void HardwareService::handleGesture(TouchGesture gesture) {
+  MQTTService* mqtt = MQTTService::getSharedInstance();
+  GestureAction action = getGestureAction(gesture);
+
+  Serial.println(PRINT_PREFIX + "Gesture: " + TouchGestureRecognizer::getName(gesture) + " -> " + GESTURE_ACTION_NAMES[action]);
+  mqtt->publishGesture(gesture);
+
+  switch (action) {
+    case GESTURE_ACTION_TOGGLE_LIGHT:
+      mqtt->setLightOn(!mqtt->isLightOn());
+      mqtt->publishLightState();
+      break;
+    case GESTURE_ACTION_NEXT_EFFECT:
+      cycleEffect(true);
+      mqtt->publishLightState();
+      break;
+    case GESTURE_ACTION_PREVIOUS_EFFECT:
+      cycleEffect(false);
+      mqtt->publishLightState();
+      break;
+    case GESTURE_ACTION_TOGGLE_COVER:
+    case GESTURE_ACTION_OPEN_COVER:
+    case GESTURE_ACTION_CLOSE_COVER: {
+      Configuration new_configuration = configuration;
+      if (action == GESTURE_ACTION_TOGGLE_COVER) {
+        new_configuration.motor_position = (configuration.motor_position > 0.5f) ? MOTOR_POSITION_CLOSED : MOTOR_POSITION_OPEN;
+      } else {
+        new_configuration.motor_position = (action == GESTURE_ACTION_OPEN_COVER) ? MOTOR_POSITION_OPEN : MOTOR_POSITION_CLOSED;
+      }
+      new_configuration.speed = 1.0f;
+      setConfiguration(new_configuration);
+      mqtt->publishCoverState();
+      break;
+    }
+    case GESTURE_ACTION_TOGGLE_ADAPTIVE_BRIGHTNESS:
+      mqtt->setAdaptiveBrightnessEnabled(!mqtt->isAdaptiveBrightnessEnabled());
+      mqtt->publishAdaptiveBrightnessState();
+      saveStateToNVS();
+      break;
+    default:
+      break;
+  }
+}
+
+// Effect order: None -> Rainbow -> Rainbow Multi -> Circadian -> Weather -> Sensor -> None
+void HardwareService::cycleEffect(boolean forward) {
+  MQTTService* mqtt = MQTTService::getSharedInstance();
+  const int effect_count = 6;
+
+  int effect = 0;
+  if (mqtt->isSensorEnabled()) effect = 5;
+  else if (mqtt->isWeatherEnabled()) effect = 4;
+  else if (mqtt->isCircadianEnabled()) effect = 3;
+  else if (mqtt->isRainbowMultiEnabled()) effect = 2;
+  else if (mqtt->isRainbowEnabled()) effect = 1;
+
+  effect = (effect + (forward ? 1 : effect_count - 1)) % effect_count;
+
+  mqtt->setRainbowEnabled(effect == 1);
+  mqtt->setRainbowMultiEnabled(effect == 2);
+  mqtt->setCircadianEnabled(effect == 3);
+  mqtt->setWeatherEnabled(effect == 4);
+  mqtt->setSensorEnabled(effect == 5);
+}
+
+// MARK: Touch Calibration
+
+void HardwareService::resetTouchCalibration() {
+  uint8_t thresholds[TouchCalibrator::PAD_COUNT] = { 0x40, 0x40, 0x40 };
+  if (sensor_data.has_touch_sensor) {
+    touch_sensor.readThresholds(thresholds);
+  }
+  // begin() starts at 2x, the value calibrated for the SparkFun board
+  touch_calibrator.reset(TOUCH_CALIBRATION_PADS, SENSITIVITY_2X, thresholds);
+  touch_calibration_sampled_at = millis();
+  touch_calibrated_at = touch_calibration_sampled_at;
+  has_touch_calibration_update = false;
+}
+
+// Called from readSensors (I2C bus held). Samples the delta counts in one
+// transfer and adjusts the sensor every TOUCH_CALIBRATION_INTERVAL.
+void HardwareService::updateTouchCalibration(boolean left_touched, boolean right_touched) {
+  unsigned long now = millis();
+  if (now - touch_calibration_sampled_at < TOUCH_CALIBRATION_SAMPLE_INTERVAL) return;
+  touch_calibration_sampled_at = now;
+
+  int8_t deltas[TouchCalibrator::PAD_COUNT];
+  boolean touched[TouchCalibrator::PAD_COUNT] = { right_touched, false, left_touched };
+  touch_sensor.readDeltaCounts(deltas);
+  touch_calibrator.addSample(deltas, touched);
+
+  if (now - touch_calibrated_at < TOUCH_CALIBRATION_INTERVAL) return;
+  touch_calibrated_at = now;
+
+  uint8_t base_counts[TouchCalibrator::PAD_COUNT];
+  touch_sensor.readBaseCounts(base_counts);
+
+  if (touch_calibrator.calibrate(base_counts)) {
+    uint8_t thresholds[TouchCalibrator::PAD_COUNT];
+    memcpy(thresholds, touch_calibrator.getThresholds(), sizeof(thresholds));
+    touch_sensor.setSensitivity(touch_calibrator.getSensitivity());
+    touch_sensor.writeThresholds(thresholds);
+    Serial.println(PRINT_PREFIX + "Touch calibration: sensitivity " + String(touch_calibrator.getSensitivity()) +
+                   ", thresholds " + String(thresholds[0]) + "/" + String(thresholds[2]));
+  }
+  if (touch_calibrator.needsRecalibration()) {
+    touch_sensor.recalibrate(TOUCH_CALIBRATION_PADS);
+    Serial.println(PRINT_PREFIX + "Touch baseline drifted, re-calibrating.");
+  }
+  has_touch_calibration_update = true;
+}
+
+// MARK: Persistence
+
 void HardwareService::saveStateToNVS() {
   // Debounce: only mark as pending, actual save happens in loop()
   nvs_save_pending = true;
@@ -944,6 +1341,14 @@ void HardwareService::checkPendingNVSSave() {
   prefs.putBool("sensor", mqtt->isSensorEnabled());
   prefs.putBool("adapt_br", mqtt->isAdaptiveBrightnessEnabled());
 
+  // Save touch gestures
+  TouchGestureTimings timings = touch_gestures.getTimings();
+  prefs.putBytes("gestures", gesture_actions, sizeof(gesture_actions));
+  prefs.putUShort("g_long", timings.long_press);
+  prefs.putUShort("g_double", timings.double_tap);
+  prefs.putUShort("g_swipe", timings.swipe);
+  prefs.putBool("prox_mode", proximity_mode_enabled);
+
   prefs.end();
   Serial.println(PRINT_PREFIX + "State saved to NVS");
 }
@@ -981,8 +1386,21 @@ void HardwareService::loadStateFromNVS() {
   mqtt->setSensorEnabled(prefs.getBool("sensor", false));
   mqtt->setAdaptiveBrightnessEnabled(prefs.getBool("adapt_br", true));
 
+  // Load touch gestures
+  if (prefs.getBytesLength("gestures") == sizeof(gesture_actions)) {
+    prefs.getBytes("gestures", gesture_actions, sizeof(gesture_actions));
+  }
+  TouchGestureTimings timings;
+  timings.long_press = prefs.getUShort("g_long", TOUCH_LONG_PRESS_DURATION);
+  timings.double_tap = prefs.getUShort("g_double", TOUCH_DOUBLE_TAP_INTERVAL);
+  timings.swipe = prefs.getUShort("g_swipe", TOUCH_SWIPE_INTERVAL);
+  touch_gestures.setTimings(timings);
+  boolean proximity_mode = prefs.getBool("prox_mode", false);
+
   prefs.end();
 
+  setProximityModeEnabled(proximity_mode);
+
   Serial.println(PRINT_PREFIX + "State loaded from NVS:");
   Serial.println(PRINT_PREFIX + "  Color: R=" + String(configuration.color.red) +
                  " G=" + String(configuration.color.green) +
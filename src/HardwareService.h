@@ -12,6 +12,11 @@
 #include "RPR-0521RS.h"
 #include "SparkFun_CAP1203.h"
 #include "MotorLogic.h"
+#include "TouchGestureRecognizer.h"
+#include "AmbientLightCompensator.h"
+#include "ProximityGestureDetector.h"
+#include "TouchCalibrator.h"
+#include "DiagnosticsRecorder.h"
 
 // Forward declaration
 class MQTTService;
@@ -34,8 +39,41 @@ class HardwareService {
       return sensor_data;
     }
 
+    // Published by the control loop for other tasks (MQTT discovery), which
+    // must not copy sensor_data while it is being written
+    boolean hasLightSensor() {
+      return has_light_sensor;
+    }
+
+    boolean hasTouchSensor() {
+      return has_touch_sensor;
+    }
+
+    // Rendered frame, as last written by the control loop
+    const CRGB* getLEDs() {
+      return leds;
+    }
+
+    // 1.0f (open), 0.0f (closed)
+    float getMotorPosition() {
+      return 1 - ((float)(MotorLogic::getMotorPosition()) / (float)(32 * MOTOR_FULL_STEP_COUNT));
+    }
+
+    float getIntendedMotorPosition() {
+      return intended_motor_position;
+    }
+
+    boolean isMotorRunning() {
+      return MotorLogic::isRunning();
+    }
+
+    // External frames (RealtimeReceiver), the active effect resumes REALTIME_TIMEOUT after the last one
+    void showRealtimeFrame(const uint8_t* rgb);
+    void endRealtime();
+    boolean isRealtimeActive();
+
     void loop(const boolean has_active_connection, uint32_t count);
-    void setConfiguration(Configuration configuration);
+    boolean setConfiguration(Configuration configuration, boolean is_motor_commanded = false); // false if the motor keeps its position
     void readSensors();
     void updateMotor();
     boolean start();
@@ -43,6 +81,24 @@ class HardwareService {
     void saveStateToNVS();
     void loadStateFromNVS();
 
+    // Touch gestures
+    GestureAction getGestureAction(TouchGesture gesture);
+    void setGestureAction(TouchGesture gesture, GestureAction action);
+    TouchGestureTimings getGestureTimings();
+    void setGestureTimings(TouchGestureTimings timings);
+
+    // Proximity gestures
+    boolean isProximityModeEnabled() {
+      return proximity_mode_enabled;
+    }
+
+    void setProximityModeEnabled(boolean enabled);
+
+    // Touch calibration
+    TouchCalibrator getTouchCalibration() {
+      return touch_calibrator;
+    }
+
   protected:
 
   private:
@@ -59,24 +115,43 @@ class HardwareService {
 
     CRGB leds[LED_COUNT];
     RPR0521RS light_sensor = RPR0521RS();
+    AmbientLightCompensator light_compensator;
     CAP1203 touch_sensor = CAP1203(0x28);
     MotorLogic motor;
-    TaskHandle_t task;
+    TaskHandle_t proximity_task; // Created once, parked while the mode is off
+    SemaphoreHandle_t i2c_mutex;
+    QueueHandle_t proximity_events;
+    ProximityGestureDetector proximity_detector;
+    volatile boolean proximity_mode_enabled;
+
+    uint8_t light_sensor_range;
+    unsigned long light_sensor_range_changed_at;
+    volatile boolean has_light_sensor; // sensor_data's flags once the connection check is done
+    volatile boolean has_touch_sensor;
 
     float ambient_brightness;
     uint32_t light_measurement_count;
     uint32_t reopen_cycle_count;
     float intended_motor_position;
     boolean motor_calibration_finished;
-    uint16_t rgb_hue;
 
-    // Touch handling for manual mode
-    unsigned long touch_left_start;
-    unsigned long touch_right_start;
-    bool touch_left_was_pressed;
-    bool touch_right_was_pressed;
-    bool touch_left_long_triggered;
-    bool touch_right_long_triggered;
+    // Touch gestures
+    TouchGestureRecognizer touch_gestures;
+    GestureAction gesture_actions[GESTURE_COUNT];
+
+    // Touch calibration
+    TouchCalibrator touch_calibrator;
+    unsigned long touch_calibration_sampled_at;
+    unsigned long touch_calibrated_at;
+    volatile boolean has_touch_calibration_update;
+
+    // Diagnostics stream (ENABLE_DIAGNOSTICS)
+    DiagnosticsRecorder diagnostics;
+    uint16_t show_duration; // us, last FastLED.show
+
+    // Realtime frames, shown from the UDP task
+    SemaphoreHandle_t led_mutex;
+    volatile unsigned long realtime_frame_at; // 0 = none
 
     // Adaptive brightness
     unsigned long last_adaptive_brightness_update;
@@ -91,9 +166,18 @@ class HardwareService {
     void checkPendingNVSSave();
 
     void updateAdaptiveBrightness();
+    void handleGesture(TouchGesture gesture);
+    void cycleEffect(boolean forward);
+    void resetTouchCalibration();
+    void updateTouchCalibration(boolean left_touched, boolean right_touched);
+    void recordDiagnostics(unsigned long loop_started_at);
+    boolean updateLightSensorRange(uint32_t* raw_als);
+    uint8_t applyLightSensorRange(uint8_t range);
+    static void proximityTask(void* parameter);
     
     void move(float position, float speed);
     void writeLED(Color color);
+    void showLEDs();
 
 };
 
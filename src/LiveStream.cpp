@@ -0,0 +1,185 @@
+// MARK: Includes
+
+#include "LiveStream.h"
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[LIVE]: ";
+const uint8_t EVENT_QUEUE_LENGTH = 8;
+const char INTERVAL_PREFIX[] = "interval=";
+
+const uint8_t FLAG_MOTOR_RUNNING = 0x01;
+
+// MARK: Initialization
+
+LiveStream::LiveStream(const char* url) {
+  hardware_service = HardwareService::getSharedInstance();
+  client_events = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(LiveClientEvent));
+  memset(clients, 0, sizeof(clients));
+
+  socket = new AsyncWebSocket(url);
+  socket->onEvent([this](AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type,
+                         void* arg, uint8_t* data, size_t length) {
+    handleEvent(client, type, arg, data, length);
+  });
+}
+
+// MARK: Methods
+
+void LiveStream::loop() {
+  applyClientEvents();
+  if (client_count == 0) {
+    return;
+  }
+
+  unsigned long now = millis();
+  uint8_t frame[FRAME_LENGTH];
+  size_t length = 0;
+
+  for (LiveClient& live_client : clients) {
+    // Half a frame early, the control loop only runs once per frame
+    if ((live_client.id == 0) || (now - live_client.sent_at + ANIMATION_FRAME_DURATION / 2 < live_client.interval)) {
+      continue;
+    }
+
+    AsyncWebSocketClient* client = socket->client(live_client.id);
+    if (client == nullptr) {
+      // Gone, the disconnect event was lost
+      live_client.id = 0;
+      client_count--;
+      continue;
+    }
+
+    live_client.sent_at = now;
+    live_client.sequence++;
+    if ((client->status() != WS_CONNECTED) || client->queueIsFull()) {
+      dropped_frame_count++;
+      continue;
+    }
+
+    // Captured once per pass, clients only differ in the sequence number
+    if (length == 0) {
+      length = writeFrame(frame);
+    }
+    frame[2] = live_client.sequence & 0xFF;
+    frame[3] = live_client.sequence >> 8;
+    client->binary(frame, length);
+  }
+}
+
+// MARK: Helpers
+
+// AsyncTCP task
+void LiveStream::handleEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length) {
+  LiveClientEvent event = { type, client->id(), LIVE_STREAM_INTERVAL };
+
+  if (type == WS_EVT_DATA) {
+    AwsFrameInfo* info = (AwsFrameInfo*)arg;
+    if (!info->final || (info->index != 0) || (info->len != length) || (info->opcode != WS_TEXT)) {
+      return;
+    }
+    event.interval = parseInterval(data, length);
+    if (event.interval == 0) {
+      return;
+    }
+  } else if ((type != WS_EVT_CONNECT) && (type != WS_EVT_DISCONNECT)) {
+    return;
+  }
+
+  if ((xQueueSend(client_events, &event, 0) != pdTRUE) && (type == WS_EVT_CONNECT)) {
+    client->close();
+  }
+}
+
+void LiveStream::applyClientEvents() {
+  LiveClientEvent event;
+  while (xQueueReceive(client_events, &event, 0) == pdTRUE) {
+    LiveClient* live_client = findClient(event.client_id);
+
+    switch (event.type) {
+      case WS_EVT_CONNECT: {
+        live_client = findClient(0);
+        if (live_client == nullptr) {
+          AsyncWebSocketClient* client = socket->client(event.client_id);
+          if (client != nullptr) {
+            client->close();
+          }
+          Serial.println(PRINT_PREFIX + "Too many clients, closed " + String(event.client_id));
+          break;
+        }
+        live_client->id = event.client_id;
+        live_client->interval = event.interval;
+        live_client->sent_at = millis() - event.interval;
+        live_client->sequence = 0;
+        client_count++;
+        break;
+      }
+
+      case WS_EVT_DISCONNECT:
+        if (live_client != nullptr) {
+          live_client->id = 0;
+          client_count--;
+        }
+        break;
+
+      default:
+        if (live_client != nullptr) {
+          live_client->interval = event.interval;
+        }
+        break;
+    }
+  }
+}
+
+LiveStream::LiveClient* LiveStream::findClient(uint32_t id) {
+  for (LiveClient& live_client : clients) {
+    if (live_client.id == id) {
+      return &live_client;
+    }
+  }
+  return nullptr;
+}
+
+size_t LiveStream::writeFrame(uint8_t* frame) {
+  uint16_t motor_position = constrain(hardware_service->getMotorPosition(), 0.0f, 1.0f) * 65535;
+  uint16_t intended_motor_position = constrain(hardware_service->getIntendedMotorPosition(), 0.0f, 1.0f) * 65535;
+
+  frame[0] = SCHEMA_VERSION;
+  frame[1] = hardware_service->isMotorRunning() ? FLAG_MOTOR_RUNNING : 0;
+  frame[2] = 0; // Sequence number, per client
+  frame[3] = 0;
+  frame[4] = motor_position & 0xFF;
+  frame[5] = motor_position >> 8;
+  frame[6] = intended_motor_position & 0xFF;
+  frame[7] = intended_motor_position >> 8;
+  frame[8] = FastLED.getBrightness();
+  frame[9] = LED_COUNT;
+
+  const CRGB* leds = hardware_service->getLEDs();
+  for (uint8_t i = 0; i < LED_COUNT; i++) {
+    frame[10 + 3 * i] = leds[i].r;
+    frame[11 + 3 * i] = leds[i].g;
+    frame[12 + 3 * i] = leds[i].b;
+  }
+  return FRAME_LENGTH;
+}
+
+// "interval=<ms>", limited to what the control loop can deliver, 0 if invalid
+uint16_t LiveStream::parseInterval(const uint8_t* data, size_t length) {
+  char message[16];
+  if ((length >= sizeof(message)) || (length <= strlen(INTERVAL_PREFIX))) {
+    return 0;
+  }
+  memcpy(message, data, length);
+  message[length] = '\0';
+  if (strncmp(message, INTERVAL_PREFIX, strlen(INTERVAL_PREFIX)) != 0) {
+    return 0;
+  }
+
+  char* end;
+  unsigned long interval = strtoul(message + strlen(INTERVAL_PREFIX), &end, 10);
+  if (*end != '\0') {
+    return 0;
+  }
+  return constrain(interval, (unsigned long)ANIMATION_FRAME_DURATION, (unsigned long)LIVE_STREAM_MAX_INTERVAL);
+}
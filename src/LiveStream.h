@@ -0,0 +1,89 @@
+
+#ifndef LIVESTREAM_H_
+#define LIVESTREAM_H_
+
+// MARK: Includes
+
+#include <ESPAsyncWebServer.h>
+#include "HardwareService.h"
+#include "Settings.h"
+
+// Streams the rendered LED frame and the motor position to web UI clients
+// over a WebSocket (/live). Every frame is one binary message, little endian:
+//
+//   [0]     schema version (1)
+//   [1]     flags: 0x01 motor running
+//   [2-3]   sequence number, per client (gaps = dropped frames)
+//   [4-5]   motor position, 0 (closed) to 65535 (open)
+//   [6-7]   intended motor position, same scale
+//   [8]     global LED brightness (FastLED scales the colors with it)
+//   [9]     LED count n
+//   [10-]   n * (red, green, blue)
+//
+// Clients choose their rate by sending the text message "interval=<ms>"
+// (LIVE_STREAM_INTERVAL by default). A client whose send queue is full skips
+// the frame, the control loop never waits for the network. Without clients
+// nothing is captured.
+class LiveStream {
+
+  public:
+
+    // MARK: Constants
+
+    static const uint8_t SCHEMA_VERSION = 1;
+    static const size_t FRAME_LENGTH = 10 + 3 * LED_COUNT;
+
+    // MARK: Initialization
+
+    LiveStream(const char* url);
+
+    // MARK: Methods
+
+    AsyncWebSocket* getSocket() {
+      return socket;
+    }
+
+    uint32_t getDroppedFrameCount() {
+      return dropped_frame_count;
+    }
+
+    void loop(); // Control loop, after the frame was rendered
+
+  private:
+
+    // MARK: Types
+
+    struct LiveClient {
+      uint32_t id; // 0 = free
+      uint16_t interval; // ms
+      unsigned long sent_at;
+      uint16_t sequence; // Frames due for this client, sent or dropped
+    };
+
+    // Posted by the AsyncTCP task, the client table belongs to the control loop
+    struct LiveClientEvent {
+      AwsEventType type;
+      uint32_t client_id;
+      uint16_t interval;
+    };
+
+    // MARK: Properties
+
+    AsyncWebSocket* socket;
+    HardwareService* hardware_service;
+    QueueHandle_t client_events;
+    LiveClient clients[LIVE_STREAM_MAX_CLIENTS];
+    uint8_t client_count = 0;
+    uint32_t dropped_frame_count = 0;
+
+    // MARK: Helpers
+
+    void handleEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length);
+    void applyClientEvents();
+    LiveClient* findClient(uint32_t id);
+    size_t writeFrame(uint8_t* frame);
+    static uint16_t parseInterval(const uint8_t* data, size_t length);
+
+};
+
+#endif
@@ -1,18 +1,90 @@
 
 #include "MQTTService.h"
 #include "HardwareService.h"
+#include "DiscoveryPayloads.h"
+#include "AnimationClock.h"
+#include "CommandQueue.h"
+#include "Metrics.h"
+#include "FirmwareUpdater.h"
+#include <Preferences.h>
 
 const String PRINT_PREFIX = "[MQTT]: ";
 const unsigned long RECONNECT_INTERVAL = 5000;
-const unsigned long SENSOR_PUBLISH_INTERVAL = 5000;
+const unsigned long TEMPERATURE_READ_INTERVAL = 1000;
+
+// Order of TelemetryChannel
+const TelemetryPolicy TELEMETRY_POLICIES[TELEMETRY_CHANNEL_COUNT] = {
+  // absolute, relative, min interval, max interval
+  { 0.5f, 0.0f, 1000, 300000 },  // illuminance [%]
+  { 1.0f, 0.05f, 1000, 300000 }, // illuminance [lx]
+  { 2.0f, 0.0f, 500, 300000 },   // proximity [%]
+  { 0.5f, 0.0f, 0, 300000 },     // touch left, binary: every change right away
+  { 0.5f, 0.0f, 0, 300000 },     // touch right
+  { 0.5f, 0.0f, 10000, 300000 }, // temperature [°C]
+  { 1.0f, 0.0f, 0, 300000 },     // cover position [%]
+};
+// Order of TelemetryChannel, names of replayed samples
+const char* TELEMETRY_CHANNEL_NAMES[TELEMETRY_CHANNEL_COUNT] = {
+  "illuminance", "illuminance_lux", "proximity", "touch_left", "touch_right", "temperature", "position"
+};
+const time_t MIN_VALID_TIME = 1700000000; // Clock not synced via NTP before
+const size_t MAX_TOPIC_LENGTH = 128;
+const unsigned long MQTT_TASK_POLL_INTERVAL = 20; // ms between socket polls while idle
+const uint8_t OUTGOING_QUEUE_LENGTH = 16; // Fixed slots, ~15 KB
+const uint8_t INCOMING_QUEUE_LENGTH = 8;
+const unsigned long DISCOVERY_VERIFICATION_TIMEOUT = 2000; // ms to wait for retained configs
+const char* DISCOVERY_HASH_NAMESPACE = "discovery";
+const char* LEGACY_DISCOVERY_CLEARED_KEY = "legacy_cleared";
+
+static_assert(sizeof(GESTURE_TRIGGER_DISCOVERY) / sizeof(DiscoveryConfig) == GESTURE_COUNT, "One trigger per TouchGesture");
+static_assert(sizeof(PROXIMITY_TRIGGER_DISCOVERY) / sizeof(DiscoveryConfig) == PROXIMITY_GESTURE_COUNT, "One trigger per ProximityGesture");
 
 MQTTService* mqtt_shared_instance = nullptr;
 
+// Topics below the device or the group topic, both dispatch the same way.
+// Firmware updates and configuration changes (including the gesture actions
+// saved to NVS, proximity mode and the diagnostics stream) are only taken on
+// the device topic, a single group message must not reflash or reconfigure
+// the fleet.
+#define COMMAND_ROUTE(topic, handler) { topic, hashTopic(topic), &MQTTService::handler, true }
+#define DEVICE_COMMAND_ROUTE(topic, handler) { topic, hashTopic(topic), &MQTTService::handler, false }
+
+const MQTTService::CommandRoute MQTTService::COMMAND_ROUTES[] = {
+  COMMAND_ROUTE("/light/set", handleLightCommand),
+  COMMAND_ROUTE("/cover/set", handleCoverCommand),
+  COMMAND_ROUTE("/cover/set_position", handleCoverPositionCommand),
+  COMMAND_ROUTE("/select/mode/set", handleModeCommand),
+  COMMAND_ROUTE("/switch/adaptive_brightness/set", handleAdaptiveBrightnessCommand),
+  COMMAND_ROUTE("/weather/state", handleWeatherStateCommand),
+  COMMAND_ROUTE("/weather/temperature", handleWeatherTemperatureCommand),
+  DEVICE_COMMAND_ROUTE("/gesture/set", handleGestureCommand),
+  DEVICE_COMMAND_ROUTE("/switch/proximity_mode/set", handleProximityModeCommand),
+  DEVICE_COMMAND_ROUTE("/diagnostics/set", handleDiagnosticsCommand),
+  DEVICE_COMMAND_ROUTE("/configuration/set", handleConfigurationCommand),
+  DEVICE_COMMAND_ROUTE("/ota/set", handleFirmwareCommand),
+};
+const uint8_t MQTTService::COMMAND_ROUTE_COUNT = sizeof(COMMAND_ROUTES) / sizeof(CommandRoute);
+
 // MARK: Initialization
 
 MQTTService::MQTTService() : mqtt_client(wifi_client) {
+  // Last 3 bytes of the MAC address, unless set in Settings.h
+  if (strlen(MQTT_DEVICE_ID) > 0) {
+    strlcpy(device_id, MQTT_DEVICE_ID, sizeof(device_id));
+  } else {
+    uint64_t mac = ESP.getEfuseMac();
+    snprintf(device_id, sizeof(device_id), "%02x%02x%02x",
+             (uint8_t)(mac >> 24), (uint8_t)(mac >> 32), (uint8_t)(mac >> 40));
+  }
+  expandDeviceId(MQTT_DEVICE_TOPIC, device_topic, sizeof(device_topic));
+  snprintf(client_id, sizeof(client_id), "%s_%s", MQTT_CLIENT_ID, device_id);
   last_reconnect_attempt = 0;
-  last_sensor_publish = 0;
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    telemetry[i] = { 0, 0, false };
+  }
+  published_weather[0] = '\0';
+  temperature = 0;
+  temperature_read_at = 0;
   rainbow_enabled = false;
   rainbow_multi_enabled = true;
   circadian_enabled = false;
@@ -20,12 +92,25 @@ MQTTService::MQTTService() : mqtt_client(wifi_client) {
   sensor_enabled = false;
   light_on = true;
   adaptive_brightness_enabled = true;  // Default: ON
+  diagnostics_enabled = false;
   brightness = 255;
   last_has_light_sensor = false;
   last_has_touch_sensor = false;
+  mqtt_task = nullptr;
+  outgoing_messages = nullptr;
+  incoming_messages = nullptr;
+  is_connected = false;
+  has_connected = false;
+  pending_discovery_count = 0;
+  is_verifying_discovery = false;
+  discovery_verification_started_at = 0;
+  has_discovery_request = false;
+  scheduled_light_command_length = 0;
+  scheduled_light_command_at = 0;
+  clock_published_at = 0;
   circadian_hour = 12;
   circadian_preview_hour = -1;  // -1 = use real time
-  weather_state = "sunny";
+  strlcpy(weather_state, "sunny", sizeof(weather_state));
   weather_temperature = 20.0f;
 }
 
@@ -45,57 +130,180 @@ void MQTTService::setup() {
   mqtt_client.setCallback(messageCallback);
   mqtt_client.setBufferSize(1024);
 
-  Serial.println(PRINT_PREFIX + "Configured for broker: " + MQTT_BROKER);
+  outgoing_messages = xQueueCreate(OUTGOING_QUEUE_LENGTH, sizeof(MQTTMessage));
+  incoming_messages = xQueueCreate(INCOMING_QUEUE_LENGTH, sizeof(MQTTCommand));
+#if ENABLE_TELEMETRY_BUFFER
+  telemetry_buffer.begin();
+#endif
+  xTaskCreatePinnedToCore(mqttTask, "mqtt", 8192, this, 1, &mqtt_task, 0);
+
+  Serial.println(PRINT_PREFIX + "Configured for broker: " + MQTT_BROKER + ", topic: " + device_topic);
 }
 
+// Control loop side: handle received commands and queue changed states
 void MQTTService::loop() {
-  if (!mqtt_client.connected()) {
-    unsigned long now = millis();
-    if (now - last_reconnect_attempt > RECONNECT_INTERVAL) {
-      last_reconnect_attempt = now;
-      reconnect();
-    }
-  } else {
-    mqtt_client.loop();
-
-    // Check for sensor hot-plug changes
-    HardwareService* hw = HardwareService::getSharedInstance();
-    SensorData data = hw->getSensorData();
-
-    if (data.has_light_sensor != last_has_light_sensor) {
-      if (data.has_light_sensor) {
-        sendBrightnessSensorDiscovery();
-        sendDistanceSensorDiscovery();
-      } else {
-        removeBrightnessSensorDiscovery();
-        removeDistanceSensorDiscovery();
-      }
-      last_has_light_sensor = data.has_light_sensor;
-    }
+  MQTTCommand command;
+  while (xQueueReceive(incoming_messages, &command, 0) == pdTRUE) {
+    handleCommand(command);
+  }
+
+  // Scheduled scene reached its frame
+  if ((scheduled_light_command_at > 0) &&
+      (AnimationClock::getSharedInstance()->getEpochTime() >= scheduled_light_command_at)) {
+    scheduled_light_command_at = 0;
+    command_allocator.reset();
+    handleLightCommand(scheduled_light_command, scheduled_light_command_length);
+  }
+
+  if (!is_connected) {
+#if ENABLE_TELEMETRY_BUFFER
+    bufferSensorStates();
+#endif
+    return;
+  }
+
+  if (has_connected) {
+    has_connected = false;
+    publishInitialStates();
+  }
+
+  // Publish sensor states that changed or are due for a heartbeat
+  publishSensorStates(false);
+
+  if (millis() - clock_published_at >= ANIMATION_CLOCK_REPORT_INTERVAL) {
+    clock_published_at = millis();
+    publishClockState();
+  }
+#if ENABLE_TELEMETRY_BUFFER
+  replayBufferedTelemetry();
+#endif
+}
 
-    if (data.has_touch_sensor != last_has_touch_sensor) {
-      if (data.has_touch_sensor) {
-        sendTouchLeftDiscovery();
-        sendTouchRightDiscovery();
-      } else {
-        removeTouchLeftDiscovery();
-        removeTouchRightDiscovery();
+bool MQTTService::isConnected() {
+  return is_connected;
+}
+
+// MARK: MQTT Task
+
+void MQTTService::mqttTask(void* parameter) {
+  MQTTService* mqtt = (MQTTService*)parameter;
+  MQTTMessage message;
+
+  for (;;) {
+    if (!mqtt->mqtt_client.connected()) {
+      mqtt->is_connected = false;
+
+      // Nothing queued while offline is sent later
+      xQueueReset(mqtt->outgoing_messages);
+
+      unsigned long now = millis();
+      if (now - mqtt->last_reconnect_attempt > RECONNECT_INTERVAL) {
+        mqtt->last_reconnect_attempt = now;
+        unsigned long reconnect_started_at = micros();
+        mqtt->reconnect(); // Blocks for the TCP timeout if the broker is down
+        Metrics::getSharedInstance()->observe(METRIC_MQTT_RECONNECT, micros() - reconnect_started_at);
+        if (!mqtt->is_connected) {
+          Metrics::getSharedInstance()->countReconnectFailure();
+        }
       }
-      last_has_touch_sensor = data.has_touch_sensor;
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
     }
 
-    // Publish sensor states periodically
-    unsigned long now = millis();
-    if (now - last_sensor_publish > SENSOR_PUBLISH_INTERVAL) {
-      last_sensor_publish = now;
-      publishSensorStates();
-      publishCoverState();
+    mqtt->mqtt_client.loop();
+    mqtt->checkDiscoveryVerification();
+    mqtt->checkSensorDiscovery();
+
+    // Sleep until something is queued, but keep the socket polled
+    if (xQueueReceive(mqtt->outgoing_messages, &message, pdMS_TO_TICKS(MQTT_TASK_POLL_INTERVAL)) == pdTRUE) {
+      do {
+        unsigned long publish_started_at = micros();
+        mqtt->mqtt_client.publish(message.topic, message.payload, message.length, message.retained);
+        Metrics::getSharedInstance()->observe(METRIC_MQTT_PUBLISH, micros() - publish_started_at);
+      } while (xQueueReceive(mqtt->outgoing_messages, &message, 0) == pdTRUE);
     }
   }
 }
 
-bool MQTTService::isConnected() {
-  return mqtt_client.connected();
+// Publishes directly on the MQTT task, otherwise queues a copy. A full
+// queue drops the message instead of stalling the control loop.
+bool MQTTService::publish(const char* topic, const char* payload, bool retained) {
+  return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
+}
+
+bool MQTTService::publish(const char* topic, const uint8_t* payload, size_t length, bool retained) {
+  char expanded_topic[MAX_TOPIC_LENGTH];
+  expandDeviceId(topic, expanded_topic, sizeof(expanded_topic));
+
+  if (xTaskGetCurrentTaskHandle() == mqtt_task) {
+    unsigned long publish_started_at = micros();
+    bool is_published = mqtt_client.publish(expanded_topic, payload, length, retained);
+    Metrics::getSharedInstance()->observe(METRIC_MQTT_PUBLISH, micros() - publish_started_at);
+    return is_published;
+  }
+  if (!is_connected) return false;
+
+  if ((strlen(expanded_topic) >= MQTT_MESSAGE_TOPIC_SIZE) || (length > MQTT_MESSAGE_PAYLOAD_SIZE)) {
+    Serial.println(PRINT_PREFIX + "Message too large, dropped: " + expanded_topic + " (" + String(length) + " bytes)");
+    return false;
+  }
+
+  MQTTMessage message;
+  message.retained = retained;
+  message.length = length;
+  strlcpy(message.topic, expanded_topic, sizeof(message.topic));
+  memcpy(message.payload, payload, length);
+  return xQueueSend(outgoing_messages, &message, 0) == pdTRUE;
+}
+
+// Copies text with MQTT_DEVICE_ID_PLACEHOLDER replaced by the device ID
+void MQTTService::expandDeviceId(const char* text, char* buffer, size_t size) {
+  size_t length = 0;
+  const char* segment = text;
+  const char* placeholder;
+  while (((placeholder = strstr(segment, MQTT_DEVICE_ID_PLACEHOLDER)) != nullptr) && (length < size)) {
+    length += snprintf(buffer + length, size - length, "%.*s%s", (int)(placeholder - segment), segment, device_id);
+    segment = placeholder + strlen(MQTT_DEVICE_ID_PLACEHOLDER);
+  }
+  if (length < size) {
+    strlcpy(buffer + length, segment, size - length);
+  }
+}
+
+// Runs on the MQTT task
+void MQTTService::checkSensorDiscovery() {
+  // MQTT task: only the flags, not a copy of the sensor data
+  HardwareService* hw = HardwareService::getSharedInstance();
+  boolean has_light_sensor = hw->hasLightSensor();
+  boolean has_touch_sensor = hw->hasTouchSensor();
+
+  if (has_light_sensor != last_has_light_sensor) {
+    if (has_light_sensor) {
+      sendBrightnessSensorDiscovery();
+      sendLuxSensorDiscovery();
+      sendDistanceSensorDiscovery();
+      sendProximityGestureDiscovery();
+    } else {
+      removeBrightnessSensorDiscovery();
+      removeLuxSensorDiscovery();
+      removeDistanceSensorDiscovery();
+      removeProximityGestureDiscovery();
+    }
+    last_has_light_sensor = has_light_sensor;
+  }
+
+  if (has_touch_sensor != last_has_touch_sensor) {
+    if (has_touch_sensor) {
+      sendTouchLeftDiscovery();
+      sendTouchRightDiscovery();
+      sendGestureTriggerDiscovery();
+    } else {
+      removeTouchLeftDiscovery();
+      removeTouchRightDiscovery();
+      removeGestureTriggerDiscovery();
+    }
+    last_has_touch_sensor = has_touch_sensor;
+  }
 }
 
 // MARK: Connection
@@ -103,30 +311,39 @@ bool MQTTService::isConnected() {
 void MQTTService::reconnect() {
   Serial.println(PRINT_PREFIX + "Attempting connection...");
 
-  if (mqtt_client.connect(MQTT_CLIENT_ID, MQTT_USER, MQTT_PASSWORD)) {
+  if (mqtt_client.connect(client_id, MQTT_USER, MQTT_PASSWORD)) {
     Serial.println(PRINT_PREFIX + "Connected!");
     subscribeTopics();
+    clearLegacyDiscovery();
+    beginDiscoveryVerification();
     sendDiscoveryAll();
 
-    // Publish initial states
-    publishLightState();
-    publishCoverState();
-    publishModeState();
-    publishAdaptiveBrightnessState();
-    publishSensorStates();
+    // States belong to the control loop, it publishes them on the next pass
+    is_connected = true;
+    has_connected = true;
   } else {
     Serial.println(PRINT_PREFIX + "Failed, rc=" + String(mqtt_client.state()));
   }
 }
 
+void MQTTService::publishInitialStates() {
+  publishLightState();
+  publishCoverState();
+  publishModeState();
+  publishAdaptiveBrightnessState();
+  publishGestureConfig();
+  publishProximityModeState();
+  publishSensorStates(true);
+}
+
 void MQTTService::subscribeTopics() {
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/light/set");
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/cover/set");
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/cover/set_position");
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/select/mode/set");
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/switch/adaptive_brightness/set");
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/weather/state");
-  mqtt_client.subscribe(MQTT_BASE_TOPIC "/weather/temperature");
+  char topic[MAX_TOPIC_LENGTH];
+  for (uint8_t i = 0; i < COMMAND_ROUTE_COUNT; i++) {
+    snprintf(topic, sizeof(topic), "%s%s", device_topic, COMMAND_ROUTES[i].topic);
+    mqtt_client.subscribe(topic);
+  }
+  mqtt_client.subscribe(MQTT_GROUP_TOPIC "/#");
+  mqtt_client.subscribe(MQTT_DISCOVERY_PREFIX "/status");
 
   Serial.println(PRINT_PREFIX + "Subscribed to command topics");
 }
@@ -146,256 +363,326 @@ void MQTTService::sendDiscoveryAll() {
 
   if (data.has_light_sensor) {
     sendBrightnessSensorDiscovery();
+    sendLuxSensorDiscovery();
     sendDistanceSensorDiscovery();
+    sendProximityGestureDiscovery();
     last_has_light_sensor = true;
   }
 
   if (data.has_touch_sensor) {
     sendTouchLeftDiscovery();
     sendTouchRightDiscovery();
+    sendGestureTriggerDiscovery();
     last_has_touch_sensor = true;
   }
 }
 
 void MQTTService::sendLightDiscovery() {
-  JsonDocument doc;
-
-  doc["name"] = "Bionic Flower Light";
-  doc["unique_id"] = "bionic_flower_light";
-  doc["command_topic"] = MQTT_BASE_TOPIC "/light/set";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/light/state";
-  doc["schema"] = "json";
-  doc["brightness"] = true;
-  doc["effect"] = true;
-
-  JsonArray color_modes = doc["supported_color_modes"].to<JsonArray>();
-  color_modes.add("rgb");
-
-  JsonArray effects = doc["effect_list"].to<JsonArray>();
-  effects.add("None");
-  effects.add("Rainbow");
-  effects.add("Rainbow Multi");
-  effects.add("Circadian");
-  effects.add("Weather");
-  effects.add("Sensor");
-
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
-  device["name"] = "Bionic Flower";
-  device["model"] = "ESP32 Bionic Flower";
-  device["manufacturer"] = "DIY";
-
-  char buffer[1024];
-  serializeJson(doc, buffer);
-
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/light/bionic_flower/light/config", buffer, true);
+  publishDiscovery(LIGHT_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Sent light discovery");
 }
 
 void MQTTService::sendCoverDiscovery() {
-  JsonDocument doc;
-
-  doc["name"] = "Bionic Flower Cover";
-  doc["unique_id"] = "bionic_flower_cover";
-  doc["command_topic"] = MQTT_BASE_TOPIC "/cover/set";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/cover/state";
-  doc["position_topic"] = MQTT_BASE_TOPIC "/cover/position";
-  doc["set_position_topic"] = MQTT_BASE_TOPIC "/cover/set_position";
-  doc["device_class"] = "shade";
-  doc["position_open"] = 100;
-  doc["position_closed"] = 0;
-
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
-
-  char buffer[512];
-  serializeJson(doc, buffer);
-
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/cover/bionic_flower/cover/config", buffer, true);
+  publishDiscovery(COVER_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Sent cover discovery");
 }
 
 void MQTTService::sendModeDiscovery() {
-  JsonDocument doc;
-
-  doc["name"] = "Bionic Flower Mode";
-  doc["unique_id"] = "bionic_flower_mode";
-  doc["command_topic"] = MQTT_BASE_TOPIC "/select/mode/set";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/select/mode/state";
-
-  JsonArray options = doc["options"].to<JsonArray>();
-  options.add("Manual");
-  options.add("Automatic");
-
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
-
-  char buffer[512];
-  serializeJson(doc, buffer);
-
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/select/bionic_flower/mode/config", buffer, true);
+  publishDiscovery(MODE_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Sent mode discovery");
 }
 
 void MQTTService::sendAdaptiveBrightnessDiscovery() {
-  JsonDocument doc;
-
-  doc["name"] = "Bionic Flower Adaptive Brightness";
-  doc["unique_id"] = "bionic_flower_adaptive_brightness";
-  doc["command_topic"] = MQTT_BASE_TOPIC "/switch/adaptive_brightness/set";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/switch/adaptive_brightness/state";
-  doc["icon"] = "mdi:brightness-auto";
-
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
-
-  char buffer[512];
-  serializeJson(doc, buffer);
-
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/switch/bionic_flower/adaptive_brightness/config", buffer, true);
+  publishDiscovery(ADAPTIVE_BRIGHTNESS_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Sent adaptive brightness discovery");
 }
 
 void MQTTService::sendBrightnessSensorDiscovery() {
-  JsonDocument doc;
-
-  doc["name"] = "Bionic Flower Illuminance";
-  doc["unique_id"] = "bionic_flower_illuminance";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/sensor/illuminance";
-  doc["unit_of_measurement"] = "%";
-  doc["value_template"] = "{{ value | round(1) }}";
-  doc["icon"] = "mdi:brightness-percent";
-
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
-
-  char buffer[512];
-  serializeJson(doc, buffer);
-
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/sensor/bionic_flower/illuminance/config", buffer, true);
+  publishDiscovery(BRIGHTNESS_SENSOR_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Sent illuminance sensor discovery");
 }
 
+void MQTTService::sendLuxSensorDiscovery() {
+  publishDiscovery(LUX_SENSOR_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Sent illuminance lux sensor discovery");
+}
+
 void MQTTService::sendDistanceSensorDiscovery() {
-  JsonDocument doc;
+  publishDiscovery(DISTANCE_SENSOR_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Sent proximity sensor discovery");
+}
 
-  doc["name"] = "Bionic Flower Proximity";
-  doc["unique_id"] = "bionic_flower_proximity";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/sensor/proximity";
-  doc["unit_of_measurement"] = "%";
-  doc["value_template"] = "{{ value | round(1) }}";
-  doc["icon"] = "mdi:signal-distance-variant";
+void MQTTService::sendTouchLeftDiscovery() {
+  publishDiscovery(TOUCH_LEFT_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Sent touch left discovery");
+}
 
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
+void MQTTService::sendTouchRightDiscovery() {
+  publishDiscovery(TOUCH_RIGHT_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Sent touch right discovery");
+}
 
-  char buffer[512];
-  serializeJson(doc, buffer);
+void MQTTService::sendTemperatureDiscovery() {
+  publishDiscovery(TEMPERATURE_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Sent temperature sensor discovery");
+}
 
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/sensor/bionic_flower/proximity/config", buffer, true);
-  Serial.println(PRINT_PREFIX + "Sent proximity sensor discovery");
+void MQTTService::sendWeatherStateSensorDiscovery() {
+  publishDiscovery(WEATHER_STATE_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Sent weather state sensor discovery");
 }
 
-void MQTTService::sendTouchLeftDiscovery() {
-  JsonDocument doc;
+void MQTTService::sendGestureTriggerDiscovery() {
+  for (uint8_t i = 0; i < GESTURE_COUNT; i++) {
+    publishDiscovery(GESTURE_TRIGGER_DISCOVERY[i]);
+  }
+  Serial.println(PRINT_PREFIX + "Sent gesture trigger discovery");
+}
 
-  doc["name"] = "Bionic Flower Touch Left";
-  doc["unique_id"] = "bionic_flower_touch_left";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/binary_sensor/touch_left";
-  doc["device_class"] = "occupancy";
-  doc["payload_on"] = "ON";
-  doc["payload_off"] = "OFF";
+void MQTTService::sendProximityGestureDiscovery() {
+  publishDiscovery(PROXIMITY_MODE_DISCOVERY);
+  for (uint8_t i = 0; i < PROXIMITY_GESTURE_COUNT; i++) {
+    publishDiscovery(PROXIMITY_TRIGGER_DISCOVERY[i]);
+  }
+  Serial.println(PRINT_PREFIX + "Sent proximity gesture discovery");
+}
 
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
+// Sends a config right away if its hash differs from the one stored in NVS,
+// otherwise lets the broker's retained copy decide. Runs on the MQTT task.
+void MQTTService::publishDiscovery(const DiscoveryConfig& config) {
+  if (is_verifying_discovery && (pending_discovery_count < MAX_PENDING_DISCOVERY)) {
+    Preferences prefs;
+    prefs.begin(DISCOVERY_HASH_NAMESPACE, true);
+    char key[16];
+    getDiscoveryHashKey(config, key, sizeof(key));
+    uint32_t stored_hash = prefs.getUInt(key, 0);
+    prefs.end();
+
+    uint32_t hash;
+    writeDiscoveryPayload(config, &hash, false);
+    if (stored_hash == hash) {
+      pending_discovery[pending_discovery_count++] = &config;
+      return;
+    }
+  }
+  sendDiscoveryPayload(config);
+}
 
-  char buffer[512];
-  serializeJson(doc, buffer);
+// Streams the payload from flash, PubSubClient only buffers the header
+void MQTTService::sendDiscoveryPayload(const DiscoveryConfig& config) {
+  char topic[MAX_TOPIC_LENGTH];
+  expandDeviceId(config.topic, topic, sizeof(topic));
+  uint32_t hash;
+  size_t length = writeDiscoveryPayload(config, &hash, false);
+  if (!mqtt_client.beginPublish(topic, length, true)) return;
+  writeDiscoveryPayload(config, &hash, true);
+  if (!mqtt_client.endPublish()) return;
+
+  Preferences prefs;
+  prefs.begin(DISCOVERY_HASH_NAMESPACE, false);
+  char key[16];
+  getDiscoveryHashKey(config, key, sizeof(key));
+  if (prefs.getUInt(key, 0) != hash) {
+    prefs.putUInt(key, hash);
+  }
+  prefs.end();
+}
 
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/binary_sensor/bionic_flower/touch_left/config", buffer, true);
-  Serial.println(PRINT_PREFIX + "Sent touch left discovery");
+// Payload with the device ID filled in, segment by segment: returns the
+// length and hash, and writes it to the client if is_writing
+size_t MQTTService::writeDiscoveryPayload(const DiscoveryConfig& config, uint32_t* hash, bool is_writing) {
+  size_t length = 0;
+  size_t device_id_length = strlen(device_id);
+  const char* segment = config.payload;
+  *hash = hashDiscovery(nullptr, 0);
+  for (;;) {
+    const char* placeholder = strstr(segment, MQTT_DEVICE_ID_PLACEHOLDER);
+    size_t segment_length = (placeholder != nullptr) ? (size_t)(placeholder - segment) : strlen(segment);
+    *hash = hashDiscovery(segment, segment_length, *hash);
+    length += segment_length;
+    if (is_writing) {
+      mqtt_client.write((const uint8_t*)segment, segment_length);
+    }
+    if (placeholder == nullptr) break;
+
+    *hash = hashDiscovery(device_id, device_id_length, *hash);
+    length += device_id_length;
+    if (is_writing) {
+      mqtt_client.write((const uint8_t*)device_id, device_id_length);
+    }
+    segment = placeholder + strlen(MQTT_DEVICE_ID_PLACEHOLDER);
+  }
+  return length;
 }
 
-void MQTTService::sendTouchRightDiscovery() {
-  JsonDocument doc;
+// One-shot subscription to our own retained configs
+void MQTTService::beginDiscoveryVerification() {
+  char wildcard[MAX_TOPIC_LENGTH];
+  expandDeviceId(DISCOVERY_WILDCARD, wildcard, sizeof(wildcard));
+  pending_discovery_count = 0;
+  is_verifying_discovery = mqtt_client.subscribe(wildcard);
+  discovery_verification_started_at = millis();
+  has_discovery_request = false;
+}
 
-  doc["name"] = "Bionic Flower Touch Right";
-  doc["unique_id"] = "bionic_flower_touch_right";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/binary_sensor/touch_right";
-  doc["device_class"] = "occupancy";
-  doc["payload_on"] = "ON";
-  doc["payload_off"] = "OFF";
+void MQTTService::checkDiscoveryVerification() {
+  if (has_discovery_request) {
+    has_discovery_request = false;
+    Serial.println(PRINT_PREFIX + "Home Assistant restarted, sending discovery");
+    is_verifying_discovery = false;
+    pending_discovery_count = 0;
+    sendDiscoveryAll();
+    return;
+  }
 
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
+  if (!is_verifying_discovery) return;
+  if (millis() - discovery_verification_started_at < DISCOVERY_VERIFICATION_TIMEOUT) return;
 
-  char buffer[512];
-  serializeJson(doc, buffer);
+  is_verifying_discovery = false;
+  char wildcard[MAX_TOPIC_LENGTH];
+  expandDeviceId(DISCOVERY_WILDCARD, wildcard, sizeof(wildcard));
+  mqtt_client.unsubscribe(wildcard);
 
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/binary_sensor/bionic_flower/touch_right/config", buffer, true);
-  Serial.println(PRINT_PREFIX + "Sent touch right discovery");
+  // Missing or different on the broker
+  uint8_t sent_count = 0;
+  for (uint8_t i = 0; i < pending_discovery_count; i++) {
+    if (pending_discovery[i] != nullptr) {
+      sendDiscoveryPayload(*pending_discovery[i]);
+      sent_count++;
+    }
+  }
+  Serial.println(PRINT_PREFIX + "Discovery verified, re-sent " + String(sent_count) + " of " + String(pending_discovery_count) + " unchanged configs");
+  pending_discovery_count = 0;
 }
 
-void MQTTService::sendTemperatureDiscovery() {
-  JsonDocument doc;
-
-  doc["name"] = "Bionic Flower Temperature";
-  doc["unique_id"] = "bionic_flower_temperature";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/sensor/temperature";
-  doc["device_class"] = "temperature";
-  doc["unit_of_measurement"] = "°C";
-  doc["value_template"] = "{{ value | round(1) }}";
+// Runs on the MQTT task, inside mqtt_client.loop()
+void MQTTService::handleDiscoveryMessage(const char* topic, const byte* payload, unsigned int length) {
+  if (strcmp(topic, MQTT_DISCOVERY_PREFIX "/status") == 0) {
+    // Birth messages may be retained, the verification already covers those
+    if (!is_verifying_discovery && (length == 6) && (memcmp(payload, "online", 6) == 0)) {
+      has_discovery_request = true;
+    }
+    return;
+  }
 
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
+  if (!is_verifying_discovery) return;
 
-  char buffer[512];
-  serializeJson(doc, buffer);
+  uint32_t hash = hashDiscovery((const char*)payload, length);
+  char config_topic[MAX_TOPIC_LENGTH];
+  for (uint8_t i = 0; i < pending_discovery_count; i++) {
+    const DiscoveryConfig* config = pending_discovery[i];
+    if (config == nullptr) continue;
 
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/sensor/bionic_flower/temperature/config", buffer, true);
-  Serial.println(PRINT_PREFIX + "Sent temperature sensor discovery");
+    expandDeviceId(config->topic, config_topic, sizeof(config_topic));
+    uint32_t config_hash;
+    writeDiscoveryPayload(*config, &config_hash, false);
+    if ((strcmp(topic, config_topic) == 0) && (hash == config_hash)) {
+      pending_discovery[i] = nullptr;
+    }
+  }
 }
 
-void MQTTService::sendWeatherStateSensorDiscovery() {
-  JsonDocument doc;
+// Clears the retained config and forgets its hash, so it is sent right
+// away once the sensor is back
+void MQTTService::removeDiscovery(const DiscoveryConfig& config) {
+  for (uint8_t i = 0; i < pending_discovery_count; i++) {
+    if (pending_discovery[i] == &config) {
+      pending_discovery[i] = nullptr;
+    }
+  }
+  publish(config.topic, "", true);
+
+  Preferences prefs;
+  prefs.begin(DISCOVERY_HASH_NAMESPACE, false);
+  char key[16];
+  getDiscoveryHashKey(config, key, sizeof(key));
+  prefs.remove(key);
+  prefs.end();
+}
 
-  doc["name"] = "Bionic Flower Weather";
-  doc["unique_id"] = "bionic_flower_weather";
-  doc["state_topic"] = MQTT_BASE_TOPIC "/sensor/weather";
-  doc["icon"] = "mdi:weather-partly-cloudy";
+// FNV-1a, hash continues a previous one
+uint32_t MQTTService::hashDiscovery(const char* data, size_t length, uint32_t hash) {
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)data[i]) * 16777619u;
+  }
+  return hash;
+}
 
-  JsonObject device = doc["device"].to<JsonObject>();
-  device["identifiers"][0] = "bionic_flower";
+// NVS keys are limited to 15 characters, the topic hash identifies the config
+void MQTTService::getDiscoveryHashKey(const DiscoveryConfig& config, char* key, size_t size) {
+  snprintf(key, size, "%08x", (unsigned int)hashDiscovery(config.topic, strlen(config.topic)));
+}
 
-  char buffer[512];
-  serializeJson(doc, buffer);
+// Firmware before the per-flower namespace published its configs to shared
+// topics. Their retained copies are cleared once, on the first connect after
+// the upgrade; the flag is only stored when every topic was cleared.
+void MQTTService::clearLegacyDiscovery() {
+  Preferences prefs;
+  prefs.begin(DISCOVERY_HASH_NAMESPACE, false);
+  if (prefs.getBool(LEGACY_DISCOVERY_CLEARED_KEY, false)) {
+    prefs.end();
+    return;
+  }
 
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/sensor/bionic_flower/weather/config", buffer, true);
-  Serial.println(PRINT_PREFIX + "Sent weather state sensor discovery");
+  bool is_cleared = true;
+  for (const char* topic : LEGACY_DISCOVERY_TOPICS) {
+    if (!mqtt_client.publish(topic, "", true)) {
+      is_cleared = false;
+      continue;
+    }
+    char key[16];
+    snprintf(key, sizeof(key), "%08x", (unsigned int)hashDiscovery(topic, strlen(topic)));
+    prefs.remove(key);
+  }
+  if (is_cleared) {
+    prefs.putBool(LEGACY_DISCOVERY_CLEARED_KEY, true);
+    Serial.println(PRINT_PREFIX + "Cleared legacy discovery");
+  }
+  prefs.end();
 }
 
 // MARK: Remove Discovery (hot-unplug)
 
 void MQTTService::removeBrightnessSensorDiscovery() {
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/sensor/bionic_flower/illuminance/config", "", true);
+  removeDiscovery(BRIGHTNESS_SENSOR_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Removed illuminance sensor");
 }
 
+void MQTTService::removeLuxSensorDiscovery() {
+  removeDiscovery(LUX_SENSOR_DISCOVERY);
+  Serial.println(PRINT_PREFIX + "Removed illuminance lux sensor");
+}
+
 void MQTTService::removeDistanceSensorDiscovery() {
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/sensor/bionic_flower/proximity/config", "", true);
+  removeDiscovery(DISTANCE_SENSOR_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Removed proximity sensor");
 }
 
 void MQTTService::removeTouchLeftDiscovery() {
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/binary_sensor/bionic_flower/touch_left/config", "", true);
+  removeDiscovery(TOUCH_LEFT_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Removed touch left sensor");
 }
 
 void MQTTService::removeTouchRightDiscovery() {
-  mqtt_client.publish(MQTT_DISCOVERY_PREFIX "/binary_sensor/bionic_flower/touch_right/config", "", true);
+  removeDiscovery(TOUCH_RIGHT_DISCOVERY);
   Serial.println(PRINT_PREFIX + "Removed touch right sensor");
 }
 
+void MQTTService::removeGestureTriggerDiscovery() {
+  for (uint8_t i = 0; i < GESTURE_COUNT; i++) {
+    removeDiscovery(GESTURE_TRIGGER_DISCOVERY[i]);
+  }
+  Serial.println(PRINT_PREFIX + "Removed gesture triggers");
+}
+
+void MQTTService::removeProximityGestureDiscovery() {
+  removeDiscovery(PROXIMITY_MODE_DISCOVERY);
+  for (uint8_t i = 0; i < PROXIMITY_GESTURE_COUNT; i++) {
+    removeDiscovery(PROXIMITY_TRIGGER_DISCOVERY[i]);
+  }
+  Serial.println(PRINT_PREFIX + "Removed proximity gestures");
+}
+
 // MARK: State Publishing
 
 void MQTTService::publishLightState() {
@@ -430,7 +717,7 @@ void MQTTService::publishLightState() {
   char buffer[256];
   serializeJson(doc, buffer);
 
-  mqtt_client.publish(MQTT_BASE_TOPIC "/light/state", buffer, true);
+  publish(MQTT_DEVICE_TOPIC "/light/state", buffer, true);
 
   // Save state to NVS whenever light state changes
   hw->saveStateToNVS();
@@ -444,113 +731,439 @@ void MQTTService::publishCoverState() {
   // For Home Assistant: 100% = open, 0% = closed
   // Direct mapping: motor_position * 100 = HA position
   int position = (int)(config.motor_position * 100);
-
-  const char* state;
-  if (position >= 99) {
-    state = "open";
-  } else if (position <= 1) {
-    state = "closed";
-  } else {
-    state = "stopped";
-  }
+  const char* state = getCoverState(position);
 
   Serial.println(PRINT_PREFIX + "Cover position: " + String(position) + "%, state: " + state);
-  mqtt_client.publish(MQTT_BASE_TOPIC "/cover/state", state, true);
-  mqtt_client.publish(MQTT_BASE_TOPIC "/cover/position", String(position).c_str(), true);
+
+#if MQTT_CONSOLIDATED_STATE
+  // Part of the state document
+  publishSensorStates(true);
+#else
+  char payload[8];
+  snprintf(payload, sizeof(payload), "%d", position);
+  publish(MQTT_DEVICE_TOPIC "/cover/state", state, true);
+  publish(MQTT_DEVICE_TOPIC "/cover/position", payload, true);
+  markTelemetryPublished(TELEMETRY_COVER_POSITION, position, millis());
+#endif
 }
 
-void MQTTService::publishSensorStates() {
+// Publishes the values that moved past their deadband or are due for a
+// heartbeat (see TELEMETRY_POLICIES); force publishes all of them.
+void MQTTService::publishSensorStates(bool force) {
   HardwareService* hw = HardwareService::getSharedInstance();
   SensorData data = hw->getSensorData();
+  unsigned long now = millis();
 
-  if (data.has_light_sensor) {
-    float illuminance_percent = data.brightness * 100;
-    mqtt_client.publish(MQTT_BASE_TOPIC "/sensor/illuminance", String(illuminance_percent).c_str());
+  float values[TELEMETRY_CHANNEL_COUNT];
+  bool is_available[TELEMETRY_CHANNEL_COUNT];
+  readTelemetry(values, is_available, data, force);
 
-    float proximity_percent = data.distance * 100;
-    mqtt_client.publish(MQTT_BASE_TOPIC "/sensor/proximity", String(proximity_percent).c_str());
+  bool is_due[TELEMETRY_CHANNEL_COUNT];
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    is_due[i] = is_available[i] && isTelemetryDue((TelemetryChannel)i, values[i], now, force);
   }
 
+  // Weather state (retained, only publish if weather effect is enabled)
+  const char* weather = weather_enabled ? weather_state : "disabled";
+  bool is_weather_due = force || (strcmp(weather, published_weather) != 0);
+
+#if MQTT_CONSOLIDATED_STATE
+  // One document whenever any value is due, related values stay consistent
+  bool is_any_due = is_weather_due;
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    is_any_due |= is_due[i];
+  }
+  if (!is_any_due) return;
+
+  JsonDocument doc;
+  if (data.has_light_sensor) {
+    doc["illuminance"] = round(values[TELEMETRY_ILLUMINANCE] * 100) / 100;
+    doc["illuminance_lux"] = round(values[TELEMETRY_ILLUMINANCE_LUX] * 100) / 100;
+    doc["proximity"] = round(values[TELEMETRY_PROXIMITY] * 100) / 100;
+  }
   if (data.has_touch_sensor) {
-    mqtt_client.publish(MQTT_BASE_TOPIC "/binary_sensor/touch_left", data.touch_left ? "ON" : "OFF");
-    mqtt_client.publish(MQTT_BASE_TOPIC "/binary_sensor/touch_right", data.touch_right ? "ON" : "OFF");
+    doc["touch_left"] = data.touch_left ? "ON" : "OFF";
+    doc["touch_right"] = data.touch_right ? "ON" : "OFF";
+  }
+  doc["temperature"] = round(values[TELEMETRY_TEMPERATURE] * 100) / 100;
+  int position = values[TELEMETRY_COVER_POSITION];
+  doc["cover"] = getCoverState(position);
+  doc["position"] = position;
+  doc["weather"] = weather;
+  doc["mode"] = hw->getConfiguration().is_autonomous ? "Automatic" : "Manual";
+  doc["adaptive_brightness"] = adaptive_brightness_enabled ? "ON" : "OFF";
+
+  char buffer[384];
+  serializeJson(doc, buffer, sizeof(buffer));
+  publish(MQTT_DEVICE_TOPIC "/state", buffer, true);
+
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    if (is_available[i]) {
+      markTelemetryPublished((TelemetryChannel)i, values[i], now);
+    }
+  }
+#else
+  char payload[16];
+
+  if (is_due[TELEMETRY_ILLUMINANCE]) {
+    snprintf(payload, sizeof(payload), "%.2f", values[TELEMETRY_ILLUMINANCE]);
+    publish(MQTT_DEVICE_TOPIC "/sensor/illuminance", payload);
+  }
+  if (is_due[TELEMETRY_ILLUMINANCE_LUX]) {
+    snprintf(payload, sizeof(payload), "%.2f", values[TELEMETRY_ILLUMINANCE_LUX]);
+    publish(MQTT_DEVICE_TOPIC "/sensor/illuminance_lux", payload);
+  }
+  if (is_due[TELEMETRY_PROXIMITY]) {
+    snprintf(payload, sizeof(payload), "%.2f", values[TELEMETRY_PROXIMITY]);
+    publish(MQTT_DEVICE_TOPIC "/sensor/proximity", payload);
+  }
+  if (is_due[TELEMETRY_TOUCH_LEFT]) {
+    publish(MQTT_DEVICE_TOPIC "/binary_sensor/touch_left", data.touch_left ? "ON" : "OFF");
+  }
+  if (is_due[TELEMETRY_TOUCH_RIGHT]) {
+    publish(MQTT_DEVICE_TOPIC "/binary_sensor/touch_right", data.touch_right ? "ON" : "OFF");
+  }
+  if (is_due[TELEMETRY_TEMPERATURE]) {
+    snprintf(payload, sizeof(payload), "%.2f", values[TELEMETRY_TEMPERATURE]);
+    publish(MQTT_DEVICE_TOPIC "/sensor/temperature", payload);
+  }
+
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    if (is_due[i]) {
+      markTelemetryPublished((TelemetryChannel)i, values[i], now);
+    }
   }
 
+  // Cover position changes while the motor runs
+  if (is_due[TELEMETRY_COVER_POSITION]) {
+    publishCoverState();
+  }
+
+  if (is_weather_due) {
+    publish(MQTT_DEVICE_TOPIC "/sensor/weather", weather, true);
+  }
+#endif
+
+  if (is_weather_due) {
+    strlcpy(published_weather, weather, sizeof(published_weather));
+  }
+}
+
+// Snapshot of all channels
+void MQTTService::readTelemetry(float* values, bool* is_available, const SensorData& data, bool force) {
+  HardwareService* hw = HardwareService::getSharedInstance();
+  unsigned long now = millis();
+
   // ESP32 internal temperature (with calibration offset, raw value is ~33°C too high)
-  float temp = temperatureRead() - 33.0f;
-  mqtt_client.publish(MQTT_BASE_TOPIC "/sensor/temperature", String(temp).c_str());
+  if (force || (now - temperature_read_at >= TEMPERATURE_READ_INTERVAL)) {
+    temperature_read_at = now;
+    temperature = temperatureRead() - 33.0f;
+  }
 
-  // Weather state (only publish if weather effect is enabled)
-  if (weather_enabled) {
-    mqtt_client.publish(MQTT_BASE_TOPIC "/sensor/weather", weather_state.c_str(), true);
-  } else {
-    mqtt_client.publish(MQTT_BASE_TOPIC "/sensor/weather", "disabled", true);
+  values[TELEMETRY_ILLUMINANCE] = data.brightness * 100;
+  values[TELEMETRY_ILLUMINANCE_LUX] = data.illuminance;
+  values[TELEMETRY_PROXIMITY] = data.distance * 100;
+  values[TELEMETRY_TOUCH_LEFT] = data.touch_left ? 1 : 0;
+  values[TELEMETRY_TOUCH_RIGHT] = data.touch_right ? 1 : 0;
+  values[TELEMETRY_TEMPERATURE] = temperature;
+  values[TELEMETRY_COVER_POSITION] = (int)(hw->getConfiguration().motor_position * 100);
+
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    is_available[i] = true;
+  }
+  is_available[TELEMETRY_ILLUMINANCE] = data.has_light_sensor;
+  is_available[TELEMETRY_ILLUMINANCE_LUX] = data.has_light_sensor;
+  is_available[TELEMETRY_PROXIMITY] = data.has_light_sensor;
+  is_available[TELEMETRY_TOUCH_LEFT] = data.has_touch_sensor;
+  is_available[TELEMETRY_TOUCH_RIGHT] = data.has_touch_sensor;
+}
+
+// While offline: record what would have been published, with the same
+// deadbands. Needs the NTP time for the timestamps.
+void MQTTService::bufferSensorStates() {
+  time_t timestamp = time(nullptr);
+  if (timestamp < MIN_VALID_TIME) return;
+
+  SensorData data = HardwareService::getSharedInstance()->getSensorData();
+  unsigned long now = millis();
+
+  float values[TELEMETRY_CHANNEL_COUNT];
+  bool is_available[TELEMETRY_CHANNEL_COUNT];
+  readTelemetry(values, is_available, data, false);
+
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    if (is_available[i] && isTelemetryDue((TelemetryChannel)i, values[i], now, false)) {
+      telemetry_buffer.push({ (uint32_t)timestamp, values[i], i });
+      markTelemetryPublished((TelemetryChannel)i, values[i], now);
+    }
+  }
+}
+
+// After reconnecting: one batch of buffered samples per loop pass, oldest
+// first, with their original timestamps. Home Assistant records states at
+// arrival, so they go to their own topic instead of the state topics.
+// Payload: {"samples": [{"time": 1700000000, "channel": "illuminance", "value": 12.5}, ...], "remaining": 42}
+void MQTTService::replayBufferedTelemetry() {
+  TelemetrySample samples[TELEMETRY_REPLAY_BATCH];
+  uint16_t count = telemetry_buffer.peek(samples, TELEMETRY_REPLAY_BATCH);
+  if (count == 0) return;
+
+  JsonDocument doc;
+  JsonArray array = doc["samples"].to<JsonArray>();
+  for (uint16_t i = 0; i < count; i++) {
+    JsonObject sample = array.add<JsonObject>();
+    sample["time"] = samples[i].timestamp;
+    sample["channel"] = TELEMETRY_CHANNEL_NAMES[samples[i].channel];
+    sample["value"] = round(samples[i].value * 100) / 100;
+  }
+  doc["remaining"] = telemetry_buffer.getCount() - count;
+  if (telemetry_buffer.getOverflowCount() > 0) {
+    doc["overflows"] = telemetry_buffer.getOverflowCount();
+  }
+
+  char buffer[640];
+  serializeJson(doc, buffer, sizeof(buffer));
+  if (publish(MQTT_DEVICE_TOPIC "/telemetry/replay", buffer)) {
+    // Kept for the next pass if the queue was full
+    telemetry_buffer.drop(count);
+  }
+}
+
+bool MQTTService::isTelemetryDue(TelemetryChannel channel, float value, unsigned long now, bool force) {
+  const TelemetryPolicy& policy = TELEMETRY_POLICIES[channel];
+  const TelemetryState& state = telemetry[channel];
+  unsigned long elapsed = now - state.published_at;
+
+  if (force || !state.has_value || (elapsed >= policy.max_interval)) return true;
+  if (elapsed < policy.min_interval) return false;
+
+  float deadband = max(policy.absolute_deadband, policy.relative_deadband * fabsf(state.value));
+  return fabsf(value - state.value) >= deadband;
+}
+
+void MQTTService::markTelemetryPublished(TelemetryChannel channel, float value, unsigned long now) {
+  telemetry[channel] = { value, now, true };
+}
+
+const char* MQTTService::getCoverState(int position) {
+  if (position >= 99) {
+    return "open";
+  } else if (position <= 1) {
+    return "closed";
   }
+  return "stopped";
 }
 
 void MQTTService::publishModeState() {
+#if MQTT_CONSOLIDATED_STATE
+  // Part of the state document
+  publishSensorStates(true);
+#else
   HardwareService* hw = HardwareService::getSharedInstance();
   Configuration config = hw->getConfiguration();
-
   const char* mode = config.is_autonomous ? "Automatic" : "Manual";
-  mqtt_client.publish(MQTT_BASE_TOPIC "/select/mode/state", mode, true);
+  publish(MQTT_DEVICE_TOPIC "/select/mode/state", mode, true);
+#endif
 }
 
 void MQTTService::publishAdaptiveBrightnessState() {
+#if MQTT_CONSOLIDATED_STATE
+  // Part of the state document
+  publishSensorStates(true);
+#else
   const char* state = adaptive_brightness_enabled ? "ON" : "OFF";
-  mqtt_client.publish(MQTT_BASE_TOPIC "/switch/adaptive_brightness/state", state, true);
+  publish(MQTT_DEVICE_TOPIC "/switch/adaptive_brightness/state", state, true);
+#endif
+}
+
+void MQTTService::publishGesture(TouchGesture gesture) {
+  if (!is_connected) return;
+  publish(MQTT_DEVICE_TOPIC "/gesture", TouchGestureRecognizer::getName(gesture));
+}
+
+void MQTTService::publishGestureConfig() {
+  HardwareService* hw = HardwareService::getSharedInstance();
+  TouchGestureTimings timings = hw->getGestureTimings();
+
+  JsonDocument doc;
+
+  JsonObject actions = doc["actions"].to<JsonObject>();
+  for (uint8_t i = 0; i < GESTURE_COUNT; i++) {
+    TouchGesture gesture = (TouchGesture)i;
+    actions[TouchGestureRecognizer::getName(gesture)] = GESTURE_ACTION_NAMES[hw->getGestureAction(gesture)];
+  }
+  doc["long_press_ms"] = timings.long_press;
+  doc["double_tap_ms"] = timings.double_tap;
+  doc["swipe_ms"] = timings.swipe;
+
+  char buffer[512];
+  serializeJson(doc, buffer);
+
+  publish(MQTT_DEVICE_TOPIC "/gesture/config", buffer, true);
+}
+
+void MQTTService::publishProximityGesture(ProximityGesture gesture) {
+  if (!is_connected) return;
+  publish(MQTT_DEVICE_TOPIC "/proximity/gesture", ProximityGestureDetector::getName(gesture));
+}
+
+void MQTTService::publishProximityModeState() {
+  HardwareService* hw = HardwareService::getSharedInstance();
+  const char* state = hw->isProximityModeEnabled() ? "ON" : "OFF";
+  publish(MQTT_DEVICE_TOPIC "/switch/proximity_mode/state", state, true);
+}
+
+void MQTTService::publishTouchCalibration() {
+  if (!is_connected) return;
+
+  TouchCalibrator calibrator = HardwareService::getSharedInstance()->getTouchCalibration();
+  const char* pad_names[TouchCalibrator::PAD_COUNT] = { "right", nullptr, "left" };
+
+  JsonDocument doc;
+  doc["sensitivity"] = 128 >> calibrator.getSensitivity();
+  doc["recalibrations"] = calibrator.getRecalibrationCount();
+  for (uint8_t pad = 0; pad < TouchCalibrator::PAD_COUNT; pad++) {
+    if (pad_names[pad] == nullptr) continue;
+    TouchPadStatistics stats = calibrator.getStatistics(pad);
+    JsonObject entry = doc[pad_names[pad]].to<JsonObject>();
+    entry["threshold"] = stats.threshold;
+    entry["noise"] = round(stats.noise * 100) / 100;
+    entry["noise_peak"] = stats.noise_peak;
+    entry["touch_peak"] = stats.touch_peak;
+    entry["drift"] = round(stats.drift * 100) / 100;
+    entry["base"] = stats.base_count;
+  }
+
+  char buffer[512];
+  serializeJson(doc, buffer);
+
+  publish(MQTT_DEVICE_TOPIC "/touch/calibration", buffer);
+}
+
+// Alignment of the animations with the other flowers: all follow NTP, so
+// the error between two flowers is about the sum of their errors here
+void MQTTService::publishClockState() {
+  AnimationClock* clock = AnimationClock::getSharedInstance();
+
+  JsonDocument doc;
+  doc["synced"] = clock->isSynced();
+  doc["offset_error_ms"] = clock->getOffsetError();
+  doc["frame_phase_ms"] = clock->getMeanPhaseError();
+  doc["frame_phase_max_ms"] = clock->getMaxPhaseError();
+  doc["steps"] = clock->getStepCount();
+  clock->resetStatistics();
+
+  char buffer[192];
+  serializeJson(doc, buffer);
+
+  publish(MQTT_DEVICE_TOPIC "/clock", buffer);
+}
+
+// Binary batch, see DiagnosticsRecorder for the schema
+void MQTTService::publishDiagnostics(DiagnosticsRecorder& recorder) {
+  static_assert(DiagnosticsRecorder::MAX_BATCH_LENGTH <= MQTT_MESSAGE_PAYLOAD_SIZE, "Diagnostics batch must fit a queue slot");
+  uint8_t buffer[DiagnosticsRecorder::MAX_BATCH_LENGTH];
+  size_t length = recorder.encodeBatch(buffer, sizeof(buffer));
+  if (length > 0) {
+    publish(MQTT_DEVICE_TOPIC "/diagnostics/frames", buffer, length);
+  }
 }
 
 // MARK: Message Callback
 
+// Runs on the MQTT task: copy the message, the control loop handles it
 void MQTTService::messageCallback(char* topic, byte* payload, unsigned int length) {
-  if (mqtt_shared_instance != nullptr) {
-    mqtt_shared_instance->handleMessage(topic, payload, length);
+  if (mqtt_shared_instance == nullptr) return;
+
+  if (strncmp(topic, MQTT_DISCOVERY_PREFIX "/", strlen(MQTT_DISCOVERY_PREFIX "/")) == 0) {
+    mqtt_shared_instance->handleDiscoveryMessage(topic, payload, length);
+    return;
   }
-}
 
-void MQTTService::handleMessage(char* topic, byte* payload, unsigned int length) {
-  String topicStr = String(topic);
-  String payloadStr;
+  // Same commands for this flower and for the whole group
+  MQTTService* mqtt = mqtt_shared_instance;
+  const char* route_topic = nullptr;
+  bool is_group = false;
+  size_t device_topic_length = strlen(mqtt->device_topic);
+  if (strncmp(topic, mqtt->device_topic, device_topic_length) == 0) {
+    route_topic = topic + device_topic_length;
+  } else if (strncmp(topic, MQTT_GROUP_TOPIC, strlen(MQTT_GROUP_TOPIC)) == 0) {
+    route_topic = topic + strlen(MQTT_GROUP_TOPIC);
+    is_group = true;
+  }
+  if (route_topic == nullptr) return;
+
+  uint32_t topic_hash = hashTopic(route_topic);
+  const CommandRoute* route = findCommandRoute(topic_hash);
+  if (route == nullptr) return;
+  if (is_group && !route->is_group_command) {
+    Serial.println(PRINT_PREFIX + "Ignored group command on " + topic);
+    return;
+  }
 
-  for (unsigned int i = 0; i < length; i++) {
-    payloadStr += (char)payload[i];
+  if (length >= MQTT_COMMAND_PAYLOAD_SIZE) {
+    Serial.println(PRINT_PREFIX + "Dropped oversized command on " + topic);
+    return;
   }
 
-  Serial.println(PRINT_PREFIX + "Received: " + topicStr + " = " + payloadStr);
+  MQTTCommand command;
+  command.topic_hash = topic_hash;
+  command.length = length;
+  memcpy(command.payload, payload, length);
+  command.payload[length] = '\0';
+  xQueueSend(mqtt->incoming_messages, &command, 0);
+}
+
+// Control loop: look up the handler by topic hash, no copies of the topic
+// or payload and no heap allocations
+void MQTTService::handleCommand(MQTTCommand& command) {
+  const CommandRoute* route = findCommandRoute(command.topic_hash);
+  if (route == nullptr) return;
+
+  Serial.print(PRINT_PREFIX);
+  Serial.print("Received: ");
+  Serial.print(route->topic);
+  Serial.print(" = ");
+  Serial.println(command.payload);
 
-  if (topicStr == MQTT_BASE_TOPIC "/light/set") {
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, payloadStr);
-    if (!error) {
-      handleLightCommand(doc);
+  command_allocator.reset();
+  (this->*(route->handler))(command.payload, command.length);
+}
+
+const MQTTService::CommandRoute* MQTTService::findCommandRoute(uint32_t topic_hash) {
+  for (uint8_t i = 0; i < COMMAND_ROUTE_COUNT; i++) {
+    if (COMMAND_ROUTES[i].topic_hash == topic_hash) {
+      return &COMMAND_ROUTES[i];
     }
-  } else if (topicStr == MQTT_BASE_TOPIC "/cover/set") {
-    handleCoverCommand(payloadStr);
-  } else if (topicStr == MQTT_BASE_TOPIC "/cover/set_position") {
-    handleCoverPositionCommand(payloadStr.toInt());
-  } else if (topicStr == MQTT_BASE_TOPIC "/select/mode/set") {
-    handleModeCommand(payloadStr);
-  } else if (topicStr == MQTT_BASE_TOPIC "/switch/adaptive_brightness/set") {
-    handleAdaptiveBrightnessCommand(payloadStr);
-  } else if (topicStr == MQTT_BASE_TOPIC "/weather/state") {
-    weather_state = payloadStr;
-    Serial.println(PRINT_PREFIX + "Weather state: " + weather_state);
-  } else if (topicStr == MQTT_BASE_TOPIC "/weather/temperature") {
-    weather_temperature = payloadStr.toFloat();
-    Serial.println(PRINT_PREFIX + "Weather temperature: " + String(weather_temperature));
   }
+  return nullptr;
 }
 
 // MARK: Command Handlers
 
-void MQTTService::handleLightCommand(JsonDocument& doc) {
+void MQTTService::handleLightCommand(char* payload, size_t length) {
+  JsonDocument doc(&command_allocator);
+  if (deserializeJson(doc, payload, length)) return;
+
+  // {"start_at": <Unix time [ms]>, ...}: applied on that frame, e.g. by all
+  // flowers of a group command at once
+  uint64_t now = AnimationClock::getSharedInstance()->getEpochTime();
+  uint64_t start_at = doc["start_at"] | 0.0;
+  if ((now > 0) && (start_at > now) && (start_at - now <= ANIMATION_MAX_START_DELAY)) {
+    memcpy(scheduled_light_command, payload, length);
+    scheduled_light_command[length] = '\0';
+    scheduled_light_command_length = length;
+    scheduled_light_command_at = start_at;
+    Serial.printf("%sLight command scheduled in %u ms\n", PRINT_PREFIX.c_str(), (unsigned int)(start_at - now));
+    return;
+  }
+
   HardwareService* hw = HardwareService::getSharedInstance();
   Configuration config = hw->getConfiguration();
 
   // Check for effect first
-  if (doc["effect"].is<const char*>()) {
-    String effect = doc["effect"].as<String>();
+  const char* effect = doc["effect"];
+  if (effect != nullptr) {
     // Reset all effects
     rainbow_enabled = false;
     rainbow_multi_enabled = false;
@@ -558,15 +1171,15 @@ void MQTTService::handleLightCommand(JsonDocument& doc) {
     weather_enabled = false;
     sensor_enabled = false;
 
-    if (effect == "Sensor") {
+    if (strcmp(effect, "Sensor") == 0) {
       sensor_enabled = true;
-    } else if (effect == "Weather") {
+    } else if (strcmp(effect, "Weather") == 0) {
       weather_enabled = true;
-    } else if (effect == "Circadian") {
+    } else if (strcmp(effect, "Circadian") == 0) {
       circadian_enabled = true;
-    } else if (effect == "Rainbow Multi") {
+    } else if (strcmp(effect, "Rainbow Multi") == 0) {
       rainbow_multi_enabled = true;
-    } else if (effect == "Rainbow") {
+    } else if (strcmp(effect, "Rainbow") == 0) {
       rainbow_enabled = true;
     }
     // "None" leaves all disabled
@@ -591,32 +1204,31 @@ void MQTTService::handleLightCommand(JsonDocument& doc) {
   }
 
   // Handle on/off
-  if (doc["state"].is<const char*>()) {
-    String state = doc["state"].as<String>();
-    if (state == "OFF") {
+  const char* state = doc["state"];
+  if (state != nullptr) {
+    if (strcmp(state, "OFF") == 0) {
       light_on = false;
-      Serial.println(PRINT_PREFIX + "Light OFF");
-    } else if (state == "ON") {
+    } else if (strcmp(state, "ON") == 0) {
       light_on = true;
-      Serial.println(PRINT_PREFIX + "Light ON");
     }
   }
 
-  Serial.println(PRINT_PREFIX + "Light state: " + String(light_on ? "ON" : "OFF") + ", Rainbow: " + String(rainbow_enabled ? "ON" : "OFF") + ", Brightness: " + String(brightness));
+  Serial.printf("%sLight state: %s, Rainbow: %s, Brightness: %u\n", PRINT_PREFIX.c_str(),
+                light_on ? "ON" : "OFF", rainbow_enabled ? "ON" : "OFF", brightness);
 
   hw->setConfiguration(config);
   publishLightState();
 }
 
-void MQTTService::handleCoverCommand(const String& command) {
+void MQTTService::handleCoverCommand(char* payload, size_t length) {
   HardwareService* hw = HardwareService::getSharedInstance();
   Configuration config = hw->getConfiguration();
 
-  if (command == "OPEN") {
+  if (strcmp(payload, "OPEN") == 0) {
     config.motor_position = MOTOR_POSITION_OPEN;
-  } else if (command == "CLOSE") {
+  } else if (strcmp(payload, "CLOSE") == 0) {
     config.motor_position = MOTOR_POSITION_CLOSED;
-  } else if (command == "STOP") {
+  } else if (strcmp(payload, "STOP") == 0) {
     // Keep current position
   }
 
@@ -625,28 +1237,115 @@ void MQTTService::handleCoverCommand(const String& command) {
   publishCoverState();
 }
 
-void MQTTService::handleCoverPositionCommand(int position) {
+void MQTTService::handleCoverPositionCommand(char* payload, size_t length) {
   HardwareService* hw = HardwareService::getSharedInstance();
   Configuration config = hw->getConfiguration();
 
   // Direct mapping: MQTT 100% (open) -> internal 1.0, MQTT 0% (closed) -> internal 0
-  config.motor_position = position / 100.0f;
+  config.motor_position = strtol(payload, nullptr, 10) / 100.0f;
   config.speed = 1.0f;
   hw->setConfiguration(config);
   publishCoverState();
 }
 
-void MQTTService::handleModeCommand(const String& mode) {
+void MQTTService::handleModeCommand(char* payload, size_t length) {
   HardwareService* hw = HardwareService::getSharedInstance();
   Configuration config = hw->getConfiguration();
 
-  config.is_autonomous = (mode == "Automatic");
+  config.is_autonomous = (strcmp(payload, "Automatic") == 0);
   hw->setConfiguration(config);
   publishModeState();
 }
 
-void MQTTService::handleAdaptiveBrightnessCommand(const String& state) {
-  adaptive_brightness_enabled = (state == "ON");
-  Serial.println(PRINT_PREFIX + "Adaptive brightness: " + String(adaptive_brightness_enabled ? "ON" : "OFF"));
+void MQTTService::handleAdaptiveBrightnessCommand(char* payload, size_t length) {
+  adaptive_brightness_enabled = (strcmp(payload, "ON") == 0);
+  Serial.printf("%sAdaptive brightness: %s\n", PRINT_PREFIX.c_str(), adaptive_brightness_enabled ? "ON" : "OFF");
   publishAdaptiveBrightnessState();
 }
+
+void MQTTService::handleProximityModeCommand(char* payload, size_t length) {
+  HardwareService* hw = HardwareService::getSharedInstance();
+  hw->setProximityModeEnabled(strcmp(payload, "ON") == 0);
+  publishProximityModeState();
+}
+
+void MQTTService::handleWeatherStateCommand(char* payload, size_t length) {
+  strlcpy(weather_state, payload, sizeof(weather_state));
+  Serial.printf("%sWeather state: %s\n", PRINT_PREFIX.c_str(), weather_state);
+}
+
+void MQTTService::handleWeatherTemperatureCommand(char* payload, size_t length) {
+  weather_temperature = strtof(payload, nullptr);
+  Serial.printf("%sWeather temperature: %.2f\n", PRINT_PREFIX.c_str(), weather_temperature);
+}
+
+void MQTTService::handleDiagnosticsCommand(char* payload, size_t length) {
+  diagnostics_enabled = (strcmp(payload, "ON") == 0);
+  Serial.printf("%sDiagnostics stream: %s\n", PRINT_PREFIX.c_str(), diagnostics_enabled ? "ON" : "OFF");
+}
+
+// Batch of configuration changes, fields as in /api/v1/configuration: validated
+// together and applied as one transition, the result goes to configuration/result
+void MQTTService::handleConfigurationCommand(char* payload, size_t length) {
+  JsonDocument doc(&command_allocator);
+  ControlCommand command;
+  char error[96];
+  char result[128];
+
+  if (deserializeJson(doc, payload, length) || !doc.is<JsonObject>()) {
+    strlcpy(error, "invalid JSON", sizeof(error));
+  } else if (CommandQueue::parseBatch(doc.as<JsonObjectConst>(), command, error, sizeof(error))) {
+    CommandQueue::getSharedInstance()->apply(command);
+    publish(MQTT_DEVICE_TOPIC "/configuration/result", "{\"success\":true}");
+    return;
+  }
+
+  Serial.printf("%sConfiguration batch rejected: %s\n", PRINT_PREFIX.c_str(), error);
+  for (char* character = error; *character != '\0'; character++) {
+    if ((*character == '"') || (*character == '\\')) *character = '\'';
+  }
+  snprintf(result, sizeof(result), "{\"success\":false,\"error\":\"%s\"}", error);
+  publish(MQTT_DEVICE_TOPIC "/configuration/result", result);
+}
+
+// {"url": "http://<host>/firmware.bin", "sha256": "<hex>"}: the flower downloads
+// and installs the image, progress and result go to ota/state
+void MQTTService::handleFirmwareCommand(char* payload, size_t length) {
+  JsonDocument doc(&command_allocator);
+  if (deserializeJson(doc, payload, length)) return;
+
+  FirmwareUpdater::getSharedInstance()->pull(doc["url"].as<const char*>(), doc["sha256"].as<const char*>());
+}
+
+// Payload: {"actions": {"<gesture>": "<action>", ...}, "long_press_ms": 800, "double_tap_ms": 250, "swipe_ms": 300}
+// All keys are optional, unknown gestures/actions are ignored.
+void MQTTService::handleGestureCommand(char* payload, size_t length) {
+  JsonDocument doc(&command_allocator);
+  if (deserializeJson(doc, payload, length)) return;
+
+  HardwareService* hw = HardwareService::getSharedInstance();
+
+  if (doc["actions"].is<JsonObject>()) {
+    for (JsonPair pair : doc["actions"].as<JsonObject>()) {
+      TouchGesture gesture = TouchGestureRecognizer::fromName(pair.key().c_str());
+      const char* action_name = pair.value().as<const char*>();
+      if ((gesture == GESTURE_NONE) || (action_name == nullptr)) continue;
+
+      for (uint8_t action = 0; action < GESTURE_ACTION_COUNT; action++) {
+        if (strcmp(action_name, GESTURE_ACTION_NAMES[action]) == 0) {
+          hw->setGestureAction(gesture, (GestureAction)action);
+          break;
+        }
+      }
+    }
+  }
+
+  TouchGestureTimings timings = hw->getGestureTimings();
+  timings.long_press = doc["long_press_ms"] | timings.long_press;
+  timings.double_tap = doc["double_tap_ms"] | timings.double_tap;
+  timings.swipe = doc["swipe_ms"] | timings.swipe;
+  hw->setGestureTimings(timings);
+
+  Serial.printf("%sGesture configuration updated\n", PRINT_PREFIX.c_str());
+  publishGestureConfig();
+}
@@ -8,7 +8,64 @@
 #include <ArduinoJson.h>
 #include "Settings.h"
 #include "Models.h"
+#include "TouchGestureRecognizer.h"
+#include "ProximityGestureDetector.h"
+#include "MessageAllocator.h"
+#include "TelemetryBuffer.h"
+#include "DiagnosticsRecorder.h"
 
+struct DiscoveryConfig;
+
+// Sensor values published on change (deadband) or as heartbeat
+enum TelemetryChannel : uint8_t {
+  TELEMETRY_ILLUMINANCE = 0,
+  TELEMETRY_ILLUMINANCE_LUX,
+  TELEMETRY_PROXIMITY,
+  TELEMETRY_TOUCH_LEFT,
+  TELEMETRY_TOUCH_RIGHT,
+  TELEMETRY_TEMPERATURE,
+  TELEMETRY_COVER_POSITION,
+  TELEMETRY_CHANNEL_COUNT
+};
+
+struct TelemetryPolicy {
+  float absolute_deadband;
+  float relative_deadband; // of the last published value
+  unsigned long min_interval; // ms, rate limit for changes
+  unsigned long max_interval; // ms, heartbeat without changes
+};
+
+const size_t MQTT_MESSAGE_TOPIC_SIZE = 96;
+const size_t MQTT_MESSAGE_PAYLOAD_SIZE = 832; // Largest queued payload, a diagnostics batch
+
+// Message passed from the control loop to the MQTT task, copied into the
+// queue slot as is. Larger messages are rejected.
+struct MQTTMessage {
+  bool retained;
+  uint16_t length;
+  char topic[MQTT_MESSAGE_TOPIC_SIZE]; // Null terminated
+  uint8_t payload[MQTT_MESSAGE_PAYLOAD_SIZE]; // Not null terminated for binary payloads
+};
+
+const size_t MQTT_COMMAND_PAYLOAD_SIZE = 384;
+
+// Command passed from the MQTT task to the control loop, copied into the
+// queue slot as is. The topic is only kept as its hash.
+struct MQTTCommand {
+  uint32_t topic_hash;
+  uint16_t length;
+  char payload[MQTT_COMMAND_PAYLOAD_SIZE]; // Null terminated
+};
+
+// FNV-1a, evaluated at compile time for the dispatch table
+constexpr uint32_t hashTopic(const char* topic, uint32_t hash = 2166136261u) {
+  return (*topic == '\0') ? hash : hashTopic(topic + 1, (hash ^ (uint8_t)*topic) * 16777619u);
+}
+
+// The PubSubClient is owned by its own task: connecting, subscribing and
+// discovery never block the control loop. Publishing from the control loop
+// only queues a copy of the message, received commands are queued the other
+// way and handled in loop().
 class MQTTService {
 
   public:
@@ -20,13 +77,21 @@ class MQTTService {
     void setup();
     void loop();
     bool isConnected();
+    const char* getDeviceId() { return device_id; }
 
     // State publishing
     void publishLightState();
     void publishCoverState();
-    void publishSensorStates();
+    void publishSensorStates(bool force);
     void publishModeState();
     void publishAdaptiveBrightnessState();
+    void publishGesture(TouchGesture gesture);
+    void publishGestureConfig();
+    void publishProximityGesture(ProximityGesture gesture);
+    void publishProximityModeState();
+    void publishTouchCalibration();
+    void publishClockState();
+    void publishDiagnostics(DiagnosticsRecorder& recorder);
 
     // Effect control
     bool isRainbowEnabled() { return rainbow_enabled; }
@@ -43,6 +108,7 @@ class MQTTService {
     void setBrightness(uint8_t b) { brightness = b; }
     bool isLightOn() { return light_on; }
     void setLightOn(bool on) { light_on = on; }
+    bool isDiagnosticsEnabled() { return diagnostics_enabled; }
     bool isAdaptiveBrightnessEnabled() { return adaptive_brightness_enabled; }
     void setAdaptiveBrightnessEnabled(bool enabled) { adaptive_brightness_enabled = enabled; }
 
@@ -50,8 +116,8 @@ class MQTTService {
     uint8_t getCircadianHour() { return circadian_hour; }
     int getCircadianPreviewHour() { return circadian_preview_hour; }
     void setCircadianPreviewHour(int hour) { circadian_preview_hour = hour; }
-    String getWeatherState() { return weather_state; }
-    void setWeatherState(const String& state) { weather_state = state; }
+    const char* getWeatherState() { return weather_state; }
+    void setWeatherState(const String& state) { strlcpy(weather_state, state.c_str(), sizeof(weather_state)); }
     float getWeatherTemperature() { return weather_temperature; }
 
   private:
@@ -63,8 +129,39 @@ class MQTTService {
     WiFiClient wifi_client;
     PubSubClient mqtt_client;
 
+    // Fleet: topics, discovery and client ID are namespaced per flower
+    char device_id[16];
+    char device_topic[48]; // MQTT_DEVICE_TOPIC with the device ID
+    char client_id[48];
+
+    TaskHandle_t mqtt_task;
+    QueueHandle_t outgoing_messages; // control loop -> MQTT task
+    QueueHandle_t incoming_messages; // MQTT task -> control loop
+    volatile bool is_connected;
+    volatile bool has_connected; // initial states are published from loop()
+
+    // Discovery verification (MQTT task): configs whose hash is unchanged
+    // wait for the broker's retained copy and are only re-sent if it differs
+    static const uint8_t MAX_PENDING_DISCOVERY = 32;
+    const DiscoveryConfig* pending_discovery[MAX_PENDING_DISCOVERY];
+    uint8_t pending_discovery_count;
+    bool is_verifying_discovery;
+    unsigned long discovery_verification_started_at;
+    bool has_discovery_request; // Home Assistant birth message
+
     unsigned long last_reconnect_attempt;
-    unsigned long last_sensor_publish;
+
+    // Telemetry (control loop)
+    struct TelemetryState {
+      float value; // last published
+      unsigned long published_at;
+      bool has_value;
+    };
+    TelemetryState telemetry[TELEMETRY_CHANNEL_COUNT];
+    char published_weather[24];
+    float temperature;
+    unsigned long temperature_read_at;
+    TelemetryBuffer telemetry_buffer; // Offline samples (ENABLE_TELEMETRY_BUFFER)
 
     bool rainbow_enabled;
     bool rainbow_multi_enabled;
@@ -73,6 +170,7 @@ class MQTTService {
     bool sensor_enabled;
     bool light_on;
     bool adaptive_brightness_enabled;
+    bool diagnostics_enabled;
     uint8_t brightness;
     bool last_has_light_sensor;
     bool last_has_touch_sensor;
@@ -80,10 +178,41 @@ class MQTTService {
     // External data for effects
     uint8_t circadian_hour;
     int circadian_preview_hour;  // -1 = use real time, >= 0 = use preview hour
-    String weather_state;
+    char weather_state[24];
     float weather_temperature;
 
+    // Command dispatch (control loop): handlers get a view of the payload
+    // in the queued command and parse it in place
+    typedef void (MQTTService::*CommandHandler)(char* payload, size_t length);
+    struct CommandRoute {
+      const char* topic;
+      uint32_t topic_hash;
+      CommandHandler handler;
+      bool is_group_command; // Also accepted below MQTT_GROUP_TOPIC
+    };
+    static const CommandRoute COMMAND_ROUTES[];
+    static const uint8_t COMMAND_ROUTE_COUNT;
+    MessageAllocator command_allocator;
+
+    // Light command waiting for its start_at time (synchronized scenes)
+    char scheduled_light_command[MQTT_COMMAND_PAYLOAD_SIZE];
+    size_t scheduled_light_command_length;
+    uint64_t scheduled_light_command_at; // Unix time [ms], 0 = none
+    unsigned long clock_published_at;
+
     // MARK: Methods
+    static void mqttTask(void* parameter);
+    bool publish(const char* topic, const char* payload, bool retained = false);
+    bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained = false);
+    void expandDeviceId(const char* text, char* buffer, size_t size);
+    void publishInitialStates();
+    void readTelemetry(float* values, bool* is_available, const SensorData& data, bool force);
+    void bufferSensorStates();
+    void replayBufferedTelemetry();
+    bool isTelemetryDue(TelemetryChannel channel, float value, unsigned long now, bool force);
+    void markTelemetryPublished(TelemetryChannel channel, float value, unsigned long now);
+    static const char* getCoverState(int position);
+    void checkSensorDiscovery();
     void connect();
     void reconnect();
     void subscribeTopics();
@@ -95,28 +224,52 @@ class MQTTService {
     void sendModeDiscovery();
     void sendAdaptiveBrightnessDiscovery();
     void sendBrightnessSensorDiscovery();
+    void sendLuxSensorDiscovery();
     void sendDistanceSensorDiscovery();
     void sendTouchLeftDiscovery();
     void sendTouchRightDiscovery();
     void sendTemperatureDiscovery();
     void sendWeatherStateSensorDiscovery();
+    void sendGestureTriggerDiscovery();
+    void sendProximityGestureDiscovery();
+    void publishDiscovery(const DiscoveryConfig& config);
+    void sendDiscoveryPayload(const DiscoveryConfig& config);
+    size_t writeDiscoveryPayload(const DiscoveryConfig& config, uint32_t* hash, bool is_writing);
+    void removeDiscovery(const DiscoveryConfig& config);
+    void clearLegacyDiscovery();
+    void beginDiscoveryVerification();
+    void checkDiscoveryVerification();
+    void handleDiscoveryMessage(const char* topic, const byte* payload, unsigned int length);
+    static uint32_t hashDiscovery(const char* data, size_t length, uint32_t hash = 2166136261u);
+    static void getDiscoveryHashKey(const DiscoveryConfig& config, char* key, size_t size);
 
     // Remove discovery (for hot-unplug)
     void removeBrightnessSensorDiscovery();
+    void removeLuxSensorDiscovery();
     void removeDistanceSensorDiscovery();
     void removeTouchLeftDiscovery();
     void removeTouchRightDiscovery();
+    void removeGestureTriggerDiscovery();
+    void removeProximityGestureDiscovery();
 
     // Callback
     static void messageCallback(char* topic, byte* payload, unsigned int length);
-    void handleMessage(char* topic, byte* payload, unsigned int length);
+    void handleCommand(MQTTCommand& command);
+    static const CommandRoute* findCommandRoute(uint32_t topic_hash);
 
     // Command handlers
-    void handleLightCommand(JsonDocument& doc);
-    void handleCoverCommand(const String& command);
-    void handleCoverPositionCommand(int position);
-    void handleModeCommand(const String& mode);
-    void handleAdaptiveBrightnessCommand(const String& state);
+    void handleLightCommand(char* payload, size_t length);
+    void handleCoverCommand(char* payload, size_t length);
+    void handleCoverPositionCommand(char* payload, size_t length);
+    void handleModeCommand(char* payload, size_t length);
+    void handleAdaptiveBrightnessCommand(char* payload, size_t length);
+    void handleGestureCommand(char* payload, size_t length);
+    void handleProximityModeCommand(char* payload, size_t length);
+    void handleWeatherStateCommand(char* payload, size_t length);
+    void handleWeatherTemperatureCommand(char* payload, size_t length);
+    void handleDiagnosticsCommand(char* payload, size_t length);
+    void handleConfigurationCommand(char* payload, size_t length);
+    void handleFirmwareCommand(char* payload, size_t length);
 
 };
 
@@ -0,0 +1,82 @@
+
+// MARK: Includes
+
+#include "MessageAllocator.h"
+
+// MARK: Constants
+
+const size_t ALIGNMENT = 8;
+const size_t HEADER_SIZE = ALIGNMENT; // Block size, keeps the blocks aligned
+
+static size_t alignSize(size_t size) {
+  return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+// MARK: Initialization
+
+MessageAllocator::MessageAllocator() {
+  reset();
+}
+
+// MARK: Methods
+
+void MessageAllocator::reset() {
+  used = 0;
+  last = nullptr;
+}
+
+void* MessageAllocator::allocate(size_t size) {
+  size_t block_size = HEADER_SIZE + alignSize(size);
+  if (block_size > CAPACITY - used) {
+    return malloc(size);
+  }
+
+  uint8_t* block = arena + used;
+  *(size_t*)block = size;
+  used += block_size;
+  last = block + HEADER_SIZE;
+  return last;
+}
+
+// Only the most recent block is given back, everything else on reset()
+void MessageAllocator::deallocate(void* pointer) {
+  if (!owns(pointer)) {
+    free(pointer);
+    return;
+  }
+
+  if (pointer == last) {
+    used = (uint8_t*)pointer - HEADER_SIZE - arena;
+    last = nullptr;
+  }
+}
+
+void* MessageAllocator::reallocate(void* pointer, size_t new_size) {
+  if (pointer == nullptr) return allocate(new_size);
+  if (!owns(pointer)) return realloc(pointer, new_size);
+
+  size_t* header = (size_t*)((uint8_t*)pointer - HEADER_SIZE);
+  size_t size = *header;
+  if (pointer == last) {
+    size_t offset = (uint8_t*)pointer - arena;
+    if (alignSize(new_size) <= CAPACITY - offset) {
+      *header = new_size;
+      used = offset + alignSize(new_size);
+      return pointer;
+    }
+  } else if (new_size <= size) {
+    *header = new_size;
+    return pointer;
+  }
+
+  void* moved = allocate(new_size);
+  if (moved != nullptr) {
+    memcpy(moved, pointer, (size < new_size) ? size : new_size);
+    deallocate(pointer);
+  }
+  return moved;
+}
+
+bool MessageAllocator::owns(void* pointer) {
+  return ((uint8_t*)pointer >= arena) && ((uint8_t*)pointer < arena + CAPACITY);
+}
@@ -0,0 +1,46 @@
+
+#ifndef MESSAGEALLOCATOR_H_
+#define MESSAGEALLOCATOR_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Bump allocator for the JsonDocument of one received command. Memory comes
+// from a fixed arena that is rewound before each command, so parsing does
+// not touch the heap. Only falls back to the heap if the arena is exhausted.
+class MessageAllocator : public ArduinoJson::Allocator {
+
+  public:
+
+    // MARK: Constants
+
+    static const size_t CAPACITY = 4096;
+
+    // MARK: Initialization
+
+    MessageAllocator();
+
+    // MARK: Methods
+
+    void reset();
+    void* allocate(size_t size) override;
+    void deallocate(void* pointer) override;
+    void* reallocate(void* pointer, size_t new_size) override;
+
+  private:
+
+    // MARK: Properties
+
+    alignas(8) uint8_t arena[CAPACITY];
+    size_t used;
+    uint8_t* last; // Most recent block, can grow and shrink in place
+
+    // MARK: Methods
+
+    bool owns(void* pointer);
+
+};
+
+#endif
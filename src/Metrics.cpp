@@ -0,0 +1,188 @@
+
+// MARK: Includes
+
+#include "Metrics.h"
+#include "MotorLogic.h"
+#include <stdarg.h>
+
+// MARK: Constants
+
+const uint32_t BUCKET_BOUNDS[METRICS_BUCKET_COUNT] = {
+  100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+const char* BUCKET_LABELS[METRICS_BUCKET_COUNT] = {
+  "0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.05", "0.1", "0.25", "1"
+};
+
+const char* LOOP_STAGES[] = { "commands", "hardware", "web", "mqtt", "frame" };
+
+const unsigned long MOTOR_SAMPLE_INTERVAL = 1000; // ms
+
+Metrics* metrics_shared_instance = nullptr;
+
+// MARK: Text
+
+// Appends formatted text to a fixed buffer, remembers if anything was cut off
+class TextWriter {
+
+  public:
+
+    TextWriter(char* buffer, size_t size) : buffer(buffer), size(size), length(0), has_overflow(false) {}
+
+    void write(const char* format, ...) {
+      if (has_overflow) return;
+      va_list arguments;
+      va_start(arguments, format);
+      int written = vsnprintf(buffer + length, size - length, format, arguments);
+      va_end(arguments);
+      if ((written < 0) || ((size_t)written >= size - length)) {
+        has_overflow = true;
+        return;
+      }
+      length += written;
+    }
+
+    // Seconds with microsecond resolution, without floating point formatting
+    void writeSeconds(uint64_t microseconds) {
+      write("%llu.%06llu", microseconds / 1000000, microseconds % 1000000);
+    }
+
+    void writeHeader(const char* name, const char* type, const char* help) {
+      write("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    }
+
+    // labels: "" or e.g. "stage=\"mqtt\","
+    void writeHistogram(const char* name, const char* labels, const LatencyHistogram& histogram) {
+      uint32_t count = 0;
+      for (uint8_t i = 0; i < METRICS_BUCKET_COUNT; i++) {
+        count += histogram.counts[i];
+        write("%s_bucket{%sle=\"%s\"} %lu\n", name, labels, BUCKET_LABELS[i], (unsigned long)count);
+      }
+      write("%s_bucket{%sle=\"+Inf\"} %lu\n", name, labels, (unsigned long)histogram.count);
+
+      int labels_length = strlen(labels);
+      if (labels_length > 0) {
+        write("%s_sum{%.*s} ", name, labels_length - 1, labels); // Without the trailing comma
+      } else {
+        write("%s_sum ", name);
+      }
+      writeSeconds(histogram.sum);
+      if (labels_length > 0) {
+        write("\n%s_count{%.*s} %lu\n", name, labels_length - 1, labels, (unsigned long)histogram.count);
+      } else {
+        write("\n%s_count %lu\n", name, (unsigned long)histogram.count);
+      }
+    }
+
+    size_t getLength() {
+      return has_overflow ? 0 : length;
+    }
+
+  private:
+
+    char* buffer;
+    size_t size;
+    size_t length;
+    boolean has_overflow;
+
+};
+
+// MARK: Initialization
+
+Metrics::Metrics() {
+  memset(histograms, 0, sizeof(histograms));
+}
+
+// MARK: Static Methods
+
+Metrics* Metrics::getSharedInstance() {
+  if (metrics_shared_instance == nullptr) {
+    metrics_shared_instance = new Metrics();
+  }
+  return metrics_shared_instance;
+}
+
+// MARK: Methods
+
+void Metrics::observe(MetricsHistogram histogram, uint32_t duration) {
+  uint8_t bucket = 0;
+  while ((bucket < METRICS_BUCKET_COUNT) && (duration > BUCKET_BOUNDS[bucket])) {
+    bucket++;
+  }
+
+  portENTER_CRITICAL(&lock);
+  LatencyHistogram& target = histograms[histogram];
+  target.counts[bucket]++;
+  target.sum += duration;
+  target.count++;
+  portEXIT_CRITICAL(&lock);
+}
+
+void Metrics::countReconnectFailure() {
+  portENTER_CRITICAL(&lock);
+  reconnect_failure_count++;
+  portEXIT_CRITICAL(&lock);
+}
+
+void Metrics::loop() {
+  unsigned long now = millis();
+  if (now - motor_sampled_at < MOTOR_SAMPLE_INTERVAL) {
+    return;
+  }
+
+  uint32_t step_count = MotorLogic::getStepCount();
+  float rate = (float)(step_count - motor_step_count) * 1000 / (now - motor_sampled_at);
+  portENTER_CRITICAL(&lock);
+  motor_step_rate = rate;
+  portEXIT_CRITICAL(&lock);
+  motor_step_count = step_count;
+  motor_sampled_at = now;
+}
+
+size_t Metrics::write(char* buffer, size_t size) {
+  // One consistent copy, formatted outside of the critical section
+  LatencyHistogram snapshot[METRIC_HISTOGRAM_COUNT];
+  portENTER_CRITICAL(&lock);
+  memcpy(snapshot, histograms, sizeof(snapshot));
+  uint32_t reconnect_failures = reconnect_failure_count;
+  float step_rate = motor_step_rate;
+  portEXIT_CRITICAL(&lock);
+
+  TextWriter writer(buffer, size);
+  char labels[24];
+
+  writer.writeHeader("bionic_loop_stage_duration_seconds", "histogram", "Control loop time per frame and stage");
+  for (uint8_t stage = METRIC_LOOP_COMMANDS; stage <= METRIC_LOOP_FRAME; stage++) {
+    snprintf(labels, sizeof(labels), "stage=\"%s\",", LOOP_STAGES[stage - METRIC_LOOP_COMMANDS]);
+    writer.writeHistogram("bionic_loop_stage_duration_seconds", labels, snapshot[stage]);
+  }
+
+  writer.writeHeader("bionic_sensor_read_duration_seconds", "histogram", "Light, distance and touch sensor reads over I2C");
+  writer.writeHistogram("bionic_sensor_read_duration_seconds", "", snapshot[METRIC_SENSOR_READ]);
+  writer.writeHeader("bionic_led_show_duration_seconds", "histogram", "FastLED.show");
+  writer.writeHistogram("bionic_led_show_duration_seconds", "", snapshot[METRIC_LED_SHOW]);
+  writer.writeHeader("bionic_mqtt_publish_duration_seconds", "histogram", "MQTT publish on the MQTT task");
+  writer.writeHistogram("bionic_mqtt_publish_duration_seconds", "", snapshot[METRIC_MQTT_PUBLISH]);
+  writer.writeHeader("bionic_mqtt_reconnect_duration_seconds", "histogram", "MQTT connection attempts");
+  writer.writeHistogram("bionic_mqtt_reconnect_duration_seconds", "", snapshot[METRIC_MQTT_RECONNECT]);
+
+  writer.writeHeader("bionic_mqtt_reconnect_failures_total", "counter", "Failed MQTT connection attempts");
+  writer.write("bionic_mqtt_reconnect_failures_total %lu\n", (unsigned long)reconnect_failures);
+
+  writer.writeHeader("bionic_heap_free_bytes", "gauge", "Free heap");
+  writer.write("bionic_heap_free_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+  writer.writeHeader("bionic_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+  writer.write("bionic_heap_min_free_bytes %lu\n", (unsigned long)ESP.getMinFreeHeap());
+  writer.writeHeader("bionic_heap_largest_free_block_bytes", "gauge", "Largest allocatable heap block");
+  writer.write("bionic_heap_largest_free_block_bytes %lu\n", (unsigned long)ESP.getMaxAllocHeap());
+
+  writer.writeHeader("bionic_motor_steps_total", "counter", "Motor step timer calls");
+  writer.write("bionic_motor_steps_total %lu\n", (unsigned long)MotorLogic::getStepCount());
+  writer.writeHeader("bionic_motor_step_rate_hertz", "gauge", "Motor step timer calls per second, last second");
+  writer.write("bionic_motor_step_rate_hertz %.1f\n", step_rate);
+
+  writer.writeHeader("bionic_uptime_seconds", "gauge", "Time since boot");
+  writer.write("bionic_uptime_seconds %lu\n", (unsigned long)(millis() / 1000));
+
+  return writer.getLength();
+}
@@ -0,0 +1,75 @@
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include "Settings.h"
+
+// MARK: Types
+
+const uint8_t METRICS_BUCKET_COUNT = 12; // Bounds in Metrics.cpp, 100 us to 1 s
+
+enum MetricsHistogram : uint8_t {
+  // Control loop stages, one observation per frame
+  METRIC_LOOP_COMMANDS = 0, // CommandQueue::applyPending
+  METRIC_LOOP_HARDWARE, // HardwareService::loop
+  METRIC_LOOP_WEB, // State push and live stream
+  METRIC_LOOP_MQTT, // MQTTService::loop
+  METRIC_LOOP_FRAME, // All of the above
+  METRIC_SENSOR_READ, // readSensors, I2C bus held
+  METRIC_LED_SHOW, // FastLED.show
+  METRIC_MQTT_PUBLISH, // PubSubClient::publish, MQTT task
+  METRIC_MQTT_RECONNECT, // Connect, subscriptions and discovery
+  METRIC_HISTOGRAM_COUNT
+};
+
+// Durations in fixed buckets, no allocation
+struct LatencyHistogram {
+  uint32_t counts[METRICS_BUCKET_COUNT + 1]; // Per bucket, the last one is +Inf
+  uint64_t sum; // us
+  uint32_t count;
+};
+
+// Counters and latency histograms of the control loop, the sensors, the LEDs
+// and MQTT, plus heap and motor statistics, rendered in the Prometheus text
+// format for /metrics. Observations are cheap and safe from any task; the
+// rendering works on a copy taken in one critical section, so the buckets,
+// sums and counts of a scrape always match.
+class Metrics {
+
+  public:
+
+    // MARK: Static Methods
+
+    static Metrics* getSharedInstance();
+
+    // MARK: Methods
+
+    void observe(MetricsHistogram histogram, uint32_t duration); // us, any task
+    void countReconnectFailure(); // MQTT task
+    void loop(); // Control loop, once per frame
+
+    size_t write(char* buffer, size_t size); // Prometheus text format, 0 if the buffer is too small
+
+  private:
+
+    // MARK: Initialization
+
+    Metrics();
+
+    // MARK: Properties
+
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    LatencyHistogram histograms[METRIC_HISTOGRAM_COUNT];
+    uint32_t reconnect_failure_count = 0;
+
+    // Motor step timer rate, sampled by the control loop
+    uint32_t motor_step_count = 0;
+    unsigned long motor_sampled_at = 0;
+    float motor_step_rate = 0; // Hz
+
+};
+
+#endif
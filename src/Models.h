@@ -59,6 +59,29 @@ struct Color {
   }
 };
 
+enum GestureAction : uint8_t {
+  GESTURE_ACTION_NONE = 0,
+  GESTURE_ACTION_TOGGLE_LIGHT,
+  GESTURE_ACTION_NEXT_EFFECT,
+  GESTURE_ACTION_PREVIOUS_EFFECT,
+  GESTURE_ACTION_TOGGLE_COVER,
+  GESTURE_ACTION_OPEN_COVER,
+  GESTURE_ACTION_CLOSE_COVER,
+  GESTURE_ACTION_TOGGLE_ADAPTIVE_BRIGHTNESS,
+  GESTURE_ACTION_COUNT
+};
+
+static const char* const GESTURE_ACTION_NAMES[GESTURE_ACTION_COUNT] = {
+  "none",
+  "toggle_light",
+  "next_effect",
+  "previous_effect",
+  "toggle_cover",
+  "open_cover",
+  "close_cover",
+  "toggle_adaptive_brightness",
+};
+
 struct Configuration {
   float motor_position; // Motor Position [0 (closed), 1 (open)]
   float upper_brightness_threshold; // Brightness Threshold [0, 1]
@@ -73,6 +96,7 @@ struct SensorData {
 
   boolean has_light_sensor;
   float brightness; // Ambient Light Sensor Value [0 (dark), 1 (bright)]
+  float illuminance; // Ambient Light Sensor Value [lx]
   float distance; // Proximity Sensor Value [0 (close), 1 (far)]
 
   boolean has_touch_sensor;
@@ -387,6 +387,17 @@ MotorLogic::getMotorPosition()
     return m_motorposition_i32;
 }
 
+/* ********************************* METHOD **********************************/
+/**
+ * \brief     get number of motor timer steps since setup (wraps around)
+ *
+ *****************************************************************************/
+uint32_t
+MotorLogic::getStepCount() 
+{
+    return m_motor_state_i32;
+}
+
 /* ********************************* METHOD **********************************/
 /**
  * \brief     get motor direction
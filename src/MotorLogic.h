@@ -111,6 +111,7 @@ public:
     static uint32_t getSteppingFactor( );
     
     static uint32_t getMotorPosition();
+    static uint32_t getStepCount();
     EDirection_t getDirection();
     uint32_t getState() const;
 
@@ -0,0 +1,102 @@
+
+// MARK: Includes
+
+#include "ProximityGestureDetector.h"
+#include "Settings.h"
+
+// MARK: Constants
+
+const char* PROXIMITY_GESTURE_NAMES[PROXIMITY_GESTURE_COUNT] = {
+  "approach",
+  "hover",
+  "wave",
+};
+
+const uint8_t APPROACH_SLOPE_SAMPLES = 3; // Rising over the last 3 samples (150 ms)
+const float BASELINE_RISE_RATE = 0.01f; // Slowly follow crosstalk drift
+const float BASELINE_FALL_RATE = 0.1f;
+
+// MARK: Initialization
+
+ProximityGestureDetector::ProximityGestureDetector() {
+  reset();
+}
+
+// MARK: Static Methods
+
+const char* ProximityGestureDetector::getName(ProximityGesture gesture) {
+  if (gesture >= PROXIMITY_GESTURE_COUNT) {
+    return "none";
+  }
+  return PROXIMITY_GESTURE_NAMES[gesture];
+}
+
+// MARK: Methods
+
+void ProximityGestureDetector::reset() {
+  sample_head = 0;
+  sample_count = 0;
+  baseline = 0;
+  is_near = false;
+  has_approached = false;
+  has_hovered = false;
+  near_since = 0;
+}
+
+ProximityGesture ProximityGestureDetector::addSample(uint16_t value, unsigned long now) {
+  samples[sample_head] = { value, now };
+  sample_head = (sample_head + 1) % BUFFER_SIZE;
+  if (sample_count < BUFFER_SIZE) sample_count++;
+
+  if (sample_count == 1) {
+    baseline = value;
+  }
+
+  float delta = value - baseline;
+  ProximityGesture gesture = PROXIMITY_NONE;
+
+  // Leaving the near zone: a short visit is a wave
+  if (is_near && (delta < PROXIMITY_NEAR_DELTA / 2)) {
+    is_near = false;
+    if (!has_hovered && (now - near_since <= PROXIMITY_WAVE_DURATION)) {
+      gesture = PROXIMITY_WAVE;
+    }
+  }
+
+  // Approach: above the approach level and still rising
+  uint8_t age = min((uint8_t)(sample_count - 1), APPROACH_SLOPE_SAMPLES);
+  if (!has_approached && (age > 0) && (delta >= PROXIMITY_APPROACH_DELTA) &&
+      ((int32_t)value - (int32_t)getSample(age).value >= PROXIMITY_APPROACH_DELTA / 2)) {
+    has_approached = true;
+    if (gesture == PROXIMITY_NONE) gesture = PROXIMITY_APPROACH;
+  }
+
+  // Entering the near zone
+  if (!is_near && (delta >= PROXIMITY_NEAR_DELTA)) {
+    is_near = true;
+    has_hovered = false;
+    near_since = now;
+  }
+
+  // Staying in the near zone: hover
+  if (is_near && !has_hovered && (now - near_since >= PROXIMITY_HOVER_DURATION)) {
+    has_hovered = true;
+    if (gesture == PROXIMITY_NONE) gesture = PROXIMITY_HOVER;
+  }
+
+  // Back to far: re-arm approach and follow the baseline
+  if (!is_near && (delta < PROXIMITY_APPROACH_DELTA / 2)) {
+    has_approached = false;
+    float rate = (delta < 0) ? BASELINE_FALL_RATE : BASELINE_RISE_RATE;
+    baseline += rate * delta;
+  }
+
+  return gesture;
+}
+
+// MARK: Helpers
+
+// age 0 = newest sample
+const ProximityGestureDetector::Sample& ProximityGestureDetector::getSample(uint8_t age) {
+  return samples[(sample_head + BUFFER_SIZE - 1 - age) % BUFFER_SIZE];
+}
@@ -0,0 +1,68 @@
+
+#ifndef PROXIMITYGESTUREDETECTOR_H_
+#define PROXIMITYGESTUREDETECTOR_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+
+// MARK: Types
+
+enum ProximityGesture : uint8_t {
+  PROXIMITY_APPROACH = 0,
+  PROXIMITY_HOVER,
+  PROXIMITY_WAVE,
+  PROXIMITY_GESTURE_COUNT,
+  PROXIMITY_NONE = 0xFF
+};
+
+// Detects approach, hover and wave gestures from the trajectory of raw
+// RPR-0521RS PS samples. Samples are kept in a ring buffer; thresholds are
+// relative to a baseline that follows the crosstalk of the housing.
+class ProximityGestureDetector {
+
+  public:
+
+    // MARK: Initialization
+
+    ProximityGestureDetector();
+
+    // MARK: Static Methods
+
+    static const char* getName(ProximityGesture gesture);
+
+    // MARK: Methods
+
+    ProximityGesture addSample(uint16_t value, unsigned long now);
+    void reset();
+
+  private:
+
+    // MARK: Types
+
+    struct Sample {
+      uint16_t value;
+      unsigned long time;
+    };
+
+    // MARK: Properties
+
+    static const uint8_t BUFFER_SIZE = 32;
+
+    Sample samples[BUFFER_SIZE];
+    uint8_t sample_head;
+    uint8_t sample_count;
+
+    float baseline;
+    boolean is_near;
+    boolean has_approached;
+    boolean has_hovered;
+    unsigned long near_since;
+
+    // MARK: Methods
+
+    const Sample& getSample(uint8_t age);
+
+};
+
+#endif
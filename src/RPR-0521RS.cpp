@@ -37,7 +37,7 @@ uint8_t RPR0521RS::init(void)
   uint8_t reg;
   uint8_t index;
   uint8_t als_gain_table[] = {1, 2, 64, 128};
-  uint32_t als_meas_time_table[] = {0,0,0,0,0,100,100,100,100,100,400,400,50,0,0,0};
+  uint32_t als_meas_time_table[] = {0,0,0,0,0,100,100,100,400,400,400,400,50,0,0,0};
 
   rc = read(RPR0521RS_SYSTEM_CONTROL, &reg, sizeof(reg));
   if (rc != 0) {
@@ -132,12 +132,36 @@ uint8_t RPR0521RS::get_rawpsalsval(uint8_t *data)
   return (rc);
 }
 
+uint8_t RPR0521RS::get_psval(uint32_t *ps)
+{
+  uint8_t rc;
+  uint8_t val[2];
+
+  rc = read(RPR0521RS_PS_DATA_LSB, val, sizeof(val));
+  if (rc != 0) {
+    return (rc);
+  }
+
+  *ps = (((uint32_t)val[1] << 8) | val[0]) & 0x0FFF;
+
+  return (rc);
+}
+
 uint8_t RPR0521RS::get_psalsval(uint32_t *ps, float *als)
+{
+  uint32_t rawals[2];
+
+  return (get_psalsval(ps, als, rawals));
+}
+
+// Same as above, but also hands back the raw DATA0/DATA1 counts so the caller
+// can decide whether the current gain/measurement time is still in range.
+uint8_t RPR0521RS::get_psalsval(uint32_t *ps, float *als, uint32_t *rawals)
 {
   uint8_t rc;
   uint8_t val[6];
   uint32_t rawps;
-  uint32_t rawals[2];
+  uint32_t data[2];
 
   rc = get_rawpsalsval(val);
   if (rc != 0) {
@@ -148,12 +172,66 @@ uint8_t RPR0521RS::get_psalsval(uint32_t *ps, float *als)
   rawals[0] = ((uint32_t)val[3] << 8) | val[2];
   rawals[1] = ((uint32_t)val[5] << 8) | val[4];
 
+  // convert_lx() clamps its input in 50 ms mode, keep the raw counts untouched
+  data[0] = rawals[0];
+  data[1] = rawals[1];
+
   *ps  = rawps;
-  *als = convert_lx(rawals);
+  *als = convert_lx(data);
+
+  return (rc);
+}
+
+// Reconfigures DATA0/DATA1 gain (RPR0521RS_ALS_GAIN_*) and the ALS/PS measurement
+// time (RPR0521RS_MODE_CONTROL_MEASTIME_*). LED current and the PS/ALS enable bits
+// are preserved. The next result is only valid after one full measurement time.
+uint8_t RPR0521RS::set_als_range(uint8_t gain, uint8_t meas_time)
+{
+  uint8_t rc;
+  uint8_t reg;
+  uint8_t als_gain_table[] = {1, 2, 64, 128};
+  uint32_t als_meas_time_table[] = {0,0,0,0,0,100,100,100,400,400,400,400,50,0,0,0};
+
+  gain &= 0x03;
+  meas_time &= RPR0521RS_MODE_CONTROL_MEASTIME_MASK;
+
+  rc = read(RPR0521RS_ALS_PS_CONTROL, &reg, sizeof(reg));
+  if (rc != 0) {
+    return (rc);
+  }
+  reg = (reg & RPR0521RS_ALS_PS_CONTROL_LED_CURRENT_MASK) | (gain << 4) | (gain << 2);
+  rc = write(RPR0521RS_ALS_PS_CONTROL, &reg, sizeof(reg));
+  if (rc != 0) {
+    return (rc);
+  }
+
+  rc = read(RPR0521RS_MODE_CONTROL, &reg, sizeof(reg));
+  if (rc != 0) {
+    return (rc);
+  }
+  reg = (reg & ~RPR0521RS_MODE_CONTROL_MEASTIME_MASK) | meas_time;
+  rc = write(RPR0521RS_MODE_CONTROL, &reg, sizeof(reg));
+  if (rc != 0) {
+    return (rc);
+  }
+
+  _als_data0_gain = als_gain_table[gain];
+  _als_data1_gain = als_gain_table[gain];
+  _als_measure_time = als_meas_time_table[meas_time];
 
   return (rc);
 }
 
+uint32_t RPR0521RS::get_als_gain(void)
+{
+  return (_als_data0_gain);
+}
+
+uint32_t RPR0521RS::get_als_measure_time(void)
+{
+  return (_als_measure_time);
+}
+
 uint8_t RPR0521RS::check_near_far(uint32_t data)
 {
   if (data >= RPR0521RS_NEAR_THRESH) {
@@ -187,8 +265,8 @@ float RPR0521RS::convert_lx(uint32_t *data)
     }
   }
 
-  d0 = (float)data[0] * (100 / _als_measure_time) / _als_data0_gain;
-  d1 = (float)data[1] * (100 / _als_measure_time) / _als_data1_gain;
+  d0 = (float)data[0] * (100.0f / _als_measure_time) / _als_data0_gain;
+  d1 = (float)data[1] * (100.0f / _als_measure_time) / _als_data1_gain;
 
   if (d0 == 0) {
     lx = 0;
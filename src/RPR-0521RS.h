@@ -39,14 +39,24 @@
 #define RPR0521RS_ALS_DATA0_LSB                    (0x46)
 #define RPR0521RS_MANUFACT_ID                      (0x92)
 
+#define RPR0521RS_MODE_CONTROL_MEASTIME_100_50MS   (5 << 0)
 #define RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS  (6 << 0)
+#define RPR0521RS_MODE_CONTROL_MEASTIME_400_400MS  (11 << 0)
+#define RPR0521RS_MODE_CONTROL_MEASTIME_50_50MS    (12 << 0)
+#define RPR0521RS_MODE_CONTROL_MEASTIME_MASK       (0x0F)
 #define RPR0521RS_MODE_CONTROL_PS_EN               (1 << 6)
 #define RPR0521RS_MODE_CONTROL_ALS_EN              (1 << 7)
 
 #define RPR0521RS_ALS_PS_CONTROL_LED_CURRENT_100MA (2 << 0)
+#define RPR0521RS_ALS_PS_CONTROL_LED_CURRENT_MASK  (0x03)
 #define RPR0521RS_ALS_PS_CONTROL_DATA1_GAIN_X1     (0 << 2)
 #define RPR0521RS_ALS_PS_CONTROL_DATA0_GAIN_X1     (0 << 4)
 
+#define RPR0521RS_ALS_GAIN_X1                      (0)
+#define RPR0521RS_ALS_GAIN_X2                      (1)
+#define RPR0521RS_ALS_GAIN_X64                     (2)
+#define RPR0521RS_ALS_GAIN_X128                    (3)
+
 #define RPR0521RS_PS_CONTROL_PS_GAINX1             (0 << 4)
 
 #define RPR0521RS_MODE_CONTROL_VAL                 (RPR0521RS_MODE_CONTROL_MEASTIME_100_100MS | RPR0521RS_MODE_CONTROL_PS_EN | RPR0521RS_MODE_CONTROL_ALS_EN)
@@ -66,7 +76,12 @@ class RPR0521RS
     uint8_t init(void);
     boolean is_connected(void);
     uint8_t get_rawpsalsval(uint8_t *data);
+    uint8_t get_psval(uint32_t *ps);
     uint8_t get_psalsval(uint32_t *ps, float *als);
+    uint8_t get_psalsval(uint32_t *ps, float *als, uint32_t *rawals);
+    uint8_t set_als_range(uint8_t gain, uint8_t meas_time);
+    uint32_t get_als_gain(void);
+    uint32_t get_als_measure_time(void);
     uint8_t check_near_far(uint32_t data);
     float convert_lx(uint32_t *data);
     uint8_t write(uint8_t memory_address, uint8_t *data, uint8_t size);
@@ -0,0 +1,195 @@
+
+// MARK: Includes
+
+#include "RealtimeDecoder.h"
+
+// MARK: Constants
+
+// DDP, http://www.3waylabs.com/ddp/
+const size_t DDP_HEADER_LENGTH = 10;
+const size_t DDP_TIMECODE_LENGTH = 4;
+const uint8_t DDP_VERSION_MASK = 0xC0;
+const uint8_t DDP_VERSION_1 = 0x40;
+const uint8_t DDP_FLAG_TIMECODE = 0x10;
+const uint8_t DDP_FLAG_REPLY = 0x04;
+const uint8_t DDP_FLAG_QUERY = 0x02;
+const uint8_t DDP_FLAG_PUSH = 0x01;
+const uint8_t DDP_SEQUENCE_MASK = 0x0F;
+const uint8_t DDP_TYPE_MASK = 0x38;
+const uint8_t DDP_TYPE_RGB = 0x08;
+const uint8_t DDP_ID_DISPLAY = 1;
+const uint8_t DDP_ID_STATUS = 251;
+const uint8_t DDP_ID_ALL = 255;
+const size_t DDP_STATUS_LENGTH = 160;
+const int8_t DDP_LATE_WINDOW = 8; // Half of the 15 sequence numbers
+
+// E1.31 (ANSI E1.31-2018), offsets into the data packet
+const char E131_PACKET_IDENTIFIER[] = "ASC-E1.17";
+const size_t E131_PACKET_IDENTIFIER_OFFSET = 4;
+const size_t E131_ROOT_VECTOR_OFFSET = 18;
+const size_t E131_FRAMING_VECTOR_OFFSET = 40;
+const size_t E131_SEQUENCE_OFFSET = 111;
+const size_t E131_OPTIONS_OFFSET = 112;
+const size_t E131_UNIVERSE_OFFSET = 113;
+const size_t E131_DMP_VECTOR_OFFSET = 117;
+const size_t E131_VALUE_COUNT_OFFSET = 123;
+const size_t E131_START_CODE_OFFSET = 125;
+const size_t E131_HEADER_LENGTH = 126;
+const uint32_t E131_VECTOR_ROOT_DATA = 0x00000004;
+const uint32_t E131_VECTOR_DATA_PACKET = 0x00000002;
+const uint8_t E131_VECTOR_DMP_SET_PROPERTY = 0x02;
+const uint8_t E131_OPTION_PREVIEW = 0x80;
+const uint8_t E131_OPTION_TERMINATED = 0x40;
+const int8_t E131_LATE_WINDOW = 20; // Sequence numbers this far behind are late, further back the source restarted
+
+// MARK: Functions
+
+static uint16_t readUInt16(const uint8_t* data) {
+  return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static uint32_t readUInt32(const uint8_t* data) {
+  return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+}
+
+// MARK: Initialization
+
+RealtimeDecoder::RealtimeDecoder(RealtimeOutput* output) {
+  this->output = output;
+  memset(frame, 0, sizeof(frame));
+}
+
+// MARK: Methods
+
+void RealtimeDecoder::handleDDP(const uint8_t* data, size_t length) {
+  if ((length < DDP_HEADER_LENGTH) || ((data[0] & DDP_VERSION_MASK) != DDP_VERSION_1)) {
+    return;
+  }
+
+  uint8_t flags = data[0];
+  uint8_t sequence = data[1] & DDP_SEQUENCE_MASK;
+  uint8_t type = data[2];
+  uint8_t id = data[3];
+  uint32_t offset = readUInt32(data + 4);
+  uint16_t data_length = readUInt16(data + 8);
+  size_t header_length = DDP_HEADER_LENGTH + ((flags & DDP_FLAG_TIMECODE) ? DDP_TIMECODE_LENGTH : 0);
+
+  if (flags & DDP_FLAG_REPLY) {
+    return;
+  }
+  if (flags & DDP_FLAG_QUERY) {
+    if (id == DDP_ID_STATUS) {
+      replyDDPStatus(sequence);
+    }
+    return;
+  }
+  if (((id != DDP_ID_DISPLAY) && (id != DDP_ID_ALL)) || ((type & DDP_TYPE_MASK) > DDP_TYPE_RGB)) {
+    return;
+  }
+  if ((length < header_length) || (length - header_length < data_length)) {
+    return;
+  }
+
+  // 1 to 15, wrapping to 1, 0 = the sender doesn't count
+  if ((sequence != 0) && (ddp_sequence != 0) && output->isRealtimeActive()) {
+    int8_t difference = (sequence - ddp_sequence + 15) % 15;
+    if (difference > 7) {
+      difference -= 15;
+    }
+    if (!acceptSequence(difference, DDP_LATE_WINDOW)) {
+      return;
+    }
+  }
+  ddp_sequence = sequence;
+
+  if (offset < sizeof(frame)) {
+    memcpy(frame + offset, data + header_length, min((size_t)data_length, sizeof(frame) - offset));
+  }
+  if (flags & DDP_FLAG_PUSH) {
+    show();
+  }
+}
+
+void RealtimeDecoder::handleE131(const uint8_t* data, size_t length) {
+  if ((length < E131_HEADER_LENGTH) ||
+      (memcmp(data + E131_PACKET_IDENTIFIER_OFFSET, E131_PACKET_IDENTIFIER, sizeof(E131_PACKET_IDENTIFIER)) != 0) ||
+      (readUInt32(data + E131_ROOT_VECTOR_OFFSET) != E131_VECTOR_ROOT_DATA) ||
+      (readUInt32(data + E131_FRAMING_VECTOR_OFFSET) != E131_VECTOR_DATA_PACKET) ||
+      (data[E131_DMP_VECTOR_OFFSET] != E131_VECTOR_DMP_SET_PROPERTY) ||
+      (readUInt16(data + E131_UNIVERSE_OFFSET) != REALTIME_E131_UNIVERSE)) {
+    return;
+  }
+
+  uint8_t options = data[E131_OPTIONS_OFFSET];
+  if (options & E131_OPTION_PREVIEW) {
+    return;
+  }
+  if (options & E131_OPTION_TERMINATED) {
+    has_e131_sequence = false;
+    output->endRealtime();
+    return;
+  }
+  if (data[E131_START_CODE_OFFSET] != 0) {
+    return; // Not dimmer data (e.g. RDM, per-address priority)
+  }
+
+  uint8_t sequence = data[E131_SEQUENCE_OFFSET];
+  if (has_e131_sequence && output->isRealtimeActive()) {
+    if (!acceptSequence((int8_t)(sequence - e131_sequence), E131_LATE_WINDOW)) {
+      return;
+    }
+  }
+  e131_sequence = sequence;
+  has_e131_sequence = true;
+
+  // Property values include the start code
+  size_t value_count = min((size_t)readUInt16(data + E131_VALUE_COUNT_OFFSET), length - E131_START_CODE_OFFSET);
+  size_t slot_count = (value_count > 0) ? value_count - 1 : 0;
+  size_t first_slot = REALTIME_E131_START_ADDRESS - 1;
+  if (first_slot < slot_count) {
+    memcpy(frame, data + E131_HEADER_LENGTH + first_slot, min(slot_count - first_slot, sizeof(frame)));
+  }
+  show();
+}
+
+// MARK: Helpers
+
+void RealtimeDecoder::replyDDPStatus(uint8_t sequence) {
+  uint8_t reply[DDP_HEADER_LENGTH + DDP_STATUS_LENGTH];
+  int status_length = snprintf((char*)reply + DDP_HEADER_LENGTH, DDP_STATUS_LENGTH,
+                               "{\"status\":{\"frames\":%lu,\"lost\":%lu,\"late\":%lu,\"show_us\":%u,\"active\":%s}}",
+                               (unsigned long)frame_count, (unsigned long)lost_packet_count,
+                               (unsigned long)late_packet_count, show_duration,
+                               output->isRealtimeActive() ? "true" : "false");
+  if ((status_length < 0) || ((size_t)status_length >= DDP_STATUS_LENGTH)) {
+    return;
+  }
+
+  reply[0] = DDP_VERSION_1 | DDP_FLAG_REPLY | DDP_FLAG_PUSH;
+  reply[1] = sequence;
+  reply[2] = 0;
+  reply[3] = DDP_ID_STATUS;
+  memset(reply + 4, 0, 4);
+  reply[8] = status_length >> 8;
+  reply[9] = status_length & 0xFF;
+  output->reply(reply, DDP_HEADER_LENGTH + status_length);
+}
+
+// difference: sequence number minus the last one, late_window: how far back a packet counts as late
+boolean RealtimeDecoder::acceptSequence(int8_t difference, int8_t late_window) {
+  if ((difference <= 0) && (difference > -late_window)) {
+    late_packet_count++;
+    return false;
+  }
+  if (difference > 1) {
+    lost_packet_count += difference - 1;
+  }
+  return true;
+}
+
+void RealtimeDecoder::show() {
+  unsigned long show_started_at = micros();
+  output->showFrame(frame);
+  show_duration = min(micros() - show_started_at, 65535UL);
+  frame_count++;
+}
@@ -0,0 +1,73 @@
+#ifndef REALTIMEDECODER_H_
+#define REALTIMEDECODER_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include "RealtimeOutput.h"
+#include "Settings.h"
+
+// Decodes DDP and E1.31 packets into LED frames. Works on plain packet
+// buffers, so it builds without the network stack (RealtimeReceiver feeds it
+// from the UDP sockets):
+//
+//   DDP: RGB data for output 1, shown on the push flag. A query for the
+//     status id (251) is answered with a JSON status, sent after all earlier
+//     packets were shown, so its round trip bounds the frame latency
+//     (realtime_sender.py).
+//   E1.31/sACN: REALTIME_E131_START_ADDRESS is the first slot, three per
+//     LED. Preview data is ignored, "stream terminated" hands the LEDs back
+//     right away.
+//
+// Packets arriving late (sequence number behind the last one) are dropped,
+// skipped sequence numbers are counted as lost.
+class RealtimeDecoder {
+
+  public:
+
+    // MARK: Initialization
+
+    RealtimeDecoder(RealtimeOutput* output);
+
+    // MARK: Methods
+
+    void handleDDP(const uint8_t* data, size_t length);
+    void handleE131(const uint8_t* data, size_t length);
+
+    uint32_t getFrameCount() {
+      return frame_count;
+    }
+
+    uint32_t getLostPacketCount() {
+      return lost_packet_count;
+    }
+
+    uint32_t getLatePacketCount() {
+      return late_packet_count;
+    }
+
+  private:
+
+    // MARK: Properties
+
+    RealtimeOutput* output;
+
+    // Both protocols are decoded on the same task
+    uint8_t frame[3 * LED_COUNT];
+    uint8_t ddp_sequence = 0; // 0 = none
+    uint8_t e131_sequence = 0;
+    boolean has_e131_sequence = false;
+    uint32_t frame_count = 0;
+    uint32_t lost_packet_count = 0;
+    uint32_t late_packet_count = 0;
+    uint16_t show_duration = 0; // us, last frame
+
+    // MARK: Helpers
+
+    void replyDDPStatus(uint8_t sequence);
+    boolean acceptSequence(int8_t difference, int8_t late_window);
+    void show();
+
+};
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef REALTIMEOUTPUT_H_
+#define REALTIMEOUTPUT_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+
+// Where RealtimeDecoder sends what it decoded: the LEDs and the sender of
+// the packet being handled. RealtimeReceiver is the real one, the host tests
+// record the calls.
+class RealtimeOutput {
+
+  public:
+
+    virtual ~RealtimeOutput() {}
+
+    // MARK: LEDs
+
+    virtual void showFrame(const uint8_t* rgb) = 0; // LED_COUNT colors
+    virtual void endRealtime() = 0; // The active effect takes over right away
+    virtual boolean isRealtimeActive() = 0; // A frame within REALTIME_TIMEOUT
+
+    // MARK: Replies
+
+    virtual void reply(const uint8_t* data, size_t length) = 0;
+
+};
+
+#endif
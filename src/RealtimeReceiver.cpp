@@ -0,0 +1,62 @@
+
+// MARK: Includes
+
+#include "RealtimeReceiver.h"
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[REALTIME]: ";
+
+// MARK: Initialization
+
+RealtimeReceiver::RealtimeReceiver() : decoder(this) {
+  hardware_service = HardwareService::getSharedInstance();
+}
+
+// MARK: Methods
+
+boolean RealtimeReceiver::start() {
+  if (!ddp.listen(REALTIME_DDP_PORT)) {
+    Serial.println(PRINT_PREFIX + "DDP listen failed.");
+    return false;
+  }
+  ddp.onPacket([this](AsyncUDPPacket packet) {
+    this->packet = &packet;
+    decoder.handleDDP(packet.data(), packet.length());
+    this->packet = nullptr;
+  });
+
+  IPAddress group = IPAddress(239, 255, REALTIME_E131_UNIVERSE >> 8, REALTIME_E131_UNIVERSE & 0xFF);
+  if (!e131.listenMulticast(group, REALTIME_E131_PORT)) {
+    Serial.println(PRINT_PREFIX + "E1.31 listen failed.");
+    return false;
+  }
+  e131.onPacket([this](AsyncUDPPacket packet) {
+    this->packet = &packet;
+    decoder.handleE131(packet.data(), packet.length());
+    this->packet = nullptr;
+  });
+
+  Serial.println(PRINT_PREFIX + "DDP on port " + String(REALTIME_DDP_PORT) + ", E1.31 universe " + String(REALTIME_E131_UNIVERSE));
+  return true;
+}
+
+// MARK: RealtimeOutput
+
+void RealtimeReceiver::showFrame(const uint8_t* rgb) {
+  hardware_service->showRealtimeFrame(rgb);
+}
+
+void RealtimeReceiver::endRealtime() {
+  hardware_service->endRealtime();
+}
+
+boolean RealtimeReceiver::isRealtimeActive() {
+  return hardware_service->isRealtimeActive();
+}
+
+void RealtimeReceiver::reply(const uint8_t* data, size_t length) {
+  if (packet != nullptr) {
+    packet->write(data, length);
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef REALTIMERECEIVER_H_
+#define REALTIMERECEIVER_H_
+
+// MARK: Includes
+
+#include <AsyncUDP.h>
+#include "HardwareService.h"
+#include "RealtimeDecoder.h"
+#include "Settings.h"
+
+// Receives LED frames from lighting software over UDP and shows them as soon
+// as they arrive, on the UDP task, without waiting for the next control loop
+// frame (decoding in RealtimeDecoder):
+//
+//   DDP on port REALTIME_DDP_PORT.
+//   E1.31/sACN on port REALTIME_E131_PORT, multicast group of universe
+//     REALTIME_E131_UNIVERSE or unicast.
+//
+// The active effect resumes REALTIME_TIMEOUT after the last frame.
+class RealtimeReceiver : public RealtimeOutput {
+
+  public:
+
+    // MARK: Initialization
+
+    RealtimeReceiver();
+
+    // MARK: Methods
+
+    boolean start(); // Once WiFi is connected
+
+    uint32_t getFrameCount() {
+      return decoder.getFrameCount();
+    }
+
+    uint32_t getLostPacketCount() {
+      return decoder.getLostPacketCount();
+    }
+
+    uint32_t getLatePacketCount() {
+      return decoder.getLatePacketCount();
+    }
+
+    // MARK: RealtimeOutput
+
+    void showFrame(const uint8_t* rgb) override;
+    void endRealtime() override;
+    boolean isRealtimeActive() override;
+    void reply(const uint8_t* data, size_t length) override;
+
+  private:
+
+    // MARK: Properties
+
+    HardwareService* hardware_service;
+    AsyncUDP ddp;
+    AsyncUDP e131;
+
+    // Both sockets are served by the same UDP task
+    RealtimeDecoder decoder;
+    AsyncUDPPacket* packet = nullptr; // Being decoded, for replies
+
+};
+
+#endif
@@ -11,10 +11,25 @@
 #define DEFAULT_AMBIENT_BRIGHTNESS 0.02f
 #define DEFAULT_BRIGHTNESS_THRESHOLD_DISTANCE 0.01f
 #define DEFAULT_DISTANCE_THRESHOLD 0.6f // default ADC touch threshold
+#define LIGHT_SENSOR_LUX_CALIBRATION 1.0f // reference lux / sensor lux (compensates the housing)
+#define ENABLE_LED_COMPENSATION true // subtract the flower's own LED light from ambient readings
+#define LED_SELF_ILLUMINATION_LUX 20.0f // initial estimate: lux at the sensor per full white LED (learned at runtime)
 #define DEFAULT_AUTONOMY_VALUE 0  // Start in Manual mode
 #define MOTOR_SPEED_SLOW 0.002f
 #define MOTOR_SPEED_FAST 0.001f
 
+// Touch gesture timings [ms] (defaults, adjustable via MQTT)
+#define TOUCH_LONG_PRESS_DURATION 800
+#define TOUCH_DOUBLE_TAP_INTERVAL 250 // 0 = disable double tap (taps fire without delay)
+#define TOUCH_SWIPE_INTERVAL 300 // 0 = disable swipes
+
+// Touch sensor self-calibration (CAP1203 delta counts)
+#define ENABLE_TOUCH_CALIBRATION true
+#define TOUCH_CALIBRATION_SAMPLE_INTERVAL 500 // ms between delta count samples
+#define TOUCH_CALIBRATION_INTERVAL 60000 // ms between adjustments
+#define TOUCH_MIN_THRESHOLD 32 // lowest touch threshold [delta counts]
+#define TOUCH_MAX_SENSITIVITY SENSITIVITY_32X // most sensitive setting the calibration may choose
+
 #define LED_COUNT 5
 #define LED_PIN 16
 
@@ -25,16 +40,69 @@
 
 #define DEBUG_AUTONOMOUS_MODE false
 #define DEBUG_MANUAL_MODE true
+#define DEBUG_LOOP_TIMING false // print the longest control loop pass every minute
+
+// Animations on the shared NTP clock, flowers with the same effect stay in step
+#define ANIMATION_FRAME_DURATION 100 // ms, one control loop pass
+#define ANIMATION_CLOCK_SLEW_STEP 2 // ms a clock correction may move the animations per frame
+#define ANIMATION_CLOCK_MAX_SLEW 1000 // ms, larger corrections jump
+#define ANIMATION_CLOCK_REPORT_INTERVAL 60000 // ms between alignment reports via MQTT
+#define ANIMATION_MAX_START_DELAY 60000 // ms, commands starting later than this apply right away
+
+// Binary diagnostics stream, switched on via MQTT (bionic_flower/<id>/diagnostics/set)
+#define ENABLE_DIAGNOSTICS true
+#define DIAGNOSTICS_BATCH_SIZE 20 // records (one per frame) per message, at most 20 for the MQTT buffer
+
+// Web UI state push (/events), replaces polling /sensorData
+#define WEB_EVENTS_MIN_INTERVAL 250 // ms between pushed state updates
+#define WEB_EVENTS_RECONNECT_INTERVAL 2000 // ms the browser waits before reconnecting
+
+// Live LED/motor stream (/live)
+#define LIVE_STREAM_INTERVAL 100 // ms between frames, unless the client asks for another interval
+#define LIVE_STREAM_MAX_INTERVAL 5000 // ms
+#define LIVE_STREAM_MAX_CLIENTS 4
+
+// Firmware updates over WiFi (POST /api/v1/ota, bionic_flower/<id>/ota/set)
+#define OTA_CHUNK_SIZE 4096 // bytes per flash write, one sector
+#define OTA_HEALTH_TIMEOUT 120 // s a new image has to connect to MQTT before the previous one is restored
+#define OTA_MAX_BOOT_ATTEMPTS 3 // boots of an unconfirmed image before it is rolled back
+#define OTA_PROGRESS_STEP 10 // % between progress reports
+
+// Realtime LED frames over UDP from lighting software (DDP, E1.31/sACN)
+#define ENABLE_REALTIME_RECEIVER true
+#define REALTIME_DDP_PORT 4048
+#define REALTIME_E131_PORT 5568
+#define REALTIME_E131_UNIVERSE 1 // also selects the multicast group 239.255.0.1
+#define REALTIME_E131_START_ADDRESS 1 // first DMX slot, 3 per LED (red, green, blue)
+#define REALTIME_TIMEOUT 2500 // ms without a frame before the active effect takes over again
+#ifndef EMBED_WEB_ASSETS
+#define EMBED_WEB_ASSETS false // true = web UI linked into the firmware, no SPIFFS image (set by env:esp32dev_embedded)
+#endif
 
 #define MOTOR_POSITION_OPEN 1.0f
 #define MOTOR_POSITION_CLOSED 0.0f
 
 // MQTT Configuration (credentials in Credentials.h)
-#define MQTT_CLIENT_ID "bionic_flower"
+#define MQTT_CLIENT_ID "bionic_flower" // followed by "_" and the device ID
+#define MQTT_DEVICE_ID "" // empty = last 3 bytes of the MAC address (e.g. "a1b2c3"), unique per flower
 #define MQTT_DISCOVERY_PREFIX "homeassistant"
 #define MQTT_BASE_TOPIC "bionic_flower"
+#define MQTT_DEVICE_ID_PLACEHOLDER "{id}" // replaced by the device ID in topics and discovery
+#define MQTT_DEVICE_TOPIC MQTT_BASE_TOPIC "/" MQTT_DEVICE_ID_PLACEHOLDER // e.g. bionic_flower/a1b2c3
+#define MQTT_GROUP_TOPIC MQTT_BASE_TOPIC "/group" // commands for all flowers on the broker
+#define MQTT_CONSOLIDATED_STATE false // true = all sensor and cover states as one JSON document on bionic_flower/<id>/state
+#define ENABLE_TELEMETRY_BUFFER true // record telemetry while MQTT is offline, replay it after reconnecting
+#define TELEMETRY_BUFFER_SIZE 256 // samples (12 bytes each, RTC memory), the newest are kept
+#define TELEMETRY_REPLAY_BATCH 8 // samples per replay message, one message per loop pass
 
 // Enable/disable distance sensor feature
 #define ENABLE_DISTANCE false
 
+// Proximity gesture mode (switched on via MQTT), raw PS counts above baseline
+#define PROXIMITY_SAMPLE_INTERVAL 50 // ms, fastest PS measurement time with ALS running
+#define PROXIMITY_APPROACH_DELTA 40
+#define PROXIMITY_NEAR_DELTA 150
+#define PROXIMITY_HOVER_DURATION 800 // ms in the near zone
+#define PROXIMITY_WAVE_DURATION 500 // max ms in the near zone
+
 #endif
@@ -332,7 +332,8 @@ bool CAP1203::isTouched()
 /* IS RIGHT SWIPE
     Checks if a right swipe occured on the board. This method
     takes up all functionality due to implementation of 
-    while loop with millis().
+    while loop with millis(). Blocks while a pad is held, the
+    firmware uses TouchGestureRecognizer instead.
 */
 bool CAP1203::isRightSwipePulled()
 {
@@ -394,7 +395,8 @@ bool CAP1203::isRightSwipePulled()
 /* IS LEFT SWIPE PULLED
     Checks if a left swipe occured on the board. This method
     takes up all functionality due to implementation of 
-    while loop with millis().
+    while loop with millis(). Blocks while a pad is held, the
+    firmware uses TouchGestureRecognizer instead.
 */
 bool CAP1203::isLeftSwipePulled()
 {
@@ -634,6 +636,60 @@ bool CAP1203::isPowerButtonTouched()
     return false;
 }
 
+/* READ DELTA COUNTS
+    Reads the delta counts of all three pads in one transfer. The delta
+    count is the signed difference to the pad's base count, scaled by the
+    sensitivity setting. See data sheet on Sensor Input Delta Count
+    Registers (pg. 24).
+*/
+void CAP1203::readDeltaCounts(int8_t *deltas)
+{
+    byte buffer[3] = {0, 0, 0};
+    readRegisters(SENSOR_INPUT_1_DELTA_COUNT, buffer, 3);
+    for (int i = 0; i < 3; i++)
+        deltas[i] = (int8_t)buffer[i];
+}
+
+/* READ BASE COUNTS
+    Reads the base counts (baselines) of all three pads in one transfer.
+    See data sheet on Sensor Input Base Count Registers (pg. 42).
+*/
+void CAP1203::readBaseCounts(uint8_t *baseCounts)
+{
+    readRegisters(SENSOR_INPUT_1_BASE_COUNT, baseCounts, 3);
+}
+
+/* READ THRESHOLDS
+    Reads the touch thresholds of all three pads in one transfer. See
+    data sheet on Sensor Input Threshold Registers (pg. 38).
+*/
+void CAP1203::readThresholds(uint8_t *thresholds)
+{
+    readRegisters(SENSOR_1_INPUT_THRESH, thresholds, 3);
+}
+
+/* WRITE THRESHOLDS
+    Writes the touch thresholds of all three pads in one transfer
+    (0 - 127, delta count needed to detect a touch).
+*/
+void CAP1203::writeThresholds(uint8_t *thresholds)
+{
+    byte buffer[3];
+    for (int i = 0; i < 3; i++)
+        buffer[i] = thresholds[i] & 0x7F;
+    writeRegisters(SENSOR_1_INPUT_THRESH, buffer, 3);
+}
+
+/* RECALIBRATE
+    Forces a re-calibration of the base counts for the pads in padMask
+    (bit 0 = pad 1). See data sheet on Calibration Activate and Status
+    Register (pg. 32).
+*/
+void CAP1203::recalibrate(uint8_t padMask)
+{
+    writeRegister(CALIBRATION_ACTIVATE_AND_STATUS, padMask & 0x07);
+}
+
 /* READ A SINGLE REGISTER
     Read a single byte of data from the CAP1203 register "reg"
 */
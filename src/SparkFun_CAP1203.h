@@ -195,6 +195,13 @@ public:
   bool isPowerButtonEnabled();
   bool isPowerButtonTouched();
 
+  // Raw measurement data and calibration (one batched transfer each)
+  void readDeltaCounts(int8_t *deltas);
+  void readBaseCounts(uint8_t *baseCounts);
+  void readThresholds(uint8_t *thresholds);
+  void writeThresholds(uint8_t *thresholds);
+  void recalibrate(uint8_t padMask);
+
 private:
   TwoWire *_i2cPort = NULL; //The generic connection to user's chosen I2C hardware
   uint8_t _deviceAddress;   //Keeps track of I2C address. setI2CAddress changes this.
@@ -0,0 +1,131 @@
+
+// MARK: Includes
+
+#include "StaticAssetHandler.h"
+#if EMBED_WEB_ASSETS
+#include "WebAssets.h" // Generated by compress_fs.py
+#endif
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[ASSETS]: ";
+
+const char* MANIFEST_PATH = "/assets.txt"; // "<path> <etag> <gzipped>" per line
+const char* INDEX_PATH = "/index.html";
+const char* HEADER_IF_NONE_MATCH = "If-None-Match";
+const char* CACHE_IMMUTABLE = "public, max-age=31536000, immutable";
+const char* CACHE_REVALIDATE = "no-cache";
+
+// MARK: Initialization
+
+StaticAssetHandler::StaticAssetHandler(fs::FS& fs) : fs(fs) {}
+
+// MARK: Methods
+
+boolean StaticAssetHandler::begin() {
+#if EMBED_WEB_ASSETS
+  count = (WEB_ASSET_COUNT < MAX_ASSETS) ? WEB_ASSET_COUNT : MAX_ASSETS;
+  memcpy(assets, WEB_ASSETS, count * sizeof(StaticAsset));
+  Serial.println(PRINT_PREFIX + "Serving " + String(count) + " embedded assets.");
+  return count > 0;
+#else
+  return loadManifest();
+#endif
+}
+
+bool StaticAssetHandler::canHandle(AsyncWebServerRequest *request) {
+  if ((request->method() != HTTP_GET) || (find(request->url()) == nullptr)) {
+    return false;
+  }
+  request->addInterestingHeader(HEADER_IF_NONE_MATCH);
+  return true;
+}
+
+void StaticAssetHandler::handleRequest(AsyncWebServerRequest *request) {
+  const StaticAsset* asset = find(request->url());
+  if (asset == nullptr) {
+    request->send(404);
+    return;
+  }
+
+  const char* cache_control = isVersioned(request, *asset) ? CACHE_IMMUTABLE : CACHE_REVALIDATE;
+
+  AsyncWebServerResponse *response;
+  if (request->hasHeader(HEADER_IF_NONE_MATCH) && (request->header(HEADER_IF_NONE_MATCH) == asset->etag)) {
+    response = request->beginResponse(304);
+  } else {
+    if (asset->data != nullptr) {
+      response = request->beginResponse_P(200, getContentType(asset->path), asset->data, asset->length);
+    } else {
+      response = request->beginResponse(fs, asset->path);
+    }
+    if (asset->is_gzipped) {
+      response->addHeader("Content-Encoding", "gzip");
+    }
+  }
+  response->addHeader("ETag", asset->etag);
+  response->addHeader("Cache-Control", cache_control);
+  request->send(response);
+}
+
+// MARK: Helpers
+
+boolean StaticAssetHandler::loadManifest() {
+  File manifest = fs.open(MANIFEST_PATH, "r");
+  if (!manifest) {
+    Serial.println(PRINT_PREFIX + "No manifest, serving uncompressed files.");
+    return false;
+  }
+
+  count = 0;
+  while (manifest.available() && (count < MAX_ASSETS)) {
+    String line = manifest.readStringUntil('\n');
+    StaticAsset& asset = assets[count];
+    char etag[17];
+    int is_gzipped = 0;
+    if (sscanf(line.c_str(), "%31s %16s %d", asset.path, etag, &is_gzipped) != 3) {
+      continue;
+    }
+    snprintf(asset.etag, sizeof(asset.etag), "\"%s\"", etag);
+    asset.is_gzipped = is_gzipped != 0;
+    asset.data = nullptr;
+    asset.length = 0;
+    count++;
+  }
+  manifest.close();
+
+  Serial.println(PRINT_PREFIX + "Serving " + String(count) + " assets from manifest.");
+  return count > 0;
+}
+
+const StaticAsset* StaticAssetHandler::find(const String& url) {
+  const char* path = (url == "/") ? INDEX_PATH : url.c_str();
+  for (uint8_t index = 0; index < count; index++) {
+    if (strcmp(assets[index].path, path) == 0) {
+      return &assets[index];
+    }
+  }
+  return nullptr;
+}
+
+const char* StaticAssetHandler::getContentType(const char* path) {
+  const char* extension = strrchr(path, '.');
+  if (extension == nullptr) return "text/plain";
+  if (strcmp(extension, ".html") == 0) return "text/html";
+  if (strcmp(extension, ".css") == 0) return "text/css";
+  if (strcmp(extension, ".js") == 0) return "application/javascript";
+  if (strcmp(extension, ".svg") == 0) return "image/svg+xml";
+  if (strcmp(extension, ".ico") == 0) return "image/x-icon";
+  if (strcmp(extension, ".png") == 0) return "image/png";
+  return "text/plain";
+}
+
+boolean StaticAssetHandler::isVersioned(AsyncWebServerRequest *request, const StaticAsset& asset) {
+  if (!request->hasArg("v")) {
+    return false;
+  }
+  // The etag without its quotes
+  const String& version = request->arg("v");
+  size_t length = strlen(asset.etag) - 2;
+  return (version.length() == length) && (strncmp(version.c_str(), asset.etag + 1, length) == 0);
+}
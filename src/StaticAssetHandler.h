@@ -0,0 +1,63 @@
+
+#ifndef STATICASSETHANDLER_H_
+#define STATICASSETHANDLER_H_
+
+// MARK: Includes
+
+#include <ESPAsyncWebServer.h>
+#include <FS.h>
+#include "Settings.h"
+
+// Compressed asset (compress_fs.py), either a file of the filesystem image
+// or linked into the firmware (EMBED_WEB_ASSETS)
+struct StaticAsset {
+  char path[32]; // SPIFFS name limit
+  char etag[20]; // Content hash, quoted
+  boolean is_gzipped;
+  const uint8_t* data; // Embedded content in flash, nullptr = file
+  size_t length;
+};
+
+// Serves the assets listed in the image's manifest, or the ones embedded in
+// the firmware (read straight from flash): gzipped content is sent as is with
+// Content-Encoding, every response carries the asset's ETag and requests with
+// a matching If-None-Match are answered with 304. URLs that carry the current
+// hash as version (?v=) are cached as immutable.
+class StaticAssetHandler : public AsyncWebHandler {
+
+  public:
+
+    // MARK: Initialization
+
+    StaticAssetHandler(fs::FS& fs);
+
+    // MARK: Methods
+
+    boolean begin();
+    uint8_t getCount() {
+      return count;
+    }
+
+    bool canHandle(AsyncWebServerRequest *request) override;
+    void handleRequest(AsyncWebServerRequest *request) override;
+
+  private:
+
+    // MARK: Private Properties
+
+    static const uint8_t MAX_ASSETS = 24;
+
+    fs::FS& fs;
+    StaticAsset assets[MAX_ASSETS];
+    uint8_t count = 0;
+
+    // MARK: Helpers
+
+    boolean loadManifest();
+    const StaticAsset* find(const String& url);
+    static const char* getContentType(const char* path);
+    boolean isVersioned(AsyncWebServerRequest *request, const StaticAsset& asset);
+
+};
+
+#endif
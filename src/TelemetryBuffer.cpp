@@ -0,0 +1,79 @@
+
+// MARK: Includes
+
+#include "TelemetryBuffer.h"
+#include <esp_attr.h>
+
+// MARK: Constants
+
+const String PRINT_PREFIX = "[TELEMETRY]: ";
+const uint32_t STORAGE_MAGIC = 0x544C4D31; // "TLM1"
+
+// MARK: Storage
+
+struct TelemetryBufferStorage {
+  uint32_t magic;
+  uint16_t head; // Oldest sample
+  uint16_t count;
+  TelemetrySample samples[TELEMETRY_BUFFER_SIZE];
+};
+
+// RTC slow memory is 8 KB and shared with the rest of the system
+static_assert(sizeof(TelemetryBufferStorage) <= 4096, "TELEMETRY_BUFFER_SIZE too large for RTC memory");
+
+// Not initialized on reset, validated in begin()
+RTC_NOINIT_ATTR TelemetryBufferStorage telemetry_storage;
+
+// MARK: Initialization
+
+TelemetryBuffer::TelemetryBuffer() {
+  overflow_count = 0;
+}
+
+// MARK: Methods
+
+void TelemetryBuffer::begin() {
+  if ((telemetry_storage.magic == STORAGE_MAGIC) &&
+      (telemetry_storage.head < TELEMETRY_BUFFER_SIZE) &&
+      (telemetry_storage.count <= TELEMETRY_BUFFER_SIZE)) {
+    Serial.println(PRINT_PREFIX + "Kept " + String(telemetry_storage.count) + " buffered samples");
+    return;
+  }
+
+  // Power on: RTC memory holds garbage
+  telemetry_storage.magic = STORAGE_MAGIC;
+  telemetry_storage.head = 0;
+  telemetry_storage.count = 0;
+}
+
+void TelemetryBuffer::push(const TelemetrySample& sample) {
+  uint16_t index = (telemetry_storage.head + telemetry_storage.count) % TELEMETRY_BUFFER_SIZE;
+  telemetry_storage.samples[index] = sample;
+
+  if (telemetry_storage.count < TELEMETRY_BUFFER_SIZE) {
+    telemetry_storage.count++;
+  } else {
+    // Overwrote the oldest sample
+    telemetry_storage.head = (telemetry_storage.head + 1) % TELEMETRY_BUFFER_SIZE;
+    overflow_count++;
+  }
+}
+
+// Copies up to max_count of the oldest samples, they stay buffered until drop()
+uint16_t TelemetryBuffer::peek(TelemetrySample* samples, uint16_t max_count) {
+  uint16_t count = min(max_count, telemetry_storage.count);
+  for (uint16_t i = 0; i < count; i++) {
+    samples[i] = telemetry_storage.samples[(telemetry_storage.head + i) % TELEMETRY_BUFFER_SIZE];
+  }
+  return count;
+}
+
+void TelemetryBuffer::drop(uint16_t count) {
+  count = min(count, telemetry_storage.count);
+  telemetry_storage.head = (telemetry_storage.head + count) % TELEMETRY_BUFFER_SIZE;
+  telemetry_storage.count -= count;
+}
+
+uint16_t TelemetryBuffer::getCount() {
+  return telemetry_storage.count;
+}
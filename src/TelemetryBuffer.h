@@ -0,0 +1,46 @@
+
+#ifndef TELEMETRYBUFFER_H_
+#define TELEMETRYBUFFER_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+#include "Settings.h"
+
+// MARK: Types
+
+struct TelemetrySample {
+  uint32_t timestamp; // Unix time [s]
+  float value;
+  uint8_t channel; // TelemetryChannel
+};
+
+// Ring buffer for telemetry recorded while MQTT is offline. Lives in RTC
+// memory, so a reset during an outage keeps the samples. When full, the
+// oldest sample is overwritten.
+class TelemetryBuffer {
+
+  public:
+
+    // MARK: Initialization
+
+    TelemetryBuffer();
+
+    // MARK: Methods
+
+    void begin();
+    void push(const TelemetrySample& sample);
+    uint16_t peek(TelemetrySample* samples, uint16_t max_count);
+    void drop(uint16_t count);
+    uint16_t getCount();
+    uint32_t getOverflowCount() { return overflow_count; }
+
+  private:
+
+    // MARK: Properties
+
+    uint32_t overflow_count; // Samples lost to overwrites since boot
+
+};
+
+#endif
@@ -0,0 +1,152 @@
+
+// MARK: Includes
+
+#include "TouchCalibrator.h"
+#include "Settings.h"
+#include "SparkFun_CAP1203.h"
+
+// MARK: Constants
+
+const uint16_t MIN_WINDOW_SAMPLES = 20; // Untouched samples needed before adjusting a pad
+const uint8_t MAX_THRESHOLD = 127;
+const uint8_t NOISE_MARGIN = 3; // Threshold >= 3x noise peak
+const uint8_t MIN_THRESHOLD_CHANGE = 4; // Avoid rewriting the registers for jitter
+
+// MARK: Initialization
+
+TouchCalibrator::TouchCalibrator() {
+  uint8_t thresholds[PAD_COUNT] = { 0x40, 0x40, 0x40 };
+  recalibration_count = 0;
+  reset(0, SENSITIVITY_2X, thresholds);
+}
+
+// MARK: Methods
+
+void TouchCalibrator::reset(uint8_t pad_mask, uint8_t sensitivity, const uint8_t* thresholds) {
+  this->pad_mask = pad_mask;
+  this->sensitivity = sensitivity;
+  needs_recalibration = false;
+  for (uint8_t pad = 0; pad < PAD_COUNT; pad++) {
+    this->thresholds[pad] = thresholds[pad];
+    windows[pad] = { 0, 0, INT8_MAX, INT8_MIN, 0, 0 };
+    statistics[pad] = { 0, 0, 0, 0, thresholds[pad], 0, 0 };
+  }
+}
+
+void TouchCalibrator::addSample(const int8_t* deltas, const boolean* touched) {
+  for (uint8_t pad = 0; pad < PAD_COUNT; pad++) {
+    if (!(pad_mask & (1 << pad))) continue;
+
+    PadWindow& window = windows[pad];
+    if (touched[pad]) {
+      window.touch_peak = max(window.touch_peak, (uint8_t)abs(deltas[pad]));
+    } else if (window.count < UINT16_MAX) {
+      window.delta_sum += deltas[pad];
+      window.square_sum += deltas[pad] * deltas[pad];
+      window.min_delta = min(window.min_delta, deltas[pad]);
+      window.max_delta = max(window.max_delta, deltas[pad]);
+      window.count++;
+    }
+  }
+}
+
+// Evaluates the samples since the last call. Returns true if the sensitivity
+// or the thresholds changed; needsRecalibration() tells if the base counts
+// should be re-calibrated.
+boolean TouchCalibrator::calibrate(const uint8_t* base_counts) {
+  needs_recalibration = false;
+  boolean has_statistics = false;
+
+  for (uint8_t pad = 0; pad < PAD_COUNT; pad++) {
+    if (!(pad_mask & (1 << pad))) continue;
+
+    PadWindow& window = windows[pad];
+    TouchPadStatistics& stats = statistics[pad];
+    stats.base_count = base_counts[pad];
+
+    if (window.touch_peak > 0) {
+      // Average over the windows, single touches vary a lot
+      stats.touch_peak = (stats.touch_peak == 0) ? window.touch_peak : (stats.touch_peak + window.touch_peak) / 2;
+    }
+    if (window.count >= MIN_WINDOW_SAMPLES) {
+      stats.drift = (float)window.delta_sum / window.count;
+      stats.noise = sqrt(max(0.0f, ((float)window.square_sum / window.count) - (stats.drift * stats.drift)));
+      stats.noise_peak = ceil(max(window.max_delta - stats.drift, stats.drift - window.min_delta));
+      stats.sample_count = window.count;
+      has_statistics = true;
+    }
+    windows[pad] = { 0, 0, INT8_MAX, INT8_MIN, 0, 0 };
+  }
+
+  if (!has_statistics) {
+    return false;
+  }
+
+  // Sensitivity is shared by all pads: back off if noise alone would
+  // need a threshold out of range, amplify if touches barely clear the
+  // minimum threshold and there is headroom above the noise
+  boolean is_too_noisy = false;
+  boolean is_too_weak = false;
+  boolean has_headroom = true;
+  for (uint8_t pad = 0; pad < PAD_COUNT; pad++) {
+    if (!(pad_mask & (1 << pad))) continue;
+    TouchPadStatistics& stats = statistics[pad];
+
+    // The untouched signal wandered off the base count (humidity,
+    // temperature), the chip's own drift compensation is too slow
+    if (fabs(stats.drift) > thresholds[pad] / 2) needs_recalibration = true;
+
+    if (stats.noise_peak * NOISE_MARGIN > MAX_THRESHOLD) is_too_noisy = true;
+    if ((stats.touch_peak > 0) && (stats.touch_peak < 2 * TOUCH_MIN_THRESHOLD)) is_too_weak = true;
+    if (stats.noise_peak * NOISE_MARGIN * 2 > TOUCH_MIN_THRESHOLD) has_headroom = false;
+  }
+
+  boolean has_changed = false;
+  if (is_too_noisy && (sensitivity < SENSITIVITY_1X)) {
+    sensitivity++;
+    scaleStatistics(0.5f);
+    has_changed = true;
+  } else if (!is_too_noisy && is_too_weak && has_headroom && (sensitivity > TOUCH_MAX_SENSITIVITY)) {
+    sensitivity--;
+    scaleStatistics(2.0f);
+    has_changed = true;
+  }
+
+  for (uint8_t pad = 0; pad < PAD_COUNT; pad++) {
+    if (!(pad_mask & (1 << pad))) continue;
+    TouchPadStatistics& stats = statistics[pad];
+
+    // Well above the noise, but at most half of a typical touch
+    uint16_t threshold = max((uint16_t)(stats.noise_peak * NOISE_MARGIN), (uint16_t)TOUCH_MIN_THRESHOLD);
+    if (stats.touch_peak > 0) {
+      threshold = min(threshold, (uint16_t)(stats.touch_peak / 2));
+      threshold = max(threshold, (uint16_t)(stats.noise_peak * 2 + 1));
+    }
+    threshold = min(threshold, (uint16_t)MAX_THRESHOLD);
+
+    if (has_changed || (abs((int16_t)threshold - (int16_t)thresholds[pad]) >= MIN_THRESHOLD_CHANGE)) {
+      has_changed |= (thresholds[pad] != threshold);
+      thresholds[pad] = threshold;
+    }
+    stats.threshold = thresholds[pad];
+  }
+
+  if (needs_recalibration) {
+    recalibration_count++;
+  }
+
+  return has_changed;
+}
+
+// MARK: Helpers
+
+// Delta counts scale with the sensitivity, keep the history comparable
+void TouchCalibrator::scaleStatistics(float factor) {
+  for (uint8_t pad = 0; pad < PAD_COUNT; pad++) {
+    TouchPadStatistics& stats = statistics[pad];
+    stats.noise *= factor;
+    stats.drift *= factor;
+    stats.noise_peak = min(stats.noise_peak * factor, (float)MAX_THRESHOLD);
+    stats.touch_peak = min(stats.touch_peak * factor, (float)MAX_THRESHOLD);
+  }
+}
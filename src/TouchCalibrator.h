@@ -0,0 +1,96 @@
+
+#ifndef TOUCHCALIBRATOR_H_
+#define TOUCHCALIBRATOR_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+
+// MARK: Types
+
+struct TouchPadStatistics {
+  float noise; // Standard deviation of the delta count while untouched
+  float drift; // Mean delta count while untouched (offset from the base count)
+  uint8_t noise_peak; // Max deviation from the drift while untouched
+  uint8_t touch_peak; // Typical peak delta count of a touch (0 = no touch seen yet)
+  uint8_t threshold;
+  uint8_t base_count;
+  uint16_t sample_count;
+};
+
+// Tracks CAP1203 noise and touch strength per pad and derives sensitivity,
+// touch thresholds and when the base counts need a re-calibration. Pure
+// logic, the hardware access stays in HardwareService.
+class TouchCalibrator {
+
+  public:
+
+    // MARK: Constants
+
+    static const uint8_t PAD_COUNT = 3;
+
+    // MARK: Initialization
+
+    TouchCalibrator();
+
+    // MARK: Methods
+
+    void reset(uint8_t pad_mask, uint8_t sensitivity, const uint8_t* thresholds);
+    void addSample(const int8_t* deltas, const boolean* touched);
+    boolean calibrate(const uint8_t* base_counts);
+
+    uint8_t getSensitivity() {
+      return sensitivity;
+    }
+
+    const uint8_t* getThresholds() {
+      return thresholds;
+    }
+
+    boolean needsRecalibration() {
+      return needs_recalibration;
+    }
+
+    uint8_t getPadMask() {
+      return pad_mask;
+    }
+
+    uint32_t getRecalibrationCount() {
+      return recalibration_count;
+    }
+
+    TouchPadStatistics getStatistics(uint8_t pad) {
+      return statistics[pad];
+    }
+
+  private:
+
+    // MARK: Types
+
+    struct PadWindow {
+      int32_t delta_sum;
+      uint32_t square_sum;
+      int8_t min_delta;
+      int8_t max_delta;
+      uint8_t touch_peak;
+      uint16_t count;
+    };
+
+    // MARK: Properties
+
+    uint8_t pad_mask;
+    uint8_t sensitivity; // CAP1203 SENSITIVITY_* code, higher = less sensitive
+    uint8_t thresholds[PAD_COUNT];
+    boolean needs_recalibration;
+    uint32_t recalibration_count;
+
+    PadWindow windows[PAD_COUNT];
+    TouchPadStatistics statistics[PAD_COUNT];
+
+    // MARK: Methods
+
+    void scaleStatistics(float factor);
+
+};
+
+#endif
@@ -0,0 +1,147 @@
+
+// MARK: Includes
+
+#include "TouchGestureRecognizer.h"
+#include "Settings.h"
+
+// MARK: Constants
+
+const uint8_t PAD_LEFT_INDEX = 0;
+const uint8_t PAD_RIGHT_INDEX = 1;
+
+const char* GESTURE_NAMES[GESTURE_COUNT] = {
+  "left_tap",
+  "left_double_tap",
+  "left_long_press",
+  "right_tap",
+  "right_double_tap",
+  "right_long_press",
+  "swipe_left",
+  "swipe_right",
+};
+
+// Per pad: tap, double tap, long press
+const TouchGesture PAD_GESTURES[2][3] = {
+  { GESTURE_LEFT_TAP, GESTURE_LEFT_DOUBLE_TAP, GESTURE_LEFT_LONG_PRESS },
+  { GESTURE_RIGHT_TAP, GESTURE_RIGHT_DOUBLE_TAP, GESTURE_RIGHT_LONG_PRESS },
+};
+
+// MARK: Initialization
+
+TouchGestureRecognizer::TouchGestureRecognizer() {
+  timings.long_press = TOUCH_LONG_PRESS_DURATION;
+  timings.double_tap = TOUCH_DOUBLE_TAP_INTERVAL;
+  timings.swipe = TOUCH_SWIPE_INTERVAL;
+  reset();
+}
+
+// MARK: Static Methods
+
+const char* TouchGestureRecognizer::getName(TouchGesture gesture) {
+  if (gesture >= GESTURE_COUNT) {
+    return "none";
+  }
+  return GESTURE_NAMES[gesture];
+}
+
+TouchGesture TouchGestureRecognizer::fromName(const char* name) {
+  for (uint8_t i = 0; i < GESTURE_COUNT; i++) {
+    if (strcmp(name, GESTURE_NAMES[i]) == 0) {
+      return (TouchGesture)i;
+    }
+  }
+  return GESTURE_NONE;
+}
+
+// MARK: Methods
+
+void TouchGestureRecognizer::reset() {
+  for (uint8_t i = 0; i < 2; i++) {
+    pads[i] = {};
+  }
+  queue_head = 0;
+  queue_count = 0;
+}
+
+void TouchGestureRecognizer::update(boolean left, boolean right, unsigned long now) {
+  updatePad(PAD_LEFT_INDEX, left, now);
+  updatePad(PAD_RIGHT_INDEX, right, now);
+}
+
+TouchGesture TouchGestureRecognizer::nextGesture() {
+  if (queue_count == 0) {
+    return GESTURE_NONE;
+  }
+  TouchGesture gesture = queue[queue_head];
+  queue_head = (queue_head + 1) % QUEUE_SIZE;
+  queue_count--;
+  return gesture;
+}
+
+// MARK: Helpers
+
+void TouchGestureRecognizer::updatePad(uint8_t index, boolean is_pressed, unsigned long now) {
+  PadState& pad = pads[index];
+  PadState& other = pads[1 - index];
+
+  if (is_pressed && !pad.is_down) {
+    // Press: a swipe if the other pad was pressed shortly before
+    pad.is_down = true;
+    pad.is_consumed = false;
+    pad.is_long = false;
+    pad.down_at = now;
+
+    boolean other_is_active = (other.is_down || other.tap_pending) && !other.is_long && !other.is_consumed;
+    if ((timings.swipe > 0) && other_is_active && (now - other.down_at <= timings.swipe)) {
+      // Both pads first seen in the same sample: a swipe faster than the
+      // sampling, in an unknown direction. Dropped, it isn't two taps either.
+      if (other.down_at != now) {
+        emit((index == PAD_RIGHT_INDEX) ? GESTURE_SWIPE_RIGHT : GESTURE_SWIPE_LEFT);
+      }
+      pad.is_consumed = true;
+      pad.tap_pending = false;
+      pad.tap_count = 0;
+      other.is_consumed = other.is_down;
+      other.tap_pending = false;
+      other.tap_count = 0;
+    }
+  } else if (is_pressed) {
+    // Held: long press fires once, while the finger is still down
+    if (!pad.is_consumed && !pad.is_long && (now - pad.down_at >= timings.long_press)) {
+      emit(PAD_GESTURES[index][2]);
+      pad.is_long = true;
+      pad.tap_pending = false;
+      pad.tap_count = 0;
+    }
+  } else if (pad.is_down) {
+    // Release: count the tap, resolve it once no double tap or swipe can follow
+    pad.is_down = false;
+    pad.released_at = now;
+    if (!pad.is_consumed && !pad.is_long) {
+      pad.tap_count++;
+      pad.tap_pending = true;
+      if ((pad.tap_count >= 2) && (timings.double_tap > 0)) {
+        emit(PAD_GESTURES[index][1]);
+        pad.tap_pending = false;
+        pad.tap_count = 0;
+      }
+    }
+  }
+
+  if (pad.tap_pending && !pad.is_down &&
+      (now - pad.released_at >= timings.double_tap) && (now - pad.down_at > timings.swipe)) {
+    emit(PAD_GESTURES[index][0]);
+    pad.tap_pending = false;
+    pad.tap_count = 0;
+  }
+}
+
+void TouchGestureRecognizer::emit(TouchGesture gesture) {
+  if (queue_count == QUEUE_SIZE) {
+    // Drop the oldest, the newest gesture is the one the user is waiting for
+    queue_head = (queue_head + 1) % QUEUE_SIZE;
+    queue_count--;
+  }
+  queue[(queue_head + queue_count) % QUEUE_SIZE] = gesture;
+  queue_count++;
+}
@@ -0,0 +1,90 @@
+
+#ifndef TOUCHGESTURERECOGNIZER_H_
+#define TOUCHGESTURERECOGNIZER_H_
+
+// MARK: Includes
+
+#include <Arduino.h>
+
+// MARK: Types
+
+enum TouchGesture : uint8_t {
+  GESTURE_LEFT_TAP = 0,
+  GESTURE_LEFT_DOUBLE_TAP,
+  GESTURE_LEFT_LONG_PRESS,
+  GESTURE_RIGHT_TAP,
+  GESTURE_RIGHT_DOUBLE_TAP,
+  GESTURE_RIGHT_LONG_PRESS,
+  GESTURE_SWIPE_LEFT,
+  GESTURE_SWIPE_RIGHT,
+  GESTURE_COUNT,
+  GESTURE_NONE = 0xFF
+};
+
+struct TouchGestureTimings {
+  uint16_t long_press; // Hold time until a long press fires [ms]
+  uint16_t double_tap; // Max gap between release and second press [ms], 0 = no double tap
+  uint16_t swipe; // Max time between the two pad presses of a swipe [ms], 0 = no swipe
+};
+
+// Event-driven recognizer for the two touch pads. It is fed timestamped pad
+// samples and never waits for the user, so it can run on the main loop.
+class TouchGestureRecognizer {
+
+  public:
+
+    // MARK: Initialization
+
+    TouchGestureRecognizer();
+
+    // MARK: Static Methods
+
+    static const char* getName(TouchGesture gesture);
+    static TouchGesture fromName(const char* name);
+
+    // MARK: Methods
+
+    void update(boolean left, boolean right, unsigned long now);
+    TouchGesture nextGesture();
+    void reset();
+
+    TouchGestureTimings getTimings() {
+      return timings;
+    }
+
+    void setTimings(TouchGestureTimings timings) {
+      this->timings = timings;
+    }
+
+  private:
+
+    // MARK: Types
+
+    struct PadState {
+      boolean is_down;
+      boolean is_consumed; // Part of a swipe, release is not a tap
+      boolean is_long; // Long press already fired
+      boolean tap_pending; // Released, waiting for a second tap or a swipe
+      uint8_t tap_count;
+      unsigned long down_at;
+      unsigned long released_at;
+    };
+
+    // MARK: Properties
+
+    static const uint8_t QUEUE_SIZE = 4;
+
+    TouchGestureTimings timings;
+    PadState pads[2];
+    TouchGesture queue[QUEUE_SIZE];
+    uint8_t queue_head;
+    uint8_t queue_count;
+
+    // MARK: Methods
+
+    void updatePad(uint8_t index, boolean is_pressed, unsigned long now);
+    void emit(TouchGesture gesture);
+
+};
+
+#endif
@@ -8,6 +8,7 @@
 
 const String PRINT_PREFIX = "[WEB]: ";
 const String TEXT_PLAIN = "text/plain";
+const String APPLICATION_JSON = "application/json";
 
 const String KEY_MOTOR_POSITION = "motor_position";
 const String KEY_DISTANCE_THRESHOLD = "distance_threshold";
@@ -27,6 +28,7 @@ const String KEY_LED_BRIGHTNESS = "led_brightness";
 const String KEY_ADAPTIVE_BRIGHTNESS = "adaptive_brightness";
 const String KEY_WEATHER_DEBUG = "weather_debug";
 const String KEY_WEATHER_STATE = "weather_state";
+const size_t MAX_BATCH_SIZE = 512;
 
 // MARK: Initialization
 
@@ -34,12 +36,21 @@ WebService::WebService() {
   hardware_service = HardwareService::getSharedInstance();
   dns_service = new DNSService();
   wifi_service = new WiFiService();
+  command_queue = CommandQueue::getSharedInstance();
+  metrics = Metrics::getSharedInstance();
+  firmware_updater = FirmwareUpdater::getSharedInstance();
+  state_mutex = xSemaphoreCreateMutex();
+  published_state = {}; // Until the first frame
+  published_state.effect = "none";
+  strlcpy(published_state.weather_state, "none", sizeof(published_state.weather_state));
 }
 
 // MARK: Methods
 
 void WebService::start(IPAddress ip, const uint16_t port, std::function<void(bool)> completion) {
+#if !EMBED_WEB_ASSETS
   SPIFFS.begin();
+#endif
 
   if (!hardware_service->start()) {
     Serial.println(PRINT_PREFIX + "Calibration failed.");
@@ -66,6 +77,12 @@ void WebService::start(IPAddress ip, const uint16_t port, std::function<void(boo
       return;
     }
 
+#if ENABLE_REALTIME_RECEIVER
+    // Not fatal, the flower works without it
+    realtime_receiver = new RealtimeReceiver();
+    realtime_receiver->start();
+#endif
+
     completion(true);
   });
 }
@@ -75,7 +92,17 @@ void WebService::loop(uint32_t count) {
   if (has_active_connection) {
     dns_service->processRequest();
   }
+  unsigned long hardware_started_at = micros();
   hardware_service->loop(has_active_connection, count);
+  unsigned long web_started_at = micros();
+  WebState state = readState();
+  publishState(state);
+  pushState(state);
+  if (live_stream != nullptr) {
+    live_stream->loop();
+  }
+  metrics->observe(METRIC_LOOP_HARDWARE, web_started_at - hardware_started_at);
+  metrics->observe(METRIC_LOOP_WEB, micros() - web_started_at);
 }
 
 // MARK: Helpers
@@ -85,9 +112,16 @@ boolean WebService::startWebServer(const uint16_t port) {
   // Create and start the webserver with the given port
   server = new AsyncWebServer(port);
 
-  // Tells the webserver where the website is stored in the internal file system
-  // Important to cache the files, because the web server crashes when refreshing the page on mobile devices when files not cashed
-  server->serveStatic("/", SPIFFS, "/").setDefaultFile("index.html").setCacheControl("max-age=6000");
+  // Serve the compressed website (compress_fs.py) with ETags, from the firmware
+  // (EMBED_WEB_ASSETS) or the filesystem image, or the plain files of an older image
+  static_assets = new StaticAssetHandler(SPIFFS);
+  if (static_assets->begin()) {
+    server->addHandler(static_assets);
+  } else {
+    // Tells the webserver where the website is stored in the internal file system
+    // Important to cache the files, because the web server crashes when refreshing the page on mobile devices when files not cashed
+    server->serveStatic("/", SPIFFS, "/").setDefaultFile("index.html").setCacheControl("max-age=6000");
+  }
 
   // Handle if the requested file is not found
   server->onNotFound(std::bind(&WebService::handleNotFound, this, std::placeholders::_1));
@@ -98,6 +132,25 @@ boolean WebService::startWebServer(const uint16_t port) {
   server->on("/configuration", HTTP_POST, std::bind(&WebService::handleUpdateFromWeb, this, std::placeholders::_1));
   server->on("/calibrate", HTTP_POST, std::bind(&WebService::handleCalibrate, this, std::placeholders::_1));
   server->on("/sensorData", HTTP_GET, std::bind(&WebService::handleReadADC, this, std::placeholders::_1));
+  server->on("/api/v1/state", HTTP_GET, std::bind(&WebService::handleApiState, this, std::placeholders::_1));
+  server->on("/metrics", HTTP_GET, std::bind(&WebService::handleMetrics, this, std::placeholders::_1));
+  server->on("/api/v1/ota", HTTP_POST, std::bind(&WebService::handleFirmwareUpdate, this, std::placeholders::_1), nullptr,
+             std::bind(&WebService::handleFirmwareBody, this, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+  server->on("/api/v1/configuration", HTTP_POST, std::bind(&WebService::handleBatch, this, std::placeholders::_1), nullptr,
+             std::bind(&WebService::handleBatchBody, this, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+
+  // Push the state to the web UI instead of having every tab poll /sensorData
+  events = new AsyncEventSource("/events");
+  events->onConnect([this](AsyncEventSourceClient *client) {
+    has_new_event_client = true;
+  });
+  server->addHandler(events);
+
+  // Rendered LED frames and motor position for the live view
+  live_stream = new LiveStream("/live");
+  server->addHandler(live_stream->getSocket());
 
   server->begin();
 
@@ -106,6 +159,120 @@ boolean WebService::startWebServer(const uint16_t port) {
   return true;
 }
 
+void WebService::pushState(const WebState& state) {
+  if ((events == nullptr) || (events->count() == 0)) {
+    return;
+  }
+
+  // New clients get the current state right away, changes are rate limited
+  boolean is_forced = has_new_event_client;
+  if (!is_forced && (millis() - state_pushed_at < WEB_EVENTS_MIN_INTERVAL)) {
+    return;
+  }
+  has_new_event_client = false;
+
+  char text[STATE_SNAPSHOT_SIZE];
+  size_t length = writeState(state, text, sizeof(text));
+  if (!is_forced && (length == state_snapshot_length) && (memcmp(text, state_snapshot, length) == 0)) {
+    return;
+  }
+
+  memcpy(state_snapshot, text, length + 1);
+  state_snapshot_length = length;
+  state_pushed_at = millis();
+  events->send(state_snapshot, "state", state_pushed_at, WEB_EVENTS_RECONNECT_INTERVAL);
+}
+
+void WebService::publishState(const WebState& state) {
+  xSemaphoreTake(state_mutex, portMAX_DELAY);
+  published_state = state;
+  xSemaphoreGive(state_mutex);
+}
+
+WebState WebService::getPublishedState() {
+  xSemaphoreTake(state_mutex, portMAX_DELAY);
+  WebState state = published_state;
+  xSemaphoreGive(state_mutex);
+  return state;
+}
+
+// Control loop only: the configuration, sensor data and weather state are
+// written by it without a lock
+WebState WebService::readState() {
+  MQTTService* mqtt = MQTTService::getSharedInstance();
+  WebState state;
+  state.configuration = hardware_service->getConfiguration();
+  state.sensor_data = hardware_service->getSensorData();
+  state.effect = getEffectName();
+  state.led_brightness = mqtt->getBrightness();
+  state.is_adaptive_brightness = mqtt->isAdaptiveBrightnessEnabled();
+  strlcpy(state.weather_state, mqtt->isWeatherEnabled() ? mqtt->getWeatherState() : "none", sizeof(state.weather_state));
+  return state;
+}
+
+size_t WebService::writeState(const WebState& state, char* buffer, size_t size) {
+  const Configuration& configuration = state.configuration;
+  const SensorData& sensor_data = state.sensor_data;
+
+  int length = snprintf(buffer, size,
+    "%s=%.2f&%s=%.2f&%s=%.2f&%s=%.2f&%s=%.2f&%s=%.2f&%s=%.2f&%s=%d&%s=#%02x%02x%02x&"
+    "%s=%d&%s=%d&%s=%d&%s=%d&%s=%s&%s=%d&%s=%d&%s=%s",
+    KEY_BRIGHTNESS.c_str(), sensor_data.brightness * 100,
+    KEY_DISTANCE.c_str(), sensor_data.distance * 100,
+    KEY_MOTOR_POSITION.c_str(), configuration.motor_position * 100,
+    KEY_SPEED.c_str(), configuration.speed * 100,
+    KEY_UPPER_BRIGHTNESS_THRESHOLD.c_str(), configuration.upper_brightness_threshold * 100,
+    KEY_LOWER_BRIGHTNESS_THRESHOLD.c_str(), configuration.lower_brightness_threshold * 100,
+    KEY_DISTANCE_THRESHOLD.c_str(), configuration.distance_threshold * 100,
+    KEY_IS_AUTONOMOUS.c_str(), configuration.is_autonomous ? 1 : 0,
+    KEY_COLOR.c_str(), configuration.color.red, configuration.color.green, configuration.color.blue,
+    KEY_TOUCH_LEFT.c_str(), sensor_data.touch_left ? 1 : 0,
+    KEY_TOUCH_RIGHT.c_str(), sensor_data.touch_right ? 1 : 0,
+    KEY_HAS_LIGHT.c_str(), sensor_data.has_light_sensor ? 1 : 0,
+    KEY_HAS_TOUCH.c_str(), sensor_data.has_touch_sensor ? 1 : 0,
+    KEY_EFFECT.c_str(), state.effect,
+    KEY_LED_BRIGHTNESS.c_str(), state.led_brightness * 100 / 255,
+    KEY_ADAPTIVE_BRIGHTNESS.c_str(), state.is_adaptive_brightness ? 1 : 0,
+    KEY_WEATHER_STATE.c_str(), state.weather_state);
+
+  return (length < 0) ? 0 : min((size_t)length, size - 1);
+}
+
+size_t WebService::writeJsonState(const WebState& state, char* buffer, size_t size) {
+  const Configuration& configuration = state.configuration;
+  const SensorData& sensor_data = state.sensor_data;
+
+  // Model units: positions, thresholds and sensor values [0, 1], LED brightness [0, 255]
+  int length = snprintf(buffer, size,
+    "{\"configuration\":{\"motor_position\":%.3f,\"speed\":%.3f,"
+    "\"upper_brightness_threshold\":%.3f,\"lower_brightness_threshold\":%.3f,"
+    "\"distance_threshold\":%.3f,\"is_autonomous\":%s,\"color\":\"#%02x%02x%02x\"},"
+    "\"sensors\":{\"has_light\":%s,\"brightness\":%.3f,\"illuminance\":%.1f,\"distance\":%.3f,"
+    "\"has_touch\":%s,\"touch_left\":%s,\"touch_right\":%s},"
+    "\"light\":{\"effect\":\"%s\",\"brightness\":%d,\"adaptive_brightness\":%s,\"weather_state\":\"%s\"},"
+    "\"system\":{\"uptime\":%lu,\"free_heap\":%lu,\"min_free_heap\":%lu}}",
+    configuration.motor_position, configuration.speed,
+    configuration.upper_brightness_threshold, configuration.lower_brightness_threshold,
+    configuration.distance_threshold, configuration.is_autonomous ? "true" : "false",
+    configuration.color.red, configuration.color.green, configuration.color.blue,
+    sensor_data.has_light_sensor ? "true" : "false", sensor_data.brightness, sensor_data.illuminance, sensor_data.distance,
+    sensor_data.has_touch_sensor ? "true" : "false", sensor_data.touch_left ? "true" : "false", sensor_data.touch_right ? "true" : "false",
+    state.effect, state.led_brightness, state.is_adaptive_brightness ? "true" : "false", state.weather_state,
+    (unsigned long)millis(), (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+
+  return (length < 0) ? 0 : min((size_t)length, size - 1);
+}
+
+const char* WebService::getEffectName() {
+  MQTTService* mqtt = MQTTService::getSharedInstance();
+  if (mqtt->isRainbowEnabled()) return "rainbow";
+  if (mqtt->isRainbowMultiEnabled()) return "rainbow_multi";
+  if (mqtt->isCircadianEnabled()) return "circadian";
+  if (mqtt->isWeatherEnabled()) return "weather";
+  if (mqtt->isSensorEnabled()) return "sensor";
+  return "none";
+}
+
 void WebService::handleGenerate(AsyncWebServerRequest *request) {
   Serial.println(PRINT_PREFIX + "Generate 204 answer: " + request->url());
   request->send(204, TEXT_PLAIN, "No Content");
@@ -118,221 +285,196 @@ void WebService::handleNotFound(AsyncWebServerRequest *request) {
 
 void WebService::handleCalibrate(AsyncWebServerRequest *request) {
   Serial.println(PRINT_PREFIX + "Calibrate");
-  hardware_service->resetSensorData();
-  handleUpdateWeb(request);
+  ControlCommand command = {};
+  command.fields = COMMAND_CALIBRATE;
+  postCommand(request, command);
 }
 
 void WebService::handleUpdateWeb(AsyncWebServerRequest *request) {
-  Configuration configuration = hardware_service->getConfiguration();
-  SensorData sensor_data = hardware_service->getSensorData();
-  MQTTService* mqtt = MQTTService::getSharedInstance();
-
-  // Determine current effect
-  String effect = "none";
-  if (mqtt->isRainbowEnabled()) effect = "rainbow";
-  else if (mqtt->isRainbowMultiEnabled()) effect = "rainbow_multi";
-  else if (mqtt->isCircadianEnabled()) effect = "circadian";
-  else if (mqtt->isWeatherEnabled()) effect = "weather";
-  else if (mqtt->isSensorEnabled()) effect = "sensor";
-
-  String response =
-    KEY_MOTOR_POSITION + "=" + String(configuration.motor_position * 100) + "&" +
-    KEY_SPEED + "=" + String(configuration.speed * 100) + "&" +
-    KEY_UPPER_BRIGHTNESS_THRESHOLD + "=" + String(configuration.upper_brightness_threshold * 100) + "&" +
-    KEY_LOWER_BRIGHTNESS_THRESHOLD + "=" + String(configuration.lower_brightness_threshold * 100) + "&" +
-    KEY_DISTANCE_THRESHOLD + "=" + String(configuration.distance_threshold * 100) + "&" +
-    KEY_IS_AUTONOMOUS + "=" + String(configuration.is_autonomous ? 1 : 0) + "&" +
-    KEY_COLOR + "=" + configuration.color.hexString() + "&" +
-    KEY_TOUCH_LEFT + "=" + String(sensor_data.touch_left ? 1 : 0) + "&" +
-    KEY_TOUCH_RIGHT + "=" + String(sensor_data.touch_right ? 1 : 0) + "&" +
-    KEY_HAS_LIGHT + "=" + String(sensor_data.has_light_sensor ? 1 : 0) + "&" +
-    KEY_HAS_TOUCH + "=" + String(sensor_data.has_touch_sensor ? 1 : 0) + "&" +
-    KEY_EFFECT + "=" + effect + "&" +
-    KEY_LED_BRIGHTNESS + "=" + String(mqtt->getBrightness() * 100 / 255) + "&" +
-    KEY_ADAPTIVE_BRIGHTNESS + "=" + String(mqtt->isAdaptiveBrightnessEnabled() ? 1 : 0) + "&" +
-    KEY_WEATHER_STATE + "=" + (mqtt->isWeatherEnabled() ? mqtt->getWeatherState() : "none");
-
-  Serial.println(PRINT_PREFIX + "Update web with \"" + response + "\".");
-  request->send(200, TEXT_PLAIN, response);
+  // Form encoded state for the web UI, same payload as /sensorData and /events
+  char state[STATE_SNAPSHOT_SIZE];
+  writeState(getPublishedState(), state, sizeof(state));
+  request->send(200, TEXT_PLAIN, state);
 }
 
 void WebService::handleReadADC(AsyncWebServerRequest *request) {
-  Serial.println(PRINT_PREFIX + "Read sensor data.");
-  Configuration configuration = hardware_service->getConfiguration();
-  SensorData sensor_data = hardware_service->getSensorData();
-  MQTTService* mqtt = MQTTService::getSharedInstance();
+  // Fallback for browsers without EventSource
+  handleUpdateWeb(request);
+}
 
-  // Determine current effect
-  String effect = "none";
-  if (mqtt->isRainbowEnabled()) effect = "rainbow";
-  else if (mqtt->isRainbowMultiEnabled()) effect = "rainbow_multi";
-  else if (mqtt->isCircadianEnabled()) effect = "circadian";
-  else if (mqtt->isWeatherEnabled()) effect = "weather";
-  else if (mqtt->isSensorEnabled()) effect = "sensor";
-
-  String response =
-    KEY_BRIGHTNESS + "=" + String(sensor_data.brightness * 100) + "&" +
-    KEY_DISTANCE + "=" + String(sensor_data.distance * 100) + "&" +
-    KEY_MOTOR_POSITION + "=" + String(configuration.motor_position * 100) + "&" +
-    KEY_SPEED + "=" + String(configuration.speed * 100) + "&" +
-    KEY_UPPER_BRIGHTNESS_THRESHOLD + "=" + String(configuration.upper_brightness_threshold * 100) + "&" +
-    KEY_LOWER_BRIGHTNESS_THRESHOLD + "=" + String(configuration.lower_brightness_threshold * 100) + "&" +
-    KEY_DISTANCE_THRESHOLD + "=" + String(configuration.distance_threshold * 100) + "&" +
-    KEY_IS_AUTONOMOUS + "=" + String(configuration.is_autonomous ? 1 : 0) + "&" +
-    KEY_COLOR + "=" + configuration.color.hexString() + "&" +
-    KEY_TOUCH_LEFT + "=" + String(sensor_data.touch_left ? 1 : 0) + "&" +
-    KEY_TOUCH_RIGHT + "=" + String(sensor_data.touch_right ? 1 : 0) + "&" +
-    KEY_HAS_LIGHT + "=" + String(sensor_data.has_light_sensor ? 1 : 0) + "&" +
-    KEY_HAS_TOUCH + "=" + String(sensor_data.has_touch_sensor ? 1 : 0) + "&" +
-    KEY_EFFECT + "=" + effect + "&" +
-    KEY_LED_BRIGHTNESS + "=" + String(mqtt->getBrightness() * 100 / 255) + "&" +
-    KEY_ADAPTIVE_BRIGHTNESS + "=" + String(mqtt->isAdaptiveBrightnessEnabled() ? 1 : 0) + "&" +
-    KEY_WEATHER_STATE + "=" + (mqtt->isWeatherEnabled() ? mqtt->getWeatherState() : "none");
-
-  request->send(200, TEXT_PLAIN, response);
+void WebService::handleApiState(AsyncWebServerRequest *request) {
+  // Rendered into a fixed buffer, the server keeps the only copy of the body
+  char state[API_STATE_SIZE];
+  writeJsonState(getPublishedState(), state, sizeof(state));
+  request->send(200, APPLICATION_JSON, state);
 }
 
-void WebService::handleUpdateFromWeb(AsyncWebServerRequest *request) {
-  Serial.println(PRINT_PREFIX + "Update configuration from web.");
+void WebService::handleMetrics(AsyncWebServerRequest *request) {
+  // The response reads straight from metrics_text until the connection closes
+  if (is_sending_metrics) {
+    AsyncWebServerResponse *response = request->beginResponse(503, TEXT_PLAIN, "Busy");
+    response->addHeader("Retry-After", "1");
+    request->send(response);
+    return;
+  }
 
-  Configuration configuration = hardware_service->getConfiguration();
-  MQTTService* mqtt = MQTTService::getSharedInstance();
+  size_t length = metrics->write(metrics_text, sizeof(metrics_text));
+  if (length == 0) {
+    request->send(500, TEXT_PLAIN, "Metrics buffer too small");
+    return;
+  }
 
-  // IMPORTANT: Handle effect changes FIRST, before setConfiguration()
-  // This prevents race conditions where loop() still sees old effect state
+  is_sending_metrics = true;
+  request->onDisconnect([this]() {
+    is_sending_metrics = false;
+  });
+  request->send_P(200, "text/plain; version=0.0.4", (const uint8_t*)metrics_text, length);
+}
+
+// AsyncTCP task: only parses the request, the control loop applies it
+void WebService::handleUpdateFromWeb(AsyncWebServerRequest *request) {
+  ControlCommand command = {};
 
-  // Handle effect change
   if (request->hasArg(KEY_EFFECT.c_str())) {
-    String effect = request->arg(KEY_EFFECT.c_str());
-    // Disable all effects first
-    mqtt->setRainbowEnabled(false);
-    mqtt->setRainbowMultiEnabled(false);
-    mqtt->setCircadianEnabled(false);
-    mqtt->setWeatherEnabled(false);
-    mqtt->setSensorEnabled(false);
-    // Reset circadian preview when switching effects normally
-    mqtt->setCircadianPreviewHour(-1);
-    // Enable selected effect
-    if (effect == "rainbow") mqtt->setRainbowEnabled(true);
-    else if (effect == "rainbow_multi") mqtt->setRainbowMultiEnabled(true);
-    else if (effect == "circadian") mqtt->setCircadianEnabled(true);
-    else if (effect == "weather") mqtt->setWeatherEnabled(true);
-    else if (effect == "sensor") mqtt->setSensorEnabled(true);
+    command.fields |= COMMAND_EFFECT;
+    strlcpy(command.effect, request->arg(KEY_EFFECT.c_str()).c_str(), sizeof(command.effect));
   }
-  // If color was changed without specifying effect, disable all effects (static color mode)
-  else if (request->hasArg(KEY_COLOR.c_str())) {
-    mqtt->setRainbowEnabled(false);
-    mqtt->setRainbowMultiEnabled(false);
-    mqtt->setCircadianEnabled(false);
-    mqtt->setWeatherEnabled(false);
-    mqtt->setSensorEnabled(false);
+  if (request->hasArg(KEY_COLOR.c_str())) {
+    command.fields |= COMMAND_COLOR;
+    command.color = Color::fromHexString(request->arg(KEY_COLOR.c_str()));
+    // A color without an effect switches to the static color
+    if (!command.has(COMMAND_EFFECT)) {
+      command.fields |= COMMAND_EFFECT;
+      strlcpy(command.effect, "none", sizeof(command.effect));
+    }
   }
-
-  // Handle LED brightness change (before setConfiguration to avoid flicker)
   if (request->hasArg(KEY_LED_BRIGHTNESS.c_str())) {
-    int brightness_percent = request->arg(KEY_LED_BRIGHTNESS.c_str()).toInt();
-    mqtt->setBrightness((uint8_t)(brightness_percent * 255 / 100));
+    command.fields |= COMMAND_LED_BRIGHTNESS;
+    command.led_brightness = (uint8_t)(constrain(request->arg(KEY_LED_BRIGHTNESS.c_str()).toInt(), 0, 100) * 255 / 100);
   }
-
-  // Handle adaptive brightness change
   if (request->hasArg(KEY_ADAPTIVE_BRIGHTNESS.c_str())) {
-    mqtt->setAdaptiveBrightnessEnabled(request->arg(KEY_ADAPTIVE_BRIGHTNESS.c_str()).toInt() > 0);
+    command.fields |= COMMAND_ADAPTIVE_BRIGHTNESS;
+    command.is_adaptive_brightness = request->arg(KEY_ADAPTIVE_BRIGHTNESS.c_str()).toInt() > 0;
   }
-
-  // Handle effect preview - weather or circadian
-  if (request->hasArg(KEY_WEATHER_DEBUG.c_str())) {
-    String preview_state = request->arg(KEY_WEATHER_DEBUG.c_str());
-    if (preview_state.length() > 0) {
-      // Disable adaptive brightness and set to full brightness
-      mqtt->setAdaptiveBrightnessEnabled(false);
-      mqtt->setBrightness(255);
-      // Disable all effects first
-      mqtt->setRainbowEnabled(false);
-      mqtt->setRainbowMultiEnabled(false);
-      mqtt->setCircadianEnabled(false);
-      mqtt->setSensorEnabled(false);
-      mqtt->setWeatherEnabled(false);
-
-      // Check if it's a circadian preview
-      if (preview_state.startsWith("circadian_")) {
-        // Enable circadian effect with preview hour
-        mqtt->setCircadianEnabled(true);
-        int preview_hour = 12; // Default midday
-        if (preview_state == "circadian_night") preview_hour = 2;
-        else if (preview_state == "circadian_sunrise") preview_hour = 7;
-        else if (preview_state == "circadian_morning") preview_hour = 9;
-        else if (preview_state == "circadian_midday") preview_hour = 13;
-        else if (preview_state == "circadian_afternoon") preview_hour = 17;
-        else if (preview_state == "circadian_sunset") preview_hour = 20;
-        mqtt->setCircadianPreviewHour(preview_hour);
-      } else {
-        // Weather preview
-        mqtt->setWeatherEnabled(true);
-        mqtt->setWeatherState(preview_state);
-        mqtt->setCircadianPreviewHour(-1); // Disable circadian preview
-
-        // Calculate and set motor position for weather preview
-        float target_position = MOTOR_POSITION_OPEN;
-        if (preview_state == "rainy" || preview_state == "pouring" ||
-            preview_state == "lightning" || preview_state == "lightning-rainy" ||
-            preview_state == "hail" || preview_state == "snowy" || preview_state == "snowy-rainy") {
-          target_position = MOTOR_POSITION_CLOSED;
-        } else if (preview_state == "partlycloudy") {
-          target_position = 0.75f;
-        } else if (preview_state == "cloudy" || preview_state == "fog" ||
-                   preview_state == "windy" || preview_state == "windy-variant") {
-          target_position = 0.5f;
-        }
-        configuration.motor_position = target_position;
-      }
-    }
+  if (request->hasArg(KEY_WEATHER_DEBUG.c_str()) && (request->arg(KEY_WEATHER_DEBUG.c_str()).length() > 0)) {
+    command.fields |= COMMAND_PREVIEW;
+    strlcpy(command.preview, request->arg(KEY_WEATHER_DEBUG.c_str()).c_str(), sizeof(command.preview));
   }
-
-  // Now handle configuration changes
   if (request->hasArg(KEY_MOTOR_POSITION.c_str())) {
-    configuration.motor_position = request->arg(KEY_MOTOR_POSITION.c_str()).toFloat() / 100;
+    command.fields |= COMMAND_MOTOR_POSITION;
+    command.motor_position = request->arg(KEY_MOTOR_POSITION.c_str()).toFloat() / 100;
   }
-
   if (request->hasArg(KEY_UPPER_BRIGHTNESS_THRESHOLD.c_str())) {
-    configuration.upper_brightness_threshold = request->arg(KEY_UPPER_BRIGHTNESS_THRESHOLD.c_str()).toFloat() / 100;
+    command.fields |= COMMAND_UPPER_BRIGHTNESS_THRESHOLD;
+    command.upper_brightness_threshold = request->arg(KEY_UPPER_BRIGHTNESS_THRESHOLD.c_str()).toFloat() / 100;
   }
-
   if (request->hasArg(KEY_LOWER_BRIGHTNESS_THRESHOLD.c_str())) {
-    configuration.lower_brightness_threshold = request->arg(KEY_LOWER_BRIGHTNESS_THRESHOLD.c_str()).toFloat() / 100;
+    command.fields |= COMMAND_LOWER_BRIGHTNESS_THRESHOLD;
+    command.lower_brightness_threshold = request->arg(KEY_LOWER_BRIGHTNESS_THRESHOLD.c_str()).toFloat() / 100;
   }
-
   if (request->hasArg(KEY_DISTANCE_THRESHOLD.c_str())) {
-    configuration.distance_threshold = request->arg(KEY_DISTANCE_THRESHOLD.c_str()).toFloat() / 100;
+    command.fields |= COMMAND_DISTANCE_THRESHOLD;
+    command.distance_threshold = request->arg(KEY_DISTANCE_THRESHOLD.c_str()).toFloat() / 100;
   }
-
   if (request->hasArg(KEY_IS_AUTONOMOUS.c_str())) {
-    configuration.is_autonomous = request->arg(KEY_IS_AUTONOMOUS.c_str()).toInt() > 0;
+    command.fields |= COMMAND_IS_AUTONOMOUS;
+    command.is_autonomous = request->arg(KEY_IS_AUTONOMOUS.c_str()).toInt() > 0;
+  }
+  if (request->hasArg(KEY_SPEED.c_str())) {
+    command.fields |= COMMAND_SPEED;
+    command.speed = request->arg(KEY_SPEED.c_str()).toFloat() / 100;
   }
 
-  if (request->hasArg(KEY_COLOR.c_str())) {
-    configuration.color = Color::fromHexString(request->arg(KEY_COLOR.c_str()));
+  postCommand(request, command);
+}
+
+// Body of POST /api/v1/configuration, collected in the request's temporary buffer
+void WebService::handleBatchBody(AsyncWebServerRequest *request, uint8_t *data, size_t length, size_t index, size_t total) {
+  if (total > MAX_BATCH_SIZE) {
+    return;
+  }
+  if (index == 0) {
+    request->_tempObject = malloc(total + 1);
   }
+  if ((request->_tempObject != nullptr) && (index + length <= total)) {
+    memcpy((uint8_t*)request->_tempObject + index, data, length);
+    ((char*)request->_tempObject)[index + length] = '\0';
+  }
+}
 
-  if (request->hasArg(KEY_SPEED.c_str())) {
-    configuration.speed = request->arg(KEY_SPEED.c_str()).toFloat() / 100;
+void WebService::handleBatch(AsyncWebServerRequest *request) {
+  if (request->_tempObject == nullptr) {
+    request->send(413, TEXT_PLAIN, "Batch missing or too large");
+    return;
   }
 
-  // Apply configuration (effects are already set correctly)
-  hardware_service->setConfiguration(configuration);
+  // Validated as a whole, an invalid batch changes nothing
+  JsonDocument doc;
+  ControlCommand command;
+  char error[96];
+  if (deserializeJson(doc, (const char*)request->_tempObject) || !doc.is<JsonObject>()) {
+    request->send(400, TEXT_PLAIN, "Invalid JSON");
+    return;
+  }
+  if (!CommandQueue::parseBatch(doc.as<JsonObjectConst>(), command, error, sizeof(error))) {
+    request->send(400, TEXT_PLAIN, error);
+    return;
+  }
+  postCommand(request, command);
+}
 
-  // Publish state changes to MQTT
-  if (request->hasArg(KEY_EFFECT.c_str()) || request->hasArg(KEY_COLOR.c_str()) ||
-      request->hasArg(KEY_LED_BRIGHTNESS.c_str())) {
-    mqtt->publishLightState();
+void WebService::postCommand(AsyncWebServerRequest *request, const ControlCommand& command) {
+  if (!command_queue->post(command)) {
+    Serial.println(PRINT_PREFIX + "Command queue full, configuration dropped.");
+    request->send(503, TEXT_PLAIN, "Busy");
+    return;
   }
 
-  if (request->hasArg(KEY_ADAPTIVE_BRIGHTNESS.c_str())) {
-    mqtt->publishAdaptiveBrightnessState();
+  // Applied with the next frame, the new state reaches the web UI through /events
+  request->send(202, TEXT_PLAIN, "");
+}
+
+// Body of POST /api/v1/ota?sha256=<hex>, streamed into the update partition
+void WebService::handleFirmwareBody(AsyncWebServerRequest *request, uint8_t *data, size_t length, size_t index, size_t total) {
+  if (index == 0) {
+    const char* sha256 = request->hasParam("sha256") ? request->getParam("sha256")->value().c_str() : nullptr;
+    if (!firmware_updater->begin(total, sha256)) {
+      return;
+    }
+    firmware_request = request;
+    request->onDisconnect([this, request]() {
+      if (firmware_request == request) {
+        firmware_request = nullptr;
+        firmware_updater->abort("upload interrupted");
+      }
+    });
   }
+  if (request == firmware_request) {
+    firmware_updater->write(data, length);
+  }
+}
 
-  if (request->hasArg(KEY_IS_AUTONOMOUS.c_str())) {
-    mqtt->publishModeState();
+void WebService::handleFirmwareUpdate(AsyncWebServerRequest *request) {
+  if (request != firmware_request) {
+    switch (firmware_updater->getState()) {
+      case UPDATE_WRITING:
+      case UPDATE_FINISHED:
+        request->send(409, TEXT_PLAIN, "Update in progress");
+        break;
+      case UPDATE_FAILED:
+        request->send(400, TEXT_PLAIN, firmware_updater->getError());
+        break;
+      default:
+        request->send(400, TEXT_PLAIN, "Firmware image missing");
+        break;
+    }
+    return;
   }
 
-  handleUpdateWeb(request);
+  firmware_request = nullptr;
+  if (!firmware_updater->end()) {
+    request->send(400, TEXT_PLAIN, firmware_updater->getError());
+    return;
+  }
+  request->send(200, TEXT_PLAIN, "Image verified, restarting");
 }
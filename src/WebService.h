@@ -9,6 +9,22 @@
 #include "DNSService.h"
 #include "HardwareService.h"
 #include "WiFiService.h"
+#include "StaticAssetHandler.h"
+#include "CommandQueue.h"
+#include "LiveStream.h"
+#include "RealtimeReceiver.h"
+#include "Metrics.h"
+#include "FirmwareUpdater.h"
+
+// Consistent copy of the state shown by the web UI and the API
+struct WebState {
+  Configuration configuration;
+  SensorData sensor_data;
+  const char* effect;
+  uint8_t led_brightness; // [0, 255]
+  boolean is_adaptive_brightness;
+  char weather_state[24];
+};
 
 class WebService {
 
@@ -35,18 +51,63 @@ class WebService {
     HardwareService* hardware_service;
     WiFiService* wifi_service;
     AsyncWebServer *server;
+    StaticAssetHandler *static_assets;
+    AsyncEventSource *events = nullptr;
+    LiveStream *live_stream = nullptr;
+    RealtimeReceiver *realtime_receiver = nullptr;
+
+    // State pushed to all web UI clients, serialized once per change
+    static const size_t STATE_SNAPSHOT_SIZE = 512;
+    static const size_t API_STATE_SIZE = 768;
+    char state_snapshot[STATE_SNAPSHOT_SIZE];
+    size_t state_snapshot_length = 0;
+    unsigned long state_pushed_at = 0;
+    volatile boolean has_new_event_client = false;
+
+    // Published by the control loop once per frame, the request handlers
+    // (AsyncTCP task) only copy this instead of reading the live state
+    WebState published_state;
+    SemaphoreHandle_t state_mutex;
+
+    // Changes from web requests are applied by the control loop
+    CommandQueue* command_queue;
+
+    // Prometheus scrapes (/metrics) are rendered into one fixed buffer,
+    // a second scrape while the first is still being sent gets a 503
+    static const size_t METRICS_SIZE = 12288;
+    Metrics* metrics;
+    char metrics_text[METRICS_SIZE];
+    volatile boolean is_sending_metrics = false;
+
+    // Firmware upload being written, one at a time
+    FirmwareUpdater* firmware_updater;
+    AsyncWebServerRequest *firmware_request = nullptr;
 
     // MARK: Helpers
 
     boolean startWebServer(const uint16_t port);
+    void pushState(const WebState& state);
+    void publishState(const WebState& state);
+    WebState getPublishedState();
+    WebState readState();
+    size_t writeState(const WebState& state, char* buffer, size_t size);
+    size_t writeJsonState(const WebState& state, char* buffer, size_t size);
+    const char* getEffectName();
 
     void handleNotFound(AsyncWebServerRequest *request);
     void handleGenerate(AsyncWebServerRequest *request);
     void handleReadADC(AsyncWebServerRequest *request);
+    void handleApiState(AsyncWebServerRequest *request);
+    void handleMetrics(AsyncWebServerRequest *request);
     void handleCalibrate(AsyncWebServerRequest *request);
 
     void handleUpdateWeb(AsyncWebServerRequest *request);
     void handleUpdateFromWeb(AsyncWebServerRequest *request);
+    void handleBatch(AsyncWebServerRequest *request);
+    void handleBatchBody(AsyncWebServerRequest *request, uint8_t *data, size_t length, size_t index, size_t total);
+    void postCommand(AsyncWebServerRequest *request, const ControlCommand& command);
+    void handleFirmwareUpdate(AsyncWebServerRequest *request);
+    void handleFirmwareBody(AsyncWebServerRequest *request, uint8_t *data, size_t length, size_t index, size_t total);
     
 };
 
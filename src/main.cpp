@@ -6,6 +6,10 @@
 #include "Models.h"
 #include "WebService.h"
 #include "MQTTService.h"
+#include "AnimationClock.h"
+#include "CommandQueue.h"
+#include "Metrics.h"
+#include "FirmwareUpdater.h"
 #include <exception>
 #include <esp_task_wdt.h>
 // MARK: Constants
@@ -19,10 +23,10 @@ const IPAddress IP_ADDRESS = IPAddress(192, 168, 4, 1);
 const uint16_t PORT = 80;
 
 const long BAUD_RATE = 115200;
-const unsigned long MIN_LOOP_DURATION = 100;
 
 uint32_t loop_count = 0;
 boolean has_started = false;
+unsigned long max_loop_duration = 0; // us, DEBUG_LOOP_TIMING
 
 // MARK: Variables
 
@@ -38,6 +42,9 @@ void setup() {
 
   esp_task_wdt_init(60, false);
 
+  // Rolls back a new firmware image that keeps crashing before it is confirmed
+  FirmwareUpdater::getSharedInstance()->checkBoot();
+
   Serial.println(PRINT_PREFIX + "Version: " + VERSION);
   Serial.println(PRINT_PREFIX + "Build Date: " + DATE);
   Serial.println(PRINT_PREFIX + "Build Time: " + TIME);
@@ -56,14 +63,33 @@ void setup() {
 void loop() {
   try {
     loop_count++;
-    unsigned long start_time = millis();
+    AnimationClock* animation_clock = AnimationClock::getSharedInstance();
+    animation_clock->update();
+    Metrics* metrics = Metrics::getSharedInstance();
+    unsigned long frame_started_at = micros();
+    // Configuration changes from the web server, applied at one point per frame
+    CommandQueue::getSharedInstance()->applyPending();
+    metrics->observe(METRIC_LOOP_COMMANDS, micros() - frame_started_at);
+#if DEBUG_LOOP_TIMING
+    unsigned long start_micros = micros();
+#endif
     web_service->loop(loop_count);
+    unsigned long mqtt_started_at = micros();
     mqtt_service->loop();
-    unsigned long end_time = millis();
-    if (end_time > start_time) { // millis has the possibility to overflow every 50 days.
-      long delay_duration = ((long)start_time - (long)end_time) + (long)MIN_LOOP_DURATION;
-      delay((delay_duration >= 0) ? delay_duration : 0);
+    metrics->observe(METRIC_LOOP_MQTT, micros() - mqtt_started_at);
+    metrics->observe(METRIC_LOOP_FRAME, micros() - frame_started_at);
+    metrics->loop();
+    // A new image is confirmed once it is up and connected to MQTT
+    FirmwareUpdater::getSharedInstance()->loop(has_started && mqtt_service->isConnected());
+#if DEBUG_LOOP_TIMING
+    max_loop_duration = max(max_loop_duration, micros() - start_micros);
+    if ((loop_count % 600) == 0) {
+      Serial.println(PRINT_PREFIX + "Max loop duration: " + String(max_loop_duration) + " us, MQTT " + (mqtt_service->isConnected() ? "connected" : "offline"));
+      max_loop_duration = 0;
     }
+#endif
+    // Frames start on the boundaries of the shared clock, on all flowers at once
+    delay(animation_clock->getDelayToNextFrame());
   } catch (const std::runtime_error& error) {
     Serial.println(PRINT_PREFIX + "Loop caused error: " + error.what() + ".");
   } catch (const std::exception& exception) {
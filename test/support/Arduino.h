@@ -0,0 +1,99 @@
+
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+// Host stand-in for the parts of the Arduino core that the hardware
+// independent classes use, so they build in the native test environment.
+
+// MARK: Includes
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+using std::min;
+using std::max;
+
+// MARK: Types
+
+typedef bool boolean;
+
+// MARK: Time
+
+// Set by the tests, it never advances on its own
+inline unsigned long host_millis = 0;
+
+inline unsigned long millis() {
+  return host_millis;
+}
+
+inline unsigned long micros() {
+  return host_millis * 1000;
+}
+
+// MARK: Strings
+
+// Only what log messages need
+class String {
+
+  public:
+
+    String(const char* text = "") : value(text) {}
+    String(const std::string& text) : value(text) {}
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    String(T number) : value(std::to_string(number)) {}
+
+    const char* c_str() const {
+      return value.c_str();
+    }
+
+    friend String operator+(const String& left, const String& right) {
+      return String(left.value + right.value);
+    }
+
+  private:
+
+    std::string value;
+
+};
+
+// Not in every C library, a macro so it can't clash with one that has it
+inline size_t host_strlcpy(char* destination, const char* source, size_t size) {
+  size_t length = strlen(source);
+  if (size > 0) {
+    size_t count = std::min(length, size - 1);
+    memcpy(destination, source, count);
+    destination[count] = '\0';
+  }
+  return length;
+}
+#define strlcpy host_strlcpy
+
+// MARK: Serial
+
+// Output is dropped, the tests report through Unity
+struct HostSerial {
+  template <typename T> void print(const T&) {}
+  template <typename T> void println(const T&) {}
+  void println() {}
+  int printf(const char*, ...) { return 0; }
+};
+
+inline HostSerial Serial;
+
+// MARK: FreeRTOS
+
+// Tests run on one thread
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef CREDENTIALS_H_
+#define CREDENTIALS_H_
+
+// Placeholders for host tests, Settings.h includes this file
+
+#define WIFI_SSID ""
+#define WIFI_PASSWORD ""
+
+#define MQTT_BROKER "127.0.0.1"
+#define MQTT_PORT 1883
+#define MQTT_USER ""
+#define MQTT_PASSWORD ""
+
+#define NTP_TIMEZONE "UTC0"
+
+#endif
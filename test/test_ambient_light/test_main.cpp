@@ -0,0 +1,223 @@
+
+// LED self-illumination compensation against a simulated light sensor: the
+// sensor sees the ambient light plus a fixed lux per unit of LED output,
+// averaged over its integration window (the ALS measurement time). Like the
+// control loop, every sixth frame skips the reading for the motor, so the
+// samples are up to 200 ms apart.
+
+// MARK: Includes
+
+#include <unity.h>
+#include "AmbientLightCompensator.h"
+
+// MARK: Constants
+
+const unsigned long FRAME_DURATION = 100; // ms, one sample per frame like the control loop
+const uint8_t FRAMES_PER_MOTOR_UPDATE = 6; // No sample in these frames
+const float LUX_PER_OUTPUT = 35.0f; // Simulated sensor, the initial estimate is LED_SELF_ILLUMINATION_LUX (20)
+const float OUTPUT_LEVELS[] = { 0.5f, 3.0f, 1.5f, 4.5f }; // Stepped LED output
+const uint8_t FRAMES_PER_LEVEL = 5;
+
+// MARK: Helpers
+
+AmbientLightCompensator* compensator;
+uint32_t frame_index;
+unsigned long integration_time; // ms, the active ALS measurement time
+float compensated_lux; // Of the last sample
+
+// What the LEDs actually showed, for the simulated sensor
+float shown_outputs[8];
+unsigned long shown_at[8];
+uint8_t shown_head;
+
+float outputForFrame(uint32_t index) {
+  return OUTPUT_LEVELS[(index / FRAMES_PER_LEVEL) % 4];
+}
+
+void showFrame(float output) {
+  shown_outputs[shown_head] = output;
+  shown_at[shown_head] = millis();
+  shown_head = (shown_head + 1) % 8;
+  compensator->addFrame(output, millis());
+}
+
+// Ambient light plus the LED output averaged over the integration window
+float readSensor(float ambient_lux) {
+  float output_sum = 0;
+  unsigned long covered = 0;
+  for (uint8_t i = 1; (i <= 8) && (covered < integration_time); i++) {
+    uint8_t index = (shown_head + 8 - i) % 8;
+    unsigned long age = min(millis() - shown_at[index], integration_time);
+    output_sum += shown_outputs[index] * (age - covered);
+    covered = age;
+  }
+  return ambient_lux + LUX_PER_OUTPUT * output_sum / integration_time;
+}
+
+// One control loop frame: read the sensor (unless the motor takes this
+// frame), then render the next frame. Returns true if it took a sample.
+boolean runFrame(float ambient_lux, float output) {
+  host_millis += FRAME_DURATION;
+  boolean is_sampled = (frame_index % FRAMES_PER_MOTOR_UPDATE) != 0;
+  if (is_sampled) {
+    compensated_lux = compensator->compensate(readSensor(ambient_lux), millis(), integration_time);
+  }
+
+  showFrame(output);
+  frame_index++;
+  return is_sampled;
+}
+
+void setUp() {
+  host_millis = 1000;
+  compensator = new AmbientLightCompensator();
+  frame_index = 0;
+  integration_time = 100;
+  compensated_lux = 0;
+  shown_head = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    shown_outputs[i] = 0;
+    shown_at[i] = 0;
+  }
+}
+
+void tearDown() {
+  delete compensator;
+}
+
+// MARK: Tests
+
+void test_gain_converges() {
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(100.0f, outputForFrame(frame_index));
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, LUX_PER_OUTPUT, compensator->getLuxPerOutput());
+}
+
+// The bright range integrates only the last 50 ms of each frame
+void test_gain_converges_with_short_integration_time() {
+  integration_time = 50;
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(100.0f, outputForFrame(frame_index));
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, LUX_PER_OUTPUT, compensator->getLuxPerOutput());
+}
+
+void test_compensated_lux_follows_ambient_while_leds_change() {
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(100.0f, outputForFrame(frame_index));
+  }
+
+  // Ambient light ramps from 100 to 400 lux over a minute while the LEDs keep stepping
+  float worst_error = 0;
+  for (uint16_t i = 0; i <= 600; i++) {
+    float ambient_lux = 100.0f + i * 0.5f;
+    if (runFrame(ambient_lux, outputForFrame(frame_index))) {
+      worst_error = max(worst_error, fabsf(compensated_lux - ambient_lux));
+    }
+  }
+  TEST_ASSERT_LESS_THAN(5.0f, worst_error);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, LUX_PER_OUTPUT, compensator->getLuxPerOutput());
+}
+
+// Frames shorter than the sampling interval are weighted by how long they were shown
+void test_output_is_averaged_over_the_window() {
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(50.0f, outputForFrame(frame_index));
+  }
+
+  // 30 ms at 4.0 and 70 ms at 0, one sample at the end
+  showFrame(4.0f);
+  host_millis += 30;
+  showFrame(0.0f);
+  host_millis += 70;
+  float lux = compensator->compensate(readSensor(50.0f), millis(), integration_time);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 50.0f, lux);
+}
+
+// After a skipped sample only the integration window counts, not the 200 ms since the previous sample
+void test_skipped_sample_uses_integration_time() {
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(50.0f, outputForFrame(frame_index));
+  }
+
+  host_millis += FRAME_DURATION;
+  compensator->compensate(readSensor(50.0f), millis(), integration_time);
+  showFrame(4.5f);
+  host_millis += FRAME_DURATION; // No sample, the motor frame
+  showFrame(0.5f);
+  host_millis += FRAME_DURATION;
+  float measured_lux = readSensor(50.0f);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f + LUX_PER_OUTPUT * 0.5f, measured_lux);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 50.0f, compensator->compensate(measured_lux, millis(), integration_time));
+}
+
+// Without output steps, ambient changes must not be mistaken for LED light
+void test_constant_output_learns_nothing() {
+  // Switching the LEDs on is a step, the frames after it are not
+  runFrame(100.0f, 2.0f);
+  runFrame(100.0f, 2.0f);
+  float lux_per_output = compensator->getLuxPerOutput();
+
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(100.0f + i, 2.0f);
+  }
+  TEST_ASSERT_EQUAL_FLOAT(lux_per_output, compensator->getLuxPerOutput());
+}
+
+void test_never_negative() {
+  for (uint16_t i = 0; i < 600; i++) {
+    runFrame(0.0f, outputForFrame(frame_index));
+  }
+  host_millis += FRAME_DURATION;
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, compensator->compensate(0.0f, millis(), integration_time));
+}
+
+// Adaptive brightness mapping of HardwareService: 1% of 4095 lux = 5% LED
+// output, 9% = 100%, recomputed every 15 s from the smoothed compensated lux
+float brightnessFactorFor(float lux) {
+  float brightness_percent = min(lux, 4095.0f) / 4095.0f * 100.0f;
+  return min(255.0f, max(13.0f, 13 + (brightness_percent - 1.0f) * 30.25f)) / 255.0f;
+}
+
+// The compensated lux sets the LED brightness, which the sensor sees again.
+// Starting from the wrong initial estimate, the loop must settle on the
+// factor of the ambient light alone instead of brightening itself up.
+void test_closed_loop_does_not_drift() {
+  const float AMBIENT_LUX = 150.0f;
+  const uint16_t FRAMES_PER_UPDATE = 150;
+  float factor = 1.0f;
+  float smoothed_lux = 0;
+  boolean has_sample = false;
+  float factors[8];
+
+  for (uint16_t update = 0; update < 80; update++) {
+    for (uint16_t i = 0; i < FRAMES_PER_UPDATE; i++) {
+      if (runFrame(AMBIENT_LUX, factor * outputForFrame(frame_index))) {
+        smoothed_lux = has_sample ? (0.9f * smoothed_lux + 0.1f * compensated_lux) : compensated_lux;
+        has_sample = true;
+      }
+    }
+    factor = brightnessFactorFor(smoothed_lux);
+    factors[update % 8] = factor;
+  }
+
+  // Settled on the ambient light's factor, and stays there
+  for (uint8_t i = 0; i < 8; i++) {
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, brightnessFactorFor(AMBIENT_LUX), factors[i]);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(5.0f, AMBIENT_LUX, smoothed_lux);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_gain_converges);
+  RUN_TEST(test_gain_converges_with_short_integration_time);
+  RUN_TEST(test_compensated_lux_follows_ambient_while_leds_change);
+  RUN_TEST(test_output_is_averaged_over_the_window);
+  RUN_TEST(test_skipped_sample_uses_integration_time);
+  RUN_TEST(test_constant_output_learns_nothing);
+  RUN_TEST(test_never_negative);
+  RUN_TEST(test_closed_loop_does_not_drift);
+  return UNITY_END();
+}
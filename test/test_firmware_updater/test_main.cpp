@@ -0,0 +1,411 @@
+
+// Firmware updates against a fake update partition: chunked writes, size and
+// SHA-256 checks, and the rollback of a new image that doesn't come up
+
+// MARK: Includes
+
+#include <unity.h>
+#include <vector>
+#include "FirmwareUpdater.h"
+
+// MARK: Fake Platform
+
+class FakePartition : public FirmwarePlatform {
+
+  public:
+
+    size_t size = 64 * 1024;
+    boolean is_image_valid = true; // Result of endImage
+    boolean has_other_image = true; // A rollback needs one
+
+    boolean is_open = false;
+    boolean was_aborted = false;
+    boolean is_boot_partition = false;
+    boolean is_marked_valid = false;
+    uint8_t restart_count = 0;
+    std::vector<uint8_t> image;
+    std::vector<size_t> write_lengths;
+    FirmwareBootState boot_state = { false, 0, false };
+    std::vector<std::string> states;
+
+    // Download
+    int download_status = 200;
+    int download_size = -1;
+    std::string download_url;
+    std::vector<uint8_t> download;
+    size_t download_offset = 0;
+
+    size_t getUpdatePartitionSize() override { return size; }
+    const char* getUpdatePartitionLabel() override { return "app1"; }
+
+    boolean beginImage() override {
+      image.clear();
+      is_open = true;
+      return true;
+    }
+
+    boolean writeImage(const uint8_t* data, size_t length) override {
+      if (!is_open) {
+        return false;
+      }
+      image.insert(image.end(), data, data + length);
+      write_lengths.push_back(length);
+      return true;
+    }
+
+    boolean endImage() override {
+      is_open = false;
+      return is_image_valid;
+    }
+
+    void abortImage() override {
+      is_open = false;
+      was_aborted = true;
+    }
+
+    boolean bootUpdatePartition() override {
+      is_boot_partition = has_other_image;
+      return has_other_image;
+    }
+
+    void markRunningImageValid() override { is_marked_valid = true; }
+    void restart() override { restart_count++; }
+
+    FirmwareBootState loadBootState() override { return boot_state; }
+    void saveBootState(const FirmwareBootState& state) override { boot_state = state; }
+
+    // Runs the download right away instead of on a task
+    boolean startPullTask(FirmwareUpdater* updater) override {
+      updater->runPull();
+      return true;
+    }
+
+    int openDownload(const char* url, int* size) override {
+      download_url = url;
+      *size = download_size;
+      return download_status;
+    }
+
+    size_t readDownload(uint8_t* buffer, size_t length) override {
+      size_t count = std::min(length, download.size() - download_offset);
+      memcpy(buffer, download.data() + download_offset, count);
+      download_offset += count;
+      return count;
+    }
+
+    void closeDownload() override {}
+
+    void publishState(const char* message) override { states.push_back(message); }
+
+    boolean hasState(const char* text) {
+      for (const std::string& state : states) {
+        if (state.find(text) != std::string::npos) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+};
+
+// MARK: Helpers
+
+FakePartition* partition;
+FirmwareUpdater* updater;
+
+std::vector<uint8_t> makeImage(size_t size) {
+  std::vector<uint8_t> image(size);
+  for (size_t i = 0; i < size; i++) {
+    image[i] = (uint8_t)(i * 31 + (i >> 8));
+  }
+  return image;
+}
+
+std::string hashImage(const std::vector<uint8_t>& image) {
+  mbedtls_sha256_context context;
+  mbedtls_sha256_init(&context);
+  mbedtls_sha256_starts(&context, 0);
+  mbedtls_sha256_update(&context, image.data(), image.size());
+  uint8_t hash[32];
+  mbedtls_sha256_finish(&context, hash);
+  mbedtls_sha256_free(&context);
+
+  char text[65];
+  for (uint8_t i = 0; i < 32; i++) {
+    snprintf(text + 2 * i, 3, "%02x", hash[i]);
+  }
+  return text;
+}
+
+// Feeds the image in pieces of length bytes, like an upload or a download does
+boolean writeImage(const std::vector<uint8_t>& image, size_t length) {
+  for (size_t offset = 0; offset < image.size(); offset += length) {
+    if (!updater->write(image.data() + offset, std::min(length, image.size() - offset))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Boots with the given boot state, like setup() does
+void boot(FirmwareBootState boot_state) {
+  partition->boot_state = boot_state;
+  updater->checkBoot();
+}
+
+void setUp() {
+  host_millis = 1000;
+  partition = new FakePartition();
+  updater = new FirmwareUpdater(partition);
+}
+
+void tearDown() {
+  delete updater;
+  delete partition;
+}
+
+// MARK: Tests
+
+void test_sha256_of_known_input() {
+  std::vector<uint8_t> abc = { 'a', 'b', 'c' };
+  TEST_ASSERT_EQUAL_STRING("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", hashImage(abc).c_str());
+}
+
+void test_image_is_written_in_sector_chunks() {
+  std::vector<uint8_t> image = makeImage(10000);
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+  TEST_ASSERT_TRUE(writeImage(image, 1000));
+
+  // Nothing of the last, partial chunk is written before end()
+  TEST_ASSERT_EQUAL(2, partition->write_lengths.size());
+  TEST_ASSERT_TRUE(updater->end());
+  TEST_ASSERT_EQUAL(3, partition->write_lengths.size());
+  TEST_ASSERT_EQUAL(OTA_CHUNK_SIZE, partition->write_lengths[0]);
+  TEST_ASSERT_EQUAL(OTA_CHUNK_SIZE, partition->write_lengths[1]);
+  TEST_ASSERT_EQUAL(10000 - 2 * OTA_CHUNK_SIZE, partition->write_lengths[2]);
+  TEST_ASSERT_TRUE(partition->image == image);
+
+  TEST_ASSERT_EQUAL(UPDATE_FINISHED, updater->getState());
+  TEST_ASSERT_TRUE(partition->is_boot_partition);
+  TEST_ASSERT_TRUE(partition->boot_state.is_pending);
+  TEST_ASSERT_EQUAL(0, partition->boot_state.boot_count);
+  TEST_ASSERT_TRUE(partition->hasState("\"progress\":80"));
+}
+
+void test_pieces_larger_than_a_chunk() {
+  std::vector<uint8_t> image = makeImage(3 * OTA_CHUNK_SIZE + 1);
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+  TEST_ASSERT_TRUE(writeImage(image, 5000));
+  TEST_ASSERT_TRUE(updater->end());
+  TEST_ASSERT_EQUAL(4, partition->write_lengths.size());
+  TEST_ASSERT_EQUAL(1, partition->write_lengths[3]);
+  TEST_ASSERT_TRUE(partition->image == image);
+}
+
+void test_restarts_after_the_report() {
+  std::vector<uint8_t> image = makeImage(5000);
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+  writeImage(image, 1000);
+  TEST_ASSERT_TRUE(updater->end());
+
+  updater->loop(true);
+  TEST_ASSERT_EQUAL(0, partition->restart_count);
+  host_millis += 2000;
+  updater->loop(true);
+  TEST_ASSERT_EQUAL(1, partition->restart_count);
+}
+
+void test_unknown_size() {
+  std::vector<uint8_t> image = makeImage(9000);
+  TEST_ASSERT_TRUE(updater->begin(0, hashImage(image).c_str()));
+  TEST_ASSERT_TRUE(writeImage(image, 700));
+  TEST_ASSERT_TRUE(updater->end());
+  TEST_ASSERT_TRUE(partition->image == image);
+  TEST_ASSERT_FALSE(partition->hasState("progress"));
+}
+
+void test_image_larger_than_announced() {
+  // Caught by the chunk that crosses the announced size
+  std::vector<uint8_t> image = makeImage(3 * OTA_CHUNK_SIZE);
+  TEST_ASSERT_TRUE(updater->begin(5000, hashImage(image).c_str()));
+  TEST_ASSERT_FALSE(writeImage(image, 1000));
+  TEST_ASSERT_EQUAL(UPDATE_FAILED, updater->getState());
+  TEST_ASSERT_EQUAL_STRING("image larger than announced", updater->getError());
+  TEST_ASSERT_EQUAL(1, partition->write_lengths.size());
+  TEST_ASSERT_TRUE(partition->was_aborted);
+  TEST_ASSERT_FALSE(partition->is_boot_partition);
+
+  // Also by the partial chunk that end() writes
+  tearDown();
+  setUp();
+  image = makeImage(2 * OTA_CHUNK_SIZE + 1);
+  TEST_ASSERT_TRUE(updater->begin(2 * OTA_CHUNK_SIZE, hashImage(image).c_str()));
+  TEST_ASSERT_TRUE(writeImage(image, 1000));
+  TEST_ASSERT_FALSE(updater->end());
+  TEST_ASSERT_EQUAL_STRING("image larger than announced", updater->getError());
+  TEST_ASSERT_EQUAL(2, partition->write_lengths.size());
+  TEST_ASSERT_TRUE(partition->was_aborted);
+}
+
+void test_incomplete_image() {
+  std::vector<uint8_t> image = makeImage(10000);
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+  image.resize(9000);
+  TEST_ASSERT_TRUE(writeImage(image, 1000));
+  TEST_ASSERT_FALSE(updater->end());
+  TEST_ASSERT_EQUAL(UPDATE_FAILED, updater->getState());
+  TEST_ASSERT_EQUAL_STRING("image incomplete", updater->getError());
+  TEST_ASSERT_TRUE(partition->was_aborted);
+  TEST_ASSERT_FALSE(partition->is_boot_partition);
+}
+
+void test_sha256_mismatch() {
+  std::vector<uint8_t> image = makeImage(10000);
+  std::string hash = hashImage(image);
+  image[5000] ^= 0x01;
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hash.c_str()));
+  TEST_ASSERT_TRUE(writeImage(image, 1000));
+  TEST_ASSERT_FALSE(updater->end());
+  TEST_ASSERT_EQUAL(UPDATE_FAILED, updater->getState());
+  TEST_ASSERT_EQUAL_STRING("sha256 mismatch", updater->getError());
+  TEST_ASSERT_TRUE(partition->was_aborted);
+  TEST_ASSERT_FALSE(partition->is_boot_partition);
+  TEST_ASSERT_FALSE(partition->boot_state.is_pending);
+  TEST_ASSERT_TRUE(partition->hasState("\"error\":\"sha256 mismatch\""));
+}
+
+void test_invalid_image() {
+  std::vector<uint8_t> image = makeImage(5000);
+  partition->is_image_valid = false;
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+  writeImage(image, 1000);
+  TEST_ASSERT_FALSE(updater->end());
+  TEST_ASSERT_EQUAL_STRING("invalid image", updater->getError());
+  TEST_ASSERT_FALSE(partition->is_boot_partition);
+}
+
+void test_rejected_before_writing() {
+  TEST_ASSERT_FALSE(updater->begin(1000, "not a hash"));
+  TEST_ASSERT_EQUAL_STRING("expected sha256 as 64 hex digits", updater->getError());
+
+  std::vector<uint8_t> image = makeImage(100);
+  TEST_ASSERT_FALSE(updater->begin(partition->size + 1, hashImage(image).c_str()));
+  TEST_ASSERT_EQUAL_STRING("image larger than the partition", updater->getError());
+  TEST_ASSERT_TRUE(partition->write_lengths.empty());
+
+  // A failed update doesn't block the next one
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+  TEST_ASSERT_FALSE(updater->begin(image.size(), hashImage(image).c_str()));
+}
+
+void test_pull() {
+  partition->download = makeImage(10000);
+  partition->download_size = partition->download.size();
+  TEST_ASSERT_TRUE(updater->pull("http://host/firmware.bin", hashImage(partition->download).c_str()));
+  TEST_ASSERT_EQUAL(UPDATE_FINISHED, updater->getState());
+  TEST_ASSERT_EQUAL_STRING("http://host/firmware.bin", partition->download_url.c_str());
+  TEST_ASSERT_TRUE(partition->image == partition->download);
+}
+
+void test_pull_interrupted() {
+  std::vector<uint8_t> image = makeImage(10000);
+  partition->download = image;
+  partition->download.resize(6000);
+  partition->download_size = image.size();
+  TEST_ASSERT_TRUE(updater->pull("http://host/firmware.bin", hashImage(image).c_str()));
+  TEST_ASSERT_EQUAL(UPDATE_FAILED, updater->getState());
+  TEST_ASSERT_EQUAL_STRING("download interrupted", updater->getError());
+  TEST_ASSERT_TRUE(partition->was_aborted);
+}
+
+void test_boot_count_rollback() {
+  // Crashes before it is confirmed count as boots
+  for (uint8_t boot_count = 0; boot_count < OTA_MAX_BOOT_ATTEMPTS; boot_count++) {
+    boot({ true, boot_count, false });
+    TEST_ASSERT_EQUAL(boot_count + 1, partition->boot_state.boot_count);
+    TEST_ASSERT_EQUAL(0, partition->restart_count);
+    TEST_ASSERT_FALSE(partition->is_marked_valid);
+  }
+
+  boot({ true, OTA_MAX_BOOT_ATTEMPTS, false });
+  TEST_ASSERT_TRUE(partition->is_boot_partition);
+  TEST_ASSERT_EQUAL(1, partition->restart_count);
+  TEST_ASSERT_FALSE(partition->boot_state.is_pending);
+  TEST_ASSERT_TRUE(partition->boot_state.has_rolled_back);
+
+  // The previous image reports it once MQTT is up
+  boot(partition->boot_state);
+  TEST_ASSERT_FALSE(partition->boot_state.has_rolled_back);
+  TEST_ASSERT_TRUE(partition->is_marked_valid);
+  updater->loop(false);
+  TEST_ASSERT_FALSE(partition->hasState("rolled_back"));
+  updater->loop(true);
+  updater->loop(true);
+  TEST_ASSERT_EQUAL(1, partition->states.size());
+  TEST_ASSERT_TRUE(partition->hasState("rolled_back"));
+}
+
+void test_health_timeout_rollback() {
+  boot({ true, 0, false });
+  host_millis = OTA_HEALTH_TIMEOUT * 1000UL - 1;
+  updater->loop(false);
+  TEST_ASSERT_EQUAL(0, partition->restart_count);
+
+  host_millis = OTA_HEALTH_TIMEOUT * 1000UL + 1;
+  updater->loop(false);
+  TEST_ASSERT_TRUE(partition->is_boot_partition);
+  TEST_ASSERT_EQUAL(1, partition->restart_count);
+  TEST_ASSERT_FALSE(partition->boot_state.is_pending);
+  TEST_ASSERT_TRUE(partition->boot_state.has_rolled_back);
+}
+
+void test_without_previous_image_keeps_running() {
+  partition->has_other_image = false;
+  boot({ true, 0, false });
+  host_millis = OTA_HEALTH_TIMEOUT * 1000UL + 1;
+  updater->loop(false);
+  updater->loop(false);
+  TEST_ASSERT_EQUAL(0, partition->restart_count);
+  TEST_ASSERT_FALSE(partition->boot_state.is_pending);
+  TEST_ASSERT_FALSE(partition->boot_state.has_rolled_back);
+}
+
+void test_healthy_image_is_confirmed() {
+  boot({ true, 1, false });
+  std::vector<uint8_t> image = makeImage(100);
+  TEST_ASSERT_FALSE(updater->begin(image.size(), hashImage(image).c_str()));
+  TEST_ASSERT_EQUAL_STRING("running image not confirmed yet", updater->getError());
+
+  updater->loop(true);
+  TEST_ASSERT_TRUE(partition->is_marked_valid);
+  TEST_ASSERT_FALSE(partition->boot_state.is_pending);
+  TEST_ASSERT_EQUAL(0, partition->boot_state.boot_count);
+  TEST_ASSERT_TRUE(partition->hasState("confirmed"));
+
+  // No rollback after the timeout anymore, and updates are taken again
+  host_millis = OTA_HEALTH_TIMEOUT * 1000UL + 1;
+  updater->loop(false);
+  TEST_ASSERT_EQUAL(0, partition->restart_count);
+  TEST_ASSERT_TRUE(updater->begin(image.size(), hashImage(image).c_str()));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_sha256_of_known_input);
+  RUN_TEST(test_image_is_written_in_sector_chunks);
+  RUN_TEST(test_pieces_larger_than_a_chunk);
+  RUN_TEST(test_restarts_after_the_report);
+  RUN_TEST(test_unknown_size);
+  RUN_TEST(test_image_larger_than_announced);
+  RUN_TEST(test_incomplete_image);
+  RUN_TEST(test_sha256_mismatch);
+  RUN_TEST(test_invalid_image);
+  RUN_TEST(test_rejected_before_writing);
+  RUN_TEST(test_pull);
+  RUN_TEST(test_pull_interrupted);
+  RUN_TEST(test_boot_count_rollback);
+  RUN_TEST(test_health_timeout_rollback);
+  RUN_TEST(test_without_previous_image_keeps_running);
+  RUN_TEST(test_healthy_image_is_confirmed);
+  return UNITY_END();
+}
@@ -0,0 +1,274 @@
+// DDP and E1.31 decoding against a fake LED output: frame bounds, sequence
+// numbers (wrap, late and lost packets) and the E1.31 options
+
+// MARK: Includes
+
+#include <unity.h>
+#include <vector>
+#include <string>
+#include "RealtimeDecoder.h"
+
+// MARK: Fake Output
+
+class FakeLEDs : public RealtimeOutput {
+
+  public:
+
+    boolean is_active = false;
+    uint8_t end_count = 0;
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<std::vector<uint8_t>> replies;
+
+    void showFrame(const uint8_t* rgb) override {
+      frames.push_back(std::vector<uint8_t>(rgb, rgb + 3 * LED_COUNT));
+      is_active = true;
+    }
+
+    void endRealtime() override {
+      end_count++;
+      is_active = false;
+    }
+
+    boolean isRealtimeActive() override { return is_active; }
+
+    void reply(const uint8_t* data, size_t length) override {
+      replies.push_back(std::vector<uint8_t>(data, data + length));
+    }
+
+};
+
+// MARK: Constants
+
+const size_t FRAME_SIZE = 3 * LED_COUNT;
+const uint8_t DDP_PUSH = 0x41; // Version 1, push
+const uint8_t DDP_QUERY = 0x42; // Version 1, query
+const uint8_t E131_PREVIEW = 0x80;
+const uint8_t E131_TERMINATED = 0x40;
+
+// MARK: Helpers
+
+FakeLEDs* leds;
+RealtimeDecoder* decoder;
+
+// data_length defaults to the data actually sent
+std::vector<uint8_t> makeDDP(uint8_t flags, uint8_t sequence, uint32_t offset, const std::vector<uint8_t>& data, int data_length = -1) {
+  uint16_t length = (data_length < 0) ? data.size() : data_length;
+  std::vector<uint8_t> packet = {
+    flags, sequence, 0x0B, 1, // RGB, 8 bit, output 1
+    (uint8_t)(offset >> 24), (uint8_t)(offset >> 16), (uint8_t)(offset >> 8), (uint8_t)offset,
+    (uint8_t)(length >> 8), (uint8_t)length
+  };
+  packet.insert(packet.end(), data.begin(), data.end());
+  return packet;
+}
+
+void sendDDP(uint8_t sequence, uint32_t offset, const std::vector<uint8_t>& data, int data_length = -1) {
+  std::vector<uint8_t> packet = makeDDP(DDP_PUSH, sequence, offset, data, data_length);
+  decoder->handleDDP(packet.data(), packet.size());
+}
+
+std::vector<uint8_t> makeE131(uint8_t sequence, uint8_t options, const std::vector<uint8_t>& slots, uint8_t start_code = 0) {
+  std::vector<uint8_t> packet(126, 0);
+  memcpy(packet.data() + 4, "ASC-E1.17", 10);
+  packet[21] = 0x04; // Root vector: data
+  packet[43] = 0x02; // Framing vector: data packet
+  packet[111] = sequence;
+  packet[112] = options;
+  packet[113] = REALTIME_E131_UNIVERSE >> 8;
+  packet[114] = REALTIME_E131_UNIVERSE & 0xFF;
+  packet[117] = 0x02; // DMP set property
+  uint16_t value_count = slots.size() + 1;
+  packet[123] = value_count >> 8;
+  packet[124] = value_count & 0xFF;
+  packet[125] = start_code;
+  packet.insert(packet.end(), slots.begin(), slots.end());
+  return packet;
+}
+
+void sendE131(uint8_t sequence, uint8_t options, const std::vector<uint8_t>& slots, uint8_t start_code = 0) {
+  std::vector<uint8_t> packet = makeE131(sequence, options, slots, start_code);
+  decoder->handleE131(packet.data(), packet.size());
+}
+
+std::vector<uint8_t> makeFrame(uint8_t value) {
+  return std::vector<uint8_t>(FRAME_SIZE, value);
+}
+
+void setUp() {
+  host_millis = 1000;
+  leds = new FakeLEDs();
+  decoder = new RealtimeDecoder(leds);
+}
+
+void tearDown() {
+  delete decoder;
+  delete leds;
+}
+
+// MARK: DDP
+
+void test_ddp_frame_is_shown_on_push() {
+  std::vector<uint8_t> packet = makeDDP(0x40, 1, 0, makeFrame(7));
+  decoder->handleDDP(packet.data(), packet.size());
+  TEST_ASSERT_EQUAL(0, leds->frames.size());
+
+  sendDDP(2, 0, {});
+  TEST_ASSERT_EQUAL(1, leds->frames.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(makeFrame(7).data(), leds->frames[0].data(), FRAME_SIZE);
+  TEST_ASSERT_EQUAL(1, decoder->getFrameCount());
+}
+
+void test_ddp_data_past_the_frame_is_clipped() {
+  sendDDP(1, FRAME_SIZE - 2, { 1, 2, 3, 4, 5 });
+  TEST_ASSERT_EQUAL(1, leds->frames.size());
+  TEST_ASSERT_EQUAL(0, leds->frames[0][FRAME_SIZE - 3]);
+  TEST_ASSERT_EQUAL(1, leds->frames[0][FRAME_SIZE - 2]);
+  TEST_ASSERT_EQUAL(2, leds->frames[0][FRAME_SIZE - 1]);
+}
+
+void test_ddp_offset_past_the_frame_is_ignored() {
+  sendDDP(1, 0, makeFrame(9));
+  sendDDP(2, FRAME_SIZE, { 1, 2, 3 });
+  sendDDP(3, 0xFFFFFFFF, { 1, 2, 3 });
+  TEST_ASSERT_EQUAL(3, leds->frames.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(makeFrame(9).data(), leds->frames[2].data(), FRAME_SIZE);
+}
+
+// A data length beyond the packet is a truncated packet
+void test_ddp_length_past_the_packet_is_dropped() {
+  sendDDP(1, 0, { 1, 2, 3 }, 4);
+  TEST_ASSERT_EQUAL(0, leds->frames.size());
+
+  std::vector<uint8_t> packet = makeDDP(DDP_PUSH, 1, 0, {});
+  decoder->handleDDP(packet.data(), 9);
+  TEST_ASSERT_EQUAL(0, leds->frames.size());
+}
+
+// 1 to 15, then 1 again
+void test_ddp_sequence_wraps() {
+  for (uint8_t i = 0; i < 40; i++) {
+    sendDDP((i % 15) + 1, 0, makeFrame(i));
+  }
+  TEST_ASSERT_EQUAL(40, leds->frames.size());
+  TEST_ASSERT_EQUAL(0, decoder->getLostPacketCount());
+  TEST_ASSERT_EQUAL(0, decoder->getLatePacketCount());
+}
+
+void test_ddp_late_and_lost_packets() {
+  sendDDP(14, 0, makeFrame(1));
+  sendDDP(3, 0, makeFrame(2)); // 15, 1 and 2 lost across the wrap
+  TEST_ASSERT_EQUAL(3, decoder->getLostPacketCount());
+
+  sendDDP(1, 0, makeFrame(3)); // Behind 3, late
+  sendDDP(3, 0, makeFrame(4)); // Duplicate, late
+  TEST_ASSERT_EQUAL(2, decoder->getLatePacketCount());
+  TEST_ASSERT_EQUAL(2, leds->frames.size());
+
+  // Sequence 0 is not counted
+  sendDDP(0, 0, makeFrame(5));
+  TEST_ASSERT_EQUAL(3, leds->frames.size());
+  TEST_ASSERT_EQUAL(3, decoder->getLostPacketCount());
+}
+
+// Once the stream timed out, any sequence number starts a new one
+void test_ddp_sequence_restarts_after_timeout() {
+  sendDDP(9, 0, makeFrame(1));
+  leds->is_active = false;
+  sendDDP(2, 0, makeFrame(2));
+  TEST_ASSERT_EQUAL(2, leds->frames.size());
+  TEST_ASSERT_EQUAL(0, decoder->getLatePacketCount());
+}
+
+void test_ddp_status_query_is_answered() {
+  sendDDP(1, 0, makeFrame(1));
+  std::vector<uint8_t> packet = makeDDP(DDP_QUERY, 5, 0, {});
+  packet[3] = 251;
+  decoder->handleDDP(packet.data(), packet.size());
+
+  TEST_ASSERT_EQUAL(1, leds->replies.size());
+  const std::vector<uint8_t>& reply = leds->replies[0];
+  TEST_ASSERT_EQUAL_HEX8(0x45, reply[0]); // Version 1, reply, push
+  TEST_ASSERT_EQUAL(5, reply[1]);
+  TEST_ASSERT_EQUAL(251, reply[3]);
+  TEST_ASSERT_EQUAL(reply.size() - 10, (reply[8] << 8) | reply[9]);
+  std::string status(reply.begin() + 10, reply.end());
+  TEST_ASSERT_TRUE(status.find("\"frames\":1,") != std::string::npos);
+  TEST_ASSERT_TRUE(status.find("\"active\":true") != std::string::npos);
+}
+
+// MARK: E1.31
+
+void test_e131_slots_are_shown() {
+  std::vector<uint8_t> slots(REALTIME_E131_START_ADDRESS - 1, 0xEE);
+  std::vector<uint8_t> frame = makeFrame(4);
+  slots.insert(slots.end(), frame.begin(), frame.end());
+  sendE131(1, 0, slots);
+  TEST_ASSERT_EQUAL(1, leds->frames.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(frame.data(), leds->frames[0].data(), FRAME_SIZE);
+}
+
+void test_e131_other_start_codes_are_ignored() {
+  sendE131(1, 0, makeFrame(4), 0xDD); // Per-address priority
+  sendE131(2, 0, makeFrame(4), 0xCC); // RDM
+  TEST_ASSERT_EQUAL(0, leds->frames.size());
+}
+
+void test_e131_preview_is_ignored() {
+  sendE131(1, E131_PREVIEW, makeFrame(4));
+  TEST_ASSERT_EQUAL(0, leds->frames.size());
+}
+
+void test_e131_terminate_ends_the_stream() {
+  sendE131(200, 0, makeFrame(4));
+  sendE131(201, E131_TERMINATED, makeFrame(4));
+  TEST_ASSERT_EQUAL(1, leds->end_count);
+  TEST_ASSERT_EQUAL(1, leds->frames.size());
+
+  // A new stream may start anywhere
+  sendE131(1, 0, makeFrame(5));
+  TEST_ASSERT_EQUAL(2, leds->frames.size());
+  TEST_ASSERT_EQUAL(0, decoder->getLatePacketCount());
+  TEST_ASSERT_EQUAL(0, decoder->getLostPacketCount());
+}
+
+void test_e131_late_and_lost_packets() {
+  sendE131(254, 0, makeFrame(1));
+  sendE131(255, 0, makeFrame(2));
+  sendE131(2, 0, makeFrame(3)); // 0 and 1 lost across the wrap
+  TEST_ASSERT_EQUAL(2, decoder->getLostPacketCount());
+
+  sendE131(1, 0, makeFrame(4)); // Late
+  TEST_ASSERT_EQUAL(1, decoder->getLatePacketCount());
+  TEST_ASSERT_EQUAL(3, leds->frames.size());
+
+  // Far behind: the source restarted
+  sendE131(100, 0, makeFrame(5));
+  TEST_ASSERT_EQUAL(4, leds->frames.size());
+  TEST_ASSERT_EQUAL(1, decoder->getLatePacketCount());
+}
+
+void test_e131_other_universes_are_ignored() {
+  std::vector<uint8_t> packet = makeE131(1, 0, makeFrame(4));
+  packet[114] ^= 0x01;
+  decoder->handleE131(packet.data(), packet.size());
+  TEST_ASSERT_EQUAL(0, leds->frames.size());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ddp_frame_is_shown_on_push);
+  RUN_TEST(test_ddp_data_past_the_frame_is_clipped);
+  RUN_TEST(test_ddp_offset_past_the_frame_is_ignored);
+  RUN_TEST(test_ddp_length_past_the_packet_is_dropped);
+  RUN_TEST(test_ddp_sequence_wraps);
+  RUN_TEST(test_ddp_late_and_lost_packets);
+  RUN_TEST(test_ddp_sequence_restarts_after_timeout);
+  RUN_TEST(test_ddp_status_query_is_answered);
+  RUN_TEST(test_e131_slots_are_shown);
+  RUN_TEST(test_e131_other_start_codes_are_ignored);
+  RUN_TEST(test_e131_preview_is_ignored);
+  RUN_TEST(test_e131_terminate_ends_the_stream);
+  RUN_TEST(test_e131_late_and_lost_packets);
+  RUN_TEST(test_e131_other_universes_are_ignored);
+  return UNITY_END();
+}
@@ -0,0 +1,118 @@
+
+// Touch gestures from sampled pad states, at the rate the control loop reads the pads
+
+// MARK: Includes
+
+#include <unity.h>
+#include "TouchGestureRecognizer.h"
+
+// MARK: Constants
+
+const unsigned long SAMPLE_INTERVAL = 100; // ms
+
+// MARK: Helpers
+
+TouchGestureRecognizer recognizer;
+unsigned long now;
+
+// Feeds the same pad state for duration ms
+void hold(boolean left, boolean right, unsigned long duration) {
+  for (unsigned long end = now + duration; now < end; now += SAMPLE_INTERVAL) {
+    recognizer.update(left, right, now);
+  }
+}
+
+// Lets every pending tap resolve
+void idle() {
+  hold(false, false, 1000);
+}
+
+void setUp() {
+  recognizer = TouchGestureRecognizer();
+  now = 10000;
+}
+
+void tearDown() {
+}
+
+// MARK: Tests
+
+void test_tap() {
+  hold(true, false, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_LEFT_TAP, recognizer.nextGesture());
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+}
+
+void test_double_tap() {
+  hold(false, true, 100);
+  hold(false, false, 100);
+  hold(false, true, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_RIGHT_DOUBLE_TAP, recognizer.nextGesture());
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+}
+
+void test_long_press() {
+  hold(true, false, 1000);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_LEFT_LONG_PRESS, recognizer.nextGesture());
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+}
+
+void test_swipe_right() {
+  hold(true, false, 100);
+  hold(true, true, 100);
+  hold(false, true, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_SWIPE_RIGHT, recognizer.nextGesture());
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+}
+
+void test_swipe_left_after_release() {
+  hold(false, true, 100);
+  hold(false, false, 100);
+  hold(true, false, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_SWIPE_LEFT, recognizer.nextGesture());
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+}
+
+// Both pads first seen in the same sample: no direction, and not two taps
+void test_simultaneous_press_is_dropped() {
+  hold(true, true, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+
+  hold(true, true, 100);
+  hold(true, false, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_NONE, recognizer.nextGesture());
+
+  // The next touch is a normal tap again
+  hold(false, true, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_RIGHT_TAP, recognizer.nextGesture());
+}
+
+void test_simultaneous_press_with_swipes_disabled() {
+  TouchGestureTimings timings = recognizer.getTimings();
+  timings.swipe = 0;
+  recognizer.setTimings(timings);
+  hold(true, true, 100);
+  idle();
+  TEST_ASSERT_EQUAL(GESTURE_LEFT_TAP, recognizer.nextGesture());
+  TEST_ASSERT_EQUAL(GESTURE_RIGHT_TAP, recognizer.nextGesture());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_tap);
+  RUN_TEST(test_double_tap);
+  RUN_TEST(test_long_press);
+  RUN_TEST(test_swipe_right);
+  RUN_TEST(test_swipe_left_after_release);
+  RUN_TEST(test_simultaneous_press_is_dropped);
+  RUN_TEST(test_simultaneous_press_with_swipes_disabled);
+  return UNITY_END();
+}